@@ -0,0 +1,212 @@
+/*
+  Host benchmark: CPU time of one log call on the calling task.
+
+  "print chain" is the former MqttLogger path: Print::print() per fragment and a
+  virtual write() per byte into the line buffer. Sending is left out, so this is
+  the lower bound of what the caller paid. "print chain, ring" is the same chain
+  into the current MqttLogger::write(), one ring record per fragment. "event" is
+  logEvent(): encoding the typed arguments and pushing the record into the ring.
+  Formatting the event to text happens on the logger task and is measured
+  separately. Each case runs several rounds, the median is printed.
+
+  g++ -std=c++11 -O2 -I../src log_benchmark.cpp ../src/LogRecord.cpp -o log_benchmark && ./log_benchmark
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include "LogRecord.h"
+#include "LogRingBuffer.h"
+
+static const int iterations = 1000000;
+
+// the parts of Arduino's Print used by the log calls
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+        {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+    size_t print(const char* str)
+    {
+        return write((const uint8_t*)str, strlen(str));
+    }
+    size_t print(long number)
+    {
+        char buf[8 * sizeof(long) + 1];
+        char *str = &buf[sizeof(buf) - 1];
+        bool negative = number < 0;
+        unsigned long n = negative ? -number : number;
+        *str = '\0';
+        do
+        {
+            *--str = '0' + n % 10;
+            n /= 10;
+        }
+        while (n);
+        if (negative)
+        {
+            *--str = '-';
+        }
+        return print(str);
+    }
+    size_t print(int number)
+    {
+        return print((long)number);
+    }
+    size_t println(const char* str)
+    {
+        size_t n = print(str);
+        return n + print("\r\n");
+    }
+    size_t println(int number)
+    {
+        size_t n = print(number);
+        return n + print("\r\n");
+    }
+};
+
+// line buffering of the former MqttLogger::write(uint8_t), without sending
+class LineLogger : public Print
+{
+public:
+    uint8_t buffer[1024];
+    uint16_t bufferCnt = 0;
+    uint32_t lines = 0;
+
+    size_t write(uint8_t character) override
+    {
+        if (character == '\n' || bufferCnt == sizeof(buffer))
+        {
+            lines++;
+            bufferCnt = 0;
+        }
+        if (character != '\n')
+        {
+            buffer[bufferCnt++] = character;
+        }
+        return 1;
+    }
+
+    using Print::write;
+};
+
+// MqttLogger::write(const uint8_t*, size_t) without the task notification
+class RingLogger : public Print
+{
+public:
+    LogRingBuffer ring {8192};
+    uint8_t drained[256];
+    bool isEvent;
+
+    size_t write(uint8_t character) override
+    {
+        return write(&character, 1);
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        if (!ring.push(buffer, size))
+        {
+            // the logger task would have emptied the ring long ago
+            while (ring.pop(drained, sizeof(drained), isEvent) > 0) {}
+            ring.push(buffer, size);
+        }
+        return size;
+    }
+};
+
+static const int rounds = 7;
+
+template<typename F>
+static double measure(F func)
+{
+    double results[rounds];
+    for (int r = 0; r < rounds; r++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            func(i);
+        }
+        auto end = std::chrono::steady_clock::now();
+        results[r] = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+    std::sort(results, results + rounds);
+    return results[rounds / 2];
+}
+
+int main()
+{
+    const char* reference = "Lock";
+    const int retryDelay = 1000;
+    const int nrOfRetries = 3;
+    const char* format = "%s: Last command failed, retrying after %d milliseconds. Retry %d of %d";
+
+    LineLogger logger;
+    Print* Log = &logger;
+    double printChain = measure([&](int i)
+    {
+        Log->print(reference);
+        Log->print(": Last command failed, retrying after ");
+        Log->print(retryDelay);
+        Log->print(" milliseconds. Retry ");
+        Log->print(i & 3);
+        Log->print(" of ");
+        Log->println(nrOfRetries);
+    });
+
+    RingLogger ringLogger;
+    Log = &ringLogger;
+    double printChainRing = measure([&](int i)
+    {
+        Log->print(reference);
+        Log->print(": Last command failed, retrying after ");
+        Log->print(retryDelay);
+        Log->print(" milliseconds. Retry ");
+        Log->print(i & 3);
+        Log->print(" of ");
+        Log->println(nrOfRetries);
+    });
+
+    LogRingBuffer ring(8192);
+    uint8_t drained[256];
+    bool isEvent;
+    double event = measure([&](int i)
+    {
+        uint8_t record[256];
+        LogRecordWriter writer(record, sizeof(record), 1);
+        writer.add(reference, retryDelay, i & 3, nrOfRetries);
+        if (!ring.push(record, writer.length(), true))
+        {
+            // the logger task would have emptied the ring long ago
+            while (ring.pop(drained, sizeof(drained), isEvent) > 0) {}
+            ring.push(record, writer.length(), true);
+        }
+    });
+
+    uint8_t record[256];
+    LogRecordWriter writer(record, sizeof(record), 1);
+    writer.add(reference, retryDelay, 1, nrOfRetries);
+    char text[256];
+    double formatting = measure([&](int)
+    {
+        logRecordFormat(format, record, writer.length(), text, sizeof(text));
+    });
+
+    printf("%s\n", text);
+    printf("print chain:          %7.1f ns per call (%u lines)\n", printChain, logger.lines);
+    printf("print chain, ring:    %7.1f ns per call\n", printChainRing);
+    printf("event:                %7.1f ns per call, %u bytes\n", event, writer.length());
+    printf("deferred formatting:  %7.1f ns per event on the logger task\n", formatting);
+    return 0;
+}
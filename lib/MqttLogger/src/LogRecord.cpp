@@ -0,0 +1,134 @@
+#include "LogRecord.h"
+#include <stdio.h>
+
+uint16_t logRecordFormatId(const uint8_t* record)
+{
+    return record[0] | (record[1] << 8);
+}
+
+static bool isFloatConversion(char conversion)
+{
+    return strchr("fFeEgGaA", conversion) != nullptr;
+}
+
+size_t logRecordFormat(const char* format, const uint8_t* record, size_t recordLength, char* out, size_t outLength)
+{
+    if (outLength == 0)
+    {
+        return 0;
+    }
+
+    const uint8_t* arg = record + 2;
+    const uint8_t* end = record + recordLength;
+    size_t pos = 0;
+
+    while (*format != 0 && pos + 1 < outLength)
+    {
+        if (*format != '%')
+        {
+            out[pos++] = *format++;
+            continue;
+        }
+        if (format[1] == '%')
+        {
+            out[pos++] = '%';
+            format += 2;
+            continue;
+        }
+
+        // rebuild the conversion with the length modifier of the stored type
+        char spec[16];
+        size_t specLength = 0;
+        spec[specLength++] = *format++;
+        while (*format != 0 && strchr("-+ #0123456789.", *format) != nullptr && specLength < sizeof(spec) - 4)
+        {
+            spec[specLength++] = *format++;
+        }
+        while (*format != 0 && strchr("hlLqjzt", *format) != nullptr)
+        {
+            format++;
+        }
+        char conversion = *format != 0 ? *format++ : 's';
+
+        if (arg >= end)
+        {
+            out[pos++] = '?';
+            continue;
+        }
+
+        uint8_t tag = *arg++;
+        size_t room = outLength - pos;
+        int written = 0;
+
+        switch (tag)
+        {
+            case 'i':
+            case 'u':
+            {
+                uint32_t value;
+                memcpy(&value, arg, sizeof(value));
+                arg += sizeof(value);
+                if (isFloatConversion(conversion) || conversion == 's')
+                {
+                    conversion = tag == 'i' ? 'd' : 'u';
+                }
+                spec[specLength] = conversion;
+                spec[specLength + 1] = 0;
+                written = tag == 'i' ? snprintf(out + pos, room, spec, (int)value) : snprintf(out + pos, room, spec, (unsigned int)value);
+                break;
+            }
+            case 'q':
+            case 'Q':
+            {
+                uint64_t value;
+                memcpy(&value, arg, sizeof(value));
+                arg += sizeof(value);
+                if (isFloatConversion(conversion) || conversion == 's' || conversion == 'c')
+                {
+                    conversion = tag == 'q' ? 'd' : 'u';
+                }
+                spec[specLength] = 'l';
+                spec[specLength + 1] = 'l';
+                spec[specLength + 2] = conversion;
+                spec[specLength + 3] = 0;
+                written = tag == 'q' ? snprintf(out + pos, room, spec, (long long)value) : snprintf(out + pos, room, spec, (unsigned long long)value);
+                break;
+            }
+            case 'd':
+            {
+                double value;
+                memcpy(&value, arg, sizeof(value));
+                arg += sizeof(value);
+                spec[specLength] = isFloatConversion(conversion) ? conversion : 'g';
+                spec[specLength + 1] = 0;
+                written = snprintf(out + pos, room, spec, value);
+                break;
+            }
+            case 's':
+            {
+                char value[256];
+                uint8_t length = *arg++;
+                memcpy(value, arg, length);
+                value[length] = 0;
+                arg += length;
+                spec[specLength] = 's';
+                spec[specLength + 1] = 0;
+                written = snprintf(out + pos, room, spec, value);
+                break;
+            }
+            default:
+                // unknown tag, the remaining arguments can't be decoded
+                arg = end;
+                out[pos++] = '?';
+                break;
+        }
+
+        if (written > 0)
+        {
+            pos += (size_t)written < room ? written : room - 1;
+        }
+    }
+
+    out[pos] = 0;
+    return pos;
+}
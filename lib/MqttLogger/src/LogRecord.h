@@ -0,0 +1,144 @@
+#ifndef LogRecord_h
+#define LogRecord_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#if defined(ARDUINO)
+#include <WString.h>
+#endif
+
+// Binary log event: a little endian uint16 format id followed by the arguments,
+// each one a type tag and its value. Strings are stored with a one byte length.
+//   'i' int32, 'u' uint32, 'q' int64, 'Q' uint64, 'd' double, 's' string
+// Text is only produced by logRecordFormat() when a sink consumes the event.
+class LogRecordWriter
+{
+private:
+    uint8_t* buffer;
+    uint16_t size;
+    uint16_t cnt = 0;
+
+    void append(uint8_t tag, const void* value, uint16_t length)
+    {
+        if (this->cnt + 1 + length > this->size)
+        {
+            this->cnt = this->size; // drop the remaining arguments
+            return;
+        }
+        this->buffer[this->cnt++] = tag;
+        memcpy(this->buffer + this->cnt, value, length);
+        this->cnt += length;
+    }
+
+public:
+    LogRecordWriter(uint8_t* buffer, uint16_t size, uint16_t formatId)
+        : buffer(buffer), size(size)
+    {
+        this->buffer[this->cnt++] = formatId & 0xFF;
+        this->buffer[this->cnt++] = formatId >> 8;
+    }
+
+    uint16_t length() const
+    {
+        return this->cnt;
+    }
+
+    void add() {}
+
+    template<typename T, typename... Args>
+    void add(const T& value, const Args&... args)
+    {
+        this->addValue(value);
+        this->add(args...);
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) <= 4>::type addValue(T value)
+    {
+        int32_t v = value;
+        this->append('i', &v, sizeof(v));
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value && sizeof(T) <= 4>::type addValue(T value)
+    {
+        uint32_t v = value;
+        this->append('u', &v, sizeof(v));
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 8>::type addValue(T value)
+    {
+        int64_t v = value;
+        this->append('q', &v, sizeof(v));
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value && sizeof(T) == 8>::type addValue(T value)
+    {
+        uint64_t v = value;
+        this->append('Q', &v, sizeof(v));
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type addValue(T value)
+    {
+        double v = value;
+        this->append('d', &v, sizeof(v));
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_enum<T>::value>::type addValue(T value)
+    {
+        this->addValue(static_cast<typename std::underlying_type<T>::type>(value));
+    }
+
+    void addValue(const char* value)
+    {
+        if (value == nullptr)
+        {
+            value = "(null)";
+        }
+        if (this->cnt + 2 > this->size)
+        {
+            this->cnt = this->size;
+            return;
+        }
+        size_t length = strlen(value);
+        size_t available = this->size - this->cnt - 2;
+        if (length > available)
+        {
+            length = available;
+        }
+        if (length > 255)
+        {
+            length = 255;
+        }
+        this->buffer[this->cnt++] = 's';
+        this->buffer[this->cnt++] = length;
+        memcpy(this->buffer + this->cnt, value, length);
+        this->cnt += length;
+    }
+
+    void addValue(char* value)
+    {
+        this->addValue((const char*)value);
+    }
+
+#if defined(ARDUINO)
+    void addValue(const String& value)
+    {
+        this->addValue(value.c_str());
+    }
+#endif
+};
+
+uint16_t logRecordFormatId(const uint8_t* record);
+
+// Formats the arguments of record into out, always null terminated. Returns the text length.
+// Length modifiers in the format string are ignored, the argument type decides.
+size_t logRecordFormat(const char* format, const uint8_t* record, size_t recordLength, char* out, size_t outLength);
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef LogRingBuffer_h
+#define LogRingBuffer_h
+
+#include <atomic>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Lock-free byte ring for many producers and a single consumer.
+// Producers reserve a record with a CAS on the reserve index, copy their bytes and
+// publish the record by setting the ready bit in its 4 byte header, next to a flag
+// that tells binary events from text. The consumer only takes records in order, so a
+// producer preempted before publishing holds back later records but never blocks
+// other producers.
+class LogRingBuffer
+{
+private:
+    static const uint32_t READY = 0x80000000;
+    static const uint32_t EVENT = 0x40000000;
+    static const uint32_t LENGTH = 0x3FFFFFFF;
+
+    uint32_t* words = nullptr;
+    uint32_t size = 0;
+    std::atomic<uint32_t> reserveIndex {0};
+    std::atomic<uint32_t> tailIndex {0};
+
+    uint8_t* bytes() const
+    {
+        return (uint8_t*)this->words;
+    }
+
+    void copyIn(uint32_t index, const uint8_t* data, uint32_t length)
+    {
+        uint32_t pos = index & (this->size - 1);
+        uint32_t first = length < this->size - pos ? length : this->size - pos;
+        memcpy(this->bytes() + pos, data, first);
+        memcpy(this->bytes(), data + first, length - first);
+    }
+
+    void copyOut(uint32_t index, uint8_t* data, uint32_t length) const
+    {
+        uint32_t pos = index & (this->size - 1);
+        uint32_t first = length < this->size - pos ? length : this->size - pos;
+        memcpy(data, this->bytes() + pos, first);
+        memcpy(data + first, this->bytes(), length - first);
+    }
+
+    void clear(uint32_t index, uint32_t length)
+    {
+        uint32_t pos = index & (this->size - 1);
+        uint32_t first = length < this->size - pos ? length : this->size - pos;
+        memset(this->bytes() + pos, 0, first);
+        memset(this->bytes(), 0, length - first);
+    }
+
+    static uint32_t recordSize(uint32_t length)
+    {
+        return (sizeof(uint32_t) + length + 3) & ~3u;
+    }
+
+public:
+    // size must be a power of two
+    explicit LogRingBuffer(uint32_t size)
+    {
+        this->words = (uint32_t*)calloc(size / sizeof(uint32_t), sizeof(uint32_t));
+        this->size = this->words != nullptr ? size : 0;
+    }
+
+    ~LogRingBuffer()
+    {
+        free(this->words);
+    }
+
+    bool push(const uint8_t* data, uint32_t length, bool event = false)
+    {
+        uint32_t record = recordSize(length);
+        uint32_t start = this->reserveIndex.load(std::memory_order_relaxed);
+
+        do
+        {
+            if (start + record - this->tailIndex.load(std::memory_order_acquire) > this->size)
+            {
+                return false;
+            }
+        }
+        while (!this->reserveIndex.compare_exchange_weak(start, start + record, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+        this->copyIn(start + sizeof(uint32_t), data, length);
+        __atomic_store_n(&this->words[(start & (this->size - 1)) / sizeof(uint32_t)], length | READY | (event ? EVENT : 0), __ATOMIC_RELEASE);
+        return true;
+    }
+
+    // copies the oldest record into out, returns its length or 0 when there is none
+    // out has to hold the largest record pushed
+    uint32_t pop(uint8_t* out, uint32_t maxLength, bool& event)
+    {
+        if (this->size == 0)
+        {
+            return 0;
+        }
+
+        uint32_t tail = this->tailIndex.load(std::memory_order_relaxed);
+        uint32_t header = __atomic_load_n(&this->words[(tail & (this->size - 1)) / sizeof(uint32_t)], __ATOMIC_ACQUIRE);
+        if ((header & READY) == 0)
+        {
+            return 0;
+        }
+
+        uint32_t length = header & LENGTH;
+        event = (header & EVENT) != 0;
+        this->copyOut(tail + sizeof(uint32_t), out, length < maxLength ? length : maxLength);
+
+        // headers of later records may land anywhere in this record, so it has to be zeroed
+        uint32_t record = recordSize(length);
+        this->clear(tail, record);
+        this->tailIndex.store(tail + record, std::memory_order_release);
+
+        return length < maxLength ? length : maxLength;
+    }
+
+    uint32_t used() const
+    {
+        return this->reserveIndex.load(std::memory_order_relaxed) - this->tailIndex.load(std::memory_order_relaxed);
+    }
+
+    uint32_t capacity() const
+    {
+        return this->size;
+    }
+};
+
+#endif
@@ -2,26 +2,88 @@
 #include "Arduino.h"
 
 MqttLogger::MqttLogger(MqttLoggerMode mode)
+    : ring(MQTT_LOGGER_RING_SIZE)
 {
     this->setMode(mode);
     this->setBufferSize(MQTT_MAX_PACKET_SIZE);
+    this->startTask();
 }
 
 MqttLogger::MqttLogger(MqttClient& client, const char* topic, MqttLoggerMode mode)
+    : ring(MQTT_LOGGER_RING_SIZE)
 {
     this->setClient(client);
     this->setTopic(topic);
     this->setMode(mode);
     this->setBufferSize(MQTT_MAX_PACKET_SIZE);
+    this->startTask();
 }
 
 MqttLogger::~MqttLogger()
 {
+    if (this->taskHandle != nullptr)
+    {
+        vTaskDelete(this->taskHandle);
+    }
+    if (this->clientMutex != nullptr)
+    {
+        vSemaphoreDelete(this->clientMutex);
+    }
+    free(this->buffer);
+    free(this->line);
+    free(this->drainBuffer);
+    free(this->binaryBuffer);
+}
+
+void MqttLogger::startTask()
+{
+    if (this->clientMutex == nullptr)
+    {
+        this->clientMutex = xSemaphoreCreateMutex();
+    }
+    if (this->drainBuffer == nullptr)
+    {
+        this->drainBuffer = (uint8_t *)malloc(MQTT_LOGGER_MAX_RECORD);
+    }
+    xTaskCreatePinnedToCore(&MqttLogger::taskEntry, "mqttlog", MQTT_LOGGER_TASK_SIZE, this, MQTT_LOGGER_TASK_PRIORITY, &this->taskHandle, tskNO_AFFINITY);
+}
+
+void MqttLogger::taskEntry(void* param)
+{
+    MqttLogger* logger = static_cast<MqttLogger*>(param);
+
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(MQTT_LOGGER_DRAIN_INTERVAL));
+        logger->drain();
+    }
 }
 
 void MqttLogger::setClient(MqttClient& client)
 {
+    if (this->clientMutex != nullptr)
+    {
+        xSemaphoreTake(this->clientMutex, portMAX_DELAY);
+    }
     this->client = &client;
+    if (this->clientMutex != nullptr)
+    {
+        xSemaphoreGive(this->clientMutex);
+    }
+}
+
+// waits for a publish in progress, call before the client is deleted
+void MqttLogger::clearClient()
+{
+    if (this->clientMutex != nullptr)
+    {
+        xSemaphoreTake(this->clientMutex, portMAX_DELAY);
+    }
+    this->client = nullptr;
+    if (this->clientMutex != nullptr)
+    {
+        xSemaphoreGive(this->clientMutex);
+    }
 }
 
 void MqttLogger::setTopic(const char* topic)
@@ -34,12 +96,34 @@ void MqttLogger::setMode(MqttLoggerMode mode)
     this->mode = mode;
 }
 
+// formats[id] is the printf style format of event id
+void MqttLogger::setEventFormats(const char* const* formats, uint16_t count)
+{
+    this->eventFormats = formats;
+    this->eventFormatCount = count;
+}
+
+// call before events are written, the buffer is only allocated here
+void MqttLogger::setBinaryTopic(const char* topic)
+{
+    if (topic != nullptr && this->binaryBuffer == nullptr)
+    {
+        this->binaryBuffer = (uint8_t *)malloc(MQTT_MAX_PACKET_SIZE);
+    }
+    this->binaryTopic = this->binaryBuffer != nullptr ? topic : nullptr;
+}
+
 uint16_t MqttLogger::getBufferSize()
 {
     return this->bufferSize;
 }
 
-// allocate or reallocate local buffer, reset end to start of buffer
+uint32_t MqttLogger::getDroppedBytes()
+{
+    return this->droppedBytes.load(std::memory_order_relaxed);
+}
+
+// allocate or reallocate local buffers, reset end to start of buffer
 boolean MqttLogger::setBufferSize(uint16_t size)
 {
     if (size == 0)
@@ -49,23 +133,31 @@ boolean MqttLogger::setBufferSize(uint16_t size)
     if (this->bufferSize == 0)
     {
         this->buffer = (uint8_t *)malloc(size);
+        this->line = (uint8_t *)malloc(size);
         this->bufferEnd = this->buffer;
     }
     else
     {
         uint8_t *newBuffer = (uint8_t *)realloc(this->buffer, size);
+        uint8_t *newLine = (uint8_t *)realloc(this->line, size);
         if (newBuffer != NULL)
         {
             this->buffer = newBuffer;
             this->bufferEnd = this->buffer;
+            this->bufferCnt = 0;
         }
-        else
+        if (newLine != NULL)
+        {
+            this->line = newLine;
+            this->lineCnt = 0;
+        }
+        if (newBuffer == NULL || newLine == NULL)
         {
             return false;
         }
     }
     this->bufferSize = size;
-    return (this->buffer != NULL);
+    return (this->buffer != NULL && this->line != NULL);
 }
 
 // send & reset current buffer
@@ -75,11 +167,18 @@ void MqttLogger::sendBuffer()
     {
         bool doSerial = this->mode==MqttLoggerMode::SerialOnly || this->mode==MqttLoggerMode::MqttAndSerial || this->mode==MqttLoggerMode::MqttAndSerialAndWeb || this->mode==MqttLoggerMode::SerialAndWeb;
         bool doWebSerial = this->mode==MqttLoggerMode::MqttAndSerialAndWeb || this->mode==MqttLoggerMode::SerialAndWeb;
-        if (this->mode!=MqttLoggerMode::SerialOnly && this->mode!=MqttLoggerMode::SerialAndWeb && this->client != NULL && this->client->connected())
+        bool published = false;
+        if (this->mode!=MqttLoggerMode::SerialOnly && this->mode!=MqttLoggerMode::SerialAndWeb)
         {
-            this->client->publish(topic, 0, true, this->buffer, this->bufferCnt);
+            xSemaphoreTake(this->clientMutex, portMAX_DELAY);
+            if (this->client != NULL && this->client->connected())
+            {
+                this->client->publish(topic, 0, true, this->buffer, this->bufferCnt);
+                published = true;
+            }
+            xSemaphoreGive(this->clientMutex);
         }
-        else if (this->mode == MqttLoggerMode::MqttAndSerialFallback)
+        if (!published && this->mode == MqttLoggerMode::MqttAndSerialFallback)
         {
             doSerial = true;
         }
@@ -97,34 +196,203 @@ void MqttLogger::sendBuffer()
     this->bufferEnd=this->buffer;
 }
 
-// implement Print::write(uint8_t c): store into a buffer until \n or buffer full
-size_t MqttLogger::write(uint8_t character)
+// move the completed line into the frame, lines are separated by \n
+void MqttLogger::appendLine()
 {
-    if (character == '\n') // when newline is printed we send the buffer
+    uint16_t separator = this->bufferCnt > 0 ? 1 : 0;
+    if (this->bufferCnt + separator + this->lineCnt > this->bufferSize)
     {
         this->sendBuffer();
+        separator = 0;
     }
-    else
+    if (separator > 0)
+    {
+        *(this->bufferEnd++) = '\n';
+        this->bufferCnt++;
+    }
+    memcpy(this->bufferEnd, this->line, this->lineCnt);
+    this->bufferEnd += this->lineCnt;
+    this->bufferCnt += this->lineCnt;
+    this->lineCnt = 0;
+}
+
+// runs on the logger task only
+void MqttLogger::drain()
+{
+    if (this->buffer == NULL || this->line == NULL || this->drainBuffer == NULL)
+    {
+        return;
+    }
+
+    uint32_t length;
+    bool event;
+    while ((length = this->ring.pop(this->drainBuffer, MQTT_LOGGER_MAX_RECORD, event)) > 0)
+    {
+        if (event)
+        {
+            this->drainEvent(length);
+            continue;
+        }
+
+        for (uint32_t i = 0; i < length; i++)
+        {
+            uint8_t character = this->drainBuffer[i];
+            if (character == '\n')
+            {
+                this->appendLine();
+            }
+            else
+            {
+                if (this->lineCnt >= this->bufferSize) // line is longer than a frame, send what we have
+                {
+                    this->appendLine();
+                }
+                this->line[this->lineCnt++] = character;
+            }
+        }
+    }
+
+    uint32_t dropped = this->droppedBytes.load(std::memory_order_relaxed);
+    if (dropped != this->reportedDroppedBytes)
+    {
+        char message[48];
+        int messageLength = snprintf(message, sizeof(message), "Log buffer overflow, %u bytes dropped", (unsigned int)(dropped - this->reportedDroppedBytes));
+        this->reportedDroppedBytes = dropped;
+        if (this->lineCnt == 0 && messageLength > 0)
+        {
+            memcpy(this->line, message, messageLength);
+            this->lineCnt = messageLength;
+            this->appendLine();
+        }
+    }
+
+    // a partial line waits for its newline
+    this->sendBuffer();
+    this->sendBinary();
+}
+
+bool MqttLogger::hasTextSink()
+{
+    bool mqtt = this->mode!=MqttLoggerMode::SerialOnly && this->mode!=MqttLoggerMode::SerialAndWeb && this->client != NULL;
+    bool serial = this->mode==MqttLoggerMode::SerialOnly || this->mode==MqttLoggerMode::MqttAndSerial || this->mode==MqttLoggerMode::MqttAndSerialAndWeb || this->mode==MqttLoggerMode::SerialAndWeb || (this->mode == MqttLoggerMode::MqttAndSerialFallback && !mqtt);
+    bool web = (this->mode==MqttLoggerMode::MqttAndSerialAndWeb || this->mode==MqttLoggerMode::SerialAndWeb) && websocketHandler != nullptr;
+    return mqtt || (serial && coredumpPrinted) || web;
+}
+
+void MqttLogger::drainEvent(uint32_t length)
+{
+    if (length < 2)
+    {
+        return;
+    }
+
+    if (this->binaryTopic != nullptr)
     {
-        if (this->bufferCnt < this->bufferSize) // add char to end of buffer
+        if (this->binaryCnt + 2 + length > MQTT_MAX_PACKET_SIZE)
         {
-            *(this->bufferEnd++) = character;
-            this->bufferCnt++;
+            this->sendBinary();
         }
-        else // buffer is full, first send&reset buffer and then add char to buffer
+        this->binaryBuffer[this->binaryCnt++] = length & 0xFF;
+        this->binaryBuffer[this->binaryCnt++] = length >> 8;
+        memcpy(this->binaryBuffer + this->binaryCnt, this->drainBuffer, length);
+        this->binaryCnt += length;
+    }
+
+    if (!this->hasTextSink())
+    {
+        return;
+    }
+
+    // an event always starts a line of its own
+    if (this->lineCnt > 0)
+    {
+        this->appendLine();
+    }
+
+    uint16_t id = logRecordFormatId(this->drainBuffer);
+    if (id < this->eventFormatCount && this->eventFormats[id] != nullptr)
+    {
+        this->lineCnt = logRecordFormat(this->eventFormats[id], this->drainBuffer, length, (char*)this->line, this->bufferSize);
+    }
+    else
+    {
+        this->lineCnt = snprintf((char*)this->line, this->bufferSize, "Unknown log event %u", id);
+    }
+    this->appendLine();
+}
+
+void MqttLogger::sendBinary()
+{
+    if (this->binaryCnt == 0)
+    {
+        return;
+    }
+
+    xSemaphoreTake(this->clientMutex, portMAX_DELAY);
+    if (this->client != NULL && this->client->connected())
+    {
+        this->client->publish(this->binaryTopic, 0, false, this->binaryBuffer, this->binaryCnt);
+    }
+    xSemaphoreGive(this->clientMutex);
+    this->binaryCnt = 0;
+}
+
+size_t MqttLogger::write(uint8_t character)
+{
+    return this->write(&character, 1);
+}
+
+// never blocks: copies into the ring and drops the text when it is full
+size_t MqttLogger::write(const uint8_t *buffer, size_t size)
+{
+    size_t remaining = size;
+
+    while (remaining > 0)
+    {
+        uint32_t chunk = remaining < MQTT_LOGGER_MAX_RECORD ? remaining : MQTT_LOGGER_MAX_RECORD;
+        if (!this->ring.push(buffer, chunk))
         {
-            this->sendBuffer();
-            *(this->bufferEnd++) = character;
-            this->bufferCnt++;
+            this->droppedBytes.fetch_add(remaining, std::memory_order_relaxed);
+            break;
         }
+        buffer += chunk;
+        remaining -= chunk;
+    }
+
+    if (this->taskHandle != nullptr && this->ring.used() > this->ring.capacity() / 2)
+    {
+        xTaskNotifyGive(this->taskHandle);
+    }
+
+    return size;
+}
+
+void MqttLogger::writeEvent(const uint8_t* record, uint16_t length)
+{
+    if (length > MQTT_LOGGER_MAX_RECORD || !this->ring.push(record, length, true))
+    {
+        this->droppedBytes.fetch_add(length, std::memory_order_relaxed);
+    }
+
+    if (this->taskHandle != nullptr && this->ring.used() > this->ring.capacity() / 2)
+    {
+        xTaskNotifyGive(this->taskHandle);
     }
-    return 1;
 }
 
-size_t MqttLogger::write(const uint8_t *buffer, size_t size) {
-  size_t n = 0;
-  while (size--) {
-    n += write(*buffer++);
-  }
-  return n;
-}
\ No newline at end of file
+// gives the logger task time to empty the ring, e.g. before a restart
+void MqttLogger::flush()
+{
+    if (this->taskHandle == nullptr || xTaskGetCurrentTaskHandle() == this->taskHandle)
+    {
+        return;
+    }
+
+    uint32_t waited = 0;
+    while (this->ring.used() > 0 && waited < MQTT_LOGGER_FLUSH_TIMEOUT)
+    {
+        xTaskNotifyGive(this->taskHandle);
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+        waited += 10;
+    }
+}
@@ -11,11 +11,33 @@
 
 #include <Arduino.h>
 #include <Print.h>
+#include <atomic>
 #include <espMqttClient.h>
 #include "PsychicWebSocket.h"
+#include "LogRingBuffer.h"
+#include "LogRecord.h"
 
 #define MQTT_MAX_PACKET_SIZE 1024
 
+#ifndef MQTT_LOGGER_RING_SIZE
+#define MQTT_LOGGER_RING_SIZE 8192
+#endif
+#ifndef MQTT_LOGGER_MAX_RECORD
+#define MQTT_LOGGER_MAX_RECORD 256
+#endif
+#ifndef MQTT_LOGGER_TASK_SIZE
+#define MQTT_LOGGER_TASK_SIZE 4096
+#endif
+#ifndef MQTT_LOGGER_TASK_PRIORITY
+#define MQTT_LOGGER_TASK_PRIORITY 1
+#endif
+#ifndef MQTT_LOGGER_DRAIN_INTERVAL
+#define MQTT_LOGGER_DRAIN_INTERVAL 100
+#endif
+#ifndef MQTT_LOGGER_FLUSH_TIMEOUT
+#define MQTT_LOGGER_FLUSH_TIMEOUT 500
+#endif
+
 extern PsychicWebSocketHandler* websocketHandler;
 extern bool coredumpPrinted;
 
@@ -28,6 +50,10 @@ enum MqttLoggerMode {
     SerialAndWeb = 5,
 };
 
+// write() only copies into a lock-free ring, a low priority task drains it and
+// publishes complete lines, batched up to the buffer size per MQTT / websocket frame.
+// Binary events from writeEvent() share the ring and are turned into text by the task,
+// and only when a sink takes text. With a binary topic set they are also published raw.
 class MqttLogger : public Print
 {
 private:
@@ -36,9 +62,30 @@ private:
     uint8_t* bufferEnd;
     uint16_t bufferCnt = 0;
     uint16_t bufferSize = 0;
-    MqttClient* client;
+    uint8_t* line = nullptr;
+    uint16_t lineCnt = 0;
+    uint8_t* drainBuffer = nullptr;
+    uint8_t* binaryBuffer = nullptr;
+    uint16_t binaryCnt = 0;
+    const char* binaryTopic = nullptr;
+    const char* const* eventFormats = nullptr;
+    uint16_t eventFormatCount = 0;
+    MqttClient* client = nullptr;
     MqttLoggerMode mode;
+    LogRingBuffer ring;
+    std::atomic<uint32_t> droppedBytes {0};
+    uint32_t reportedDroppedBytes = 0;
+    SemaphoreHandle_t clientMutex = nullptr;
+    TaskHandle_t taskHandle = nullptr;
+
+    void startTask();
+    static void taskEntry(void* param);
+    void drain();
+    void drainEvent(uint32_t length);
+    bool hasTextSink();
+    void appendLine();
     void sendBuffer();
+    void sendBinary();
 
 public:
     MqttLogger(MqttLoggerMode mode=MqttLoggerMode::MqttAndSerialFallback);
@@ -46,16 +93,24 @@ public:
     ~MqttLogger();
 
     void setClient(MqttClient& client);
+    void clearClient();
     void setTopic(const char* topic);
     void setMode(MqttLoggerMode mode);
     void setRetained(boolean retained);
+    void setEventFormats(const char* const* formats, uint16_t count);
+    void setBinaryTopic(const char* topic);
+
+    // queues a record built by LogRecordWriter, it is formatted on the logger task
+    void writeEvent(const uint8_t* record, uint16_t length);
 
     virtual size_t write(uint8_t);
     virtual size_t write(const uint8_t *buffer, size_t size);
+    virtual void flush();
     using Print::write;
 
     uint16_t getBufferSize();
     boolean setBufferSize(uint16_t size);
+    uint32_t getDroppedBytes();
 };
 
 #endif
@@ -0,0 +1,20 @@
+#!/usr/bin/env bash
+#Page view load test: TLS handshakes and latency per page view with keep-alive,
+#with session resumption only and with a full handshake per request.
+#No extra dependencies beyond node.
+
+TEST_IP="psychic.local"
+PAGE_VIEWS=20
+RESULTS_FILE=pageview-loadtest-results.csv
+PROTOCOL=https
+#PROTOCOL=http
+#PAGES="/,/style.css,/favicon.ico"
+#COOKIE="sessionId=..."
+
+rm -f $RESULTS_FILE
+
+for MODE in keepalive resume full
+do
+  PAGES=$PAGES COOKIE=$COOKIE node pageview-client-test.js "$PROTOCOL://$TEST_IP" $PAGE_VIEWS $MODE $RESULTS_FILE
+  sleep 5
+done
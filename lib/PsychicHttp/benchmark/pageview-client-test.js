@@ -0,0 +1,114 @@
+#!/usr/bin/env node
+// Replays page views (a page plus its assets, fetched like a browser does) and
+// reports TLS handshakes and latency per page view.
+//
+// node pageview-client-test.js <baseUrl> <pageViews> <mode> [resultsFile]
+//
+// modes:
+//   keepalive   connections are reused, TLS sessions are resumed (browser behaviour)
+//   resume      new connection per request, TLS session resumption only
+//   full        new connection per request, full handshake every time
+//
+// environment:
+//   PAGES   comma separated paths of one page view, default "/,/style.css,/favicon.ico"
+//   COOKIE  sent with every request, e.g. "sessionId=..." for pages behind a login
+
+const http = require('http');
+const https = require('https');
+const fs = require('fs');
+
+const baseUrl = process.argv[2];
+const pageViews = parseInt(process.argv[3] || '20');
+const mode = process.argv[4] || 'keepalive';
+const resultsFile = process.argv[5];
+
+if (!baseUrl || !['keepalive', 'resume', 'full'].includes(mode)) {
+  console.error('Usage: node pageview-client-test.js <baseUrl> <pageViews> <keepalive|resume|full> [resultsFile]');
+  process.exit(1);
+}
+
+const pages = (process.env.PAGES || '/,/style.css,/favicon.ico').split(',');
+const secure = baseUrl.startsWith('https');
+const transport = secure ? https : http;
+const agent = new transport.Agent({
+  keepAlive: mode == 'keepalive',
+  maxSockets: 1,
+  maxCachedSessions: mode == 'full' ? 0 : 100,
+  rejectUnauthorized: false, // Nuki Hub uses a self signed certificate by default
+});
+
+let connections = 0;
+let fullHandshakes = 0;
+let resumedHandshakes = 0;
+let errors = 0;
+
+function request(path) {
+  return new Promise((resolve) => {
+    const options = { agent: agent, headers: { 'Accept-Encoding': 'gzip' } };
+    if (process.env.COOKIE) {
+      options.headers['Cookie'] = process.env.COOKIE;
+    }
+    const req = transport.get(new URL(path, baseUrl), options, (res) => {
+      res.on('data', () => {});
+      res.on('end', () => {
+        if (res.statusCode >= 400) {
+          errors++;
+        }
+        resolve();
+      });
+    });
+    req.on('socket', (socket) => {
+      if (socket.pageviewCounted) {
+        return;
+      }
+      socket.pageviewCounted = true;
+      connections++;
+      socket.on('secureConnect', () => {
+        if (socket.isSessionReused()) {
+          resumedHandshakes++;
+        } else {
+          fullHandshakes++;
+        }
+      });
+    });
+    req.on('error', (error) => {
+      console.error(`${path}: ${error.message}`);
+      errors++;
+      resolve();
+    });
+  });
+}
+
+async function run() {
+  const latencies = [];
+
+  for (let i = 0; i < pageViews; i++) {
+    const start = process.hrtime.bigint();
+    for (const path of pages) {
+      await request(path);
+    }
+    latencies.push(Number(process.hrtime.bigint() - start) / 1e6);
+  }
+  agent.destroy();
+
+  latencies.sort((a, b) => a - b);
+  const mean = latencies.reduce((sum, value) => sum + value, 0) / latencies.length;
+  const percentile = (p) => latencies[Math.min(latencies.length - 1, Math.floor(latencies.length * p))];
+  const handshakes = fullHandshakes + resumedHandshakes;
+
+  console.log(`${mode}: ${pageViews} page views of ${pages.length} requests on ${baseUrl}`);
+  console.log(`  connections:             ${connections}`);
+  console.log(`  handshakes:              ${handshakes} (${fullHandshakes} full, ${resumedHandshakes} resumed)`);
+  console.log(`  handshakes per view:     ${(handshakes / pageViews).toFixed(2)}`);
+  console.log(`  latency per view (ms):   mean ${mean.toFixed(1)}, p50 ${percentile(0.5).toFixed(1)}, p95 ${percentile(0.95).toFixed(1)}`);
+  console.log(`  errors:                  ${errors}`);
+
+  if (resultsFile) {
+    if (!fs.existsSync(resultsFile)) {
+      fs.writeFileSync(resultsFile, 'url,mode,pageviews,connections,fullhandshakes,resumedhandshakes,latencymean,latencyp50,latencyp95,errors\n');
+    }
+    fs.appendFileSync(resultsFile, [baseUrl, mode, pageViews, connections, fullHandshakes, resumedHandshakes, mean.toFixed(1), percentile(0.5).toFixed(1), percentile(0.95).toFixed(1), errors].join(',') + '\n');
+  }
+}
+
+run();
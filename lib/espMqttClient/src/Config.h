@@ -61,8 +61,20 @@ the LICENSE file.
 #define EMC_USE_WATCHDOG 0
 #endif
 
+#ifndef EMC_TLS_SESSION_RESUMPTION
+#define EMC_TLS_SESSION_RESUMPTION 1
+#endif
+
+#ifndef EMC_TCP_CONNECT_TIMEOUT
+#define EMC_TCP_CONNECT_TIMEOUT 5000
+#endif
+
+#ifndef EMC_TLS_HANDSHAKE_TIMEOUT
+#define EMC_TLS_HANDSHAKE_TIMEOUT 10000
+#endif
+
 #ifndef EMC_USE_MEMPOOL
-#define EMC_USE_MEMPOOL 0
+#define EMC_USE_MEMPOOL 1
 #endif
 
 #if EMC_USE_MEMPOOL
@@ -72,4 +84,14 @@ the LICENSE file.
   #ifndef EMC_SIZE_POOL_ELEMENTS
     #define EMC_SIZE_POOL_ELEMENTS 128
   #endif
+  #ifndef EMC_NUM_LARGE_POOL_ELEMENTS
+    // Home Assistant discovery sends about 120 packets of 500 to 1300 bytes, see scripts/hassdiscovery
+    #define EMC_NUM_LARGE_POOL_ELEMENTS 16
+  #endif
+  #ifndef EMC_SIZE_LARGE_POOL_ELEMENTS
+    #define EMC_SIZE_LARGE_POOL_ELEMENTS (EMC_TX_BUFFER_SIZE > EMC_SIZE_POOL_ELEMENTS ? EMC_TX_BUFFER_SIZE : EMC_SIZE_POOL_ELEMENTS)
+  #endif
+  #ifndef EMC_POOL_HEAP_FALLBACK
+    #define EMC_POOL_HEAP_FALLBACK 1
+  #endif
 #endif
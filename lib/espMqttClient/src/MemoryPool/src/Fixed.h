@@ -27,7 +27,9 @@ class Fixed {
  public:
   Fixed()  // cppcheck-suppress uninitMemberVar
   : _buffer{0}
-  , _head(_buffer) {
+  , _head(_buffer)
+  , _used(0)
+  , _highWater(0) {
     unsigned char* b = _head;
     std::size_t adjustedBlocksize = sizeof(std::size_t) > blocksize ? sizeof(std::size_t) : blocksize;
     for (std::size_t i = 0; i < nrBlocks - 1; ++i) {
@@ -48,6 +50,7 @@ class Fixed {
     if (_head) {
       void* retVal = _head;
       _head = *reinterpret_cast<unsigned char**>(_head);
+      if (++_used > _highWater) _highWater = _used;
       return retVal;
     }
     return nullptr;
@@ -60,6 +63,25 @@ class Fixed {
     #endif
     *reinterpret_cast<unsigned char**>(ptr) = _head;
     _head = reinterpret_cast<unsigned char*>(ptr);
+    --_used;
+  }
+
+  // true if ptr was handed out by this pool
+  bool owns(const void* ptr) const {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(ptr);
+    return p >= _buffer && p < _buffer + sizeof(_buffer);
+  }
+
+  std::size_t usedBlocks() const {
+    return _used;
+  }
+
+  std::size_t highWater() const {
+    return _highWater;
+  }
+
+  std::size_t capacity() const {
+    return nrBlocks;
   }
 
   std::size_t freeMemory() {
@@ -111,6 +133,8 @@ class Fixed {
  private:
   unsigned char _buffer[nrBlocks * (sizeof(std::size_t) > blocksize ? sizeof(std::size_t) : blocksize)];
   unsigned char* _head;
+  std::size_t _used;
+  std::size_t _highWater;
   #if _GLIBCXX_HAS_GTHREADS
   std::mutex _mutex;
   #endif
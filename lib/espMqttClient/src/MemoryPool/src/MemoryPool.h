@@ -10,3 +10,4 @@ the LICENSE file.
 
 #include "Variable.h"
 #include "Fixed.h"
+#include "SizeClassed.h"
@@ -0,0 +1,72 @@
+/*
+Copyright (c) 2024 Bert Melis. All rights reserved.
+
+This work is licensed under the terms of the MIT license.  
+For a copy, see <https://opensource.org/licenses/MIT> or
+the LICENSE file.
+*/
+
+#pragma once
+
+#include <cstddef>  // std::size_t
+
+#include "Fixed.h"
+
+namespace MemoryPool {
+
+/**
+ * @brief Two fixed-block pools of different block sizes
+ *
+ * Requests are served from the smallest class that fits. Small requests
+ * spill into the large class when the small class is exhausted.
+ * Requests larger than the large block size are never served.
+ */
+template <std::size_t nrSmallBlocks, std::size_t smallBlocksize, std::size_t nrLargeBlocks, std::size_t largeBlocksize>
+class SizeClassed {
+  static_assert(smallBlocksize <= largeBlocksize, "Small blocks must not be larger than large blocks");
+
+ public:
+  SizeClassed() = default;
+
+  // no copy nor move
+  SizeClassed (const SizeClassed&) = delete;
+  SizeClassed& operator= (const SizeClassed&) = delete;
+
+  void* malloc(std::size_t size) {
+    if (size == 0 || size > largeBlocksize) return nullptr;
+    void* retVal = nullptr;
+    if (size <= smallBlocksize) {
+      retVal = _small.malloc();
+    }
+    if (!retVal) {
+      retVal = _large.malloc();
+    }
+    return retVal;
+  }
+
+  void free(void* ptr) {
+    if (_small.owns(ptr)) {
+      _small.free(ptr);
+    } else if (_large.owns(ptr)) {
+      _large.free(ptr);
+    }
+  }
+
+  bool owns(const void* ptr) const {
+    return _small.owns(ptr) || _large.owns(ptr);
+  }
+
+  const Fixed<nrSmallBlocks, smallBlocksize>& small() const {
+    return _small;
+  }
+
+  const Fixed<nrLargeBlocks, largeBlocksize>& large() const {
+    return _large;
+  }
+
+ private:
+  Fixed<nrSmallBlocks, smallBlocksize> _small;
+  Fixed<nrLargeBlocks, largeBlocksize> _large;
+};
+
+}  // end namespace MemoryPool
@@ -38,6 +38,7 @@ MqttClient::MqttClient(espMqttClientTypes::UseInternalTask useInternalTask, uint
 , _willQos(0)
 , _willRetain(false)
 , _timeout(EMC_TX_TIMEOUT)
+, _coalescePublishes(false)
 , _state(State::disconnected)
 , _generatedClientId{0}
 , _packetId(0)
@@ -53,6 +54,7 @@ MqttClient::MqttClient(espMqttClientTypes::UseInternalTask useInternalTask, uint
 , _lastServerActivity(0)
 , _pingSent(false)
 , _disconnectReason(DisconnectReason::TCP_DISCONNECTED)
+, _coalescedPublishes(0)
 #if defined(ARDUINO_ARCH_ESP32) && ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
 , _highWaterMark(4294967295)
 #endif
@@ -159,6 +161,10 @@ uint16_t MqttClient::publish(const char* topic, uint8_t qos, bool retain, const
   }
   EMC_SEMAPHORE_TAKE();
   uint16_t packetId = (qos > 0) ? _getNextPacketId() : 1;
+  if (_coalescePublishes && retain && qos < 2 && _replacePublish(topic, packetId, topic, payload, length, qos, retain)) {
+    EMC_SEMAPHORE_GIVE();
+    return packetId;
+  }
   if (!_addPacket(packetId, topic, payload, length, qos, retain)) {
     emc_log_e("Could not create PUBLISH packet");
     EMC_SEMAPHORE_GIVE();
@@ -214,6 +220,21 @@ size_t MqttClient::queueSize() {
   return ret;
 }
 
+espMqttClientTypes::PoolStats MqttClient::poolStats() {
+  espMqttClientTypes::PoolStats stats;
+  #if EMC_USE_MEMPOOL
+  EMC_SEMAPHORE_TAKE();
+  _outbox.addPoolStats(stats);
+  espMqttClientInternals::Packet::addPoolStats(stats);
+  EMC_SEMAPHORE_GIVE();
+  #endif
+  return stats;
+}
+
+uint32_t MqttClient::coalescedPublishes() const {
+  return _coalescedPublishes;
+}
+
 void MqttClient::loop() {
   switch (_state) {
     case State::disconnected:
@@ -68,6 +68,8 @@ class MqttClient {
   void clearQueue(bool deleteSessionData = false);  // Not MQTT compliant and may cause unpredictable results when `deleteSessionData` = true!
   const char* getClientId() const;
   size_t queueSize();  // No const because of mutex
+  espMqttClientTypes::PoolStats poolStats();  // No const because of mutex
+  uint32_t coalescedPublishes() const;
   void loop();
 
  protected:
@@ -98,6 +100,7 @@ class MqttClient {
   uint8_t _willQos;
   bool _willRetain;
   uint32_t _timeout;
+  bool _coalescePublishes;
 
   // state is protected to allow state changes by the transport system, defined in child classes
   // eg. to allow AsyncTCP
@@ -145,6 +148,7 @@ class MqttClient {
   uint32_t _lastServerActivity;
   bool _pingSent;
   espMqttClientTypes::DisconnectReason _disconnectReason;
+  std::atomic<uint32_t> _coalescedPublishes;
 
   uint16_t _getNextPacketId();
 
@@ -160,6 +164,33 @@ class MqttClient {
     }
   }
 
+  // replaces a queued, not yet sent retained PUBLISH to the same topic
+  // returns false when there is nothing to replace or the new packet could not be created
+  template <typename... Args>
+  bool _replacePublish(const char* topic, Args&&... args) {
+    espMqttClientInternals::Outbox<OutgoingPacket>::Iterator it = _outbox.current();
+    // skip the packet being transmitted
+    if (it && _bytesSent > 0) ++it;
+    while (it) {
+      const espMqttClientInternals::Packet& queued = it.get()->packet;
+      if (queued.packetType() == espMqttClientInternals::PacketType.PUBLISH && !queued.dup() && queued.retained() && queued.qos() < 2 && queued.hasTopic(topic)) {
+        break;
+      }
+      ++it;
+    }
+    if (!it) return false;
+
+    espMqttClientTypes::Error error(espMqttClientTypes::Error::SUCCESS);
+    espMqttClientInternals::Outbox<OutgoingPacket>::Iterator added = _outbox.emplace(0, error, std::forward<Args>(args) ...);
+    if (!added || error != espMqttClientTypes::Error::SUCCESS) {
+      if (added) _outbox.remove(added);
+      return false;
+    }
+    _outbox.replace(it, added);
+    ++_coalescedPublishes;
+    return true;
+  }
+
   template <typename... Args>
   bool _addPacketFront(Args&&... args) {
     espMqttClientTypes::Error error(espMqttClientTypes::Error::SUCCESS);
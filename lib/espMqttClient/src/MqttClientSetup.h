@@ -78,6 +78,12 @@ class MqttClientSetup : public MqttClient {
     return static_cast<T&>(*this);
   }
 
+  // a retained QoS 0/1 publish replaces a queued, unsent publish to the same topic
+  T& setPublishCoalescing(bool coalesce) {
+    _coalescePublishes = coalesce;
+    return static_cast<T&>(*this);
+  }
+
   T& onConnect(espMqttClientTypes::OnConnectCallback callback, uint32_t id = 0) {
     #if EMC_MULTIPLE_CALLBACKS
     _onConnectCallbacks.emplace_back(callback, id);
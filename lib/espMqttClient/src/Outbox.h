@@ -9,9 +9,11 @@ the LICENSE file.
 
 #pragma once
 
+#include "Config.h"
+#include "Helpers.h"
+#include "TypeDefs.h"
 #if EMC_USE_MEMPOOL
   #include "MemoryPool/src/MemoryPool.h"
-  #include "Config.h"
 #endif
 #include <new>  // new, std::nothrow
 #include <utility>  // std::forward
@@ -35,17 +37,14 @@ class Outbox {
   , _prev(nullptr)
   #if EMC_USE_MEMPOOL
   , _memPool()
+  , _heapFallbacks(0)
+  , _rejected(0)
   #endif
   {}
   ~Outbox() {
     while (_first) {
       Node* n = _first->next;
-      #if EMC_USE_MEMPOOL
-      _first->~Node();
-      _memPool.free(_first);
-      #else
-      delete _first;
-      #endif
+      _freeNode(_first);
       _first = n;
     }
   }
@@ -92,15 +91,11 @@ class Outbox {
   template <class... Args>
   Iterator emplace(Args&&... args) {
     Iterator it;
-    #if EMC_USE_MEMPOOL
-    void* buf = _memPool.malloc();
+    void* buf = _allocNode();
     Node* node = nullptr;
     if (buf) {
       node = new(buf) Node(std::forward<Args>(args) ...);
     }
-    #else
-    Node* node = new(std::nothrow) Node(std::forward<Args>(args) ...);
-    #endif
     if (node != nullptr) {
       if (!_first) {
         // queue is empty
@@ -124,15 +119,11 @@ class Outbox {
   template <class... Args>
   Iterator emplaceFront(Args&&... args) {
     Iterator it;
-    #if EMC_USE_MEMPOOL
-    void* buf = _memPool.malloc();
+    void* buf = _allocNode();
     Node* node = nullptr;
     if (buf) {
       node = new(buf) Node(std::forward<Args>(args) ...);
     }
-    #else
-    Node* node = new(std::nothrow) Node(std::forward<Args>(args) ...);
-    #endif
     if (node != nullptr) {
       if (!_first) {
         // queue is empty
@@ -182,6 +173,44 @@ class Outbox {
     return it;
   }
 
+  // iterator starting at current, all items from here on have not been sent yet
+  Iterator current() const {
+    Iterator it;
+    it._node = _current;
+    it._prev = _prev;
+    return it;
+  }
+
+  // move the node at `with` into the position of `it` and delete the node at `it`
+  // `it` must precede `with`, afterwards `it` points to the moved node and `with` is invalidated
+  void replace(Iterator& it, Iterator& with) {  // NOLINT(runtime/references)
+    Node* old = it._node;
+    Node* node = with._node;
+    if (!old || !node || old == node) return;
+
+    // unlink node, it always has a predecessor
+    with._prev->next = node->next;
+    if (_last == node) _last = with._prev;
+    if (_current == node) _current = node->next;
+    if (_prev == node) _prev = with._prev;
+
+    // take the place of old
+    node->next = old->next;
+    if (it._prev) {
+      it._prev->next = node;
+    } else {
+      _first = node;
+    }
+    if (_last == old) _last = node;
+    if (_current == old) _current = node;
+    if (_prev == old) _prev = node;
+
+    _freeNode(old);
+    it._node = node;
+    with._node = nullptr;
+    with._prev = nullptr;
+  }
+
   // Advance current item
   void next() {
     if (_current) {
@@ -196,6 +225,16 @@ class Outbox {
     return false;
   }
 
+  #if EMC_USE_MEMPOOL
+  void addPoolStats(espMqttClientTypes::PoolStats& stats) const {  // NOLINT(runtime/references)
+    stats.nodesUsed = _memPool.usedBlocks();
+    stats.nodesHighWater = _memPool.highWater();
+    stats.nodesCapacity = _memPool.capacity();
+    stats.heapFallbacks += _heapFallbacks;
+    stats.rejected += _rejected;
+  }
+  #endif
+
   size_t size() const {
     Node* n = _first;
     size_t count = 0;
@@ -213,8 +252,38 @@ class Outbox {
   Node* _prev;  // element just before _current
   #if EMC_USE_MEMPOOL
   MemoryPool::Fixed<EMC_NUM_POOL_ELEMENTS, sizeof(Node)> _memPool;
+  uint32_t _heapFallbacks;
+  uint32_t _rejected;
   #endif
 
+  void* _allocNode() {
+    #if EMC_USE_MEMPOOL
+    void* buf = _memPool.malloc();
+    #if EMC_POOL_HEAP_FALLBACK
+    // pool exhausted: only spill to the heap while there is headroom
+    if (!buf && EMC_GET_FREE_MEMORY() >= EMC_MIN_FREE_MEMORY) {
+      buf = ::operator new(sizeof(Node), std::nothrow);
+      if (buf) ++_heapFallbacks;
+    }
+    #endif
+    if (!buf) ++_rejected;
+    return buf;
+    #else
+    return ::operator new(sizeof(Node), std::nothrow);
+    #endif
+  }
+
+  void _freeNode(Node* node) {
+    node->~Node();
+    #if EMC_USE_MEMPOOL
+    if (_memPool.owns(node)) {
+      _memPool.free(node);
+      return;
+    }
+    #endif
+    ::operator delete(node);
+  }
+
   void _remove(Node* prev, Node* node) {
     if (!node) return;
 
@@ -246,12 +315,7 @@ class Outbox {
     }
 
     // finally, delete the node
-      #if EMC_USE_MEMPOOL
-      node->~Node();
-      _memPool.free(node);
-      #else
-      delete node;
-      #endif
+    _freeNode(node);
   }
 };
 
@@ -11,12 +11,18 @@ the LICENSE file.
 namespace espMqttClientInternals {
 
 #if EMC_USE_MEMPOOL
-MemoryPool::Variable<EMC_NUM_POOL_ELEMENTS, EMC_SIZE_POOL_ELEMENTS> Packet::_memPool;
+MemoryPool::SizeClassed<EMC_NUM_POOL_ELEMENTS, EMC_SIZE_POOL_ELEMENTS, EMC_NUM_LARGE_POOL_ELEMENTS, EMC_SIZE_LARGE_POOL_ELEMENTS> Packet::_memPool;
+std::atomic<uint32_t> Packet::_heapFallbacks(0);
+std::atomic<uint32_t> Packet::_rejected(0);
 #endif
 
 Packet::~Packet() {
   #if EMC_USE_MEMPOOL
-  _memPool.free(_data);
+  if (_memPool.owns(_data)) {
+    _memPool.free(_data);
+  } else {
+    free(_data);
+  }
   #else
   free(_data);
   #endif
@@ -63,6 +69,29 @@ bool Packet::removable() const {
   return false;
 }
 
+uint8_t Packet::qos() const {
+  if (packetType() != PacketType.PUBLISH) return 0;
+  return (_data[0] & 0x06) >> 1;
+}
+
+bool Packet::dup() const {
+  if (packetType() != PacketType.PUBLISH) return false;
+  return (_data[0] & 0x08) != 0;
+}
+
+bool Packet::retained() const {
+  if (packetType() != PacketType.PUBLISH) return false;
+  return (_data[0] & HeaderFlag.PUBLISH_RETAIN) != 0;
+}
+
+bool Packet::hasTopic(const char* topic) const {
+  if (packetType() != PacketType.PUBLISH) return false;
+  // the topic is always part of the buffer, also for chunked payloads
+  size_t index = 1 + remainingLengthLength(decodeRemainingLength(&_data[1]));
+  size_t length = (static_cast<size_t>(_data[index]) << 8) | _data[index + 1];
+  return strlen(topic) == length && memcmp(&_data[index + 2], topic, length) == 0;
+}
+
 Packet::Packet(espMqttClientTypes::Error& error,
                bool cleanSession,
                const char* username,
@@ -308,19 +337,37 @@ Packet::Packet(espMqttClientTypes::Error& error, MQTTPacketType type)
 }
 
 
+#if EMC_USE_MEMPOOL
+void Packet::addPoolStats(espMqttClientTypes::PoolStats& stats) {
+  stats.smallUsed = _memPool.small().usedBlocks();
+  stats.smallHighWater = _memPool.small().highWater();
+  stats.smallCapacity = _memPool.small().capacity();
+  stats.largeUsed = _memPool.large().usedBlocks();
+  stats.largeHighWater = _memPool.large().highWater();
+  stats.largeCapacity = _memPool.large().capacity();
+  stats.heapFallbacks += _heapFallbacks;
+  stats.rejected += _rejected;
+}
+#endif
+
 bool Packet::_allocate(size_t remainingLength, bool check) {
   #if EMC_USE_MEMPOOL
-  (void) check;
+  _size = 1 + remainingLengthLength(remainingLength) + remainingLength;
+  _data = reinterpret_cast<uint8_t*>(_memPool.malloc(_size));
+  #if EMC_POOL_HEAP_FALLBACK
+  // pool exhausted or packet too large: only spill to the heap while there is headroom
+  if (!_data && (!check || EMC_GET_FREE_MEMORY() >= EMC_MIN_FREE_MEMORY)) {
+    _data = reinterpret_cast<uint8_t*>(malloc(_size));
+    if (_data) ++_heapFallbacks;
+  }
+  #endif
+  if (!_data) ++_rejected;
   #else
   if (check && EMC_GET_FREE_MEMORY() < EMC_MIN_FREE_MEMORY) {
     emc_log_w("Packet buffer not allocated: low memory");
     return false;
   }
-  #endif
   _size = 1 + remainingLengthLength(remainingLength) + remainingLength;
-  #if EMC_USE_MEMPOOL
-  _data = reinterpret_cast<uint8_t*>(_memPool.malloc(_size));
-  #else
   _data = reinterpret_cast<uint8_t*>(malloc(_size));
   #endif
   if (!_data) {
@@ -10,6 +10,7 @@ the LICENSE file.
 
 #include <stdint.h>
 #include <stddef.h>
+#include <atomic>
 
 #include "Constants.h"
 #include "../Config.h"
@@ -36,6 +37,14 @@ class Packet {
   uint16_t packetId() const;
   MQTTPacketType packetType() const;
   bool removable() const;
+  // PUBLISH only
+  uint8_t qos() const;
+  bool dup() const;
+  bool retained() const;
+  bool hasTopic(const char* topic) const;
+  #if EMC_USE_MEMPOOL
+  static void addPoolStats(espMqttClientTypes::PoolStats& stats);  // NOLINT(runtime/references)
+  #endif
 
  protected:
   uint16_t _packetId;  // save as separate variable: will be accessed frequently
@@ -156,7 +165,9 @@ class Packet {
   const uint8_t* _chunkedData(size_t index) const;
 
   #if EMC_USE_MEMPOOL
-  static MemoryPool::Variable<EMC_NUM_POOL_ELEMENTS, EMC_SIZE_POOL_ELEMENTS> _memPool;
+  static MemoryPool::SizeClassed<EMC_NUM_POOL_ELEMENTS, EMC_SIZE_POOL_ELEMENTS, EMC_NUM_LARGE_POOL_ELEMENTS, EMC_SIZE_LARGE_POOL_ELEMENTS> _memPool;
+  static std::atomic<uint32_t> _heapFallbacks;
+  static std::atomic<uint32_t> _rejected;
   #endif
 };
 
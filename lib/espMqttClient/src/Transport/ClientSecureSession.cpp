@@ -0,0 +1,389 @@
+/*
+Copyright (c) 2022 Bert Melis. All rights reserved.
+
+This work is licensed under the terms of the MIT license.
+For a copy, see <https://opensource.org/licenses/MIT> or
+the LICENSE file.
+*/
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+#include "ClientSecureSession.h"
+
+#include <Arduino.h>  // millis
+#include <Network.h>  // DNS lookup
+#include <lwip/sockets.h>  // socket options
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+
+#include "../Logging.h"
+
+namespace espMqttClientInternals {
+
+static size_t _pemLength(const char* pem) {
+  return strlen(pem) + 1;  // mbedtls wants the terminating null for PEM data
+}
+
+static int _hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+ClientSecureSession::ClientSecureSession()
+: _rootCA(nullptr)
+, _clientCert(nullptr)
+, _privateKey(nullptr)
+, _pskIdent(nullptr)
+, _psKey(nullptr)
+, _insecure(false)
+, _setupDone(false)
+, _connected(false)
+, _hasSession(false)
+, _handshakeTime(0)
+, _resumed(false)
+, _handshakes(0)
+, _resumedHandshakes(0) {
+  mbedtls_net_init(&_net);
+  mbedtls_ssl_init(&_ssl);
+  mbedtls_ssl_session_init(&_session);
+}
+
+ClientSecureSession::~ClientSecureSession() {
+  stop();
+  mbedtls_ssl_session_free(&_session);
+  _freeSetup();
+}
+
+bool ClientSecureSession::connect(IPAddress ip, uint16_t port) {
+  return _connect(ip.toString().c_str(), port);
+}
+
+bool ClientSecureSession::connect(const char* host, uint16_t port) {
+  return _connect(host, port);
+}
+
+size_t ClientSecureSession::write(const uint8_t* buf, size_t size) {
+  if (!_connected) return 0;
+  int ret = mbedtls_ssl_write(&_ssl, buf, size);
+  if (ret > 0) return ret;
+  if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) return 0;
+  emc_log_w("TLS write error -0x%04x", -ret);
+  _connected = false;
+  return 0;
+}
+
+int ClientSecureSession::read(uint8_t* buf, size_t size) {
+  if (!_connected) return -1;
+  int ret = mbedtls_ssl_read(&_ssl, buf, size);
+  if (ret > 0) return ret;
+  if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) return -1;
+  #if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
+  if (ret == MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET) {
+    // TLS 1.3 delivers tickets after the handshake
+    _saveSession();
+    return -1;
+  }
+  #endif
+  // 0 or close notify: peer closed the connection
+  if (ret != 0 && ret != MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
+    emc_log_w("TLS read error -0x%04x", -ret);
+  }
+  _connected = false;
+  return -1;
+}
+
+void ClientSecureSession::stop() {
+  if (_connected) {
+    mbedtls_ssl_close_notify(&_ssl);
+  }
+  _connected = false;
+  mbedtls_ssl_free(&_ssl);
+  mbedtls_ssl_init(&_ssl);
+  mbedtls_net_free(&_net);
+  mbedtls_net_init(&_net);
+}
+
+bool ClientSecureSession::connected() {
+  return _connected;
+}
+
+bool ClientSecureSession::disconnected() {
+  return !_connected;
+}
+
+void ClientSecureSession::setInsecure() {
+  _insecure = true;
+  _freeSetup();
+}
+
+void ClientSecureSession::setCACert(const char* rootCA) {
+  _rootCA = rootCA;
+  _freeSetup();
+}
+
+void ClientSecureSession::setCertificate(const char* clientCa) {
+  _clientCert = clientCa;
+  _freeSetup();
+}
+
+void ClientSecureSession::setPrivateKey(const char* privateKey) {
+  _privateKey = privateKey;
+  _freeSetup();
+}
+
+void ClientSecureSession::setPreSharedKey(const char* pskIdent, const char* psKey) {
+  _pskIdent = pskIdent;
+  _psKey = psKey;
+  _freeSetup();
+}
+
+void ClientSecureSession::clearSession() {
+  mbedtls_ssl_session_free(&_session);
+  mbedtls_ssl_session_init(&_session);
+  _hasSession = false;
+}
+
+uint32_t ClientSecureSession::handshakeTime() const {
+  return _handshakeTime;
+}
+
+bool ClientSecureSession::sessionResumed() const {
+  return _resumed;
+}
+
+uint32_t ClientSecureSession::handshakes() const {
+  return _handshakes;
+}
+
+uint32_t ClientSecureSession::resumedHandshakes() const {
+  return _resumedHandshakes;
+}
+
+bool ClientSecureSession::_connect(const char* host, uint16_t port) {
+  stop();
+  if (!_setup()) return false;
+
+  if (!_tcpConnect(host, port)) {
+    stop();
+    return false;
+  }
+  int val = true;
+  setsockopt(_net.fd, IPPROTO_TCP, TCP_NODELAY, &val, sizeof(int));
+
+  int ret;
+  if ((ret = mbedtls_ssl_setup(&_ssl, &_conf)) != 0 ||
+      (ret = mbedtls_ssl_set_hostname(&_ssl, host)) != 0) {
+    emc_log_e("TLS setup failed -0x%04x", -ret);
+    stop();
+    return false;
+  }
+
+  unsigned char offeredId[32];
+  size_t offeredIdLen = 0;
+  if (_hasSession) {
+    offeredIdLen = _session.MBEDTLS_PRIVATE(id_len);
+    if (offeredIdLen > sizeof(offeredId)) offeredIdLen = sizeof(offeredId);
+    memcpy(offeredId, _session.MBEDTLS_PRIVATE(id), offeredIdLen);
+    if (mbedtls_ssl_set_session(&_ssl, &_session) != 0) {
+      clearSession();
+      offeredIdLen = 0;
+    }
+  }
+
+  // handshake blocks with a read timeout, afterwards the socket is non-blocking
+  mbedtls_ssl_set_bio(&_ssl, &_net, mbedtls_net_send, nullptr, mbedtls_net_recv_timeout);
+  uint32_t start = millis();
+  while ((ret = mbedtls_ssl_handshake(&_ssl)) != 0) {
+    if ((ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) || millis() - start > EMC_TLS_HANDSHAKE_TIMEOUT) {
+      emc_log_e("TLS handshake failed -0x%04x", -ret);
+      // don't keep offering a session the broker may have dropped
+      clearSession();
+      stop();
+      return false;
+    }
+  }
+  _handshakeTime = millis() - start;
+  ++_handshakes;
+
+  mbedtls_ssl_session* session = &_session;
+  _saveSession();
+  _resumed = offeredIdLen > 0 && _hasSession &&
+             session->MBEDTLS_PRIVATE(id_len) == offeredIdLen &&
+             memcmp(session->MBEDTLS_PRIVATE(id), offeredId, offeredIdLen) == 0;
+  if (_resumed) ++_resumedHandshakes;
+  emc_log_i("TLS handshake %ums%s", _handshakeTime, _resumed ? " (resumed)" : "");
+
+  mbedtls_net_set_nonblock(&_net);
+  mbedtls_ssl_set_bio(&_ssl, &_net, mbedtls_net_send, mbedtls_net_recv, nullptr);
+  _connected = true;
+  return true;
+}
+
+bool ClientSecureSession::_tcpConnect(const char* host, uint16_t port) {
+  // mbedtls_net_connect() resolves and connects without a timeout, an unreachable broker would stall the network task
+  IPAddress ip;
+  if (!ip.fromString(host) && !Network.hostByName(host, ip)) {
+    emc_log_e("DNS lookup for %s failed", host);
+    return false;
+  }
+
+  ip_addr_t lwipAddr;
+  ip.to_ip_addr_t(&lwipAddr);
+  struct sockaddr_storage addr;
+  memset(&addr, 0, sizeof(addr));
+  socklen_t addrLen;
+  if (IP_IS_V6(&lwipAddr)) {
+    struct sockaddr_in6* addr6 = reinterpret_cast<struct sockaddr_in6*>(&addr);
+    addr6->sin6_family = AF_INET6;
+    addr6->sin6_port = htons(port);
+    inet6_addr_from_ip6addr(&addr6->sin6_addr, ip_2_ip6(&lwipAddr));
+    addrLen = sizeof(struct sockaddr_in6);
+  } else {
+    struct sockaddr_in* addr4 = reinterpret_cast<struct sockaddr_in*>(&addr);
+    addr4->sin_family = AF_INET;
+    addr4->sin_port = htons(port);
+    inet_addr_from_ip4addr(&addr4->sin_addr, ip_2_ip4(&lwipAddr));
+    addrLen = sizeof(struct sockaddr_in);
+  }
+
+  int fd = socket(addr.ss_family, SOCK_STREAM, IPPROTO_TCP);
+  if (fd < 0) {
+    emc_log_e("TCP socket failed %d", errno);
+    return false;
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+  int ret = ::connect(fd, reinterpret_cast<struct sockaddr*>(&addr), addrLen);
+  if (ret < 0 && errno == EINPROGRESS) {
+    fd_set fdset;
+    FD_ZERO(&fdset);
+    FD_SET(fd, &fdset);
+    struct timeval tv;
+    tv.tv_sec = EMC_TCP_CONNECT_TIMEOUT / 1000;
+    tv.tv_usec = (EMC_TCP_CONNECT_TIMEOUT % 1000) * 1000;
+    ret = select(fd + 1, nullptr, &fdset, nullptr, &tv);
+    if (ret == 0) {
+      emc_log_e("TCP connect timed out");
+      close(fd);
+      return false;
+    }
+    int sockErr = 0;
+    socklen_t len = sizeof(sockErr);
+    if (ret < 0 || getsockopt(fd, SOL_SOCKET, SO_ERROR, &sockErr, &len) < 0 || sockErr != 0) {
+      emc_log_e("TCP connect failed %d", sockErr != 0 ? sockErr : errno);
+      close(fd);
+      return false;
+    }
+  } else if (ret < 0) {
+    emc_log_e("TCP connect failed %d", errno);
+    close(fd);
+    return false;
+  }
+
+  // the handshake reads with its own timeout
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) & ~O_NONBLOCK);
+  _net.fd = fd;
+  return true;
+}
+
+bool ClientSecureSession::_setup() {
+  if (_setupDone) return true;
+
+  mbedtls_entropy_init(&_entropy);
+  mbedtls_ctr_drbg_init(&_drbg);
+  mbedtls_x509_crt_init(&_caChain);
+  mbedtls_x509_crt_init(&_clientChain);
+  mbedtls_pk_init(&_clientKey);
+  mbedtls_ssl_config_init(&_conf);
+  _setupDone = true;
+
+  int ret = mbedtls_ctr_drbg_seed(&_drbg, mbedtls_entropy_func, &_entropy, nullptr, 0);
+  if (ret == 0) {
+    ret = mbedtls_ssl_config_defaults(&_conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT);
+  }
+  if (ret == 0) {
+    mbedtls_ssl_conf_rng(&_conf, mbedtls_ctr_drbg_random, &_drbg);
+    mbedtls_ssl_conf_read_timeout(&_conf, EMC_TLS_HANDSHAKE_TIMEOUT);
+    #if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&_conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+    #endif
+  }
+
+  if (ret == 0 && _rootCA && !_insecure) {
+    ret = mbedtls_x509_crt_parse(&_caChain, reinterpret_cast<const unsigned char*>(_rootCA), _pemLength(_rootCA));
+    if (ret == 0) {
+      mbedtls_ssl_conf_ca_chain(&_conf, &_caChain, nullptr);
+      mbedtls_ssl_conf_authmode(&_conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+    }
+  } else if (ret == 0) {
+    mbedtls_ssl_conf_authmode(&_conf, _insecure ? MBEDTLS_SSL_VERIFY_NONE : MBEDTLS_SSL_VERIFY_REQUIRED);
+  }
+
+  if (ret == 0 && _clientCert && _privateKey) {
+    ret = mbedtls_x509_crt_parse(&_clientChain, reinterpret_cast<const unsigned char*>(_clientCert), _pemLength(_clientCert));
+    if (ret == 0) {
+      ret = mbedtls_pk_parse_key(&_clientKey, reinterpret_cast<const unsigned char*>(_privateKey), _pemLength(_privateKey),
+                                 nullptr, 0, mbedtls_ctr_drbg_random, &_drbg);
+    }
+    if (ret == 0) {
+      ret = mbedtls_ssl_conf_own_cert(&_conf, &_clientChain, &_clientKey);
+    }
+  }
+
+  #if defined(MBEDTLS_KEY_EXCHANGE_SOME_PSK_ENABLED)
+  if (ret == 0 && _pskIdent && _psKey) {
+    // key is passed as hex string, like the Arduino secure client expects
+    unsigned char psk[MBEDTLS_PSK_MAX_LEN];
+    size_t pskLen = strlen(_psKey) / 2;
+    if (pskLen > sizeof(psk)) {
+      ret = MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+    for (size_t i = 0; ret == 0 && i < pskLen; ++i) {
+      int high = _hexValue(_psKey[2 * i]);
+      int low = _hexValue(_psKey[2 * i + 1]);
+      if (high < 0 || low < 0) {
+        ret = MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+      }
+      psk[i] = (high << 4) | low;
+    }
+    if (ret == 0) {
+      ret = mbedtls_ssl_conf_psk(&_conf, psk, pskLen, reinterpret_cast<const unsigned char*>(_pskIdent), strlen(_pskIdent));
+    }
+  }
+  #endif
+
+  if (ret != 0) {
+    emc_log_e("TLS credentials invalid -0x%04x", -ret);
+    _freeSetup();
+    return false;
+  }
+  return true;
+}
+
+void ClientSecureSession::_freeSetup() {
+  if (!_setupDone) return;
+  // the ssl context references the config
+  stop();
+  mbedtls_ssl_config_free(&_conf);
+  mbedtls_pk_free(&_clientKey);
+  mbedtls_x509_crt_free(&_clientChain);
+  mbedtls_x509_crt_free(&_caChain);
+  mbedtls_ctr_drbg_free(&_drbg);
+  mbedtls_entropy_free(&_entropy);
+  _setupDone = false;
+  // a session negotiated with other credentials is of no use
+  clearSession();
+}
+
+void ClientSecureSession::_saveSession() {
+  mbedtls_ssl_session_free(&_session);
+  mbedtls_ssl_session_init(&_session);
+  _hasSession = mbedtls_ssl_get_session(&_ssl, &_session) == 0;
+}
+
+}  // namespace espMqttClientInternals
+
+#endif
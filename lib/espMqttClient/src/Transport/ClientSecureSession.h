@@ -0,0 +1,95 @@
+/*
+Copyright (c) 2022 Bert Melis. All rights reserved.
+
+This work is licensed under the terms of the MIT license.
+For a copy, see <https://opensource.org/licenses/MIT> or
+the LICENSE file.
+*/
+
+#pragma once
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+#include <IPAddress.h>
+
+#include <mbedtls/ssl.h>
+#include <mbedtls/net_sockets.h>
+#include <mbedtls/x509_crt.h>
+#include <mbedtls/pk.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+
+#include "../Config.h"
+#include "Transport.h"
+
+namespace espMqttClientInternals {
+
+/**
+ * @brief TLS transport that keeps its parsed credentials and TLS session across reconnects
+ *
+ * Certificates and key are parsed on the first connect and reused until they are changed.
+ * After a successful handshake the session is saved and offered on the next connect so the broker
+ * can resume it (session ID or session ticket) instead of doing a full handshake.
+ */
+class ClientSecureSession : public Transport {
+ public:
+  ClientSecureSession();
+  ~ClientSecureSession();
+  bool connect(IPAddress ip, uint16_t port) override;
+  bool connect(const char* host, uint16_t port) override;
+  size_t write(const uint8_t* buf, size_t size) override;
+  int read(uint8_t* buf, size_t size) override;
+  void stop() override;
+  bool connected() override;
+  bool disconnected() override;
+
+  void setInsecure();
+  void setCACert(const char* rootCA);
+  void setCertificate(const char* clientCa);
+  void setPrivateKey(const char* privateKey);
+  void setPreSharedKey(const char* pskIdent, const char* psKey);
+  void clearSession();
+
+  uint32_t handshakeTime() const;  // duration of the last handshake in ms
+  bool sessionResumed() const;  // last handshake resumed a saved session
+  uint32_t handshakes() const;
+  uint32_t resumedHandshakes() const;
+
+ private:
+  bool _connect(const char* host, uint16_t port);
+  bool _tcpConnect(const char* host, uint16_t port);
+  bool _setup();
+  void _freeSetup();
+  void _saveSession();
+
+  const char* _rootCA;
+  const char* _clientCert;
+  const char* _privateKey;
+  const char* _pskIdent;
+  const char* _psKey;
+  bool _insecure;
+
+  bool _setupDone;
+  mbedtls_entropy_context _entropy;
+  mbedtls_ctr_drbg_context _drbg;
+  mbedtls_x509_crt _caChain;
+  mbedtls_x509_crt _clientChain;
+  mbedtls_pk_context _clientKey;
+  mbedtls_ssl_config _conf;
+
+  mbedtls_net_context _net;
+  mbedtls_ssl_context _ssl;
+  bool _connected;
+
+  mbedtls_ssl_session _session;
+  bool _hasSession;
+
+  uint32_t _handshakeTime;
+  bool _resumed;
+  uint32_t _handshakes;
+  uint32_t _resumedHandshakes;
+};
+
+}  // namespace espMqttClientInternals
+
+#endif
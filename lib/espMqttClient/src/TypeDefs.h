@@ -56,6 +56,20 @@ struct MessageProperties {
   uint16_t packetId;
 };
 
+struct PoolStats {
+  size_t nodesUsed = 0;
+  size_t nodesHighWater = 0;
+  size_t nodesCapacity = 0;
+  size_t smallUsed = 0;
+  size_t smallHighWater = 0;
+  size_t smallCapacity = 0;
+  size_t largeUsed = 0;
+  size_t largeHighWater = 0;
+  size_t largeCapacity = 0;
+  uint32_t heapFallbacks = 0;
+  uint32_t rejected = 0;
+};
+
 typedef std::function<void(bool sessionPresent)> OnConnectCallback;
 typedef std::function<void(DisconnectReason reason)> OnDisconnectCallback;
 typedef std::function<void(uint16_t packetId, const SubscribeReturncode* returncodes, size_t len)> OnSubscribeCallback;
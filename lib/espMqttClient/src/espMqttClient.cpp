@@ -83,30 +83,89 @@ espMqttClientSecure::espMqttClientSecure(uint8_t priority, uint8_t core)
 }
 
 espMqttClientSecure& espMqttClientSecure::setInsecure() {
+  #if EMC_TLS_SESSION_RESUMPTION
+  _client.setInsecure();
+  #else
   _client.client.setInsecure();
+  #endif
   return *this;
 }
 
 espMqttClientSecure& espMqttClientSecure::setCACert(const char* rootCA) {
+  #if EMC_TLS_SESSION_RESUMPTION
+  _client.setCACert(rootCA);
+  #else
   _client.client.setCACert(rootCA);
+  #endif
   return *this;
 }
 
 espMqttClientSecure& espMqttClientSecure::setCertificate(const char* clientCa) {
+  #if EMC_TLS_SESSION_RESUMPTION
+  _client.setCertificate(clientCa);
+  #else
   _client.client.setCertificate(clientCa);
+  #endif
   return *this;
 }
 
 espMqttClientSecure& espMqttClientSecure::setPrivateKey(const char* privateKey) {
+  #if EMC_TLS_SESSION_RESUMPTION
+  _client.setPrivateKey(privateKey);
+  #else
   _client.client.setPrivateKey(privateKey);
+  #endif
   return *this;
 }
 
 espMqttClientSecure& espMqttClientSecure::setPreSharedKey(const char* pskIdent, const char* psKey) {
+  #if EMC_TLS_SESSION_RESUMPTION
+  _client.setPreSharedKey(pskIdent, psKey);
+  #else
   _client.client.setPreSharedKey(pskIdent, psKey);
+  #endif
   return *this;
 }
 
+espMqttClientSecure& espMqttClientSecure::clearTlsSession() {
+  #if EMC_TLS_SESSION_RESUMPTION
+  _client.clearSession();
+  #endif
+  return *this;
+}
+
+uint32_t espMqttClientSecure::tlsHandshakeTime() const {
+  #if EMC_TLS_SESSION_RESUMPTION
+  return _client.handshakeTime();
+  #else
+  return 0;
+  #endif
+}
+
+bool espMqttClientSecure::tlsSessionResumed() const {
+  #if EMC_TLS_SESSION_RESUMPTION
+  return _client.sessionResumed();
+  #else
+  return false;
+  #endif
+}
+
+uint32_t espMqttClientSecure::tlsHandshakes() const {
+  #if EMC_TLS_SESSION_RESUMPTION
+  return _client.handshakes();
+  #else
+  return 0;
+  #endif
+}
+
+uint32_t espMqttClientSecure::tlsResumedHandshakes() const {
+  #if EMC_TLS_SESSION_RESUMPTION
+  return _client.resumedHandshakes();
+  #else
+  return 0;
+  #endif
+}
+
 #endif
 
 #if defined(__linux__)
@@ -14,6 +14,7 @@ the LICENSE file.
 #if defined(ARDUINO_ARCH_ESP8266) || defined(ARDUINO_ARCH_ESP32)
 #include "Transport/ClientSync.h"
 #include "Transport/ClientSecureSync.h"
+#include "Transport/ClientSecureSession.h"
 #elif defined(__linux__)
 #include "Transport/ClientPosix.h"
 #endif
@@ -64,9 +65,18 @@ class espMqttClientSecure : public MqttClientSetup<espMqttClientSecure> {
   espMqttClientSecure& setCertificate(const char* clientCa);
   espMqttClientSecure& setPrivateKey(const char* privateKey);
   espMqttClientSecure& setPreSharedKey(const char* pskIdent, const char* psKey);
+  espMqttClientSecure& clearTlsSession();
+  uint32_t tlsHandshakeTime() const;
+  bool tlsSessionResumed() const;
+  uint32_t tlsHandshakes() const;
+  uint32_t tlsResumedHandshakes() const;
 
  protected:
+  #if EMC_TLS_SESSION_RESUMPTION
+  espMqttClientInternals::ClientSecureSession _client;
+  #else
   espMqttClientInternals::ClientSecureSync _client;
+  #endif
 };
 #endif
 
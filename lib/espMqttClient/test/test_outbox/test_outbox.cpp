@@ -3,6 +3,9 @@
 #include <Outbox.h>
 
 using espMqttClientInternals::Outbox;
+#if EMC_USE_MEMPOOL
+using MemoryPool::SizeClassed;
+#endif
 
 void setUp() {}
 void tearDown() {}
@@ -177,6 +180,147 @@ void test_outbox_remove_consecutive() {
   TEST_ASSERT_EQUAL_UINT32(3, outbox.size());
 }
 
+void test_outbox_replace() {
+  Outbox<uint32_t> outbox;
+  outbox.emplace(1);
+  outbox.emplace(2);
+  outbox.emplace(3);
+  outbox.next();
+  // 1 2 3, current points to 2
+
+  Outbox<uint32_t>::Iterator it = outbox.current();
+  TEST_ASSERT_EQUAL_UINT32(2, *(it.get()));
+  Outbox<uint32_t>::Iterator added = outbox.emplace(4);
+  outbox.replace(it, added);
+  // 1 4 3, current points to 4
+  TEST_ASSERT_NULL(added.get());
+  TEST_ASSERT_EQUAL_UINT32(4, *(it.get()));
+  TEST_ASSERT_EQUAL_UINT32(3, outbox.size());
+  TEST_ASSERT_EQUAL_UINT32(4, *(outbox.getCurrent()));
+
+  it = outbox.front();
+  ++it;
+  ++it;
+  added = outbox.emplace(5);
+  outbox.replace(it, added);
+  // 1 4 5, last replaced, new items still go to the back
+  outbox.emplace(6);
+  it = outbox.front();
+  TEST_ASSERT_EQUAL_UINT32(1, *(it.get()));
+  ++it;
+  TEST_ASSERT_EQUAL_UINT32(4, *(it.get()));
+  ++it;
+  TEST_ASSERT_EQUAL_UINT32(5, *(it.get()));
+  ++it;
+  TEST_ASSERT_EQUAL_UINT32(6, *(it.get()));
+
+  outbox.removeCurrent();
+  outbox.next();
+  outbox.removeCurrent();
+  // 1 5, current points to nullptr after removing 6
+  TEST_ASSERT_NULL(outbox.getCurrent());
+  it = outbox.front();
+  added = outbox.emplace(7);
+  outbox.replace(it, added);
+  // 7 5, current points to nullptr
+  TEST_ASSERT_EQUAL_UINT32(7, *(outbox.front().get()));
+  TEST_ASSERT_EQUAL_UINT32(2, outbox.size());
+}
+
+#if EMC_USE_MEMPOOL
+void test_outbox_pool_highwater() {
+  Outbox<uint32_t> outbox;
+  espMqttClientTypes::PoolStats stats;
+  outbox.addPoolStats(stats);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.nodesUsed);
+  TEST_ASSERT_EQUAL_UINT32(EMC_NUM_POOL_ELEMENTS, stats.nodesCapacity);
+
+  for (uint32_t i = 1; i <= 5; i++) {
+    outbox.emplace(i);
+  }
+  outbox.removeCurrent();
+  outbox.removeCurrent();
+
+  stats = espMqttClientTypes::PoolStats();
+  outbox.addPoolStats(stats);
+  TEST_ASSERT_EQUAL_UINT32(3, stats.nodesUsed);
+  TEST_ASSERT_EQUAL_UINT32(5, stats.nodesHighWater);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.heapFallbacks);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.rejected);
+}
+
+void test_outbox_pool_exhausted() {
+  Outbox<uint32_t> outbox;
+  const uint32_t extra = 3;
+
+  for (uint32_t i = 0; i < EMC_NUM_POOL_ELEMENTS + extra; i++) {
+    TEST_ASSERT_TRUE(static_cast<bool>(outbox.emplace(i)));
+  }
+  TEST_ASSERT_EQUAL_UINT32(EMC_NUM_POOL_ELEMENTS + extra, outbox.size());
+
+  espMqttClientTypes::PoolStats stats;
+  outbox.addPoolStats(stats);
+  TEST_ASSERT_EQUAL_UINT32(EMC_NUM_POOL_ELEMENTS, stats.nodesUsed);
+  TEST_ASSERT_EQUAL_UINT32(EMC_NUM_POOL_ELEMENTS, stats.nodesHighWater);
+  #if EMC_POOL_HEAP_FALLBACK
+  TEST_ASSERT_EQUAL_UINT32(extra, stats.heapFallbacks);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.rejected);
+  #endif
+
+  // remove pooled and heap nodes alike, pool slots become available again
+  Outbox<uint32_t>::Iterator it = outbox.front();
+  while (it) {
+    outbox.remove(it);
+  }
+  TEST_ASSERT_TRUE(outbox.empty());
+  stats = espMqttClientTypes::PoolStats();
+  outbox.addPoolStats(stats);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.nodesUsed);
+
+  outbox.emplace(1);
+  outbox.emplaceFront(2);
+  TEST_ASSERT_EQUAL_UINT32(2, *(outbox.getCurrent()));
+  // Valgrind should not detect a leak when the outbox goes out of scope
+}
+
+void test_sizeclassed_pool() {
+  SizeClassed<2, 16, 1, 64> pool;
+
+  void* small1 = pool.malloc(8);
+  void* small2 = pool.malloc(16);
+  TEST_ASSERT_NOT_NULL(small1);
+  TEST_ASSERT_NOT_NULL(small2);
+  TEST_ASSERT_EQUAL_UINT32(2, pool.small().usedBlocks());
+
+  // small class exhausted: spill into the large class
+  void* spilled = pool.malloc(4);
+  TEST_ASSERT_NOT_NULL(spilled);
+  TEST_ASSERT_EQUAL_UINT32(1, pool.large().usedBlocks());
+
+  // everything exhausted, oversized never served
+  TEST_ASSERT_NULL(pool.malloc(4));
+  TEST_ASSERT_NULL(pool.malloc(65));
+  TEST_ASSERT_NULL(pool.malloc(0));
+
+  TEST_ASSERT_TRUE(pool.owns(small1));
+  TEST_ASSERT_TRUE(pool.owns(spilled));
+  int onStack = 0;
+  TEST_ASSERT_FALSE(pool.owns(&onStack));
+
+  pool.free(spilled);
+  pool.free(small1);
+  TEST_ASSERT_EQUAL_UINT32(0, pool.large().usedBlocks());
+  TEST_ASSERT_EQUAL_UINT32(1, pool.small().usedBlocks());
+  TEST_ASSERT_EQUAL_UINT32(2, pool.small().highWater());
+  TEST_ASSERT_EQUAL_UINT32(1, pool.large().highWater());
+
+  void* large = pool.malloc(40);
+  TEST_ASSERT_NOT_NULL(large);
+  TEST_ASSERT_EQUAL_UINT32(1, pool.large().usedBlocks());
+  pool.free(large);
+  pool.free(small2);
+}
+#endif
 
 int main() {
   UNITY_BEGIN();
@@ -187,5 +331,11 @@ int main() {
   RUN_TEST(test_outbox_remove2);
   RUN_TEST(test_outbox_removeCurrent);
   RUN_TEST(test_outbox_remove_consecutive);
+  RUN_TEST(test_outbox_replace);
+  #if EMC_USE_MEMPOOL
+  RUN_TEST(test_outbox_pool_highwater);
+  RUN_TEST(test_outbox_pool_exhausted);
+  RUN_TEST(test_sizeclassed_pool);
+  #endif
   return UNITY_END();
 }
@@ -259,8 +259,16 @@ void test_encodePublish1() {
     0x01,0x02,0x03,0x04         // payload
   };
 
+  TEST_ASSERT_EQUAL_UINT8(qos, packet.qos());
+  TEST_ASSERT_TRUE(packet.retained());
+  TEST_ASSERT_FALSE(packet.dup());
+  TEST_ASSERT_TRUE(packet.hasTopic("top"));
+  TEST_ASSERT_FALSE(packet.hasTopic("to"));
+  TEST_ASSERT_FALSE(packet.hasTopic("tops"));
+
   packet.setDup();
   TEST_ASSERT_EQUAL_UINT8_ARRAY(checkDup, packet.data(0), length);
+  TEST_ASSERT_TRUE(packet.dup());
 }
 
 void test_encodePublish2() {
@@ -0,0 +1,201 @@
+import argparse, glob, os, re, shlex
+
+# Compiles the settings page templates in resources/pages into a C header. Static
+# HTML becomes fragments in flash, everything read from the preferences becomes a
+# slot (see src/util/WebPageTemplate.h), so a page render is a handful of large
+# writes instead of one print per attribute.
+#
+# Template lines are stripped and joined without separator. Directives:
+#   {{checkbox TOKEN "Label" bool=KEY|value=true|false [default=EXPR] [class=CLASS]}}
+#   {{input TOKEN "Label" string=KEY|int=KEY|value="TEXT" maxlength=N [default=EXPR] [attrs='...'] [password] [showlength]}}
+#   {{string KEY}} {{int KEY}} {{hex KEY}} {{checked KEY}} {{enabled KEY}}   (all take [default=EXPR])
+#   {{if bool=KEY [default=EXPR] [not]}} / {{if condition=NAME}} ... [{{else}}] ... {{endif}}
+#   {{! comment}}
+
+parser = argparse.ArgumentParser(description="Compile settings page templates to fragments and slots")
+parser.add_argument("directory", help="directory holding the *.html page templates")
+parser.add_argument("-O", "--output", required=True, help="header file to write")
+args = parser.parse_args()
+
+directive = re.compile(r"\{\{(.*?)\}\}")
+
+
+class Page:
+    def __init__(self, name):
+        self.name = name
+        self.ops = []
+        self.text = ""
+        self.blocks = []
+
+    def fail(self, message):
+        raise SystemExit(self.name + ": " + message)
+
+    def static(self, text):
+        self.text += text
+
+    def flush(self):
+        if self.text:
+            self.ops.append(["Fragment", 0, str(len(self.text.encode("utf-8"))), self.text, None])
+            self.text = ""
+
+    def op(self, type, value="0", data=None, fallback=None):
+        self.flush()
+        self.ops.append([type, 0, value, data, fallback])
+        return len(self.ops) - 1
+
+    def slot(self, type, key, options):
+        if type == "String" or type == "ValueAttribute":
+            default = options.get("default")
+            self.op(type, "0", key, None if default is None else cstring(default))
+        else:
+            self.op(type, options.get("default", "0"), key)
+
+    def begin(self, options):
+        if "condition" in options:
+            index = self.op("IfCondition", "(int32_t)WebPageCondition::" + options["condition"])
+        elif "bool" in options:
+            index = self.op("IfNotBool" if "not" in options else "IfBool", options.get("default", "false"), options["bool"])
+        else:
+            self.fail("if needs bool= or condition=")
+        self.blocks.append([index, None])
+
+    def otherwise(self):
+        if not self.blocks or self.blocks[-1][1] is not None:
+            self.fail("else without if")
+        self.blocks[-1][1] = self.op("Jump")
+        self.ops[self.blocks[-1][0]][1] = len(self.ops)
+
+    def end(self):
+        if not self.blocks:
+            self.fail("endif without if")
+        self.flush()
+        start, jump = self.blocks.pop()
+        self.ops[jump if jump is not None else start][1] = len(self.ops)
+
+
+def cstring(text):
+    return "\"" + text.replace("\\", "\\\\").replace("\"", "\\\"") + "\""
+
+
+def cliteral(text, width=120):
+    escaped = re.findall(r'\\.|[^\\]', text.replace("\\", "\\\\").replace("\"", "\\\""))
+    parts = []
+    part = ""
+    for char in escaped:
+        part += char
+        if len(part) >= width:
+            parts.append(part)
+            part = ""
+    if part or not parts:
+        parts.append(part)
+    return "\n        ".join("\"" + part + "\"" for part in parts)
+
+
+def parse(words):
+    positional = []
+    options = {}
+    for word in words:
+        if re.match(r"^[a-z]+=", word):
+            key, value = word.split("=", 1)
+            options[key] = value
+        elif word in ("password", "showlength", "not"):
+            options[word] = True
+        else:
+            positional.append(word)
+    return positional, options
+
+
+def checkbox(page, positional, options):
+    if len(positional) != 2:
+        page.fail("checkbox needs TOKEN and label")
+    token, label = positional
+    page.static("<tr><td>" + label + "</td><td>")
+    page.static("<input type=hidden name=\"" + token + "\" value=\"0\"/>")
+    page.static("<input type=checkbox name=\"" + token + "\" class=\"" + options.get("class", "") + "\" value=\"1\"")
+    if "bool" in options:
+        page.slot("Checked", options["bool"], options)
+    elif options.get("value") == "true":
+        page.static(" checked=\"checked\"")
+    page.static("/></td></tr>")
+
+
+def input(page, positional, options):
+    if len(positional) != 2 or "maxlength" not in options:
+        page.fail("input needs TOKEN, label and maxlength=")
+    token, label = positional
+    page.static("<tr><td>" + label)
+    if "showlength" in options:
+        page.static(" (Max. " + options["maxlength"] + " characters)")
+    page.static("</td><td><input type=" + ("\"password\"" if "password" in options else "\"text\""))
+    if options.get("attrs"):
+        page.static(" " + options["attrs"])
+    if "string" in options:
+        page.slot("ValueAttribute", options["string"], options)
+    elif "int" in options:
+        page.static(" value=\"")
+        page.slot("Int", options["int"], options)
+    elif options.get("value"):
+        page.static(" value=\"" + options["value"])
+    page.static("\" name=\"" + token + "\" size=\"25\" maxlength=\"" + options["maxlength"] + "\"/></td></tr>")
+
+
+slots = { "string": "String", "int": "Int", "hex": "HexUInt", "checked": "Checked", "enabled": "EnabledText" }
+
+
+def compile(name, source):
+    page = Page(name)
+    text = "".join(line.strip() for line in source.splitlines())
+    pos = 0
+    for match in directive.finditer(text):
+        page.static(text[pos:match.start()])
+        pos = match.end()
+        words = shlex.split(match.group(1))
+        if not words or words[0].startswith("!"):
+            continue
+        positional, options = parse(words[1:])
+        if words[0] == "checkbox":
+            checkbox(page, positional, options)
+        elif words[0] == "input":
+            input(page, positional, options)
+        elif words[0] in slots and len(positional) == 1:
+            page.slot(slots[words[0]], positional[0], options)
+        elif words[0] == "if":
+            page.begin(options)
+        elif words[0] == "else":
+            page.otherwise()
+        elif words[0] == "endif":
+            page.end()
+        else:
+            page.fail("unknown directive {{" + match.group(1) + "}}")
+    page.static(text[pos:])
+    page.flush()
+    if page.blocks:
+        page.fail("missing endif")
+    return page
+
+
+content = "#pragma once\n\n"
+content += "// generated from resources/pages by compile_pages.py, do not edit\n\n"
+content += "#include \"../Config.h\"\n#include \"../PreferencesKeys.h\"\n#include \"../util/WebPageTemplate.h\"\n"
+
+for filename in sorted(glob.glob(os.path.join(args.directory, "*.html"))):
+    name = os.path.splitext(os.path.basename(filename))[0]
+    with open(filename, "r", encoding="utf-8") as file:
+        page = compile(name, file.read())
+
+    content += "\nconst WebPageOp " + name + "_page_ops[] =\n{\n"
+    for type, next, value, data, fallback in page.ops:
+        if type == "Fragment":
+            data = cliteral(data)
+        content += "    { WebPageOpType::" + type + ", " + str(next) + ", " + value + ", " + (data or "nullptr") + ", " + (fallback or "nullptr") + " },\n"
+    content += "};\n"
+    content += "const WebPageTemplate " + name + "_page = { " + name + "_page_ops, sizeof(" + name + "_page_ops) / sizeof(WebPageOp) };\n"
+
+if os.path.exists(args.output):
+    with open(args.output, "r") as file:
+        if file.read() == content:
+            exit(0)
+
+os.makedirs(os.path.dirname(args.output) or ".", exist_ok=True)
+with open(args.output, "w") as file:
+    file.write(content)
@@ -0,0 +1,41 @@
+import argparse, gzip, hashlib, os
+
+# Compresses a static web asset and writes it as a C header holding the gzip
+# stream and a strong ETag derived from its content. Assets that do not get
+# smaller (e.g. PNG) are stored as they are. Output is deterministic (no
+# timestamp in the gzip header), so unchanged assets keep their ETag.
+
+parser = argparse.ArgumentParser(description="Convert a web asset to a gzip compressed C array with ETag")
+parser.add_argument("filename", help="the file to be converted")
+parser.add_argument("-O", "--output", required=True, help="header file to write")
+parser.add_argument("-N", "--name", required=True, help="name of the generated array")
+parser.add_argument("-l", "--linebreak", type=int, default=16, help="add linebreak after every N element")
+args = parser.parse_args()
+
+with open(args.filename, "rb") as file:
+    data = file.read()
+
+compressed = gzip.compress(data, compresslevel=9, mtime=0)
+gzipped = len(compressed) < len(data)
+if not gzipped:
+    compressed = data
+etag = hashlib.sha256(compressed).hexdigest()[:16]
+
+lines = []
+for i in range(0, len(compressed), args.linebreak):
+    lines.append(", ".join("0x{:02x}".format(b) for b in compressed[i:i + args.linebreak]))
+
+content = "#pragma once\n\n"
+content += "// " + os.path.basename(args.filename) + ", converted by compress_assets.py (" + str(len(data)) + " -> " + str(len(compressed)) + " bytes)\n"
+content += "const bool " + args.name + "_gzip = " + ("true" if gzipped else "false") + ";\n"
+content += "const char " + args.name + "_etag[] = \"\\\"" + etag + "\\\"\";\n"
+content += "const uint8_t " + args.name + "[] =\n{\n" + ",\n".join(lines) + "\n};\n"
+
+if os.path.exists(args.output):
+    with open(args.output, "r") as file:
+        if file.read() == content:
+            exit(0)
+
+os.makedirs(os.path.dirname(args.output) or ".", exist_ok=True)
+with open(args.output, "w") as file:
+    file.write(content)
@@ -0,0 +1,162 @@
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(__file__), "..", "..")
+
+ENTRY_PATTERN = re.compile(r'\{\s*(preference_\w+),\s*PreferenceType::(\w+),\s*PreferenceApply::(\w+),\s*[\w| ]+,\s*(-?\w+),\s*"((?:[^"\\]|\\.)*)"\s*\}')
+GET_PATTERN = re.compile(r'\bget(Bool|Int|UInt|ULong64|String)\(\s*(preference_\w+)\s*,\s*([^;]*?)\)\s*(?:[;)!=<>.|&?:,]|$)')
+PUT_PATTERN = re.compile(r'\bput(Bool|Int|UInt|ULong64|String)\(\s*(preference_\w+)\s*,\s*(.*?)\);')
+TEMPLATE_PATTERN = re.compile(r'\b(?:bool|int|string|hex|checked|enabled)=(preference_\w+)((?:\s+\w+(?:=(?:"(?:[^"\\]|\\.)*"|[^\s}]*))?)*)')
+TEMPLATE_DEFAULT_PATTERN = re.compile(r'\bdefault=("(?:[^"\\]|\\.)*"|[^\s}]*)')
+DEFINE_PATTERN = re.compile(r'^\s*#define\s+(\w+)\s+(-?\d+)\s*$')
+SOURCE_DIRS = ["src"]
+TEMPLATE_DIR = os.path.join("resources", "pages")
+SKIP_FILES = ["PreferencesRegistry.h"]
+
+# reads that use a different default than the firmware when nothing was saved. They are kept as they are,
+# changing them would change the behaviour of devices without a saved value.
+KNOWN_DIFFERENCES = {
+    # mDNS falls back to "nukihub", the network name to NH<id>
+    "preference_hostname": ["nukihub"],
+    # the web page and the save handler assume 9, the lock and opener run at 0
+    "preference_ble_tx_power": [9],
+    # the custom ethernet form and save handlers, NetworkDeviceInstantiator and Gpio use -1
+    "preference_network_custom_addr": [0, 1],
+    "preference_network_custom_irq": [0],
+    "preference_network_custom_rst": [0],
+    "preference_network_custom_cs": [0],
+    "preference_network_custom_sck": [0],
+    "preference_network_custom_miso": [0],
+    "preference_network_custom_mosi": [0],
+    "preference_network_custom_pwr": [0, 12],
+    "preference_network_custom_mdio": [0],
+    "preference_network_custom_mdc": [0],
+}
+
+def differs(key, expected, actual):
+    return actual is not None and expected is not None and actual != expected and actual not in KNOWN_DIFFERENCES.get(key, [])
+
+def load_defines(path):
+    defines = {}
+    with open(path, "r") as file:
+        for line in file:
+            match = DEFINE_PATTERN.match(line)
+            if match:
+                defines[match.group(1)] = int(match.group(2))
+    return defines
+
+def load_registry(path, defines):
+    registry = {}
+    with open(path, "r") as file:
+        for line in file:
+            match = ENTRY_PATTERN.search(line)
+            if not match:
+                continue
+            key, type, apply, value, string = match.groups()
+            if type == "Bytes":
+                continue
+            registry[key] = (type, apply, string if type == "String" else parse_number(value, defines))
+    return registry
+
+# keys written on first start in initPreferences() always exist, the default passed to get*() never applies
+def load_first_start(path):
+    values = {}
+    inside = False
+    with open(path, "r") as file:
+        for line in file:
+            if "if(firstStart)" in line:
+                inside = True
+            elif inside and re.match(r'^\s*else\s*$', line):
+                break
+            elif inside:
+                match = PUT_PATTERN.search(line)
+                if match:
+                    values[match.group(2)] = match.group(3)
+    return values
+
+def parse_number(value, defines):
+    value = value.strip()
+    if value in ("true", "false"):
+        return 1 if value == "true" else 0
+    if value in defines:
+        return defines[value]
+    if re.match(r'^\(int\)', value):
+        return None
+    try:
+        return int(value, 0)
+    except ValueError:
+        return None
+
+def parse_default(type, value, defines):
+    value = value.strip()
+    if type == "String":
+        match = re.match(r'^"((?:[^"\\]|\\.)*)"$', value)
+        return match.group(1) if match else None
+    return parse_number(value, defines)
+
+def scan(registry, defines, firstStart):
+    mismatches = []
+    for key, value in firstStart.items():
+        if key not in registry or registry[key][1] == "Internal":
+            continue
+        type, apply, expected = registry[key]
+        actual = parse_default(type, value, defines)
+        if differs(key, expected, actual):
+            mismatches.append(("src/PreferencesKeys.h", 0, key, expected, actual))
+
+    for directory in SOURCE_DIRS:
+        for dirpath, dirnames, filenames in os.walk(os.path.join(ROOT, directory)):
+            for filename in sorted(filenames):
+                if not filename.endswith((".cpp", ".h")) or filename in SKIP_FILES:
+                    continue
+                path = os.path.join(dirpath, filename)
+                with open(path, "r", errors="replace") as file:
+                    for number, line in enumerate(file, 1):
+                        for match in GET_PATTERN.finditer(line):
+                            accessor, key, value = match.groups()
+                            if key not in registry or key in firstStart:
+                                continue
+                            type, apply, expected = registry[key]
+                            actual = parse_default(type, value, defines)
+                            # non-literal defaults (expressions, enum casts) are not checked
+                            if differs(key, expected, actual):
+                                mismatches.append((os.path.relpath(path, ROOT), number, key, expected, actual))
+    templates = os.path.join(ROOT, TEMPLATE_DIR)
+    for filename in sorted(os.listdir(templates)):
+        path = os.path.join(templates, filename)
+        with open(path, "r") as file:
+            for number, line in enumerate(file, 1):
+                for match in TEMPLATE_PATTERN.finditer(line):
+                    key, options = match.groups()
+                    default = TEMPLATE_DEFAULT_PATTERN.search(options)
+                    if default is None or key not in registry or key in firstStart:
+                        continue
+                    type, apply, expected = registry[key]
+                    actual = parse_default(type, default.group(1), defines)
+                    if differs(key, expected, actual):
+                        mismatches.append((os.path.relpath(path, ROOT), number, key, expected, actual))
+
+    return mismatches
+
+def main():
+    parser = argparse.ArgumentParser(description="Checks that the defaults in src/PreferencesRegistry.h match the defaults passed to Preferences::get*() in src and used by the page templates")
+    parser.parse_args()
+
+    defines = load_defines(os.path.join(ROOT, "src", "Config.h"))
+    registry = load_registry(os.path.join(ROOT, "src", "PreferencesRegistry.h"), defines)
+    firstStart = load_first_start(os.path.join(ROOT, "src", "PreferencesKeys.h"))
+    mismatches = scan(registry, defines, firstStart)
+
+    for path, number, key, expected, actual in mismatches:
+        if number == 0:
+            print("%s: %s set to %r on first start, registry has %r" % (path, key, actual, expected))
+        else:
+            print("%s:%d: %s read with default %r, registry has %r" % (path, number, key, actual, expected))
+
+    print("%d registry entries, %d mismatches" % (len(registry), len(mismatches)))
+    return 1 if mismatches else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
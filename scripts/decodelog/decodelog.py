@@ -0,0 +1,109 @@
+import argparse
+import os
+import re
+import struct
+import sys
+
+EVENTS_HEADER = os.path.join(os.path.dirname(__file__), "..", "..", "src", "LogEvents.h")
+
+EVENT_PATTERN = re.compile(r'^\s*X\((\w+),\s*"((?:[^"\\]|\\.)*)"\)')
+SPEC_PATTERN = re.compile(r'%([-+ #0-9.]*)(hh|h|ll|l|L|q|j|z|t)?([diouxXeEfFgGaAcs%])')
+
+def load_formats(path):
+    formats = []
+    with open(path, "r") as file:
+        for line in file:
+            match = EVENT_PATTERN.match(line)
+            if match:
+                formats.append((match.group(1), bytes(match.group(2), "utf-8").decode("unicode_escape")))
+    return formats
+
+def read_args(data):
+    args = []
+    pos = 0
+    while pos < len(data):
+        tag = chr(data[pos])
+        pos += 1
+        if tag == 'i':
+            args.append(struct.unpack_from("<i", data, pos)[0])
+            pos += 4
+        elif tag == 'u':
+            args.append(struct.unpack_from("<I", data, pos)[0])
+            pos += 4
+        elif tag == 'q':
+            args.append(struct.unpack_from("<q", data, pos)[0])
+            pos += 8
+        elif tag == 'Q':
+            args.append(struct.unpack_from("<Q", data, pos)[0])
+            pos += 8
+        elif tag == 'd':
+            args.append(struct.unpack_from("<d", data, pos)[0])
+            pos += 8
+        elif tag == 's':
+            length = data[pos]
+            args.append(data[pos + 1:pos + 1 + length].decode("utf-8", "replace"))
+            pos += 1 + length
+        else:
+            raise ValueError(f"unknown argument type {tag!r}")
+    return args
+
+def format_event(fmt, args):
+    remaining = list(args)
+
+    def replace(match):
+        flags, _, conversion = match.groups()
+        if conversion == '%':
+            return '%'
+        if not remaining:
+            return '?'
+        value = remaining.pop(0)
+        if isinstance(value, str):
+            conversion = 's'
+        elif conversion in "diouxXc" and isinstance(value, float):
+            conversion = 'g'
+        elif conversion in "eEfFgGaA" and not isinstance(value, float):
+            conversion = 'd'
+        elif conversion == 's':
+            conversion = 'g' if isinstance(value, float) else 'd'
+        return ("%" + flags + conversion) % value
+
+    return SPEC_PATTERN.sub(replace, fmt)
+
+def decode(data, formats):
+    pos = 0
+    while pos + 2 <= len(data):
+        length = struct.unpack_from("<H", data, pos)[0]
+        record = data[pos + 2:pos + 2 + length]
+        pos += 2 + length
+        if len(record) < 2:
+            break
+
+        event_id = struct.unpack_from("<H", record, 0)[0]
+        if event_id >= len(formats):
+            yield f"Unknown log event {event_id}"
+            continue
+
+        name, fmt = formats[event_id]
+        try:
+            yield format_event(fmt, read_args(record[2:]))
+        except (ValueError, struct.error) as error:
+            yield f"{name}: undecodable record ({error})"
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode binary Nuki Hub log events")
+    parser.add_argument("file", nargs="?", help="dump of the maintenance/logBinary payloads, stdin if omitted")
+    parser.add_argument("--events", default=EVENTS_HEADER, help="path to src/LogEvents.h of the firmware that produced the dump")
+    args = parser.parse_args()
+
+    formats = load_formats(args.events)
+    if args.file:
+        with open(args.file, "rb") as file:
+            data = file.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    for line in decode(data, formats):
+        print(line)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,106 @@
+// host stand-in for the parts of the Arduino core used by HomeAssistantDiscovery
+#pragma once
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+class String
+{
+public:
+    String() = default;
+    String(const char* value) : _value(value != nullptr ? value : "") {}
+    String(const std::string& value) : _value(value) {}
+    String(char value) : _value(1, value) {}
+    String(int value) : _value(std::to_string(value)) {}
+    String(unsigned int value) : _value(std::to_string(value)) {}
+    String(long value) : _value(std::to_string(value)) {}
+    String(unsigned long value) : _value(std::to_string(value)) {}
+
+    const char* c_str() const { return _value.c_str(); }
+    unsigned int length() const { return _value.length(); }
+    const char* begin() const { return _value.data(); }
+    const char* end() const { return _value.data() + _value.length(); }
+    bool reserve(unsigned int size) { _value.reserve(size); return true; }
+
+    bool concat(const String& value) { _value += value._value; return true; }
+    bool concat(const char* value) { _value += value; return true; }
+    bool concat(const char* value, unsigned int length) { _value.append(value, length); return true; }
+    bool concat(char value) { _value += value; return true; }
+    bool concat(int value) { _value += std::to_string(value); return true; }
+    bool concat(unsigned int value) { _value += std::to_string(value); return true; }
+
+    String& operator+=(const String& value) { concat(value); return *this; }
+    String& operator+=(const char* value) { concat(value); return *this; }
+    String& operator+=(char value) { concat(value); return *this; }
+
+    void toCharArray(char* buffer, unsigned int size) const
+    {
+        snprintf(buffer, size, "%s", _value.c_str());
+    }
+
+    bool operator==(const String& other) const { return _value == other._value; }
+    bool operator!=(const String& other) const { return _value != other._value; }
+    bool operator==(const char* other) const { return _value == other; }
+    bool operator!=(const char* other) const { return _value != other; }
+    bool operator<(const String& other) const { return _value < other._value; }
+
+    friend String operator+(const String& a, const String& b) { return String(a._value + b._value); }
+    friend String operator+(const String& a, const char* b) { return String(a._value + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b._value); }
+
+private:
+    std::string _value;
+};
+
+typedef uint8_t byte;
+
+inline char* itoa(int value, char* str, int base)
+{
+    sprintf(str, base == 16 ? "%x" : "%d", value);
+    return str;
+}
+
+inline char* utoa(unsigned int value, char* str, int base)
+{
+    sprintf(str, base == 16 ? "%x" : "%u", value);
+    return str;
+}
+
+typedef enum
+{
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO,
+} esp_reset_reason_t;
+
+inline esp_reset_reason_t esp_reset_reason()
+{
+    return ESP_RST_POWERON;
+}
+
+struct HostSerial
+{
+    template<typename T>
+    size_t println(const T&) { return 0; }
+};
+
+static HostSerial Serial;
+
+struct HostEsp
+{
+    void restart() {}
+};
+
+static HostEsp ESP;
@@ -0,0 +1,14 @@
+// host stand-in for the file system used by initPreferences(), nothing is written
+#pragma once
+
+#include "Arduino.h"
+
+#define FILE_WRITE "w"
+
+class File
+{
+public:
+    explicit operator bool() const { return false; }
+    size_t print(const char*) { return 0; }
+    void close() {}
+};
@@ -0,0 +1,8 @@
+// host stand-in, the logger is not used
+#pragma once
+
+#include "Print.h"
+
+class MqttLogger : public Print
+{
+};
@@ -0,0 +1,51 @@
+// host stand-in for the Arduino Preferences, kept in memory
+#pragma once
+
+#include <map>
+#include <string>
+#include "Arduino.h"
+
+class IPAddress
+{
+};
+
+class Preferences
+{
+public:
+    bool begin(const char*, bool = false) { return true; }
+    void end() {}
+    bool clear() { _values.clear(); return true; }
+    bool remove(const char* key) { return _values.erase(key) > 0; }
+    bool isKey(const char* key) { return _values.count(key) > 0; }
+
+    bool getBool(const char* key, bool defaultValue = false) { return isKey(key) ? std::stoll(_values[key]) != 0 : defaultValue; }
+    int32_t getInt(const char* key, int32_t defaultValue = 0) { return isKey(key) ? std::stoll(_values[key]) : defaultValue; }
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0) { return isKey(key) ? std::stoull(_values[key]) : defaultValue; }
+    uint64_t getULong64(const char* key, uint64_t defaultValue = 0) { return isKey(key) ? std::stoull(_values[key]) : defaultValue; }
+    String getString(const char* key, const String& defaultValue = String()) { return isKey(key) ? String(_values[key]) : defaultValue; }
+    size_t getString(const char* key, char* value, size_t maxLength)
+    {
+        snprintf(value, maxLength, "%s", isKey(key) ? _values[key].c_str() : "");
+        return strlen(value);
+    }
+    size_t getBytes(const char* key, void* buffer, size_t length)
+    {
+        if(!isKey(key))
+        {
+            return 0;
+        }
+        size_t size = std::min(length, _values[key].size());
+        memcpy(buffer, _values[key].data(), size);
+        return size;
+    }
+
+    size_t putBool(const char* key, bool value) { _values[key] = std::to_string(value ? 1 : 0); return 1; }
+    size_t putInt(const char* key, int32_t value) { _values[key] = std::to_string(value); return 4; }
+    size_t putUInt(const char* key, uint32_t value) { _values[key] = std::to_string(value); return 4; }
+    size_t putULong64(const char* key, uint64_t value) { _values[key] = std::to_string(value); return 8; }
+    size_t putString(const char* key, const String& value) { _values[key] = value.c_str(); return value.length(); }
+    size_t putBytes(const char* key, const void* value, size_t length) { _values[key] = std::string((const char*)value, length); return length; }
+
+private:
+    std::map<std::string, std::string> _values;
+};
@@ -0,0 +1,16 @@
+// host stand-in for the Arduino Print class, discards everything
+#pragma once
+
+#include <cstdarg>
+#include "Arduino.h"
+
+class Print
+{
+public:
+    template<typename T>
+    size_t print(const T&) { return 0; }
+    template<typename T>
+    size_t println(const T&) { return 0; }
+    size_t println() { return 0; }
+    size_t printf(const char*, ...) { return 0; }
+};
@@ -0,0 +1,12 @@
+// host stand-in, there is no flash file system on the host
+#pragma once
+
+#include "FS.h"
+
+struct HostSpiffs
+{
+    bool begin(bool = false) { return false; }
+    File open(const char*, const char* = "r") { return File(); }
+};
+
+static HostSpiffs SPIFFS;
@@ -0,0 +1,10 @@
+// host stand-in for the WiFi calls of initPreferences()
+#pragma once
+
+struct HostWiFi
+{
+    void begin() {}
+    bool disconnect(bool = false, bool = false) { return true; }
+};
+
+static HostWiFi WiFi;
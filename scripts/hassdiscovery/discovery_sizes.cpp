@@ -0,0 +1,230 @@
+/*
+  Host measurement: size of the Home Assistant discovery burst and the
+  espMqttClient packet pool it needs.
+
+  Runs the real HomeAssistantDiscovery::setupHASS() for Nuki Hub, a lock and an
+  opener with every optional entity enabled and records each publish. The
+  MQTT packet size is computed like Packet::_allocate() does for a QoS 1
+  publish. The packets are then replayed through the real
+  MemoryPool::SizeClassed with the configured pool sizes. A packet stays in the
+  outbox until it is acknowledged; the broker is modelled to acknowledge a
+  packet after the given number of later publishes, "never" keeps the whole
+  burst in the outbox.
+
+  g++ -std=gnu++17 -O2 -I. -I../../src -I../../lib/ArduinoJson/src -I../../lib/espMqttClient/src \
+      -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -DARDUINOJSON_ENABLE_ARDUINO_STREAM=0 -DARDUINOJSON_ENABLE_ARDUINO_PRINT=0 -DARDUINOJSON_ENABLE_PROGMEM=0 \
+      discovery_sizes.cpp ../../src/HomeAssistantDiscovery.cpp ../../src/ConfigSnapshot.cpp ../../src/util/ScratchArena.cpp -o discovery_sizes && ./discovery_sizes
+*/
+
+#include <algorithm>
+#include <deque>
+#include <stdio.h>
+#include <vector>
+#include "esp_mac.h"
+#include "HomeAssistantDiscovery.h"
+#include "PreferencesKeys.h"
+#include "util/TaskScheduler.h"
+#include "MemoryPool/src/SizeClassed.h"
+
+#define EMC_TX_BUFFER_SIZE 1440
+#define EMC_NUM_POOL_ELEMENTS 32
+#define EMC_SIZE_POOL_ELEMENTS 128
+
+Print* Log = new Print();
+
+static std::vector<size_t> packetSizes;
+
+static size_t remainingLengthLength(size_t remainingLength)
+{
+    return remainingLength < 128 ? 1 : remainingLength < 16384 ? 2 : remainingLength < 2097152 ? 3 : 4;
+}
+
+bool TaskScheduler::isCurrentTask(const SchedulerTask& task)
+{
+    return false;
+}
+
+class RecordingDevice : public NetworkDevice
+{
+public:
+    explicit RecordingDevice(Preferences* preferences)
+        : NetworkDevice("nukihub", preferences, nullptr)
+    {
+    }
+
+    const String deviceName() const override { return "host"; }
+    void initialize() override {}
+    void reconfigure() override {}
+    void scan(bool passive, bool async) override {}
+    bool isConnected() override { return true; }
+    bool isApOpen() override { return false; }
+    int8_t signalStrength() override { return -60; }
+    String localIP() override { return "192.168.1.10"; }
+    String BSSIDstr() override { return ""; }
+};
+
+void NetworkDevice::update() {}
+bool NetworkDevice::isEncrypted() { return false; }
+bool NetworkDevice::mqttConnect() { return true; }
+bool NetworkDevice::mqttDisconnect(bool force) { return true; }
+void NetworkDevice::mqttDisable() {}
+void NetworkDevice::mqttRestart() {}
+bool NetworkDevice::mqttConnected() const { return true; }
+espMqttClientTypes::PoolStats NetworkDevice::mqttPoolStats() { return {}; }
+uint32_t NetworkDevice::mqttCoalescedPublishes() { return 0; }
+uint32_t NetworkDevice::mqttTlsHandshakeTime() { return 0; }
+bool NetworkDevice::mqttTlsSessionResumed() { return false; }
+uint32_t NetworkDevice::mqttTlsHandshakes() { return 0; }
+uint32_t NetworkDevice::mqttTlsResumedHandshakes() { return 0; }
+uint16_t NetworkDevice::mqttSubscribe(const char* topic, uint8_t qos) { return 1; }
+void NetworkDevice::mqttSetServer(const char* host, uint16_t port) {}
+void NetworkDevice::mqttSetClientId(const char* clientId) {}
+void NetworkDevice::mqttSetCleanSession(bool cleanSession) {}
+void NetworkDevice::mqttSetKeepAlive(uint16_t keepAlive) {}
+void NetworkDevice::mqttSetPublishCoalescing(bool coalesce) {}
+void NetworkDevice::mqttSetWill(const char* topic, uint8_t qos, bool retain, const char* payload) {}
+void NetworkDevice::mqttSetCredentials(const char* username, const char* password) {}
+void NetworkDevice::mqttOnMessage(espMqttClientTypes::OnMessageCallback callback) {}
+void NetworkDevice::mqttOnConnect(espMqttClientTypes::OnConnectCallback callback) {}
+void NetworkDevice::mqttOnDisconnect(espMqttClientTypes::OnDisconnectCallback callback) {}
+
+uint16_t NetworkDevice::mqttPublish(const char* topic, uint8_t qos, bool retain, const char* payload)
+{
+    return mqttPublish(topic, qos, retain, (const uint8_t*)payload, strlen(payload));
+}
+
+uint16_t NetworkDevice::mqttPublish(const char* topic, uint8_t qos, bool retain, const uint8_t* payload, size_t length)
+{
+    // Packet::Packet() for PUBLISH: topic length, topic, packet id (QoS > 0), payload
+    size_t remainingLength = 2 + strlen(topic) + (qos > 0 ? 2 : 0) + length;
+    packetSizes.push_back(1 + remainingLengthLength(remainingLength) + remainingLength);
+    return 1;
+}
+
+template<size_t nrLargeBlocks>
+static void replay(const size_t& ackAfter, size_t& largeHighWater, size_t& heapFallbacks)
+{
+    static MemoryPool::SizeClassed<EMC_NUM_POOL_ELEMENTS, EMC_SIZE_POOL_ELEMENTS, nrLargeBlocks, EMC_TX_BUFFER_SIZE> pool;
+    std::deque<void*> outbox;
+    largeHighWater = 0;
+    heapFallbacks = 0;
+
+    for(size_t size : packetSizes)
+    {
+        void* data = pool.malloc(size);
+        if(data == nullptr)
+        {
+            ++heapFallbacks;
+        }
+        outbox.push_back(data);
+        largeHighWater = std::max(largeHighWater, pool.large().usedBlocks());
+
+        if(ackAfter > 0 && outbox.size() > ackAfter)
+        {
+            if(outbox.front() != nullptr)
+            {
+                pool.free(outbox.front());
+            }
+            outbox.pop_front();
+        }
+    }
+
+    for(void* data : outbox)
+    {
+        if(data != nullptr)
+        {
+            pool.free(data);
+        }
+    }
+}
+
+template<size_t nrLargeBlocks>
+static void report()
+{
+    const size_t ackAfter[] = {4, 8, 16, 0};
+
+    printf("%2zu large blocks (%6zu bytes):", nrLargeBlocks, nrLargeBlocks * EMC_TX_BUFFER_SIZE);
+    for(size_t ack : ackAfter)
+    {
+        size_t largeHighWater;
+        size_t heapFallbacks;
+        replay<nrLargeBlocks>(ack, largeHighWater, heapFallbacks);
+        printf("  %s %2zu/%3zu", ack == 0 ? "never" : std::to_string(ack).c_str(), largeHighWater, heapFallbacks);
+    }
+    printf("\n");
+}
+
+int main()
+{
+    Preferences preferences;
+    preferences.putString(preference_mqtt_lock_path, "nukihub");
+    preferences.putString(preference_mqtt_hass_discovery, "homeassistant");
+    preferences.putString(preference_mqtt_hass_cu_url, "http://192.168.1.10");
+    preferences.putString(preference_mqtt_broker, "192.168.1.2");
+    preferences.putString(preference_hostname, "nukihub");
+    preferences.putUInt(preference_nuki_id_lock, 0x2a3b4c5d);
+    preferences.putUInt(preference_nuki_id_opener, 0x3a4b5c6d);
+
+    // every optional entity enabled
+    const char* flags[] = {preference_check_updates, preference_conf_info_enabled, preference_lock_gemini_enabled, preference_mqtt_log_enabled,
+                           preference_official_hybrid_enabled, preference_publish_authdata, preference_update_from_mqtt};
+    for(const char* flag : flags)
+    {
+        preferences.putBool(flag, true);
+    }
+    uint32_t acl[26];
+    std::fill(acl, acl + 26, 1);
+    preferences.putBytes(preference_acl, acl, 17 * sizeof(uint32_t));
+    preferences.putBytes(preference_conf_lock_basic_acl, acl, 16 * sizeof(uint32_t));
+    preferences.putBytes(preference_conf_opener_basic_acl, acl, 14 * sizeof(uint32_t));
+    preferences.putBytes(preference_conf_lock_advanced_acl, acl, 26 * sizeof(uint32_t));
+    preferences.putBytes(preference_conf_opener_advanced_acl, acl, 22 * sizeof(uint32_t));
+
+    // the id setupHASS() derives from the host MAC, so no removal burst is sent first
+    uint8_t mac[8] = {0};
+    esp_efuse_mac_get_default(mac);
+    uint64_t devId;
+    memcpy(&devId, mac, sizeof(devId));
+    preferences.putULong64(preference_nukihub_id, devId);
+
+    ConfigSnapshot config(&preferences);
+    RecordingDevice device(&preferences);
+    HomeAssistantDiscovery discovery(&device, &preferences, &config);
+
+    discovery.setupHASS(0, 0, nullptr, "", "", false, false);
+    size_t hubCount = packetSizes.size();
+    discovery.setupHASS(1, 0x2a3b4c5d, (char*)"Front door", "4.2.8", "5.0", true, true);
+    size_t lockCount = packetSizes.size() - hubCount;
+    discovery.setupHASS(2, 0x3a4b5c6d, (char*)"Opener", "1.9.3", "2.0", false, true);
+    size_t openerCount = packetSizes.size() - hubCount - lockCount;
+
+    std::vector<size_t> sorted = packetSizes;
+    std::sort(sorted.begin(), sorted.end());
+    size_t total = 0;
+    size_t small = 0;
+    size_t large = 0;
+    for(size_t size : sorted)
+    {
+        total += size;
+        small += size <= EMC_SIZE_POOL_ELEMENTS ? 1 : 0;
+        large += size > EMC_SIZE_POOL_ELEMENTS && size <= EMC_TX_BUFFER_SIZE ? 1 : 0;
+    }
+
+    printf("%zu discovery packets (hub %zu, lock %zu, opener %zu), %zu bytes\n", sorted.size(), hubCount, lockCount, openerCount, total);
+    printf("packet size min %zu, p50 %zu, p90 %zu, max %zu\n", sorted.front(), sorted[sorted.size() / 2], sorted[sorted.size() * 9 / 10], sorted.back());
+    for(size_t limit : {512, 640, 768, 1024})
+    {
+        printf("<= %zu bytes: %zu\n", limit, (size_t)(std::upper_bound(sorted.begin(), sorted.end(), limit) - sorted.begin()));
+    }
+    printf("<= %d bytes: %zu, <= %d bytes: %zu, larger: %zu\n\n", EMC_SIZE_POOL_ELEMENTS, small, EMC_TX_BUFFER_SIZE, large, sorted.size() - small - large);
+
+    printf("large block high water / heap fallbacks, broker acknowledges after N later publishes\n");
+    report<4>();
+    report<8>();
+    report<12>();
+    report<16>();
+    report<24>();
+    report<32>();
+
+    return 0;
+}
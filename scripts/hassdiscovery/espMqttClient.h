@@ -0,0 +1,39 @@
+// host stand-in for the espMqttClient types referenced by NetworkDevice
+#pragma once
+
+#include <functional>
+#include "Arduino.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+namespace espMqttClientTypes
+{
+struct PoolStats
+{
+};
+
+enum class DisconnectReason
+{
+    TCP_DISCONNECTED
+};
+
+struct MessageProperties
+{
+};
+
+typedef std::function<void(const MessageProperties&, const char*, const uint8_t*, size_t, size_t, size_t)> OnMessageCallback;
+typedef std::function<void(bool)> OnConnectCallback;
+typedef std::function<void(DisconnectReason)> OnDisconnectCallback;
+}
+
+class MqttClient
+{
+};
+
+class espMqttClient : public MqttClient
+{
+};
+
+class espMqttClientSecure : public MqttClient
+{
+};
@@ -0,0 +1,17 @@
+// host stand-in, there is no watchdog on the host
+#pragma once
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_ERR_NOT_FOUND 0x105
+
+inline esp_err_t esp_task_wdt_status(void*)
+{
+    return ESP_ERR_NOT_FOUND;
+}
+
+inline esp_err_t esp_task_wdt_reset()
+{
+    return ESP_OK;
+}
@@ -0,0 +1,19 @@
+// host stand-in for the parts of FreeRTOS used by HomeAssistantDiscovery and ConfigSnapshot
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define portMAX_DELAY 0
+#define portTICK_PERIOD_MS 1
+
+typedef std::mutex portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {}
+#define taskENTER_CRITICAL(mux) (mux)->lock()
+#define taskEXIT_CRITICAL(mux) (mux)->unlock()
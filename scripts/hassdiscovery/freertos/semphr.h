@@ -0,0 +1,26 @@
+// host stand-in for the FreeRTOS mutex
+#pragma once
+
+#include <mutex>
+
+typedef std::mutex* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    return new std::mutex();
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t mutex)
+{
+    delete mutex;
+}
+
+inline void xSemaphoreTake(SemaphoreHandle_t mutex, int)
+{
+    mutex->lock();
+}
+
+inline void xSemaphoreGive(SemaphoreHandle_t mutex)
+{
+    mutex->unlock();
+}
@@ -0,0 +1,10 @@
+// host stand-in, discovery setup does not wait on the host
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+
+inline void vTaskDelay(TickType_t)
+{
+}
@@ -0,0 +1,2 @@
+// host stand-in, no target options
+#pragma once
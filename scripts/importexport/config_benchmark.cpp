@@ -0,0 +1,538 @@
+/*
+  Host benchmark: time of a full settings export and import.
+
+  "former" is the former ImportExport::exportNukiHubJson() / importJson(): the
+  key lists of DebugPreferences were copied into std::vectors on every call
+  and every key was searched in the vectors of its type with std::find.
+  "registry" is the current loop over preferenceRegistry with a switch on the
+  type of the entry. Both read from and write to an in-memory stand-in for
+  Preferences and build the same ArduinoJson documents as the firmware. The
+  export starts from a store holding every setting, the import takes the
+  exported document. "type lookup" is the type dispatch alone, without the
+  store and the documents. Each case runs several rounds, the median is printed.
+
+  preference_registry.h is generated from the firmware sources, see README.md.
+
+  g++ -std=gnu++17 -O2 -I. -I../../lib/ArduinoJson/src config_benchmark.cpp -o config_benchmark && ./config_benchmark
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <ArduinoJson.h>
+#include "preference_registry.h"
+
+static const int iterations = 2000;
+static const int rounds = 7;
+
+typedef std::string String;
+
+enum PreferenceNvsType
+{
+    PT_U8,
+    PT_I32,
+    PT_U32,
+    PT_U64,
+    PT_STR
+};
+
+struct StoredPreference
+{
+    PreferenceNvsType type;
+    uint64_t value;
+    String text;
+};
+
+// in-memory stand-in for the parts of Preferences used by the import and export
+class Preferences
+{
+public:
+    bool isKey(const char* key)
+    {
+        return _values.find(key) != _values.end();
+    }
+
+    PreferenceNvsType getType(const char* key)
+    {
+        return _values[key].type;
+    }
+
+    bool getBool(const char* key)
+    {
+        return _values[key].value != 0;
+    }
+
+    int32_t getInt(const char* key)
+    {
+        return (int32_t)_values[key].value;
+    }
+
+    uint32_t getUInt(const char* key)
+    {
+        return (uint32_t)_values[key].value;
+    }
+
+    uint64_t getULong64(const char* key)
+    {
+        return _values[key].value;
+    }
+
+    String getString(const char* key)
+    {
+        return _values[key].text;
+    }
+
+    void putBool(const char* key, bool value)
+    {
+        _values[key] = { PT_U8, value, "" };
+    }
+
+    void putInt(const char* key, int32_t value)
+    {
+        _values[key] = { PT_I32, (uint64_t)(int64_t)value, "" };
+    }
+
+    void putUInt(const char* key, uint32_t value)
+    {
+        _values[key] = { PT_U32, value, "" };
+    }
+
+    void putULong64(const char* key, uint64_t value)
+    {
+        _values[key] = { PT_U64, value, "" };
+    }
+
+    void putString(const char* key, const String& value)
+    {
+        _values[key] = { PT_STR, 0, value };
+    }
+
+    void remove(const char* key)
+    {
+        _values.erase(key);
+    }
+
+private:
+    std::map<String, StoredPreference> _values;
+};
+
+// the former DebugPreferences key lists, derived from the registry
+class FormerKeyLists
+{
+public:
+    FormerKeyLists()
+    {
+        for(const auto& entry : preferenceRegistry)
+        {
+            char* key = (char*)entry.key;
+
+            if(entry.flags & PREFERENCE_FLAG_REDACT)
+            {
+                _redact.push_back(key);
+            }
+
+            switch(entry.type)
+            {
+            case PreferenceType::Bytes:
+                _bytePrefs.push_back(key);
+                continue;
+            case PreferenceType::Bool:
+                _boolPrefs.push_back(key);
+                break;
+            case PreferenceType::Int:
+                _intPrefs.push_back(key);
+                break;
+            case PreferenceType::UInt:
+                _uintPrefs.push_back(key);
+                break;
+            case PreferenceType::UInt64:
+                _uint64Prefs.push_back(key);
+                break;
+            default:
+                break;
+            }
+            _keys.push_back(key);
+        }
+    }
+
+    const std::vector<char*> getPreferencesKeys()
+    {
+        return _keys;
+    }
+
+    const std::vector<char*> getPreferencesRedactedKeys()
+    {
+        return _redact;
+    }
+
+    const std::vector<char*> getPreferencesBoolKeys()
+    {
+        return _boolPrefs;
+    }
+
+    const std::vector<char*> getPreferencesByteKeys()
+    {
+        return _bytePrefs;
+    }
+
+    const std::vector<char*> getPreferencesIntKeys()
+    {
+        return _intPrefs;
+    }
+
+    const std::vector<char*> getPreferencesUIntKeys()
+    {
+        return _uintPrefs;
+    }
+
+    const std::vector<char*> getPreferencesUInt64Keys()
+    {
+        return _uint64Prefs;
+    }
+
+private:
+    std::vector<char*> _keys;
+    std::vector<char*> _redact;
+    std::vector<char*> _boolPrefs;
+    std::vector<char*> _bytePrefs;
+    std::vector<char*> _intPrefs;
+    std::vector<char*> _uintPrefs;
+    std::vector<char*> _uint64Prefs;
+};
+
+static void formerExport(Preferences* preferences, JsonDocument& json, bool redacted)
+{
+    FormerKeyLists debugPreferences;
+
+    const std::vector<char*> keysPrefs = debugPreferences.getPreferencesKeys();
+    const std::vector<char*> boolPrefs = debugPreferences.getPreferencesBoolKeys();
+    const std::vector<char*> redactedPrefs = debugPreferences.getPreferencesRedactedKeys();
+    const std::vector<char*> bytePrefs = debugPreferences.getPreferencesByteKeys();
+
+    for(const auto& key : keysPrefs)
+    {
+        if(strcmp(key, preference_show_secrets) == 0 || strcmp(key, preference_latest_version) == 0 ||
+                strcmp(key, preference_totp_secret) == 0 || strcmp(key, preference_bypass_secret) == 0 ||
+                strcmp(key, preference_admin_secret) == 0)
+        {
+            continue;
+        }
+        if(!redacted && std::find(redactedPrefs.begin(), redactedPrefs.end(), key) != redactedPrefs.end())
+        {
+            continue;
+        }
+        if(!preferences->isKey(key))
+        {
+            json[key] = "";
+        }
+        else if(std::find(boolPrefs.begin(), boolPrefs.end(), key) != boolPrefs.end())
+        {
+            json[key] = preferences->getBool(key) ? "1" : "0";
+        }
+        else
+        {
+            switch(preferences->getType(key))
+            {
+            case PT_I32:
+                json[key] = std::to_string(preferences->getInt(key));
+                break;
+            case PT_U32:
+                json[key] = std::to_string(preferences->getUInt(key));
+                break;
+            case PT_U64:
+                json[key] = std::to_string(preferences->getULong64(key));
+                break;
+            default:
+                json[key] = preferences->getString(key);
+                break;
+            }
+        }
+    }
+}
+
+static JsonDocument formerImport(Preferences* preferences, JsonDocument& doc)
+{
+    JsonDocument json;
+    FormerKeyLists debugPreferences;
+
+    const std::vector<char*> keysPrefs = debugPreferences.getPreferencesKeys();
+    const std::vector<char*> boolPrefs = debugPreferences.getPreferencesBoolKeys();
+    const std::vector<char*> bytePrefs = debugPreferences.getPreferencesByteKeys();
+    const std::vector<char*> intPrefs = debugPreferences.getPreferencesIntKeys();
+    const std::vector<char*> uintPrefs = debugPreferences.getPreferencesUIntKeys();
+    const std::vector<char*> uint64Prefs = debugPreferences.getPreferencesUInt64Keys();
+
+    for(const auto& key : keysPrefs)
+    {
+        if(doc[key].isNull())
+        {
+            continue;
+        }
+        if(strcmp(key, preference_show_secrets) == 0 || strcmp(key, preference_latest_version) == 0)
+        {
+            continue;
+        }
+        if(doc[key].as<String>().length() == 0)
+        {
+            json[key] = "removed";
+            preferences->remove(key);
+            continue;
+        }
+        if(std::find(boolPrefs.begin(), boolPrefs.end(), key) != boolPrefs.end())
+        {
+            preferences->putBool(key, (doc[key].as<String>() == "1" ? true : false));
+        }
+        else if(std::find(intPrefs.begin(), intPrefs.end(), key) != intPrefs.end())
+        {
+            preferences->putInt(key, doc[key].as<int>());
+        }
+        else if(std::find(uintPrefs.begin(), uintPrefs.end(), key) != uintPrefs.end())
+        {
+            preferences->putUInt(key, doc[key].as<uint32_t>());
+        }
+        else if(std::find(uint64Prefs.begin(), uint64Prefs.end(), key) != uint64Prefs.end())
+        {
+            preferences->putULong64(key, doc[key].as<uint64_t>());
+        }
+        else
+        {
+            preferences->putString(key, doc[key].as<String>());
+        }
+        json[key] = "changed";
+    }
+
+    return json;
+}
+
+static void registryExport(Preferences* preferences, JsonDocument& json, bool redacted)
+{
+    for(const auto& entry : preferenceRegistry)
+    {
+        const char* key = entry.key;
+
+        if(entry.type == PreferenceType::Bytes || (entry.flags & PREFERENCE_FLAG_NO_EXPORT))
+        {
+            continue;
+        }
+        if(!redacted && (entry.flags & PREFERENCE_FLAG_REDACT))
+        {
+            continue;
+        }
+        if(!preferences->isKey(key))
+        {
+            json[key] = "";
+            continue;
+        }
+
+        switch(entry.type)
+        {
+        case PreferenceType::Bool:
+            json[key] = preferences->getBool(key) ? "1" : "0";
+            break;
+        case PreferenceType::Int:
+            json[key] = std::to_string(preferences->getInt(key));
+            break;
+        case PreferenceType::UInt:
+            json[key] = std::to_string(preferences->getUInt(key));
+            break;
+        case PreferenceType::UInt64:
+            json[key] = std::to_string(preferences->getULong64(key));
+            break;
+        default:
+            json[key] = preferences->getString(key);
+            break;
+        }
+    }
+}
+
+static JsonDocument registryImport(Preferences* preferences, JsonDocument& doc)
+{
+    JsonDocument json;
+
+    for(const auto& entry : preferenceRegistry)
+    {
+        const char* key = entry.key;
+
+        if(doc[key].isNull() || (entry.flags & PREFERENCE_FLAG_NO_IMPORT))
+        {
+            continue;
+        }
+        if(entry.type == PreferenceType::Bytes)
+        {
+            continue;
+        }
+        if(doc[key].as<String>().length() == 0)
+        {
+            json[key] = "removed";
+            preferences->remove(key);
+            continue;
+        }
+
+        switch(entry.type)
+        {
+        case PreferenceType::Bool:
+            preferences->putBool(key, (doc[key].as<String>() == "1" ? true : false));
+            break;
+        case PreferenceType::Int:
+            preferences->putInt(key, doc[key].as<int>());
+            break;
+        case PreferenceType::UInt:
+            preferences->putUInt(key, doc[key].as<uint32_t>());
+            break;
+        case PreferenceType::UInt64:
+            preferences->putULong64(key, doc[key].as<uint64_t>());
+            break;
+        default:
+            preferences->putString(key, doc[key].as<String>());
+            break;
+        }
+        json[key] = "changed";
+    }
+
+    return json;
+}
+
+static int formerTypeLookup()
+{
+    FormerKeyLists debugPreferences;
+
+    const std::vector<char*> keysPrefs = debugPreferences.getPreferencesKeys();
+    const std::vector<char*> boolPrefs = debugPreferences.getPreferencesBoolKeys();
+    const std::vector<char*> intPrefs = debugPreferences.getPreferencesIntKeys();
+    const std::vector<char*> uintPrefs = debugPreferences.getPreferencesUIntKeys();
+    const std::vector<char*> uint64Prefs = debugPreferences.getPreferencesUInt64Keys();
+    int numeric = 0;
+
+    for(const auto& key : keysPrefs)
+    {
+        if(std::find(boolPrefs.begin(), boolPrefs.end(), key) != boolPrefs.end() ||
+                std::find(intPrefs.begin(), intPrefs.end(), key) != intPrefs.end() ||
+                std::find(uintPrefs.begin(), uintPrefs.end(), key) != uintPrefs.end() ||
+                std::find(uint64Prefs.begin(), uint64Prefs.end(), key) != uint64Prefs.end())
+        {
+            numeric++;
+        }
+    }
+
+    return numeric;
+}
+
+static int registryTypeLookup()
+{
+    int numeric = 0;
+
+    for(const auto& entry : preferenceRegistry)
+    {
+        switch(entry.type)
+        {
+        case PreferenceType::Bool:
+        case PreferenceType::Int:
+        case PreferenceType::UInt:
+        case PreferenceType::UInt64:
+            numeric++;
+            break;
+        default:
+            break;
+        }
+    }
+
+    return numeric;
+}
+
+static void fillPreferences(Preferences* preferences)
+{
+    for(const auto& entry : preferenceRegistry)
+    {
+        switch(entry.type)
+        {
+        case PreferenceType::Bool:
+            preferences->putBool(entry.key, entry.defaultValue != 0);
+            break;
+        case PreferenceType::Int:
+            preferences->putInt(entry.key, (int32_t)entry.defaultValue);
+            break;
+        case PreferenceType::UInt:
+            preferences->putUInt(entry.key, (uint32_t)entry.defaultValue);
+            break;
+        case PreferenceType::UInt64:
+            preferences->putULong64(entry.key, (uint64_t)entry.defaultValue);
+            break;
+        case PreferenceType::String:
+            preferences->putString(entry.key, entry.defaultString[0] != 0 ? entry.defaultString : "value");
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static volatile int sink = 0;
+
+template<typename F>
+static double measure(F f)
+{
+    std::vector<double> results;
+
+    for(int round = 0; round < rounds; round++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for(int i = 0; i < iterations; i++)
+        {
+            f();
+        }
+        auto end = std::chrono::steady_clock::now();
+        results.push_back(std::chrono::duration<double, std::micro>(end - start).count() / iterations);
+    }
+
+    std::sort(results.begin(), results.end());
+    return results[rounds / 2];
+}
+
+int main()
+{
+    Preferences preferences;
+    fillPreferences(&preferences);
+
+    JsonDocument exported;
+    registryExport(&preferences, exported, true);
+
+    JsonDocument formerExported;
+    formerExport(&preferences, formerExported, true);
+
+    printf("%d settings, %d exported\n", (int)PREFERENCE_REGISTRY_SIZE, (int)exported.size());
+
+    double formerExportUs = measure([&]()
+    {
+        JsonDocument json;
+        formerExport(&preferences, json, true);
+    });
+    double registryExportUs = measure([&]()
+    {
+        JsonDocument json;
+        registryExport(&preferences, json, true);
+    });
+    double formerImportUs = measure([&]()
+    {
+        formerImport(&preferences, formerExported);
+    });
+    double registryImportUs = measure([&]()
+    {
+        registryImport(&preferences, exported);
+    });
+
+    double formerLookupUs = measure([&]()
+    {
+        sink += formerTypeLookup();
+    });
+    double registryLookupUs = measure([&]()
+    {
+        sink += registryTypeLookup();
+    });
+
+    printf("%-10s export %8.1f us, import %8.1f us, type lookup %6.2f us\n", "former", formerExportUs, formerImportUs, formerLookupUs);
+    printf("%-10s export %8.1f us, import %8.1f us, type lookup %6.2f us\n", "registry", registryExportUs, registryImportUs, registryLookupUs);
+    return 0;
+}
@@ -0,0 +1,6 @@
+// host stand-in for the parts of FreeRTOS used by MqttTopicTable
+#pragma once
+
+#include <mutex>
+
+#define portMAX_DELAY 0
@@ -0,0 +1,141 @@
+/*
+  Host benchmark: cost of resolving the full path of a topic on each publish of
+  NukiPublisher.
+
+  Replays the topics published on a lock state change. "former" is the publish
+  path before topic ids: NukiPublisher::publishString() copied the std::string
+  value into a zeroed variable length array and NukiNetwork::publish() zeroed a
+  200 byte buffer and joined prefix and topic with buildMqttPath() on every
+  publish. "topic id" is the current path: the id is resolved at compile time
+  with MQTT_TOPIC_ID and the publish reads the path by index. "find by name" is
+  the lookup still used once per subscription. Each publish copies the path and
+  the value into a buffer in place of sending it. Each case runs several
+  rounds, the median is printed.
+
+  g++ -std=gnu++17 -O2 -I. -I../../src publish_benchmark.cpp ../../src/MqttTopicTable.cpp -o publish_benchmark && ./publish_benchmark
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <initializer_list>
+#include <string>
+#include <stdio.h>
+#include <string.h>
+#include "MqttTopics.h"
+#include "MqttTopicTable.h"
+
+static const int iterations = 1000000;
+static const int rounds = 7;
+static const char* mqttPath = "nukihub/lock";
+
+// the former NukiNetwork::buildMqttPath(), run on every publish
+static void buildMqttPath(char* outPath, std::initializer_list<const char*> paths)
+{
+    int offset = 0;
+    int pathCount = 0;
+
+    for(const char* path : paths)
+    {
+        if(pathCount > 0 && path[0] != '/')
+        {
+            outPath[offset] = '/';
+            ++offset;
+        }
+
+        int i = 0;
+        while(path[i] != 0)
+        {
+            outPath[offset] = path[i];
+            ++offset;
+            ++i;
+        }
+        ++pathCount;
+    }
+
+    outPath[offset] = 0x00;
+}
+
+// topics of NukiNetworkLock::publishKeyTurnerState() and the publishes around it
+static const char* const stateTopics[] =
+{
+    mqtt_topic_lock_state, mqtt_topic_lock_ha_state, mqtt_topic_lock_binary_state, mqtt_topic_lock_trigger, mqtt_topic_lock_last_lock_action,
+    mqtt_topic_lock_completionStatus, mqtt_topic_lock_door_sensor_state, mqtt_topic_battery_critical, mqtt_topic_lock_json, mqtt_topic_lock_rssi,
+};
+
+static const MqttTopicId stateTopicIds[] =
+{
+    MQTT_TOPIC_ID(mqtt_topic_lock_state), MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), MQTT_TOPIC_ID(mqtt_topic_lock_binary_state),
+    MQTT_TOPIC_ID(mqtt_topic_lock_trigger), MQTT_TOPIC_ID(mqtt_topic_lock_last_lock_action), MQTT_TOPIC_ID(mqtt_topic_lock_completionStatus),
+    MQTT_TOPIC_ID(mqtt_topic_lock_door_sensor_state), MQTT_TOPIC_ID(mqtt_topic_battery_critical), MQTT_TOPIC_ID(mqtt_topic_lock_json),
+    MQTT_TOPIC_ID(mqtt_topic_lock_rssi),
+};
+
+static const size_t stateTopicCount = sizeof(stateTopics) / sizeof(stateTopics[0]);
+static const std::string value = "1";
+
+static char message[256];
+
+static void publish(const char* path, const char* value)
+{
+    size_t pathLength = strlen(path);
+    memcpy(message, path, pathLength);
+    strcpy(message + pathLength, value);
+}
+
+template<typename F>
+static double measure(F publishOne)
+{
+    double results[rounds];
+
+    for(int round = 0; round < rounds; round++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for(int i = 0; i < iterations; i++)
+        {
+            publishOne(i);
+        }
+        auto end = std::chrono::steady_clock::now();
+        results[round] = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+
+    std::sort(results, results + rounds);
+    return results[rounds / 2];
+}
+
+static void report(const char* name, double ns)
+{
+    printf("%-24s %8.1f ns/publish %10.0f publishes/s\n", name, ns, 1e9 / ns);
+}
+
+int main()
+{
+    MqttTopicTable table(mqttPath);
+    MqttTopics mqttTopics;
+    table.registerTopics(mqttTopics.getMqttTopics());
+
+    printf("%d topics, %d publishes per case\n\n", mqttTopicCount, iterations);
+
+    report("former", measure([&](int i)
+    {
+        const char* topic = stateTopics[i % stateTopicCount];
+        char str[value.size() + 1];
+        memset(str, 0, sizeof(str));
+        memcpy(str, value.data(), value.length());
+        char path[200] = {0};
+        buildMqttPath(path, { mqttPath, topic });
+        publish(path, str);
+    }));
+
+    report("topic id", measure([&](int i)
+    {
+        publish(table.path(stateTopicIds[i % stateTopicCount]), value.c_str());
+    }));
+
+    report("find by name", measure([&](int i)
+    {
+        const char* topic = stateTopics[i % stateTopicCount];
+        publish(table.path(table.find(topic)), value.c_str());
+    }));
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+// host stand-in for the parts of the Arduino core used by OtaManifestFetcher
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+class String
+{
+public:
+    String() = default;
+    String(const char* value) : _value(value != nullptr ? value : "") {}
+    String(const std::string& value) : _value(value) {}
+
+    const char* c_str() const { return _value.c_str(); }
+    unsigned int length() const { return _value.length(); }
+    bool reserve(unsigned int size) { _value.reserve(size); return true; }
+    bool concat(const char* value) { _value += value; return true; }
+    bool concat(const char* value, unsigned int length) { _value.append(value, length); return true; }
+    bool concat(char value) { _value += value; return true; }
+    String& operator+=(const char* value) { _value += value; return *this; }
+    String& operator+=(char value) { _value += value; return *this; }
+
+    bool operator==(const String& other) const { return _value == other._value; }
+    bool operator==(const char* other) const { return _value == other; }
+
+private:
+    std::string _value;
+};
+
+inline size_t strlcpy(char* dst, const char* src, size_t size)
+{
+    size_t length = strlen(src);
+    if(size > 0)
+    {
+        size_t copy = length < size - 1 ? length : size - 1;
+        memcpy(dst, src, copy);
+        dst[copy] = 0;
+    }
+    return length;
+}
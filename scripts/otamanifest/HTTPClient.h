@@ -0,0 +1,146 @@
+// host stand-in for the Arduino HTTPClient: a plain HTTP/1.0 GET over a POSIX socket
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Arduino.h"
+#include "NetworkClient.h"
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_MOVED_PERMANENTLY 301
+#define HTTP_CODE_NOT_MODIFIED 304
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+
+enum followRedirects_t
+{
+    HTTPC_DISABLE_FOLLOW_REDIRECTS,
+    HTTPC_STRICT_FOLLOW_REDIRECTS,
+    HTTPC_FORCE_FOLLOW_REDIRECTS
+};
+
+class HTTPClient
+{
+public:
+    bool begin(NetworkClient&, const char* url)
+    {
+        // http://127.0.0.1:port/path
+        int port = 0;
+        char path[128] = {0};
+        if(sscanf(url, "http://127.0.0.1:%d%127s", &port, path) != 2)
+        {
+            return false;
+        }
+        _port = port;
+        _path = path;
+        return true;
+    }
+
+    void setFollowRedirects(followRedirects_t) {}
+    void setTimeout(uint16_t timeout) { _timeout = timeout; }
+    void useHTTP10(bool) {}
+
+    void collectHeaders(const char* headerKeys[], const size_t headerKeysCount)
+    {
+        for(size_t i = 0; i < headerKeysCount; i++)
+        {
+            _collected.emplace_back(headerKeys[i], "");
+        }
+    }
+
+    void addHeader(const String& name, const String& value)
+    {
+        _request += std::string(name.c_str()) + ": " + value.c_str() + "\r\n";
+    }
+
+    int GET()
+    {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        struct timeval tv = {_timeout / 1000, (_timeout % 1000) * 1000};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+        struct sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(_port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if(connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0)
+        {
+            close(fd);
+            return HTTPC_ERROR_CONNECTION_REFUSED;
+        }
+
+        std::string request = "GET " + _path + " HTTP/1.0\r\nHost: 127.0.0.1\r\n" + _request + "\r\n";
+        send(fd, request.data(), request.size(), 0);
+
+        std::string response;
+        char buffer[512];
+        ssize_t received;
+        while((received = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+        {
+            response.append(buffer, received);
+        }
+        close(fd);
+
+        size_t headerEnd = response.find("\r\n\r\n");
+        int code = 0;
+        if(headerEnd == std::string::npos || sscanf(response.c_str(), "HTTP/1.%*d %d", &code) != 1)
+        {
+            return HTTPC_ERROR_CONNECTION_LOST;
+        }
+
+        std::istringstream headers(response.substr(0, headerEnd));
+        std::string line;
+        while(std::getline(headers, line))
+        {
+            size_t colon = line.find(':');
+            if(colon == std::string::npos)
+            {
+                continue;
+            }
+            for(auto& header : _collected)
+            {
+                if(strncasecmp(line.c_str(), header.first.c_str(), colon) == 0 && header.first.size() == colon)
+                {
+                    header.second = line.substr(colon + 2, line.size() - colon - 2 - (line.back() == '\r' ? 1 : 0));
+                }
+            }
+        }
+
+        _body.str(response.substr(headerEnd + 4));
+        return code;
+    }
+
+    String header(const char* name)
+    {
+        for(const auto& header : _collected)
+        {
+            if(strcasecmp(header.first.c_str(), name) == 0)
+            {
+                return String(header.second);
+            }
+        }
+        return String();
+    }
+
+    std::istream& getStream()
+    {
+        return _body;
+    }
+
+    void end() {}
+
+private:
+    int _port = 0;
+    std::string _path;
+    uint16_t _timeout = 5000;
+    std::string _request;
+    std::vector<std::pair<std::string, std::string>> _collected;
+    std::istringstream _body;
+};
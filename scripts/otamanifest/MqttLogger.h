@@ -0,0 +1,4 @@
+// host stand-in, the logger only prints
+#pragma once
+
+#include "Print.h"
@@ -0,0 +1,8 @@
+// host stand-in, the connection is made by the HTTPClient stand-in
+#pragma once
+
+class NetworkClient
+{
+public:
+    virtual ~NetworkClient() = default;
+};
@@ -0,0 +1,12 @@
+// host stand-in, the test only serves plain http
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "NetworkClient.h"
+
+class NetworkClientSecure : public NetworkClient
+{
+public:
+    void setCACertBundle(const uint8_t*, size_t) {}
+};
@@ -0,0 +1,13 @@
+// host stand-in for the Arduino Print class, writes to stdout
+#pragma once
+
+#include "Arduino.h"
+
+class Print
+{
+public:
+    size_t print(const char* value) { return printf("%s", value); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t println(const char* value) { return printf("%s\n", value); }
+    size_t println(int value) { return printf("%d\n", value); }
+};
@@ -0,0 +1,15 @@
+// host stand-in for the parts of FreeRTOS used by OtaManifestFetcher
+#pragma once
+
+#include <cstdint>
+
+typedef int BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS 1
+#define portMAX_DELAY 0xffffffffu
+#define portTICK_PERIOD_MS 1
+#define tskNO_AFFINITY 0x7fffffff
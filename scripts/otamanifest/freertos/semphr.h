@@ -0,0 +1,22 @@
+// host stand-in for the FreeRTOS mutex
+#pragma once
+
+#include <mutex>
+#include "FreeRTOS.h"
+
+typedef std::mutex* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    return new std::mutex();
+}
+
+inline void xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t)
+{
+    mutex->lock();
+}
+
+inline void xSemaphoreGive(SemaphoreHandle_t mutex)
+{
+    mutex->unlock();
+}
@@ -0,0 +1,60 @@
+// host stand-in for the task and notification calls of OtaManifestFetcher, one detached thread per task
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "FreeRTOS.h"
+
+struct HostTask
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    uint32_t count = 0;
+};
+
+typedef HostTask* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+inline TaskHandle_t& hostCurrentTask()
+{
+    static thread_local TaskHandle_t current = nullptr;
+    return current;
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char*, uint32_t, void* param, UBaseType_t, TaskHandle_t* handle, BaseType_t)
+{
+    HostTask* task = new HostTask();
+    *handle = task;
+    std::thread([function, param, task]()
+    {
+        hostCurrentTask() = task;
+        function(param);
+    }).detach();
+    return pdPASS;
+}
+
+inline void xTaskNotifyGive(TaskHandle_t handle)
+{
+    {
+        std::lock_guard<std::mutex> lock(handle->mutex);
+        handle->count++;
+    }
+    handle->condition.notify_one();
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t)
+{
+    TaskHandle_t task = hostCurrentTask();
+    std::unique_lock<std::mutex> lock(task->mutex);
+    task->condition.wait(lock, [task] { return task->count > 0; });
+    uint32_t count = task->count;
+    task->count = clearOnExit ? 0 : count - 1;
+    return count;
+}
+
+inline void vTaskDelay(TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
@@ -0,0 +1,263 @@
+/*
+  Host test: OtaManifestFetcher against a local HTTP stand-in.
+
+  Runs the real OtaManifestFetcher task loop against a small HTTP/1.0 server on
+  127.0.0.1 that serves an OTA manifest with an ETag and a Last-Modified header.
+  The server answers 304 when the request carries a matching If-None-Match or
+  If-Modified-Since header. Checks the first fetch, the conditional fetch, a
+  changed manifest, a server error, an invalid manifest and a refused
+  connection.
+
+  g++ -std=gnu++17 -O2 -pthread -I. -I../../src -I../../lib/ArduinoJson/src \
+      -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -DARDUINOJSON_ENABLE_STD_STREAM=1 -DARDUINOJSON_ENABLE_ARDUINO_STREAM=0 -DARDUINOJSON_ENABLE_ARDUINO_PRINT=0 -DARDUINOJSON_ENABLE_PROGMEM=0 \
+      manifest_test.cpp ../../src/util/OtaManifestFetcher.cpp -o manifest_test && ./manifest_test
+*/
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "Logger.h"
+#include "util/OtaManifestFetcher.h"
+
+Print* Log = new Print();
+
+// the certificate bundle is linked into the firmware, the test only uses plain http
+extern const uint8_t x509_crt_imported_bundle_bin_start[] asm("_binary_x509_crt_bundle_start");
+extern const uint8_t x509_crt_imported_bundle_bin_end[] asm("_binary_x509_crt_bundle_end");
+const uint8_t x509_crt_imported_bundle_bin_start[1] = {0};
+const uint8_t x509_crt_imported_bundle_bin_end[1] = {0};
+
+enum class ServerMode
+{
+    Manifest,
+    ServerError,
+    InvalidJson
+};
+
+class ManifestServer
+{
+public:
+    ManifestServer()
+    {
+        _fd = socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        struct sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(_fd, (struct sockaddr*)&addr, sizeof(addr));
+        listen(_fd, 4);
+
+        socklen_t length = sizeof(addr);
+        getsockname(_fd, (struct sockaddr*)&addr, &length);
+        _port = ntohs(addr.sin_port);
+
+        _thread = std::thread([this]() { serve(); });
+    }
+
+    void stop()
+    {
+        _running = false;
+        shutdown(_fd, SHUT_RDWR);
+        close(_fd);
+        _thread.join();
+    }
+
+    int port() const { return _port; }
+
+    void setMode(ServerMode mode)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _mode = mode;
+    }
+
+    void setManifest(const std::string& body, const std::string& etag, const std::string& lastModified)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _body = body;
+        _etag = etag;
+        _lastModified = lastModified;
+    }
+
+    std::string lastRequest()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _lastRequest;
+    }
+
+private:
+    static std::string headerValue(const std::string& request, const std::string& name)
+    {
+        size_t start = request.find("\r\n" + name + ": ");
+        if(start == std::string::npos)
+        {
+            return "";
+        }
+        start += name.size() + 4;
+        return request.substr(start, request.find("\r\n", start) - start);
+    }
+
+    void serve()
+    {
+        while(_running)
+        {
+            int client = accept(_fd, nullptr, nullptr);
+            if(client < 0)
+            {
+                continue;
+            }
+
+            std::string request;
+            char buffer[512];
+            ssize_t received;
+            while(request.find("\r\n\r\n") == std::string::npos && (received = recv(client, buffer, sizeof(buffer), 0)) > 0)
+            {
+                request.append(buffer, received);
+            }
+
+            std::string response;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _lastRequest = request;
+
+                std::string ifNoneMatch = headerValue(request, "If-None-Match");
+                std::string ifModifiedSince = headerValue(request, "If-Modified-Since");
+
+                if(_mode == ServerMode::ServerError)
+                {
+                    response = "HTTP/1.0 500 Internal Server Error\r\nContent-Length: 0\r\n\r\n";
+                }
+                else if(_mode == ServerMode::InvalidJson)
+                {
+                    response = "HTTP/1.0 200 OK\r\nContent-Type: application/json\r\n\r\n{\"release\": {\"version\": ";
+                }
+                else if((!ifNoneMatch.empty() && ifNoneMatch == _etag) || (ifNoneMatch.empty() && !ifModifiedSince.empty() && ifModifiedSince == _lastModified))
+                {
+                    response = "HTTP/1.0 304 Not Modified\r\n\r\n";
+                }
+                else
+                {
+                    response = "HTTP/1.0 200 OK\r\nContent-Type: application/json\r\n" + (_etag.empty() ? "" : "ETag: " + _etag + "\r\n") +
+                               "Last-Modified: " + _lastModified + "\r\nContent-Length: " + std::to_string(_body.size()) + "\r\n\r\n" + _body;
+                }
+            }
+
+            send(client, response.data(), response.size(), 0);
+            close(client);
+        }
+    }
+
+    int _fd;
+    int _port = 0;
+    std::atomic<bool> _running{true};
+    std::thread _thread;
+    std::mutex _mutex;
+    ServerMode _mode = ServerMode::Manifest;
+    std::string _body;
+    std::string _etag;
+    std::string _lastModified;
+    std::string _lastRequest;
+};
+
+static int failures = 0;
+
+static void check(bool condition, const char* description)
+{
+    printf("%s %s\n", condition ? "OK  " : "FAIL", description);
+    if(!condition)
+    {
+        ++failures;
+    }
+}
+
+static std::string manifestJson(const char* releaseVersion, int releaseVersionInt)
+{
+    return std::string("{\"release\": {\"version\": \"") + releaseVersion + "\", \"version_int\": " + std::to_string(releaseVersionInt) +
+           ", \"fullversion\": \"" + releaseVersion + "\", \"build\": \"release\", \"time\": \"2026-10-01 12:00:00\"},"
+           " \"beta\": {\"version\": \"9.15\", \"version_int\": 915, \"fullversion\": \"9.15-beta\", \"build\": \"b1a2\", \"time\": \"2026-10-10 08:00:00\"},"
+           " \"master\": {\"version\": \"9.15\", \"version_int\": 915, \"fullversion\": \"9.15-master\", \"build\": \"c3d4\", \"time\": \"2026-10-12 09:30:00\"}}";
+}
+
+int main()
+{
+    ManifestServer server;
+    server.setManifest(manifestJson("9.14", 914), "\"v914\"", "Wed, 01 Oct 2026 12:00:00 GMT");
+
+    static char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%d/ota/manifest.json", server.port());
+    OtaManifestFetcher::initialize(url);
+    OtaManifestFetcher* fetcher = OtaManifestFetcher::get();
+
+    OtaManifest manifest;
+    OtaManifestResult result;
+
+    // 200: fields, validators, no conditional headers on the first request
+    result = fetcher->waitFor(fetcher->request(), manifest, 5000);
+    check(result == OtaManifestResult::Ready, "200: result is Ready");
+    check(strcmp(manifest.release.version, "9.14") == 0, "200: release version");
+    check(strcmp(manifest.release.versionInt, "914") == 0, "200: numeric version_int copied as text");
+    check(strcmp(manifest.beta.fullversion, "9.15-beta") == 0, "200: beta fullversion");
+    check(strcmp(manifest.master.build, "c3d4") == 0, "200: master build");
+    check(server.lastRequest().find("If-None-Match") == std::string::npos && server.lastRequest().find("If-Modified-Since") == std::string::npos,
+          "200: first request is unconditional");
+
+    // 304: the stored validators are sent back and the cached manifest is returned
+    memset(&manifest, 0, sizeof(manifest));
+    result = fetcher->waitFor(fetcher->request(), manifest, 5000);
+    check(result == OtaManifestResult::Ready, "304: result is Ready");
+    check(server.lastRequest().find("If-None-Match: \"v914\"\r\n") != std::string::npos, "304: If-None-Match sent");
+    check(server.lastRequest().find("If-Modified-Since: Wed, 01 Oct 2026 12:00:00 GMT\r\n") != std::string::npos, "304: If-Modified-Since sent");
+    check(fetcher->notModifiedCount() == 1, "304: counted as not modified");
+    check(strcmp(manifest.release.version, "9.14") == 0, "304: cached manifest returned");
+
+    // 200 after a change: new manifest and validators
+    server.setManifest(manifestJson("9.15", 915), "\"v915\"", "Sat, 18 Oct 2026 07:00:00 GMT");
+    result = fetcher->waitFor(fetcher->request(), manifest, 5000);
+    check(result == OtaManifestResult::Ready, "changed: result is Ready");
+    check(strcmp(manifest.release.version, "9.15") == 0, "changed: new release version");
+    check(fetcher->notModifiedCount() == 1, "changed: not counted as not modified");
+    result = fetcher->waitFor(fetcher->request(), manifest, 5000);
+    check(server.lastRequest().find("If-None-Match: \"v915\"\r\n") != std::string::npos, "changed: new ETag sent on the next request");
+    check(fetcher->notModifiedCount() == 2, "changed: next request not modified");
+
+    // 304 on If-Modified-Since alone when the server sends no ETag
+    server.setManifest(manifestJson("9.16", 916), "", "Sat, 18 Oct 2026 09:00:00 GMT");
+    result = fetcher->waitFor(fetcher->request(), manifest, 5000);
+    check(result == OtaManifestResult::Ready && strcmp(manifest.release.version, "9.16") == 0, "no etag: new release version");
+    result = fetcher->waitFor(fetcher->request(), manifest, 5000);
+    check(server.lastRequest().find("If-None-Match") == std::string::npos, "no etag: If-None-Match omitted");
+    check(server.lastRequest().find("If-Modified-Since: Sat, 18 Oct 2026 09:00:00 GMT\r\n") != std::string::npos, "no etag: If-Modified-Since sent");
+    check(result == OtaManifestResult::Ready && fetcher->notModifiedCount() == 3, "no etag: not modified");
+
+    // 500
+    server.setMode(ServerMode::ServerError);
+    result = fetcher->waitFor(fetcher->request(), manifest, 5000);
+    check(result == OtaManifestResult::Failed, "500: result is Failed");
+
+    // truncated manifest
+    server.setMode(ServerMode::InvalidJson);
+    result = fetcher->waitFor(fetcher->request(), manifest, 5000);
+    check(result == OtaManifestResult::Failed, "invalid json: result is Failed");
+
+    // the cached manifest survives failed fetches
+    server.setMode(ServerMode::Manifest);
+    result = fetcher->waitFor(fetcher->request(), manifest, 5000);
+    check(result == OtaManifestResult::Ready && strcmp(manifest.release.version, "9.16") == 0, "recovered: cached manifest still valid");
+
+    // connection refused
+    server.stop();
+    result = fetcher->waitFor(fetcher->request(), manifest, 5000);
+    check(result == OtaManifestResult::Failed, "refused: result is Failed");
+
+    check(fetcher->fetchCount() == 10, "every request fetched once");
+
+    printf("%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
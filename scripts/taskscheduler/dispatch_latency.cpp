@@ -0,0 +1,341 @@
+/*
+  Host test: command-to-dispatch latency of the nuki task.
+
+  A command thread stands in for the MQTT callback on the network task: it
+  hands a lock action to the nuki task at random intervals, as
+  NukiWrapper::lock() does, and waits until it was picked up. "fixed polling"
+  is the former nukiTask loop, which ran update() and slept 50 ms whether or
+  not anything changed. "scheduler" is the current nukiTask loop from main.cpp:
+  the command is followed by TaskScheduler::notify() and the task sleeps in
+  TaskScheduler::waitUntil() until the deadline returned by
+  TaskScheduler::nextDeadline() or the next event.
+
+  SimulatedLock keeps the timestamps NukiWrapper schedules its work with and
+  advances them by the same rules and default intervals as
+  NukiWrapper::update(). Its deadlines() fills SchedulerDeadlines the way
+  NukiWrapper::nextDeadline() does. updateMs simulates the BLE work done by a
+  pass that executes a lock action or a query.
+
+  The dispatch latency is taken from handing the command over to the task
+  picking it up. After the last command the task idles for 6 s so the auth
+  log read scheduled after it runs. The lateness of scheduled queries is taken
+  from their timestamp to the pass that runs them.
+
+  Fails if the 95th percentile with the scheduler is not below the median of
+  the fixed polling loop, or if a scheduled query runs later than the maximum
+  idle time of the task.
+
+  g++ -std=gnu++17 -O2 -pthread -I. -I../../src/util dispatch_latency.cpp ../../src/util/TaskScheduler.cpp -o dispatch_latency && ./dispatch_latency [commands] [updateMs]
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+#include "TaskScheduler.h"
+#include "esp_timer.h"
+#include "../EspMillis.h"
+
+// mirrors src/Config.h, which needs sdkconfig.h
+#define NUKI_TASK_MAX_IDLE 250
+#define FORMER_NUKI_TASK_DELAY 50
+
+// NukiWrapper defaults, in seconds
+#define INTERVAL_LOCKSTATE (60 * 30)
+#define INTERVAL_BATTERY (60 * 30)
+#define INTERVAL_CONFIG (60 * 60)
+#define INTERVAL_KEYPAD (60 * 30)
+#define RSSI_PUBLISH_INTERVAL 60
+
+#define LOCK_ACTION_NONE 0xff
+
+struct LatencyResult
+{
+    double meanMs;
+    double p50Ms;
+    double p95Ms;
+    double maxMs;
+    double maxLatenessMs;
+    size_t scheduled;
+    double passesPerSecond;
+};
+
+class SimulatedLock
+{
+public:
+    explicit SimulatedLock(int updateMs)
+        : _updateMs(updateMs)
+    {
+    }
+
+    // NukiWrapper::lock(), called on the network task
+    void lock(int64_t receivedUs)
+    {
+        _commandReceivedUs = receivedUs;
+        _nextLockAction = 1;
+    }
+
+    bool actionPending() const
+    {
+        return _nextLockAction != LOCK_ACTION_NONE;
+    }
+
+    void update()
+    {
+        int64_t ts = espMillis();
+        _passes++;
+
+        checkLockAction(ts);
+        checkLockStateUpdate(ts);
+        checkQueries(ts);
+    }
+
+    SchedulerDeadlines deadlines() const
+    {
+        SchedulerDeadlines deadlines;
+        deadlines.actionPending = _nextLockAction != LOCK_ACTION_NONE || _statusUpdated;
+        deadlines.mqttConnected = true;
+        deadlines.lockStateUpdateTs = _nextLockStateUpdateTs;
+        deadlines.batteryReportTs = _nextBatteryReportTs;
+        deadlines.configUpdateTs = _nextConfigUpdateTs;
+        deadlines.waitAuthLogUpdateTs = _waitAuthLogUpdateTs;
+        deadlines.rssiEnabled = true;
+        deadlines.rssiTs = _nextRssiTs;
+        deadlines.keypadEnabled = true;
+        deadlines.keypadUpdateTs = _nextKeypadUpdateTs;
+        return deadlines;
+    }
+
+    std::vector<int64_t> latencies;
+    std::vector<int64_t> lateness;
+    size_t _passes = 0;
+
+private:
+    void bleCommand()
+    {
+        if(_updateMs > 0)
+        {
+            vTaskDelay(pdMS_TO_TICKS(_updateMs));
+        }
+    }
+
+    void scheduled(const int64_t& ts, const int64_t& due)
+    {
+        // the first queries after boot are not scheduled
+        if(due != 0)
+        {
+            lateness.push_back(ts - due);
+        }
+        bleCommand();
+    }
+
+    void checkLockAction(const int64_t& ts)
+    {
+        if(_nextLockAction == LOCK_ACTION_NONE)
+        {
+            return;
+        }
+
+        latencies.push_back(esp_timer_get_time() - _commandReceivedUs);
+        bleCommand();
+
+        _nextLockAction = LOCK_ACTION_NONE;
+        _statusUpdated = true;
+        _nextLockStateUpdateTs = ts + 10 * 1000;
+    }
+
+    void checkLockStateUpdate(const int64_t& ts)
+    {
+        if(_statusUpdated || _nextLockStateUpdateTs == 0 || ts >= _nextLockStateUpdateTs)
+        {
+            if(!_statusUpdated)
+            {
+                scheduled(ts, _nextLockStateUpdateTs);
+            }
+            _nextLockStateUpdateTs = ts + INTERVAL_LOCKSTATE * 1000;
+
+            // the changed state retrieves the auth log, which is read again after 5 s
+            if(_statusUpdated)
+            {
+                _waitAuthLogUpdateTs = ts + 5000;
+            }
+            _statusUpdated = false;
+        }
+    }
+
+    void checkQueries(const int64_t& ts)
+    {
+        if(_nextBatteryReportTs == 0 || ts > _nextBatteryReportTs)
+        {
+            scheduled(ts, _nextBatteryReportTs);
+            _nextBatteryReportTs = ts + INTERVAL_BATTERY * 1000;
+        }
+        if(_nextConfigUpdateTs == 0 || ts > _nextConfigUpdateTs)
+        {
+            scheduled(ts, _nextConfigUpdateTs);
+            _nextConfigUpdateTs = ts + INTERVAL_CONFIG * 1000;
+        }
+        if(_waitAuthLogUpdateTs != 0 && ts > _waitAuthLogUpdateTs)
+        {
+            scheduled(ts, _waitAuthLogUpdateTs);
+            _waitAuthLogUpdateTs = 0;
+        }
+        if(_nextRssiTs == 0 || ts > _nextRssiTs)
+        {
+            scheduled(ts, _nextRssiTs);
+            _nextRssiTs = ts + RSSI_PUBLISH_INTERVAL * 1000;
+        }
+        if(_nextKeypadUpdateTs == 0 || ts > _nextKeypadUpdateTs)
+        {
+            scheduled(ts, _nextKeypadUpdateTs);
+            _nextKeypadUpdateTs = ts + INTERVAL_KEYPAD * 1000;
+        }
+    }
+
+    const int _updateMs;
+    std::atomic<int> _nextLockAction {LOCK_ACTION_NONE};
+    std::atomic<int64_t> _commandReceivedUs {0};
+    bool _statusUpdated = false;
+    int64_t _nextLockStateUpdateTs = 0;
+    int64_t _nextBatteryReportTs = 0;
+    int64_t _nextConfigUpdateTs = 0;
+    int64_t _waitAuthLogUpdateTs = 0;
+    int64_t _nextRssiTs = 0;
+    int64_t _nextKeypadUpdateTs = 0;
+};
+
+static std::atomic<bool> stopTask {false};
+
+static void nukiTask(HostTask* task, SimulatedLock* lock, bool scheduler)
+{
+    hostCurrentTask() = task;
+    if(scheduler)
+    {
+        TaskScheduler::registerTask(SchedulerTask::Nuki, xTaskGetCurrentTaskHandle());
+    }
+
+    while(!stopTask)
+    {
+        lock->update();
+
+        if(scheduler)
+        {
+            int64_t deadline = espMillis() + NUKI_TASK_MAX_IDLE;
+            deadline = TaskScheduler::earliest(deadline, TaskScheduler::nextDeadline(lock->deadlines()));
+            TaskScheduler::waitUntil(SchedulerTask::Nuki, deadline, NUKI_TASK_MAX_IDLE);
+        }
+        else
+        {
+            vTaskDelay(FORMER_NUKI_TASK_DELAY / portTICK_PERIOD_MS);
+        }
+    }
+}
+
+static LatencyResult run(bool scheduler, int commands, int updateMs)
+{
+    HostTask task;
+    SimulatedLock lock(updateMs);
+    std::mt19937 random(1);
+    std::uniform_int_distribution<int> interval(20, 200);
+
+    stopTask = false;
+    int64_t startUs = esp_timer_get_time();
+
+    std::thread thread(nukiTask, &task, &lock, scheduler);
+
+    for(int i = 0; i < commands; i++)
+    {
+        vTaskDelay(pdMS_TO_TICKS(interval(random)));
+
+        while(lock.actionPending())
+        {
+            vTaskDelay(1);
+        }
+
+        lock.lock(esp_timer_get_time());
+        if(scheduler)
+        {
+            TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_LOCK_ACTION);
+        }
+    }
+
+    while(lock.actionPending())
+    {
+        vTaskDelay(1);
+    }
+
+    // idle until the auth log read 5 s after the last action has run
+    vTaskDelay(pdMS_TO_TICKS(6000));
+
+    stopTask = true;
+    if(scheduler)
+    {
+        TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_RESTART);
+    }
+    thread.join();
+    TaskScheduler::unregisterTask(SchedulerTask::Nuki);
+
+    std::vector<int64_t>& latencies = lock.latencies;
+    std::sort(latencies.begin(), latencies.end());
+
+    LatencyResult result;
+    int64_t sum = 0;
+
+    for(int64_t latency : latencies)
+    {
+        sum += latency;
+    }
+
+    result.meanMs = sum / 1000.0 / latencies.size();
+    result.p50Ms = latencies[latencies.size() / 2] / 1000.0;
+    result.p95Ms = latencies[std::min(latencies.size() - 1, latencies.size() * 95 / 100)] / 1000.0;
+    result.maxMs = latencies.back() / 1000.0;
+    result.maxLatenessMs = lock.lateness.empty() ? 0 : *std::max_element(lock.lateness.begin(), lock.lateness.end());
+    result.scheduled = lock.lateness.size();
+    result.passesPerSecond = lock._passes * 1000000.0 / (esp_timer_get_time() - startUs);
+    return result;
+}
+
+static void print(const char* name, const LatencyResult& result)
+{
+    printf("%-16s mean %7.2f ms, p50 %7.2f ms, p95 %7.2f ms, max %7.2f ms, %zu scheduled queries max %4.0f ms late, %5.1f passes/s\n",
+           name, result.meanMs, result.p50Ms, result.p95Ms, result.maxMs, result.scheduled, result.maxLatenessMs, result.passesPerSecond);
+}
+
+int main(int argc, char** argv)
+{
+    int commands = argc > 1 ? atoi(argv[1]) : 100;
+    int updateMs = argc > 2 ? atoi(argv[2]) : 0;
+
+    if(commands <= 0 || updateMs < 0)
+    {
+        printf("Usage: dispatch_latency [commands] [updateMs]\n");
+        return 1;
+    }
+
+    printf("%d lock actions, a BLE command takes %d ms\n", commands, updateMs);
+
+    LatencyResult polling = run(false, commands, updateMs);
+    print("fixed polling", polling);
+
+    LatencyResult scheduler = run(true, commands, updateMs);
+    print("scheduler", scheduler);
+    printf("scheduler recorded max dispatch latency %.2f ms\n", TaskScheduler::maxDispatchLatencyUs(SchedulerTask::Nuki) / 1000.0);
+
+    if(scheduler.p95Ms >= polling.p50Ms)
+    {
+        printf("FAIL: p95 with the scheduler is not below the median of fixed polling\n");
+        return 1;
+    }
+    if(scheduler.maxLatenessMs > NUKI_TASK_MAX_IDLE)
+    {
+        printf("FAIL: a scheduled query ran more than %d ms late\n", NUKI_TASK_MAX_IDLE);
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,28 @@
+// host stand-in for the parts of FreeRTOS used by TaskScheduler
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+typedef std::mutex portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {}
+#define portENTER_CRITICAL(mux) (mux)->lock()
+#define portEXIT_CRITICAL(mux) (mux)->unlock()
+#define portENTER_CRITICAL_ISR(mux) (mux)->lock()
+#define portEXIT_CRITICAL_ISR(mux) (mux)->unlock()
+#define portYIELD_FROM_ISR()
+
+inline bool xPortInIsrContext()
+{
+    return false;
+}
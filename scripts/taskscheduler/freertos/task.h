@@ -0,0 +1,74 @@
+// host stand-in for the task notifications used by TaskScheduler, one HostTask per thread
+#pragma once
+
+#include <chrono>
+#include <thread>
+#include "FreeRTOS.h"
+
+struct HostTask
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    uint32_t value = 0;
+    bool pending = false;
+};
+
+typedef HostTask* TaskHandle_t;
+
+enum eNotifyAction
+{
+    eSetBits
+};
+
+inline TaskHandle_t& hostCurrentTask()
+{
+    static thread_local TaskHandle_t current = nullptr;
+    return current;
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return hostCurrentTask();
+}
+
+inline BaseType_t xTaskNotify(TaskHandle_t handle, uint32_t value, eNotifyAction)
+{
+    {
+        std::lock_guard<std::mutex> lock(handle->mutex);
+        handle->value |= value;
+        handle->pending = true;
+    }
+    handle->condition.notify_one();
+    return pdTRUE;
+}
+
+inline BaseType_t xTaskNotifyFromISR(TaskHandle_t handle, uint32_t value, eNotifyAction action, BaseType_t* higherPriorityTaskWoken)
+{
+    *higherPriorityTaskWoken = pdFALSE;
+    return xTaskNotify(handle, value, action);
+}
+
+inline BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value, TickType_t ticks)
+{
+    TaskHandle_t task = hostCurrentTask();
+    std::unique_lock<std::mutex> lock(task->mutex);
+
+    if(!task->pending)
+    {
+        task->value &= ~clearOnEntry;
+    }
+    if(!task->condition.wait_for(lock, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), [task] { return task->pending; }))
+    {
+        return pdFALSE;
+    }
+
+    *value = task->value;
+    task->value &= ~clearOnExit;
+    task->pending = false;
+    return pdTRUE;
+}
+
+inline void vTaskDelay(TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
@@ -0,0 +1,54 @@
+import argparse, os, re
+
+# Extracts the page names of the /get and /post route tables in WebCfgServer.cpp
+# and their hash table sizes in WebCfgServer.h into a header for route_benchmark.cpp, so the benchmark always replays against
+# the tables the firmware is built with. Preprocessor lines inside the tables are
+# copied through; on the host they select the main firmware routes.
+
+parser = argparse.ArgumentParser(description="Generate the route lists of route_benchmark.cpp from WebCfgServer.cpp")
+parser.add_argument("source", nargs="?", default="../../src/WebCfgServer.cpp", help="WebCfgServer.cpp")
+parser.add_argument("-O", "--output", default="routes.h", help="header file to write")
+args = parser.parse_args()
+
+with open(args.source, "r") as file:
+    source = file.read()
+with open(os.path.splitext(args.source)[0] + ".h", "r") as file:
+    header = file.read()
+
+route = re.compile(r'^\s*\{\s*"(\w+)",\s*WebAuthLevel::(\w+),')
+
+def extract(table):
+    match = re.search(r"WebCfgServer::" + table + r"\[\]\s*=\s*\{\n(.*?)\n\};", source, re.S)
+    if match is None:
+        raise SystemExit("route table " + table + " not found in " + args.source)
+
+    routes = []
+    exempt = []
+    for line in match.group(1).split("\n"):
+        if line.strip().startswith("#"):
+            routes.append(line.strip())
+            exempt.append(line.strip())
+            continue
+        entry = route.match(line)
+        if entry is None:
+            continue
+        routes.append("    { \"" + entry.group(1) + "\" },")
+        # pages the former handlers let through before the authentication check
+        if entry.group(2) in ("None", "StatusJson"):
+            exempt.append("    \"" + entry.group(1) + "\",")
+    return routes, exempt
+
+content = "#pragma once\n\n"
+content += "// generated by gen_routes.py from " + os.path.basename(args.source) + ", do not edit\n\n"
+for define in ("WEB_GET_ROUTE_SLOTS", "WEB_POST_ROUTE_SLOTS"):
+    match = re.search(r"#define " + define + r" (\d+)", header)
+    if match is None:
+        raise SystemExit(define + " not found")
+    content += "#define " + define + " " + match.group(1) + "\n"
+for name, table in (("get", "_getRoutes"), ("post", "_postRoutes")):
+    routes, exempt = extract(table)
+    content += "\nstatic constexpr Route " + name + "Routes[] =\n{\n" + "\n".join(routes) + "\n};\n"
+    content += "\nstatic const char* const " + name + "Exempt[] =\n{\n" + "\n".join(exempt) + "\n};\n"
+
+with open(args.output, "w") as file:
+    file.write(content)
@@ -0,0 +1,138 @@
+/*
+  Host benchmark: cost of finding the handler for /get and /post requests.
+
+  Replays requests.txt (method and page id of a recorded browsing session, mostly
+  the status poll of the home page) against the former String comparison chains
+  of WebCfgServer::initialize() and against the perfect hash route lookup. The page
+  lists are generated from the route tables in WebCfgServer.cpp by gen_routes.py,
+  the chains compare them in table order.
+
+  python3 gen_routes.py && g++ -std=c++17 -O2 route_benchmark.cpp -o route_benchmark && ./route_benchmark requests.txt
+*/
+
+#include <chrono>
+#include <fstream>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "../../src/util/PerfectHash.h"
+
+struct Route
+{
+    const char* page;
+};
+
+// generated from the route tables in WebCfgServer.cpp by gen_routes.py
+#include "routes.h"
+
+static constexpr PerfectHashTable<WEB_GET_ROUTE_SLOTS> getIndex = buildPerfectHash<WEB_GET_ROUTE_SLOTS>(getRoutes, [](const Route& route) { return route.page; });
+static constexpr PerfectHashTable<WEB_POST_ROUTE_SLOTS> postIndex = buildPerfectHash<WEB_POST_ROUTE_SLOTS>(postRoutes, [](const Route& route) { return route.page; });
+static_assert(getIndex.valid && postIndex.valid, "no perfect hash seed");
+static constexpr size_t getExemptCount = sizeof(getExempt) / sizeof(getExempt[0]);
+static constexpr size_t postExemptCount = sizeof(postExempt) / sizeof(postExempt[0]);
+
+struct Request
+{
+    bool post;
+    std::string page;
+};
+
+// the former handlers compared an Arduino String: the exemption checks before
+// authentication, then the else if chain until the page matched
+template<size_t N>
+static int chainLookup(const Route (&routes)[N], const std::string& page, const char* const* exempt, size_t exemptCount)
+{
+    volatile int skipAuth = 0;
+    for(size_t i = 0; i < exemptCount; i++)
+    {
+        if(page == exempt[i])
+        {
+            skipAuth = 1;
+            break;
+        }
+    }
+    (void)skipAuth;
+
+    for(size_t i = 0; i < N; i++)
+    {
+        if(page == routes[i].page)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+template<size_t Slots, size_t N>
+static int hashLookup(const PerfectHashTable<Slots>& index, const Route (&routes)[N], const std::string& page)
+{
+    int candidate = perfectHashCandidate(index, page.c_str());
+    if(candidate >= 0 && strcmp(routes[candidate].page, page.c_str()) == 0)
+    {
+        return candidate;
+    }
+    return -1;
+}
+
+template<typename F>
+static double measure(const std::vector<Request>& requests, int rounds, F func)
+{
+    long checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(int round = 0; round < rounds; round++)
+    {
+        for(const auto& request : requests)
+        {
+            checksum += func(request);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    if(checksum == 42)
+    {
+        printf(" ");
+    }
+    return std::chrono::duration<double, std::nano>(end - start).count() / (rounds * requests.size());
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<Request> requests;
+    std::ifstream file(argc > 1 ? argv[1] : "requests.txt");
+    std::string method, page;
+    while(file >> method >> page)
+    {
+        requests.push_back({ method == "POST", page });
+    }
+    if(requests.empty())
+    {
+        fprintf(stderr, "no requests to replay\n");
+        return 1;
+    }
+
+    for(const auto& request : requests)
+    {
+        int chain = request.post ? chainLookup(postRoutes, request.page, postExempt, postExemptCount) : chainLookup(getRoutes, request.page, getExempt, getExemptCount);
+        int hash = request.post ? hashLookup(postIndex, postRoutes, request.page) : hashLookup(getIndex, getRoutes, request.page);
+        if(chain != hash)
+        {
+            fprintf(stderr, "mismatch for %s\n", request.page.c_str());
+            return 1;
+        }
+    }
+
+    const int rounds = 20000;
+    double chain = measure(requests, rounds, [](const Request& request)
+    {
+        return request.post ? chainLookup(postRoutes, request.page, postExempt, postExemptCount) : chainLookup(getRoutes, request.page, getExempt, getExemptCount);
+    });
+    double hash = measure(requests, rounds, [](const Request& request)
+    {
+        return request.post ? hashLookup(postIndex, postRoutes, request.page) : hashLookup(getIndex, getRoutes, request.page);
+    });
+
+    printf("%zu requests, GET seed %u, POST seed %u\n", requests.size(), getIndex.seed, postIndex.seed);
+    printf("String chain:   %6.1f ns per request\n", chain);
+    printf("perfect hash:   %6.1f ns per request\n", hash);
+    return 0;
+}
@@ -1,11 +0,0 @@
-#pragma once
-
-class CharBuffer
-{
-public:
-    static void initialize(char16_t buffer_size);
-    static char* get();
-
-private:
-    static char* _buffer;
-};
\ No newline at end of file
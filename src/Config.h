@@ -263,7 +263,33 @@
 #endif
 
 #define NETWORK_TASK_SIZE 12288
+#define NETWORK_TASK_MAX_IDLE 50
+#define NUKI_TASK_MAX_IDLE 250
 #define HTTPD_TASK_SIZE 8192
+#define WEB_STATUS_EVENTS_INTERVAL 500
+
+// web server connection handling, override with build flags
+#ifndef HTTPD_SSL_MAX_OPEN_SOCKETS
+#define HTTPD_SSL_MAX_OPEN_SOCKETS 8
+#endif
+#ifndef HTTPD_LRU_PURGE_ENABLE
+#define HTTPD_LRU_PURGE_ENABLE true
+#endif
+#ifndef HTTPD_KEEP_ALIVE_ENABLE
+#define HTTPD_KEEP_ALIVE_ENABLE true
+#endif
+#ifndef HTTPD_KEEP_ALIVE_IDLE
+#define HTTPD_KEEP_ALIVE_IDLE 5
+#endif
+#ifndef HTTPD_KEEP_ALIVE_INTERVAL
+#define HTTPD_KEEP_ALIVE_INTERVAL 5
+#endif
+#ifndef HTTPD_KEEP_ALIVE_COUNT
+#define HTTPD_KEEP_ALIVE_COUNT 3
+#endif
+#ifndef HTTPD_SSL_SESSION_TICKETS
+#define HTTPD_SSL_SESSION_TICKETS true
+#endif
 
 #ifndef CHUNK_SIZE
 #define CHUNK_SIZE 1400
@@ -0,0 +1,109 @@
+#include "ConfigSnapshot.h"
+
+ConfigSnapshot::ConfigSnapshot(Preferences* preferences)
+    : _preferences(preferences)
+{
+    _mutex = xSemaphoreCreateMutex();
+    ConfigValues values;
+    load(values);
+    activate(values);
+}
+
+std::shared_ptr<const ConfigValues> ConfigSnapshot::get() const
+{
+    taskENTER_CRITICAL(&_valuesMux);
+    std::shared_ptr<const ConfigValues> values = _values;
+    taskEXIT_CRITICAL(&_valuesMux);
+    return values;
+}
+
+ConfigValues ConfigSnapshot::edit() const
+{
+    return *get();
+}
+
+void ConfigSnapshot::commit(const ConfigValues& values)
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+
+    std::shared_ptr<const ConfigValues> snapshot = get();
+    const ConfigValues& current = *snapshot;
+
+#define CONFIG_SNAPSHOT_PUT(type, accessor, field, key, defaultValue) \
+    if(!(values.field == current.field)) \
+    { \
+        _preferences->put##accessor(key, values.field); \
+    }
+    CONFIG_SNAPSHOT_FIELDS(CONFIG_SNAPSHOT_PUT)
+#undef CONFIG_SNAPSHOT_PUT
+
+    // reload so fields sharing a key see the written value
+    ConfigValues stored;
+    load(stored);
+    bool changed = !equals(stored, current);
+    activate(stored);
+
+    xSemaphoreGive(_mutex);
+
+    if(changed)
+    {
+        for(const auto& changedCallback : _changedCallbacks)
+        {
+            changedCallback();
+        }
+    }
+}
+
+void ConfigSnapshot::reload(bool notify)
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+
+    ConfigValues stored;
+    load(stored);
+    bool changed = !equals(stored, *get());
+    activate(stored);
+
+    xSemaphoreGive(_mutex);
+
+    if(notify && changed)
+    {
+        for(const auto& changedCallback : _changedCallbacks)
+        {
+            changedCallback();
+        }
+    }
+}
+
+void ConfigSnapshot::addChangedCallback(std::function<void()> changedCallback)
+{
+    _changedCallbacks.push_back(changedCallback);
+}
+
+void ConfigSnapshot::load(ConfigValues& values)
+{
+#define CONFIG_SNAPSHOT_GET(type, accessor, field, key, defaultValue) values.field = _preferences->get##accessor(key, defaultValue);
+    CONFIG_SNAPSHOT_FIELDS(CONFIG_SNAPSHOT_GET)
+#undef CONFIG_SNAPSHOT_GET
+}
+
+bool ConfigSnapshot::equals(const ConfigValues& a, const ConfigValues& b) const
+{
+#define CONFIG_SNAPSHOT_COMPARE(type, accessor, field, key, defaultValue) \
+    if(!(a.field == b.field)) \
+    { \
+        return false; \
+    }
+    CONFIG_SNAPSHOT_FIELDS(CONFIG_SNAPSHOT_COMPARE)
+#undef CONFIG_SNAPSHOT_COMPARE
+
+    return true;
+}
+
+void ConfigSnapshot::activate(const ConfigValues& values)
+{
+    // the previous snapshot is freed by the last reader releasing it, outside the critical section
+    std::shared_ptr<const ConfigValues> next = std::make_shared<const ConfigValues>(values);
+    taskENTER_CRITICAL(&_valuesMux);
+    _values.swap(next);
+    taskEXIT_CRITICAL(&_valuesMux);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Preferences.h>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "Config.h"
+#include "PreferencesKeys.h"
+#include "enums/NukiPinState.h"
+
+// type, Preferences accessor, field, key, default
+#define CONFIG_SNAPSHOT_FIELDS(X) \
+    X(bool, Bool, updateTime, preference_update_time, false) \
+    X(int, Int, authMaxEntries, preference_auth_max_entries, MAX_AUTH) \
+    X(int, Int, authlogMaxEntries, preference_authlog_max_entries, MAX_AUTHLOG) \
+    X(int, Int, lockPinStatus, preference_lock_pin_status, (int)NukiPinState::NotConfigured) \
+    X(int, Int, openerPinStatus, preference_opener_pin_status, (int)NukiPinState::NotConfigured) \
+    X(String, String, mqttHassDiscovery, preference_mqtt_hass_discovery, "")
+
+struct ConfigValues
+{
+#define CONFIG_SNAPSHOT_MEMBER(type, accessor, field, key, defaultValue) type field = defaultValue;
+    CONFIG_SNAPSHOT_FIELDS(CONFIG_SNAPSHOT_MEMBER)
+#undef CONFIG_SNAPSHOT_MEMBER
+};
+
+class ConfigSnapshot
+{
+public:
+    explicit ConfigSnapshot(Preferences* preferences);
+
+    // readers keep their snapshot alive while a commit swaps in a new one
+    std::shared_ptr<const ConfigValues> get() const;
+    ConfigValues edit() const;
+
+    void commit(const ConfigValues& values);
+    void reload(bool notify = true);
+    void addChangedCallback(std::function<void()> changedCallback);
+
+private:
+    void load(ConfigValues& values);
+    bool equals(const ConfigValues& a, const ConfigValues& b) const;
+    void activate(const ConfigValues& values);
+
+    Preferences* _preferences;
+    std::shared_ptr<const ConfigValues> _values;
+    mutable portMUX_TYPE _valuesMux = portMUX_INITIALIZER_UNLOCKED;
+    SemaphoreHandle_t _mutex;
+    std::vector<std::function<void()>> _changedCallbacks;
+};
@@ -1,6 +1,7 @@
 #include "HomeAssistantDiscovery.h"
 #include "Config.h"
 #include "Logger.h"
+#include "util/ScratchArena.h"
 #include "PreferencesKeys.h"
 #include "MqttTopics.h"
 #if defined(CONFIG_ESP_HOSTED_ENABLE_BT_NIMBLE) || defined(CONFIG_ESP_WIFI_REMOTE_ENABLED)
@@ -9,14 +10,29 @@
 #include "esp_mac.h"
 #endif
 
-HomeAssistantDiscovery::HomeAssistantDiscovery(NetworkDevice* device, Preferences *preferences, char* buffer, size_t bufferSize)
+HomeAssistantDiscovery::HomeAssistantDiscovery(NetworkDevice* device, Preferences *preferences, ConfigSnapshot* config)
     : _device(device),
       _preferences(preferences),
-      _buffer(buffer),
-      _bufferSize(bufferSize)
+      _config(config)
 {
     _baseTopic = _preferences->getString(preference_mqtt_lock_path);
     _hostname = _preferences->getString(preference_hostname, "");
+
+    // stored hashes are only valid for the broker holding the retained configs
+    _brokerSeed = discoveryHash(_preferences->getString(preference_mqtt_broker, "").c_str());
+    _discoveryHashesMutex = xSemaphoreCreateMutex();
+    _discoveryHashes.begin("nukihub_ha", false);
+    _discoveryPrefix = _config->get()->mqttHassDiscovery;
+
+    _config->addChangedCallback([this]()
+    {
+        // configs under the old prefix are no longer tracked
+        if(_config->get()->mqttHassDiscovery != _discoveryPrefix)
+        {
+            _discoveryPrefix = _config->get()->mqttHassDiscovery;
+            resetDiscoveryHashes();
+        }
+    });
 }
 
 void HomeAssistantDiscovery::setupHASS(int type, uint32_t nukiId, char* nukiName, const char* firmwareVersion, const char* hardwareVersion, bool hasDoorSensor, bool hasKeypad)
@@ -88,6 +104,7 @@ void HomeAssistantDiscovery::setupHASS(int type, uint32_t nukiId, char* nukiName
     char uidString[20];
     itoa(nukiId, uidString, 16);
     bool publishAuthData = _preferences->getBool(preference_publish_authdata, false);
+    _unchangedDiscoveryCount = 0;
 
     if(type == 0)
     {
@@ -124,6 +141,12 @@ void HomeAssistantDiscovery::setupHASS(int type, uint32_t nukiId, char* nukiName
 
         Log->println("HomeAssistant setup for opener completed.");
     }
+
+    if(_unchangedDiscoveryCount > 0)
+    {
+        Log->print("HomeAssistant discovery configs unchanged and not republished: ");
+        Log->println(_unchangedDiscoveryCount);
+    }
 }
 
 void HomeAssistantDiscovery::disableHASS()
@@ -157,6 +180,15 @@ void HomeAssistantDiscovery::disableHASS()
         }
         vTaskDelay(3000 / portTICK_PERIOD_MS);
     }
+
+    resetDiscoveryHashes();
+}
+
+void HomeAssistantDiscovery::resetDiscoveryHashes()
+{
+    xSemaphoreTake(_discoveryHashesMutex, portMAX_DELAY);
+    _discoveryHashes.clear();
+    xSemaphoreGive(_discoveryHashesMutex);
 }
 
 void HomeAssistantDiscovery::publishHASSNukiHubConfig()
@@ -198,14 +230,15 @@ void HomeAssistantDiscovery::publishHASSNukiHubConfig()
     json["stat_on"] = "1";
     json["stat_off"] = "0";
 
-    serializeJson(json, _buffer, _bufferSize);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
 
-    String path = _preferences->getString(preference_mqtt_hass_discovery, "homeassistant");
+    String path = _config->get()->mqttHassDiscovery;
     path.concat("/switch/");
     path.concat(_nukiHubUidString);
     path.concat("/reset/config");
 
-    _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+    publishDiscoveryConfig(path, buffer.data());
 
 #ifndef CONFIG_IDF_TARGET_ESP32H2
     publishHassTopic("sensor",
@@ -588,14 +621,15 @@ void HomeAssistantDiscovery::publishHASSDeviceConfig(char* deviceType, const cha
     json["stat_opening"] = "opening";
     json["opt"] = "false";
 
-    serializeJson(json, _buffer, _bufferSize);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
 
-    String path = _preferences->getString(preference_mqtt_hass_discovery, "homeassistant");
+    String path = _config->get()->mqttHassDiscovery;
     path.concat("/lock/");
     path.concat(uidString);
     path.concat("/smartlock/config");
 
-    _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+    publishDiscoveryConfig(path, buffer.data());
 
 
     // Firmware version
@@ -1252,9 +1286,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalLockEntities(char *devic
         json["options"][2] = "Lock";
         json["options"][3] = "Lock n Go";
         json["options"][4] = "Intelligent";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "fob_action_1", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -1270,9 +1305,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalLockEntities(char *devic
         json["options"][2] = "Lock";
         json["options"][3] = "Lock n Go";
         json["options"][4] = "Intelligent";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "fob_action_2", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -1288,9 +1324,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalLockEntities(char *devic
         json["options"][2] = "Lock";
         json["options"][3] = "Lock n Go";
         json["options"][4] = "Intelligent";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "fob_action_3", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -1305,9 +1342,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalLockEntities(char *devic
         json["options"][1] = "Normal";
         json["options"][2] = "Slow";
         json["options"][3] = "Slowest";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "advertising_mode", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -1366,9 +1404,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalLockEntities(char *devic
         json["options"][45] = "Pacific/Pago_Pago";
         json["options"][46] = "None";
 
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "timezone", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -1526,9 +1565,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalLockEntities(char *devic
         json["options"][4] = "Unlatch";
         json["options"][5] = "Lock n Go";
         json["options"][6] = "Show Status";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "single_button_press_action", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -1546,9 +1586,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalLockEntities(char *devic
         json["options"][4] = "Unlatch";
         json["options"][5] = "Lock n Go";
         json["options"][6] = "Show Status";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "double_button_press_action", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -1593,9 +1634,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalLockEntities(char *devic
         json["options"][1] = "Accumulators";
         json["options"][2] = "Lithium";
         json["options"][3] = "No Warnings";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "battery_type", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -1936,9 +1978,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalLockEntities(char *devic
         json["options"][0] = "Standard";
         json["options"][1] = "Insane";
         json["options"][2] = "Gentle";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "motor_speed", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2158,9 +2201,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
     json["event_types"][0] = "ring";
     json["event_types"][1] = "ringlocked";
     json["event_types"][2] = "standby";
-    serializeJson(json, _buffer, _bufferSize);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
     String path = createHassTopicPath("event", "ring", uidString);
-    _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+    publishDiscoveryConfig(path, buffer.data());
 
     if((int)basicOpenerConfigAclPrefs[5] == 1)
     {
@@ -2354,9 +2398,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][3] = "Deactivate RTO";
         json["options"][4] = "Open";
         json["options"][5] = "Ring";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "fob_action_1", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2373,9 +2418,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][3] = "Deactivate RTO";
         json["options"][4] = "Open";
         json["options"][5] = "Ring";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "fob_action_2", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2392,9 +2438,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][3] = "Deactivate RTO";
         json["options"][4] = "Open";
         json["options"][5] = "Ring";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "fob_action_3", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2409,9 +2456,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][1] = "Normal";
         json["options"][2] = "Slow";
         json["options"][3] = "Slowest";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "advertising_mode", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2470,9 +2518,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][45] = "Pacific/Pago_Pago";
         json["options"][46] = "None";
 
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "timezone", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2499,9 +2548,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][13] = "Golmar";
         json["options"][14] = "SKS";
         json["options"][15] = "Spare";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "operating_mode", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2723,9 +2773,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][5] = "CM & Ring";
         json["options"][6] = "RTO & Ring";
         json["options"][7] = "CM & RTO & Ring";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "doorbell_suppression", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2769,9 +2820,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][1] = "Sound 1";
         json["options"][2] = "Sound 2";
         json["options"][3] = "Sound 3";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "sound_ring", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2786,9 +2838,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][1] = "Sound 1";
         json["options"][2] = "Sound 2";
         json["options"][3] = "Sound 3";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "sound_open", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2803,9 +2856,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][1] = "Sound 1";
         json["options"][2] = "Sound 2";
         json["options"][3] = "Sound 3";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "sound_rto", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2820,9 +2874,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][1] = "Sound 1";
         json["options"][2] = "Sound 2";
         json["options"][3] = "Sound 3";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "sound_cm", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2871,9 +2926,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][5] = "Activate CM";
         json["options"][6] = "Deactivate CM";
         json["options"][7] = "Open";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "single_button_press_action", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2892,9 +2948,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][5] = "Activate CM";
         json["options"][6] = "Deactivate CM";
         json["options"][7] = "Open";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "double_button_press_action", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -2909,9 +2966,10 @@ void HomeAssistantDiscovery::publishHASSConfigAdditionalOpenerEntities(char *dev
         json["options"][1] = "Accumulators";
         json["options"][2] = "Lithium";
         json["options"][3] = "No Warnings";
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath("select", "battery_type", uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
     else
     {
@@ -3084,19 +3142,20 @@ void HomeAssistantDiscovery::publishHassTopic(const String& mqttDeviceType,
         std::vector<std::pair<char*, char*>> additionalEntries
                                              )
 {
-    if (_preferences->getString(preference_mqtt_hass_discovery, "") != "")
+    if (_config->get()->mqttHassDiscovery != "")
     {
         JsonDocument json;
         json = createHassJson(uidString, uidStringPostfix, displayName, name, baseTopic, stateTopic, deviceType, deviceClass, stateClass, entityCat, commandTopic, additionalEntries);
-        serializeJson(json, _buffer, _bufferSize);
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
         String path = createHassTopicPath(mqttDeviceType, mqttDeviceName, uidString);
-        _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, _buffer);
+        publishDiscoveryConfig(path, buffer.data());
     }
 }
 
 String HomeAssistantDiscovery::createHassTopicPath(const String& mqttDeviceType, const String& mqttDeviceName, const String& uidString)
 {
-    String path = _preferences->getString(preference_mqtt_hass_discovery, "");
+    String path = _config->get()->mqttHassDiscovery;
     path.concat("/");
     path.concat(mqttDeviceType);
     path.concat("/");
@@ -3110,11 +3169,65 @@ String HomeAssistantDiscovery::createHassTopicPath(const String& mqttDeviceType,
 
 void HomeAssistantDiscovery::removeHassTopic(const String& mqttDeviceType, const String& mqttDeviceName, const String& uidString)
 {
-    if (_preferences->getString(preference_mqtt_hass_discovery, "") != "")
+    if (_config->get()->mqttHassDiscovery != "")
     {
         String path = createHassTopicPath(mqttDeviceType, mqttDeviceName, uidString);
         _device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, "");
+
+        char key[9];
+        discoveryHashKey(path, key);
+        xSemaphoreTake(_discoveryHashesMutex, portMAX_DELAY);
+        if(_discoveryHashes.isKey(key))
+        {
+            _discoveryHashes.remove(key);
+        }
+        xSemaphoreGive(_discoveryHashesMutex);
+    }
+}
+
+void HomeAssistantDiscovery::publishDiscoveryConfig(const String& path, const char* payload)
+{
+    char key[9];
+    discoveryHashKey(path, key);
+    uint32_t payloadHash = discoveryHash(payload);
+
+    xSemaphoreTake(_discoveryHashesMutex, portMAX_DELAY);
+    bool unchanged = _discoveryHashes.isKey(key) && _discoveryHashes.getUInt(key, 0) == payloadHash;
+    xSemaphoreGive(_discoveryHashesMutex);
+
+    if(unchanged)
+    {
+        ++_unchangedDiscoveryCount;
+        return;
+    }
+
+    if(_device->mqttPublish(path.c_str(), MQTT_QOS_LEVEL, true, payload) != 0)
+    {
+        xSemaphoreTake(_discoveryHashesMutex, portMAX_DELAY);
+        _discoveryHashes.putUInt(key, payloadHash);
+        xSemaphoreGive(_discoveryHashesMutex);
+    }
+}
+
+void HomeAssistantDiscovery::discoveryHashKey(const String& path, char* outKey)
+{
+    // NVS keys are limited to 15 characters
+    sprintf(outKey, "%08" PRIx32, discoveryHash(path.c_str(), _brokerSeed));
+}
+
+uint32_t HomeAssistantDiscovery::discoveryHash(const char* data, uint32_t seed)
+{
+    // FNV-1a
+    uint32_t value = seed;
+
+    while(*data != 0)
+    {
+        value ^= (uint8_t)*data;
+        value *= 16777619u;
+        ++data;
     }
+
+    return value;
 }
 
 void HomeAssistantDiscovery::removeHASSConfig(char* uidString)
@@ -2,13 +2,16 @@
 #include <Preferences.h>
 #include <ArduinoJson.h>
 #include "networkDevices/NetworkDevice.h"
+#include "ConfigSnapshot.h"
 
 class HomeAssistantDiscovery
 {
 public:
-    explicit HomeAssistantDiscovery(NetworkDevice* device, Preferences* preferences, char* buffer, size_t bufferSize);
+    explicit HomeAssistantDiscovery(NetworkDevice* device, Preferences* preferences, ConfigSnapshot* config);
     void setupHASS(int type, uint32_t nukiId, char* nukiName, const char* firmwareVersion, const char* hardwareVersion, bool hasDoorSensor, bool hasKeypad);
     void disableHASS();
+    // forgets the published discovery configs, the next setupHASS() publishes all of them
+    void resetDiscoveryHashes();
     void removeHassTopic(const String& mqttDeviceType, const String& mqttDeviceName, const String& uidString);
     void publishHassTopic(const String& mqttDeviceType,
                           const String& mqttDeviceName,
@@ -42,6 +45,9 @@ private:
     void removeHASSConfigTopic(char* deviceType, char* name, char* uidString);
 
     String createHassTopicPath(const String& mqttDeviceType, const String& mqttDeviceName, const String& uidString);
+    void publishDiscoveryConfig(const String& path, const char* payload);
+    void discoveryHashKey(const String& path, char* outKey);
+    static uint32_t discoveryHash(const char* data, uint32_t seed = 2166136261u);
     JsonDocument createHassJson(const String& uidString,
                                 const String& uidStringPostfix,
                                 const String& displayName,
@@ -58,6 +64,13 @@ private:
 
     NetworkDevice* _device = nullptr;
     Preferences* _preferences = nullptr;
+    ConfigSnapshot* _config = nullptr;
+    // payload hash per config topic, kept across reboots until Home Assistant sends its birth message
+    Preferences _discoveryHashes;
+    SemaphoreHandle_t _discoveryHashesMutex;
+    uint32_t _brokerSeed = 0;
+    String _discoveryPrefix;
+    uint32_t _unchangedDiscoveryCount = 0;
 
     String _baseTopic;
     String _hostname;
@@ -65,6 +78,4 @@ private:
     JsonDocument _uidToName;
     char _nukiHubUidString[21];
 
-    char* _buffer;
-    const size_t _bufferSize;
 };
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "SPIFFS.h"
 #include "Logger.h"
 #include "PreferencesKeys.h"
+#include "PreferencesRegistry.h"
+#include "util/WriteBehindStore.h"
 #include <DuoAuthLib.h>
 #include <TOTP-RC6236-generator.hpp>
 
@@ -120,17 +122,7 @@ void ImportExport::saveSessions()
 {
     if(_updateTime)
     {
-        if (!SPIFFS.begin(true))
-        {
-            Log->println("SPIFFS Mount Failed");
-        }
-        else
-        {
-            File file;
-            file = SPIFFS.open("/duosessions.json", "w");
-            serializeJson(_duoSessions, file);
-            file.close();
-        }
+        WriteBehindStore::get()->writeFile("/duosessions.bin", _duoSessions.snapshot());
     }
 }
 
@@ -189,7 +181,7 @@ int ImportExport::checkDuoAuth(PsychicRequest *request)
                         struct timeval time;
                         gettimeofday(&time, NULL);
                         int64_t time_us = (int64_t)time.tv_sec * 1000000L + (int64_t)time.tv_usec;
-                        _duoSessions[id] = time_us + (durationLength*1000000L);
+                        _duoSessions.add(id.c_str(), time_us + (durationLength*1000000L));
                         saveSessions();
                         if (_preferences->getBool(preference_mfa_reconfigure, false))
                         {
@@ -464,82 +456,45 @@ void ImportExport::exportMqttsJson(JsonDocument &json)
 
 void ImportExport::exportNukiHubJson(JsonDocument &json, bool redacted, bool pairing, bool nuki, bool nukiOpener)
 {
-    DebugPreferences debugPreferences;
+#ifdef DEBUG_NUKIHUB
+    int64_t startUs = esp_timer_get_time();
+#endif
 
-    const std::vector<char*> keysPrefs = debugPreferences.getPreferencesKeys();
-    const std::vector<char*> boolPrefs = debugPreferences.getPreferencesBoolKeys();
-    const std::vector<char*> redactedPrefs = debugPreferences.getPreferencesRedactedKeys();
-    const std::vector<char*> bytePrefs = debugPreferences.getPreferencesByteKeys();
-
-    for(const auto& key : keysPrefs)
+    for(const auto& entry : preferenceRegistry)
     {
-        if(strcmp(key, preference_show_secrets) == 0)
-        {
-            continue;
-        }
-        if(strcmp(key, preference_latest_version) == 0)
-        {
-            continue;
-        }
-        if(strcmp(key, preference_totp_secret) == 0)
-        {
-            continue;
-        }
-        if(strcmp(key, preference_bypass_secret) == 0)
+        const char* key = entry.key;
+
+        if(entry.type == PreferenceType::Bytes || (entry.flags & PREFERENCE_FLAG_NO_EXPORT))
         {
             continue;
         }
-        if(strcmp(key, preference_admin_secret) == 0)
+        if(!redacted && (entry.flags & PREFERENCE_FLAG_REDACT))
         {
             continue;
         }
-        if(!redacted) if(std::find(redactedPrefs.begin(), redactedPrefs.end(), key) != redactedPrefs.end())
-            {
-                continue;
-            }
         if(!_preferences->isKey(key))
         {
             json[key] = "";
+            continue;
         }
-        else if(std::find(boolPrefs.begin(), boolPrefs.end(), key) != boolPrefs.end())
+
+        switch(entry.type)
         {
+        case PreferenceType::Bool:
             json[key] = _preferences->getBool(key) ? "1" : "0";
-        }
-        else
-        {
-            switch(_preferences->getType(key))
-            {
-            case PT_I8:
-                json[key] = String(_preferences->getChar(key));
-                break;
-            case PT_I16:
-                json[key] = String(_preferences->getShort(key));
-                break;
-            case PT_I32:
-                json[key] = String(_preferences->getInt(key));
-                break;
-            case PT_I64:
-                json[key] = String(_preferences->getLong64(key));
-                break;
-            case PT_U8:
-                json[key] = String(_preferences->getUChar(key));
-                break;
-            case PT_U16:
-                json[key] = String(_preferences->getUShort(key));
-                break;
-            case PT_U32:
-                json[key] = String(_preferences->getUInt(key));
-                break;
-            case PT_U64:
-                json[key] = String(_preferences->getULong64(key));
-                break;
-            case PT_STR:
-                json[key] = _preferences->getString(key);
-                break;
-            default:
-                json[key] = _preferences->getString(key);
-                break;
-            }
+            break;
+        case PreferenceType::Int:
+            json[key] = String(_preferences->getInt(key));
+            break;
+        case PreferenceType::UInt:
+            json[key] = String(_preferences->getUInt(key));
+            break;
+        case PreferenceType::UInt64:
+            json[key] = String(_preferences->getULong64(key));
+            break;
+        default:
+            json[key] = _preferences->getString(key);
+            break;
         }
     }
 
@@ -633,8 +588,13 @@ void ImportExport::exportNukiHubJson(JsonDocument &json, bool redacted, bool pai
         }
     }
 
-    for(const auto& key : bytePrefs)
+    for(const auto& entry : preferenceRegistry)
     {
+        if(entry.type != PreferenceType::Bytes)
+        {
+            continue;
+        }
+        const char* key = entry.key;
         size_t storedLength = _preferences->getBytesLength(key);
         if(storedLength == 0)
         {
@@ -657,111 +617,207 @@ void ImportExport::exportNukiHubJson(JsonDocument &json, bool redacted, bool pai
         json[key] = text;
         memset(text, 0, sizeof(text));
     }
+
+#ifdef DEBUG_NUKIHUB
+    Log->print("Settings export took (us): ");
+    Log->println((int32_t)(esp_timer_get_time() - startUs));
+#endif
 }
 
-JsonDocument ImportExport::importJson(JsonDocument &doc)
+static bool isSettingsApiEntry(const PreferenceEntry& entry)
 {
-    JsonDocument json;
-    unsigned char currentBleAddress[6];
-    unsigned char authorizationId[4] = {0x00};
-    unsigned char secretKeyK[32] = {0x00};
-    unsigned char currentBleAddressOpn[6];
-    unsigned char authorizationIdOpn[4] = {0x00};
-    unsigned char secretKeyKOpn[32] = {0x00};
-
-    DebugPreferences debugPreferences;
+    // internal state, byte arrays, secrets and credentials stay out of the settings UI,
+    // credentials are only changed through the credentials form
+    return entry.type != PreferenceType::Bytes && entry.type != PreferenceType::UInt64 && entry.apply != PreferenceApply::Internal &&
+           !(entry.flags & (PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_NO_EXPORT | PREFERENCE_FLAG_NO_IMPORT | PREFERENCE_FLAG_CREDENTIAL));
+}
 
-    const std::vector<char*> keysPrefs = debugPreferences.getPreferencesKeys();
-    const std::vector<char*> boolPrefs = debugPreferences.getPreferencesBoolKeys();
-    const std::vector<char*> bytePrefs = debugPreferences.getPreferencesByteKeys();
-    const std::vector<char*> intPrefs = debugPreferences.getPreferencesIntKeys();
-    const std::vector<char*> uintPrefs = debugPreferences.getPreferencesUIntKeys();
-    const std::vector<char*> uint64Prefs = debugPreferences.getPreferencesUInt64Keys();
+void ImportExport::exportSettingsApi(JsonDocument &json)
+{
+    JsonArray settings = json["settings"].to<JsonArray>();
 
-    for(const auto& key : keysPrefs)
+    for(const auto& entry : preferenceRegistry)
     {
-        if(doc[key].isNull())
+        if(!isSettingsApiEntry(entry))
         {
             continue;
         }
-        if(strcmp(key, preference_show_secrets) == 0)
-        {
-            continue;
+
+        const char* key = entry.key;
+        JsonArray item = settings.add<JsonArray>();
+        item.add(key);
+        item.add(entry.type == PreferenceType::Bool ? "b" : entry.type == PreferenceType::Int ? "i" : entry.type == PreferenceType::UInt ? "u" : "s");
+        item.add((int)entry.apply);
+
+        switch(entry.type)
+        {
+        case PreferenceType::Bool:
+            item.add(entry.defaultValue != 0);
+            break;
+        case PreferenceType::Int:
+            item.add((int32_t)entry.defaultValue);
+            break;
+        case PreferenceType::UInt:
+            item.add((uint32_t)entry.defaultValue);
+            break;
+        default:
+            item.add(entry.defaultString);
+            break;
         }
-        if(strcmp(key, preference_latest_version) == 0)
+
+        switch(entry.type)
+        {
+        case PreferenceType::Bool:
+            item.add(_preferences->getBool(key, entry.defaultValue != 0));
+            break;
+        case PreferenceType::Int:
+            item.add(_preferences->getInt(key, entry.defaultValue));
+            break;
+        case PreferenceType::UInt:
+            item.add(_preferences->getUInt(key, entry.defaultValue));
+            break;
+        default:
+            item.add(_preferences->getString(key, entry.defaultString));
+            break;
+        }
+    }
+}
+
+JsonDocument ImportExport::importSettingsApi(JsonDocument &doc, PreferenceApply& apply)
+{
+    JsonDocument json;
+    apply = PreferenceApply::Immediately;
+
+    for(JsonPair kv : doc.as<JsonObject>())
+    {
+        const char* key = kv.key().c_str();
+        JsonVariant value = kv.value();
+        const PreferenceEntry* entry = findPreference(key);
+
+        if(entry == nullptr || !isSettingsApiEntry(*entry) || value.isNull())
         {
+            json[key] = "rejected";
             continue;
         }
-        if(std::find(boolPrefs.begin(), boolPrefs.end(), key) != boolPrefs.end())
+
+        switch(entry->type)
         {
-            if (doc[key].as<String>().length() > 0)
-            {
-                _preferences->putBool(key, (doc[key].as<String>() == "1" ? true : false));
-                json[key] = "changed";
-            }
-            else
+        case PreferenceType::Bool:
+        {
+            bool newValue = value.is<bool>() ? value.as<bool>() : value.as<String>() == "1";
+            if(_preferences->getBool(key, entry->defaultValue != 0) == newValue && _preferences->isKey(key))
             {
-                json[key] = "removed";
-                _preferences->remove(key);
+                continue;
             }
-            continue;
+            _preferences->putBool(key, newValue);
+            break;
         }
-        if(std::find(intPrefs.begin(), intPrefs.end(), key) != intPrefs.end())
+        case PreferenceType::Int:
         {
-            if (doc[key].as<String>().length() > 0)
+            int32_t newValue = value.is<const char*>() ? value.as<String>().toInt() : value.as<int32_t>();
+            if(_preferences->getInt(key, entry->defaultValue) == newValue && _preferences->isKey(key))
             {
-                json[key] = "changed";
-                _preferences->putInt(key, doc[key].as<int>());
-            }
-            else
-            {
-                json[key] = "removed";
-                _preferences->remove(key);
+                continue;
             }
-            continue;
+            _preferences->putInt(key, newValue);
+            break;
         }
-        if(std::find(uintPrefs.begin(), uintPrefs.end(), key) != uintPrefs.end())
+        case PreferenceType::UInt:
         {
-            if (doc[key].as<String>().length() > 0)
-            {
-                json[key] = "changed";
-                _preferences->putUInt(key, doc[key].as<uint32_t>());
-            }
-            else
+            uint32_t newValue = value.is<const char*>() ? (uint32_t)value.as<String>().toInt() : value.as<uint32_t>();
+            if(_preferences->getUInt(key, entry->defaultValue) == newValue && _preferences->isKey(key))
             {
-                json[key] = "removed";
-                _preferences->remove(key);
+                continue;
             }
-            continue;
+            _preferences->putUInt(key, newValue);
+            break;
         }
-        if(std::find(uint64Prefs.begin(), uint64Prefs.end(), key) != uint64Prefs.end())
+        default:
         {
-            if (doc[key].as<String>().length() > 0)
+            String newValue = value.as<String>();
+            if(_preferences->getString(key, entry->defaultString) == newValue && _preferences->isKey(key))
             {
-                json[key] = "changed";
-                _preferences->putULong64(key, doc[key].as<uint64_t>());
-            }
-            else
-            {
-                json[key] = "removed";
-                _preferences->remove(key);
+                continue;
             }
+            _preferences->putString(key, newValue);
+            break;
+        }
+        }
+
+        json[key] = "changed";
+        if(entry->apply > apply)
+        {
+            apply = entry->apply;
+        }
+        Log->print("Setting changed: ");
+        Log->println(key);
+    }
+
+    return json;
+}
+
+JsonDocument ImportExport::importJson(JsonDocument &doc)
+{
+    JsonDocument json;
+    unsigned char currentBleAddress[6];
+    unsigned char authorizationId[4] = {0x00};
+    unsigned char secretKeyK[32] = {0x00};
+    unsigned char currentBleAddressOpn[6];
+    unsigned char authorizationIdOpn[4] = {0x00};
+    unsigned char secretKeyKOpn[32] = {0x00};
+
+#ifdef DEBUG_NUKIHUB
+    int64_t startUs = esp_timer_get_time();
+#endif
+
+    for(const auto& entry : preferenceRegistry)
+    {
+        const char* key = entry.key;
+
+        if(doc[key].isNull() || (entry.flags & PREFERENCE_FLAG_NO_IMPORT))
+        {
             continue;
         }
-        if (doc[key].as<String>().length() > 0)
+        if(entry.type == PreferenceType::Bytes)
         {
-            json[key] = "changed";
-            _preferences->putString(key, doc[key].as<String>());
+            continue;
         }
-        else
+        if(doc[key].as<String>().length() == 0)
         {
             json[key] = "removed";
             _preferences->remove(key);
+            continue;
+        }
+
+        switch(entry.type)
+        {
+        case PreferenceType::Bool:
+            _preferences->putBool(key, (doc[key].as<String>() == "1" ? true : false));
+            break;
+        case PreferenceType::Int:
+            _preferences->putInt(key, doc[key].as<int>());
+            break;
+        case PreferenceType::UInt:
+            _preferences->putUInt(key, doc[key].as<uint32_t>());
+            break;
+        case PreferenceType::UInt64:
+            _preferences->putULong64(key, doc[key].as<uint64_t>());
+            break;
+        default:
+            _preferences->putString(key, doc[key].as<String>());
+            break;
         }
+        json[key] = "changed";
     }
 
-    for(const auto& key : bytePrefs)
+    for(const auto& entry : preferenceRegistry)
     {
+        const char* key = entry.key;
+
+        if(entry.type != PreferenceType::Bytes)
+        {
+            continue;
+        }
         if(!doc[key].isNull() && doc[key].is<JsonVariant>())
         {
             String value = doc[key].as<String>();
@@ -1143,5 +1199,10 @@ JsonDocument ImportExport::importJson(JsonDocument &doc)
         }
     }
 
+#ifdef DEBUG_NUKIHUB
+    Log->print("Settings import took (us): ");
+    Log->println((int32_t)(esp_timer_get_time() - startUs));
+#endif
+
     return json;
 }
\ No newline at end of file
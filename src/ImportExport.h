@@ -3,6 +3,9 @@
 #include <Preferences.h>
 #include "ArduinoJson.h"
 #include <PsychicHttp.h>
+#include "util/SessionTable.h"
+
+enum class PreferenceApply : uint8_t;
 
 class ImportExport
 {
@@ -12,6 +15,8 @@ public:
     void exportMqttsJson(JsonDocument &json);
     void exportNukiHubJson(JsonDocument &json, bool redacted = false, bool pairing = false, bool nuki = false, bool nukiOpener = false);
     JsonDocument importJson(JsonDocument &doc);
+    void exportSettingsApi(JsonDocument &json);
+    JsonDocument importSettingsApi(JsonDocument &doc, PreferenceApply& apply);
     int checkDuoAuth(PsychicRequest *request);
     int checkDuoApprove();
     bool startDuoAuth(char* pushType = (char*)"");
@@ -26,10 +31,10 @@ public:
     void readSettings();
     void setDuoCheckIP(String duoCheckIP);
     void setDuoCheckId(String duoCheckId);
-    JsonDocument _duoSessions;
-    JsonDocument _totpSessions;
+    SessionTable _duoSessions;
+    SessionTable _totpSessions;
     JsonDocument _sessionsOpts;
-    JsonDocument _bypassSessions;
+    SessionTable _bypassSessions;
     int64_t _lastCodeCheck = 0;
     int64_t _lastCodeCheck2 = 0;
     int _invalidCount = 0;
@@ -0,0 +1,23 @@
+#include "LogEvents.h"
+
+MqttLogger* EventLog = nullptr;
+
+const char* const logEventFormats[] =
+{
+#define LOG_EVENT_FORMAT(name, format) format,
+    LOG_EVENTS(LOG_EVENT_FORMAT)
+#undef LOG_EVENT_FORMAT
+};
+
+void logEventText(const uint8_t* record, const uint16_t length)
+{
+    uint16_t id = logRecordFormatId(record);
+    if(id >= (uint16_t)LogEvent::Count)
+    {
+        return;
+    }
+
+    char text[384];
+    logRecordFormat(logEventFormats[id], record, length, text, sizeof(text));
+    Log->println(text);
+}
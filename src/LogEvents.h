@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Logger.h"
+#include "LogRecord.h"
+
+// Structured log events: the call site only stores the event id and the typed
+// arguments, the text is formatted when a log sink consumes the event.
+// The position in this list is the event id, append new events at the end.
+// scripts/decodelog/decodelog.py reads this list, keep one event per line.
+#define LOG_EVENTS(X) \
+    X(None, "") \
+    X(CommandRetry, "%s: Last command failed, retrying after %d milliseconds. Retry %d of %d") \
+    X(LockIntervals, "Lock state interval: %d | Battery interval: %d | Publish auth data: %s") \
+    X(OpenerIntervals, "Opener state interval: %d | Battery interval: %d | Publish auth data: %s") \
+    X(LockBeaconLost, "No BLE beacon received from the lock for %lld seconds, signalling to restart BLE controller.") \
+    X(OpenerBeaconLost, "No BLE beacon received from the opener for %lld seconds, signalling to restart BLE controller.") \
+    X(LockQueryRetry, "Query lock state retrying in %dms") \
+    X(OpenerQueryRetry, "Query opener state retrying in %dms") \
+    X(LockSaveNukiId, "Saving Lock Nuki ID to preferences (%u / %s)") \
+    X(OpenerSaveNukiId, "Saving Opener Nuki ID to preferences (%u / %s)") \
+    X(GpioInput, "GPIO %d (Input) --> %d") \
+    X(GpioOutput, "GPIO %d (Output) --> %d") \
+    X(MqttSubscribe, "Subscribing to MQTT topic: %s") \
+    X(MqttConnectUser, "MQTT: Connecting with user: %s")
+
+enum class LogEvent : uint16_t
+{
+#define LOG_EVENT_ID(name, format) name,
+    LOG_EVENTS(LOG_EVENT_ID)
+#undef LOG_EVENT_ID
+    Count
+};
+
+extern const char* const logEventFormats[];
+extern MqttLogger* EventLog;
+
+void logEventText(const uint8_t* record, const uint16_t length);
+
+// Without MqttLogger (MQTT log and web serial disabled) the event is printed right away.
+template<typename... Args>
+inline void logEvent(const LogEvent event, const Args&... args)
+{
+    uint8_t record[MQTT_LOGGER_MAX_RECORD];
+    LogRecordWriter writer(record, sizeof(record), (uint16_t)event);
+    writer.add(args...);
+
+    if(EventLog != nullptr)
+    {
+        EventLog->writeEvent(record, writer.length());
+    }
+    else
+    {
+        logEventText(record, writer.length());
+    }
+}
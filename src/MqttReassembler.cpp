@@ -0,0 +1,158 @@
+#include <cstring>
+#include <cstdlib>
+#include "MqttReassembler.h"
+#include "Logger.h"
+
+MqttReassembler::MqttReassembler(const size_t& maxPayloadSize)
+    : _maxPayloadSize(maxPayloadSize)
+{
+}
+
+MqttReassembler::~MqttReassembler()
+{
+    for(auto& slot : _slots)
+    {
+        free(slot.buffer);
+    }
+}
+
+const char* MqttReassembler::feed(const char* topic, const uint8_t* payload, const size_t& len, const size_t& index, const size_t& total)
+{
+    if(total > _maxPayloadSize)
+    {
+        if(index == 0)
+        {
+            _rejectedCount++;
+            Log->print("MQTT payload too large, dropping ");
+            Log->print(total);
+            Log->print(" bytes on ");
+            Log->println(topic);
+        }
+        return nullptr;
+    }
+
+    Slot* slot = nullptr;
+
+    if(index == 0)
+    {
+        slot = acquire(topic, total);
+        if(slot == nullptr)
+        {
+            _rejectedCount++;
+            Log->print("Out of memory reassembling MQTT payload on ");
+            Log->println(topic);
+            return nullptr;
+        }
+        if(len < total)
+        {
+            _fragmentedCount++;
+        }
+    }
+    else
+    {
+        slot = findActive(topic);
+        if(slot == nullptr || slot->received != index || slot->total != total)
+        {
+            // fragment of a message whose start was dropped or lost on reconnect
+            if(slot != nullptr)
+            {
+                slot->active = false;
+            }
+            return nullptr;
+        }
+    }
+
+    if(index + len > total)
+    {
+        slot->active = false;
+        return nullptr;
+    }
+
+    memcpy(slot->buffer + index, payload, len);
+    slot->received = index + len;
+
+    if(slot->received < total)
+    {
+        return nullptr;
+    }
+
+    slot->buffer[total] = 0;
+    slot->active = false;
+    return slot->buffer;
+}
+
+void MqttReassembler::reset()
+{
+    for(auto& slot : _slots)
+    {
+        slot.active = false;
+    }
+}
+
+const size_t MqttReassembler::maxPayloadSize() const
+{
+    return _maxPayloadSize;
+}
+
+const uint32_t MqttReassembler::rejectedCount() const
+{
+    return _rejectedCount;
+}
+
+const uint32_t MqttReassembler::fragmentedCount() const
+{
+    return _fragmentedCount;
+}
+
+MqttReassembler::Slot* MqttReassembler::acquire(const char* topic, const size_t& total)
+{
+    Slot* slot = findActive(topic);
+
+    if(slot == nullptr)
+    {
+        for(auto& candidate : _slots)
+        {
+            if(!candidate.active && (slot == nullptr || candidate.capacity > slot->capacity))
+            {
+                slot = &candidate;
+            }
+        }
+    }
+
+    if(slot == nullptr)
+    {
+        // all slots hold partial messages, drop the oldest one
+        slot = &_slots[_nextEvict];
+        _nextEvict = (_nextEvict + 1) % MQTT_REASSEMBLY_SLOTS;
+    }
+
+    if(slot->capacity < total + 1)
+    {
+        char* buffer = (char*)realloc(slot->buffer, total + 1);
+        if(buffer == nullptr)
+        {
+            slot->active = false;
+            return nullptr;
+        }
+        slot->buffer = buffer;
+        slot->capacity = total + 1;
+    }
+
+    slot->topic = topic;
+    slot->received = 0;
+    slot->total = total;
+    slot->active = true;
+    return slot;
+}
+
+MqttReassembler::Slot* MqttReassembler::findActive(const char* topic)
+{
+    for(auto& slot : _slots)
+    {
+        if(slot.active && slot.topic == topic)
+        {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#define MQTT_REASSEMBLY_SLOTS 2
+
+class MqttReassembler
+{
+public:
+    explicit MqttReassembler(const size_t& maxPayloadSize);
+    ~MqttReassembler();
+
+    // Returns the NUL-terminated payload once the last fragment arrived, nullptr otherwise
+    const char* feed(const char* topic, const uint8_t* payload, const size_t& len, const size_t& index, const size_t& total);
+    void reset();
+
+    const size_t maxPayloadSize() const;
+    const uint32_t rejectedCount() const;
+    const uint32_t fragmentedCount() const;
+
+private:
+    struct Slot
+    {
+        std::string topic;
+        char* buffer = nullptr;
+        size_t capacity = 0;
+        size_t received = 0;
+        size_t total = 0;
+        bool active = false;
+    };
+
+    Slot* acquire(const char* topic, const size_t& total);
+    Slot* findActive(const char* topic);
+
+    Slot _slots[MQTT_REASSEMBLY_SLOTS];
+    size_t _maxPayloadSize;
+    uint8_t _nextEvict = 0;
+    uint32_t _rejectedCount = 0;
+    uint32_t _fragmentedCount = 0;
+};
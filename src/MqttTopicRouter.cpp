@@ -0,0 +1,119 @@
+#include <cstring>
+#include "MqttTopicRouter.h"
+
+void MqttTopicRouter::add(const char* fullTopic, const char* topic, MqttTopicHandler handler, const void* owner)
+{
+    size_t fullLength = strlen(fullTopic);
+    size_t topicLength = strlen(topic);
+    uint32_t topicHash = hash(fullTopic);
+
+    for(auto& route : _routes)
+    {
+        if(route.hash == topicHash && route.fullTopic == fullTopic)
+        {
+            route.owner = owner;
+            route.handler = handler;
+            return;
+        }
+    }
+
+    MqttRoute route;
+    route.fullTopic = fullTopic;
+    route.topicOffset = fullLength >= topicLength ? fullLength - topicLength : 0;
+    route.hash = topicHash;
+    route.owner = owner;
+    route.handler = handler;
+    _routes.push_back(route);
+
+    rebuild();
+}
+
+const MqttRoute* MqttTopicRouter::find(const char* fullTopic) const
+{
+    if(_buckets.empty())
+    {
+        return nullptr;
+    }
+
+    uint32_t topicHash = hash(fullTopic);
+    size_t mask = _buckets.size() - 1;
+    size_t index = topicHash & mask;
+
+    while(_buckets[index] != -1)
+    {
+        const MqttRoute& route = _routes[_buckets[index]];
+        if(route.hash == topicHash && strcmp(route.fullTopic.c_str(), fullTopic) == 0)
+        {
+            return &route;
+        }
+        index = (index + 1) & mask;
+    }
+
+    return nullptr;
+}
+
+bool MqttTopicRouter::dispatch(const char* fullTopic, char* data) const
+{
+    const MqttRoute* route = find(fullTopic);
+
+    if(route == nullptr || !route->handler)
+    {
+        return false;
+    }
+
+    route->handler(route->topic(), data);
+    return true;
+}
+
+void MqttTopicRouter::removeOwned()
+{
+    for(auto it = _routes.begin(); it != _routes.end();)
+    {
+        if(it->owner != nullptr)
+        {
+            it = _routes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    rebuild();
+}
+
+uint32_t MqttTopicRouter::hash(const char* topic)
+{
+    // FNV-1a
+    uint32_t value = 2166136261u;
+
+    while(*topic != 0)
+    {
+        value ^= (uint8_t)*topic;
+        value *= 16777619u;
+        ++topic;
+    }
+
+    return value;
+}
+
+void MqttTopicRouter::rebuild()
+{
+    size_t size = 16;
+    while(size < _routes.size() * 2)
+    {
+        size *= 2;
+    }
+
+    _buckets.assign(size, -1);
+
+    for(size_t i = 0; i < _routes.size(); i++)
+    {
+        size_t index = _routes[i].hash & (size - 1);
+        while(_buckets[index] != -1)
+        {
+            index = (index + 1) & (size - 1);
+        }
+        _buckets[index] = i;
+    }
+}
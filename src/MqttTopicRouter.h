@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// called with the topic relative to the subscribed prefix and the reassembled, null terminated payload
+typedef std::function<void(const char* topic, char* data)> MqttTopicHandler;
+
+struct MqttRoute
+{
+    std::string fullTopic;
+    uint16_t topicOffset;
+    uint32_t hash;
+    const void* owner;
+    MqttTopicHandler handler;
+
+    const char* topic() const
+    {
+        return fullTopic.c_str() + topicOffset;
+    }
+};
+
+class MqttTopicRouter
+{
+public:
+    void add(const char* fullTopic, const char* topic, MqttTopicHandler handler, const void* owner = nullptr);
+    const MqttRoute* find(const char* fullTopic) const;
+    bool dispatch(const char* fullTopic, char* data) const;
+    // removes the routes added with an owner, e.g. by the lock and opener
+    void removeOwned();
+
+private:
+    static uint32_t hash(const char* topic);
+    void rebuild();
+
+    std::vector<MqttRoute> _routes;
+    std::vector<int16_t> _buckets;
+};
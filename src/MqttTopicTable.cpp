@@ -0,0 +1,120 @@
+#include <cstring>
+#include "MqttTopicTable.h"
+
+MqttTopicTable::MqttTopicTable(const char* mqttPath)
+    : _mqttPath(mqttPath)
+{
+    for(uint16_t i = 0; i < MQTT_TOPIC_TABLE_SLOTS; i++)
+    {
+        _slots[i].store(MQTT_TOPIC_INVALID, std::memory_order_relaxed);
+    }
+    _mutex = xSemaphoreCreateMutex();
+}
+
+MqttTopicTable::~MqttTopicTable()
+{
+    for(char* block : _blocks)
+    {
+        delete[] block;
+    }
+    vSemaphoreDelete(_mutex);
+}
+
+void MqttTopicTable::registerTopics(const std::vector<char*>& topics)
+{
+    for(const char* topic : topics)
+    {
+        registerTopic(topic);
+    }
+}
+
+MqttTopicId MqttTopicTable::registerTopic(const char* topic)
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+
+    if(_count.load(std::memory_order_relaxed) == 0)
+    {
+        _mqttPathLength = strlen(_mqttPath);
+    }
+
+    MqttTopicId id = find(topic);
+
+    if(id == MQTT_TOPIC_INVALID && _count.load(std::memory_order_relaxed) < MQTT_TOPIC_TABLE_SIZE)
+    {
+        size_t length = _mqttPathLength + strlen(topic) + 1;
+
+        if(length <= MQTT_TOPIC_TABLE_BLOCK_SIZE)
+        {
+            if(_blockOffset + length > MQTT_TOPIC_TABLE_BLOCK_SIZE)
+            {
+                _blocks.push_back(new char[MQTT_TOPIC_TABLE_BLOCK_SIZE]);
+                _blockOffset = 0;
+            }
+
+            char* fullPath = _blocks.back() + _blockOffset;
+            memcpy(fullPath, _mqttPath, _mqttPathLength);
+            strcpy(fullPath + _mqttPathLength, topic);
+            _blockOffset += length;
+
+            id = _count.load(std::memory_order_relaxed);
+            _paths[id] = fullPath;
+            _count.store(id + 1, std::memory_order_release);
+
+            uint16_t index = hash(topic) % MQTT_TOPIC_TABLE_SLOTS;
+            while(_slots[index].load(std::memory_order_relaxed) != MQTT_TOPIC_INVALID)
+            {
+                index = (index + 1) % MQTT_TOPIC_TABLE_SLOTS;
+            }
+            _slots[index].store(id, std::memory_order_release);
+        }
+    }
+
+    xSemaphoreGive(_mutex);
+    return id;
+}
+
+MqttTopicId MqttTopicTable::find(const char* topic) const
+{
+    uint16_t index = hash(topic) % MQTT_TOPIC_TABLE_SLOTS;
+
+    // the table holds at most MQTT_TOPIC_TABLE_SIZE of MQTT_TOPIC_TABLE_SLOTS slots, an unknown topic ends at the first empty slot
+    while(true)
+    {
+        MqttTopicId id = _slots[index].load(std::memory_order_acquire);
+
+        if(id == MQTT_TOPIC_INVALID)
+        {
+            return MQTT_TOPIC_INVALID;
+        }
+        if(strcmp(_paths[id] + _mqttPathLength, topic) == 0)
+        {
+            return id;
+        }
+
+        index = (index + 1) % MQTT_TOPIC_TABLE_SLOTS;
+    }
+}
+
+const char* MqttTopicTable::path(const MqttTopicId& id) const
+{
+    if(id >= _count.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+    return _paths[id];
+}
+
+uint32_t MqttTopicTable::hash(const char* topic)
+{
+    // FNV-1a
+    uint32_t value = 2166136261u;
+
+    while(*topic != 0)
+    {
+        value ^= (uint8_t)*topic;
+        value *= 16777619u;
+        ++topic;
+    }
+
+    return value;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "MqttTopics.h"
+
+#define MQTT_TOPIC_TABLE_SIZE 192
+#define MQTT_TOPIC_TABLE_SLOTS 512
+#define MQTT_TOPIC_TABLE_BLOCK_SIZE 2048
+
+class MqttTopicTable
+{
+public:
+    explicit MqttTopicTable(const char* mqttPath);
+    virtual ~MqttTopicTable();
+
+    void registerTopics(const std::vector<char*>& topics);
+    MqttTopicId registerTopic(const char* topic);
+    MqttTopicId find(const char* topic) const;
+    const char* path(const MqttTopicId& id) const;
+
+private:
+    static uint32_t hash(const char* topic);
+
+    const char* _mqttPath;
+    size_t _mqttPathLength = 0;
+
+    std::vector<char*> _blocks;
+    size_t _blockOffset = MQTT_TOPIC_TABLE_BLOCK_SIZE;
+    const char* _paths[MQTT_TOPIC_TABLE_SIZE] = {nullptr};
+    std::atomic<uint16_t> _count {0};
+
+    std::atomic<MqttTopicId> _slots[MQTT_TOPIC_TABLE_SLOTS];
+
+    SemaphoreHandle_t _mutex;
+};
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <vector>
 
 #define mqtt_topic_lock_action (char*)"/action"
@@ -21,6 +22,7 @@
 #define mqtt_topic_lock_auth_name (char*)"/authorizationName"
 #define mqtt_topic_lock_completionStatus (char*)"/completionStatus"
 #define mqtt_topic_lock_action_command_result (char*)"/commandResult"
+#define mqtt_topic_lock_action_latency (char*)"/commandLatency"
 #define mqtt_topic_lock_door_sensor_state (char*)"/doorSensorState"
 #define mqtt_topic_doorsensorOverride (char*)"/doorsensorOverride"
 #define mqtt_topic_lock_rssi (char*)"/rssi"
@@ -109,7 +111,14 @@
 #define mqtt_topic_uptime (char*)"/maintenance/uptime"
 #define mqtt_topic_wifi_rssi (char*)"/maintenance/wifiRssi"
 #define mqtt_topic_log (char*)"/maintenance/log"
+#define mqtt_topic_log_binary (char*)"/maintenance/logBinary"
 #define mqtt_topic_freeheap (char*)"/maintenance/freeHeap"
+#define mqtt_topic_scratch_usage (char*)"/maintenance/scratchUsage"
+#define mqtt_topic_flash_writes (char*)"/maintenance/flashWrites"
+#define mqtt_topic_suppressed_publishes (char*)"/maintenance/suppressedPublishes"
+#define mqtt_topic_mqtt_pool (char*)"/maintenance/mqttPool"
+#define mqtt_topic_mqtt_tls (char*)"/maintenance/mqttTls"
+#define mqtt_topic_internet (char*)"/maintenance/internet"
 #define mqtt_topic_restart_reason_fw (char*)"/maintenance/restartReasonNukiHub"
 #define mqtt_topic_restart_reason_esp (char*)"/maintenance/restartReasonNukiEsp"
 #define mqtt_topic_mqtt_connection_state (char*)"/maintenance/mqttConnectionState"
@@ -121,37 +130,76 @@
 
 #define mqtt_topic_hybrid_state (char*)"/hybridConnected"
 
+#define mqtt_topic_hass_status (char*)"/status"
+
 #define mqtt_topic_gpio_prefix (char*)"/gpio"
 #define mqtt_topic_gpio_pin (char*)"/pin_"
 #define mqtt_topic_gpio_role (char*)"/role"
 #define mqtt_topic_gpio_state (char*)"/state"
 
-class MqttTopics
+typedef uint16_t MqttTopicId;
+#define MQTT_TOPIC_INVALID 0xffff
+
+// the id of a topic is its index in this list, publishers register the topics in this order
+constexpr char* const mqttTopicList[] =
+{
+    mqtt_topic_lock_action, mqtt_topic_lock_status_updated, mqtt_topic_lock_state, mqtt_topic_lock_ha_state, mqtt_topic_lock_json, mqtt_topic_lock_binary_state,
+    mqtt_topic_lock_continuous_mode, mqtt_topic_lock_ring, mqtt_topic_lock_binary_ring, mqtt_topic_lock_trigger, mqtt_topic_lock_last_lock_action, mqtt_topic_lock_log,
+    mqtt_topic_lock_log_latest, mqtt_topic_lock_log_rolling, mqtt_topic_lock_log_rolling_last, mqtt_topic_lock_auth_id, mqtt_topic_lock_auth_name, mqtt_topic_lock_completionStatus, mqtt_topic_lock_lock_action_context, mqtt_topic_lock_availability, mqtt_topic_doorsensorOverride,
+    mqtt_topic_lock_action_command_result, mqtt_topic_lock_action_latency, mqtt_topic_lock_door_sensor_state, mqtt_topic_lock_rssi, mqtt_topic_lock_address, mqtt_topic_lock_retry, mqtt_topic_config_action,
+    mqtt_topic_config_action_command_result, mqtt_topic_config_basic_json, mqtt_topic_config_advanced_json, mqtt_topic_config_button_enabled, mqtt_topic_config_led_enabled,
+    mqtt_topic_config_led_brightness, mqtt_topic_config_auto_unlock, mqtt_topic_config_auto_lock, mqtt_topic_config_single_lock, mqtt_topic_config_sound_level,
+    mqtt_topic_query_config, mqtt_topic_query_lockstate, mqtt_topic_query_keypad, mqtt_topic_query_battery, mqtt_topic_query_lockstate_command_result,
+    mqtt_topic_battery_level, mqtt_topic_battery_critical, mqtt_topic_battery_charging, mqtt_topic_battery_voltage, mqtt_topic_battery_drain,
+    mqtt_topic_battery_max_turn_current, mqtt_topic_battery_lock_distance, mqtt_topic_battery_keypad_critical, mqtt_topic_battery_doorsensor_critical,
+    mqtt_topic_battery_basic_json,mqtt_topic_battery_advanced_json, mqtt_topic_keypad, mqtt_topic_keypad_codes, mqtt_topic_keypad_command_action,
+    mqtt_topic_keypad_command_id, mqtt_topic_keypad_command_name, mqtt_topic_keypad_command_code, mqtt_topic_keypad_command_enabled, mqtt_topic_keypad_command_result,
+    mqtt_topic_keypad_json, mqtt_topic_keypad_json_action, mqtt_topic_keypad_json_command_result, mqtt_topic_timecontrol, mqtt_topic_timecontrol_entries,
+    mqtt_topic_timecontrol_json, mqtt_topic_timecontrol_action, mqtt_topic_timecontrol_command_result, mqtt_topic_auth, mqtt_topic_auth_entries,
+    mqtt_topic_auth_json, mqtt_topic_auth_action, mqtt_topic_auth_command_result, mqtt_topic_info_hardware_version, mqtt_topic_info_firmware_version,
+    mqtt_topic_info_nuki_hub_version, mqtt_topic_info_nuki_hub_build, mqtt_topic_info_nuki_hub_latest, mqtt_topic_info_nuki_hub_ip, mqtt_topic_reset,
+    mqtt_topic_update, mqtt_topic_webserver_state, mqtt_topic_webserver_action, mqtt_topic_uptime, mqtt_topic_wifi_rssi, mqtt_topic_log, mqtt_topic_freeheap, mqtt_topic_scratch_usage, mqtt_topic_flash_writes, mqtt_topic_suppressed_publishes, mqtt_topic_mqtt_pool, mqtt_topic_mqtt_tls, mqtt_topic_internet,
+    mqtt_topic_restart_reason_fw, mqtt_topic_restart_reason_esp, mqtt_topic_mqtt_connection_state, mqtt_topic_network_device, mqtt_topic_hybrid_state
+};
+
+constexpr MqttTopicId mqttTopicCount = sizeof(mqttTopicList) / sizeof(mqttTopicList[0]);
+
+constexpr bool mqttTopicEquals(const char* a, const char* b)
 {
-private:
-    std::vector<char*> _keys =
+    while(*a != 0 && *a == *b)
     {
-        mqtt_topic_lock_action, mqtt_topic_lock_status_updated, mqtt_topic_lock_state, mqtt_topic_lock_ha_state, mqtt_topic_lock_json, mqtt_topic_lock_binary_state,
-        mqtt_topic_lock_continuous_mode, mqtt_topic_lock_ring, mqtt_topic_lock_binary_ring, mqtt_topic_lock_trigger, mqtt_topic_lock_last_lock_action, mqtt_topic_lock_log,
-        mqtt_topic_lock_log_latest, mqtt_topic_lock_log_rolling, mqtt_topic_lock_log_rolling_last, mqtt_topic_lock_auth_id, mqtt_topic_lock_auth_name, mqtt_topic_lock_completionStatus,
-        mqtt_topic_lock_action_command_result, mqtt_topic_lock_door_sensor_state, mqtt_topic_lock_rssi, mqtt_topic_lock_address, mqtt_topic_lock_retry, mqtt_topic_config_action,
-        mqtt_topic_config_action_command_result, mqtt_topic_config_basic_json, mqtt_topic_config_advanced_json, mqtt_topic_config_button_enabled, mqtt_topic_config_led_enabled,
-        mqtt_topic_config_led_brightness, mqtt_topic_config_auto_unlock, mqtt_topic_config_auto_lock, mqtt_topic_config_single_lock, mqtt_topic_config_sound_level,
-        mqtt_topic_query_config, mqtt_topic_query_lockstate, mqtt_topic_query_keypad, mqtt_topic_query_battery, mqtt_topic_query_lockstate_command_result,
-        mqtt_topic_battery_level, mqtt_topic_battery_critical, mqtt_topic_battery_charging, mqtt_topic_battery_voltage, mqtt_topic_battery_drain,
-        mqtt_topic_battery_max_turn_current, mqtt_topic_battery_lock_distance, mqtt_topic_battery_keypad_critical, mqtt_topic_battery_doorsensor_critical,
-        mqtt_topic_battery_basic_json,mqtt_topic_battery_advanced_json, mqtt_topic_keypad, mqtt_topic_keypad_codes, mqtt_topic_keypad_command_action,
-        mqtt_topic_keypad_command_id, mqtt_topic_keypad_command_name, mqtt_topic_keypad_command_code, mqtt_topic_keypad_command_enabled, mqtt_topic_keypad_command_result,
-        mqtt_topic_keypad_json, mqtt_topic_keypad_json_action, mqtt_topic_keypad_json_command_result, mqtt_topic_timecontrol, mqtt_topic_timecontrol_entries,
-        mqtt_topic_timecontrol_json, mqtt_topic_timecontrol_action, mqtt_topic_timecontrol_command_result, mqtt_topic_auth, mqtt_topic_auth_entries,
-        mqtt_topic_auth_json, mqtt_topic_auth_action, mqtt_topic_auth_command_result, mqtt_topic_info_hardware_version, mqtt_topic_info_firmware_version,
-        mqtt_topic_info_nuki_hub_version, mqtt_topic_info_nuki_hub_build, mqtt_topic_info_nuki_hub_latest, mqtt_topic_info_nuki_hub_ip, mqtt_topic_reset,
-        mqtt_topic_update, mqtt_topic_webserver_state, mqtt_topic_webserver_action, mqtt_topic_uptime, mqtt_topic_wifi_rssi, mqtt_topic_log, mqtt_topic_freeheap,
-        mqtt_topic_restart_reason_fw, mqtt_topic_restart_reason_esp, mqtt_topic_mqtt_connection_state, mqtt_topic_network_device, mqtt_topic_hybrid_state
-    };
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+constexpr MqttTopicId mqttTopicIdOf(const char* topic)
+{
+    for(MqttTopicId id = 0; id < mqttTopicCount; id++)
+    {
+        if(mqttTopicEquals(mqttTopicList[id], topic))
+        {
+            return id;
+        }
+    }
+    return MQTT_TOPIC_INVALID;
+}
+
+template<MqttTopicId id> struct MqttTopicIdOf
+{
+    static_assert(id != MQTT_TOPIC_INVALID, "topic is missing from mqttTopicList");
+    static constexpr MqttTopicId value = id;
+};
+
+// resolves a topic from the list above to its id at compile time
+#define MQTT_TOPIC_ID(topic) MqttTopicIdOf<mqttTopicIdOf(topic)>::value
+
+class MqttTopics
+{
 public:
     const std::vector<char*> getMqttTopics()
     {
-        return _keys;
+        return std::vector<char*>(mqttTopicList, mqttTopicList + mqttTopicCount);
     }
 };
@@ -3,16 +3,19 @@
 #include "Logger.h"
 #include "Config.h"
 #include "RestartReason.h"
-#include <HTTPClient.h>
-#include <NetworkClientSecure.h>
+#include "util/TaskScheduler.h"
+#include "util/ScratchArena.h"
+#include "util/WriteBehindStore.h"
 #include "util/NetworkDeviceInstantiator.h"
+#ifndef NUKI_HUB_UPDATER
+#include "LogEvents.h"
+#endif
 #ifndef CONFIG_IDF_TARGET_ESP32H2
 #include "networkDevices/WifiDevice.h"
 #endif
 #include "networkDevices/EthernetDevice.h"
 #include "hal/wdt_hal.h"
 #include "esp_mac.h"
-#include <ESP32Ping.h>
 
 NukiNetwork* NukiNetwork::_inst = nullptr;
 
@@ -20,15 +23,12 @@ extern bool timeSynced;
 extern bool wifiFallback;
 extern bool disableNetwork;
 extern bool forceEnableWebServer;
-extern const uint8_t x509_crt_imported_bundle_bin_start[] asm("_binary_x509_crt_bundle_start");
-extern const uint8_t x509_crt_imported_bundle_bin_end[]   asm("_binary_x509_crt_bundle_end");
 
 #ifndef NUKI_HUB_UPDATER
-NukiNetwork::NukiNetwork(Preferences *preferences, Gpio* gpio, char* buffer, size_t bufferSize, ImportExport* importExport)
+NukiNetwork::NukiNetwork(Preferences *preferences, ConfigSnapshot* config, Gpio* gpio, ImportExport* importExport)
     : _preferences(preferences),
+      _config(config),
       _gpio(gpio),
-      _buffer(buffer),
-      _bufferSize(bufferSize),
       _importExport(importExport)
 #else
 NukiNetwork::NukiNetwork(Preferences *preferences)
@@ -109,7 +109,7 @@ void NukiNetwork::setupDevice()
     Log->println(_device->deviceName());
 
 #ifndef NUKI_HUB_UPDATER
-    _hadiscovery = new HomeAssistantDiscovery(_device, _preferences, _buffer, _bufferSize);
+    _hadiscovery = new HomeAssistantDiscovery(_device, _preferences, _config);
 #endif
 }
 
@@ -161,7 +161,11 @@ const bool NukiNetwork::isConnected() const
 
 const bool NukiNetwork::isInternetConnected() const
 {
-    return _hasInternet;
+#ifndef NUKI_HUB_UPDATER
+    return _reachability != nullptr && _reachability->state().reachable;
+#else
+    return false;
+#endif
 }
 
 const bool NukiNetwork::mqttConnected()
@@ -259,6 +263,8 @@ void NukiNetwork::initialize()
         _device->mqttSetClientId(_hostnameArr);
         _device->mqttSetCleanSession(false);
         _device->mqttSetKeepAlive(60);
+        // state topics are retained, only the latest queued value per topic needs to be sent
+        _device->mqttSetPublishCoalescing(true);
 
         char gpioPath[250];
         bool rebGpio = rebuildGpio();
@@ -323,6 +329,16 @@ void NukiNetwork::readSettings()
     }
 
     _publishDebugInfo = _preferences->getBool(preference_publish_debug_info, false);
+
+    if(_reassembler == nullptr)
+    {
+        _reassembler = new MqttReassembler(_preferences->getInt(preference_buffer_size, CHAR_BUFFER_SIZE));
+    }
+
+    if(_reachability == nullptr)
+    {
+        _reachability = new ReachabilityMonitor(_preferences->getString(preference_internet_check_hosts, "github.com"));
+    }
 }
 
 void NukiNetwork::setMQTTConnectionSettings()
@@ -482,8 +498,13 @@ bool NukiNetwork::update()
         Log->print("IP: ");
         Log->println(_device->localIP());
         _firstDisconnected = true;
-        
-        checkInternetConnectivity();
+
+        _reachability->trigger();
+    }
+
+    if(ts < _reconnectBackoffTs)
+    {
+        return false;
     }
 
     if(!_logIp && _device->isConnected() && !_device->mqttConnected() )
@@ -491,11 +512,7 @@ bool NukiNetwork::update()
         bool success = reconnect();
         if(!success)
         {
-            if (esp_task_wdt_status(NULL) == ESP_OK)
-            {
-                esp_task_wdt_reset();
-            }
-            vTaskDelay(2000 / portTICK_PERIOD_MS);
+            _reconnectBackoffTs = espMillis() + 2000;
             _mqttConnectCounter++;
             return false;
         }
@@ -515,11 +532,8 @@ bool NukiNetwork::update()
         {
             forceEnableWebServer = false;
         }
-        if (esp_task_wdt_status(NULL) == ESP_OK)
-        {
-            esp_task_wdt_reset();
-        }
-        vTaskDelay(2000 / portTICK_PERIOD_MS);
+        _reconnectBackoffTs = espMillis() + 2000;
+        return false;
     }
 
     if(!_device->isConnected() || !_device->mqttConnected() )
@@ -538,11 +552,7 @@ bool NukiNetwork::update()
             vTaskDelay(200 / portTICK_PERIOD_MS);
             restartEsp(RestartReason::NetworkTimeoutWatchdog);
         }
-        if (esp_task_wdt_status(NULL) == ESP_OK)
-        {
-            esp_task_wdt_reset();
-        }
-        vTaskDelay(2000 / portTICK_PERIOD_MS);
+        _reconnectBackoffTs = ts + 2000;
         return false;
     }
 
@@ -574,6 +584,7 @@ bool NukiNetwork::update()
             publishULong(_maintenancePathPrefix, mqtt_topic_uptime, curUptime, true);
             _publishedUpTime = curUptime;
         }
+        publishUInt(_maintenancePathPrefix, mqtt_topic_suppressed_publishes, _suppressedPublishCount, true);
         //publishString(_maintenancePathPrefix, mqtt_topic_mqtt_connection_state, "online", true);
 
         if(_lastMaintenanceTs == 0)
@@ -586,77 +597,38 @@ bool NukiNetwork::update()
         if(_publishDebugInfo)
         {
             publishUInt(_maintenancePathPrefix, mqtt_topic_freeheap, esp_get_free_heap_size(), true);
+            publishScratchUsage();
+            publishFlashWrites();
+            publishMqttPoolUsage();
         }
         _lastMaintenanceTs = ts;
     }
 
-    if(_checkUpdates && (!_haEnabled || (_haEnabled && _haSetupDone)) && _hasInternet)
+    if(_reachability->takeTransition())
+    {
+        Log->println(_reachability->state().reachable ? "Internet connection available" : "Internet connection lost");
+        _reachabilityPublished = false;
+    }
+
+    if(!_reachabilityPublished && _device->mqttConnected())
+    {
+        publishReachability();
+    }
+
+    if(_checkUpdates && (!_haEnabled || (_haEnabled && _haSetupDone)) && isInternetConnected())
     {
         if(_lastUpdateCheckTs == 0 || (ts - _lastUpdateCheckTs) > 86400000)
         {
             _lastUpdateCheckTs = ts;
-            bool otaManifestSuccess = false;
-            JsonDocument doc;
-
-            NetworkClientSecure *client = new NetworkClientSecure;
-            if (client)
-            {
-                client->setCACertBundle(x509_crt_imported_bundle_bin_start, x509_crt_imported_bundle_bin_end - x509_crt_imported_bundle_bin_start);
-                {
-                    HTTPClient https;
-                    https.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-                    https.useHTTP10(true);
-
-                    if (https.begin(*client, GITHUB_OTA_MANIFEST_URL))
-                    {
-                        int httpResponseCode = https.GET();
-
-                        if (httpResponseCode == HTTP_CODE_OK || httpResponseCode == HTTP_CODE_MOVED_PERMANENTLY)
-                        {
-                            DeserializationError jsonError = deserializeJson(doc, https.getStream());
-
-                            if (!jsonError)
-                            {
-                                otaManifestSuccess = true;
-                            }
-                        }
-                    }
-                    https.end();
-                }
-                delete client;
-            }
-
-            if (otaManifestSuccess)
-            {
-                String currentVersion = NUKI_HUB_VERSION;
-
-                if(atof(doc["release"]["version"]) >= atof(currentVersion.c_str()))
-                {
-                    _latestVersion = doc["release"]["fullversion"];
-                }
-                else if(currentVersion.indexOf("beta") > 0)
-                {
-                    _latestVersion = doc["beta"]["fullversion"];
-                }
-                else if(currentVersion.indexOf("master") > 0)
-                {
-                    _latestVersion = doc["master"]["fullversion"];
-                }
-                else
-                {
-                    _latestVersion = doc["release"]["fullversion"];
-                }
-
-                publishString(_maintenancePathPrefix, mqtt_topic_info_nuki_hub_latest, _latestVersion, true);
-
-                if(strcmp(_latestVersion, _preferences->getString(preference_latest_version).c_str()) != 0)
-                {
-                    _preferences->putString(preference_latest_version, _latestVersion);
-                }
-            }
+            _updateCheckTicket = OtaManifestFetcher::get()->request();
         }
     }
 
+    if(_updateCheckTicket != 0 || _otaUpdateTicket != 0)
+    {
+        processOtaManifest();
+    }
+
     for(const auto& gpioTs : _gpioTs)
     {
         uint8_t pin = gpioTs.first;
@@ -670,10 +642,7 @@ bool NukiNetwork::update()
             buildMqttPath(gpioPath, {mqtt_topic_gpio_prefix, (mqtt_topic_gpio_pin + std::to_string(pin)).c_str(), mqtt_topic_gpio_state});
             publishInt(_lockPath.c_str(), gpioPath, pinState, _retainGpio);
 
-            Log->print("GPIO ");
-            Log->print(pin);
-            Log->print(" (Input) --> ");
-            Log->println(pinState);
+            logEvent(LogEvent::GpioInput, pin, pinState);
         }
     }
 
@@ -695,9 +664,246 @@ void NukiNetwork::updateNetworkStatusLeds()
     }
 }
 
-void NukiNetwork::checkInternetConnectivity()
+void NukiNetwork::publishScratchUsage()
+{
+    ScratchArena* networkArena = ScratchArena::get(SchedulerTask::Network);
+    ScratchArena* nukiArena = ScratchArena::get(SchedulerTask::Nuki);
+
+    if(networkArena == nullptr || nukiArena == nullptr)
+    {
+        return;
+    }
+
+    JsonDocument json;
+    json["size"] = networkArena->size();
+    json["networkHighWater"] = networkArena->highWaterMark();
+    json["networkOverflows"] = networkArena->overflowCount();
+    json["nukiHighWater"] = nukiArena->highWaterMark();
+    json["nukiOverflows"] = nukiArena->overflowCount();
+
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    publishString(_maintenancePathPrefix, mqtt_topic_scratch_usage, buffer.data(), true);
+}
+
+void NukiNetwork::publishFlashWrites()
+{
+    WriteBehindStore* store = WriteBehindStore::get();
+
+    JsonDocument json;
+    json["flashWrites"] = store->flashWrites();
+    json["coalescedWrites"] = store->coalescedWrites();
+    json["pendingWrites"] = store->pendingWrites();
+
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    publishString(_maintenancePathPrefix, mqtt_topic_flash_writes, buffer.data(), true);
+}
+
+void NukiNetwork::publishMqttPoolUsage()
+{
+    espMqttClientTypes::PoolStats stats = _device->mqttPoolStats();
+
+    JsonDocument json;
+    json["nodesUsed"] = stats.nodesUsed;
+    json["nodesHighWater"] = stats.nodesHighWater;
+    json["nodesCapacity"] = stats.nodesCapacity;
+    json["smallUsed"] = stats.smallUsed;
+    json["smallHighWater"] = stats.smallHighWater;
+    json["smallCapacity"] = stats.smallCapacity;
+    json["largeUsed"] = stats.largeUsed;
+    json["largeHighWater"] = stats.largeHighWater;
+    json["largeCapacity"] = stats.largeCapacity;
+    json["heapFallbacks"] = stats.heapFallbacks;
+    json["rejected"] = stats.rejected;
+    json["coalesced"] = _device->mqttCoalescedPublishes();
+
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    publishString(_maintenancePathPrefix, mqtt_topic_mqtt_pool, buffer.data(), true);
+}
+
+void NukiNetwork::publishMqttTlsStats()
+{
+    JsonDocument json;
+    json["handshakeMs"] = _device->mqttTlsHandshakeTime();
+    json["resumed"] = _device->mqttTlsSessionResumed() ? 1 : 0;
+    json["handshakes"] = _device->mqttTlsHandshakes();
+    json["resumedHandshakes"] = _device->mqttTlsResumedHandshakes();
+
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    publishString(_maintenancePathPrefix, mqtt_topic_mqtt_tls, buffer.data(), true);
+}
+
+void NukiNetwork::processOtaManifest()
+{
+    OtaManifestFetcher* fetcher = OtaManifestFetcher::get();
+    OtaManifest manifest;
+
+    if(_updateCheckTicket != 0)
+    {
+        OtaManifestResult result = fetcher->poll(_updateCheckTicket, manifest);
+
+        if(result != OtaManifestResult::Pending)
+        {
+            _updateCheckTicket = 0;
+
+            if(result == OtaManifestResult::Ready)
+            {
+                publishLatestVersion(manifest);
+            }
+        }
+    }
+
+    if(_otaUpdateTicket != 0)
+    {
+        OtaManifestResult result = fetcher->poll(_otaUpdateTicket, manifest);
+
+        if(result != OtaManifestResult::Pending)
+        {
+            _otaUpdateTicket = 0;
+
+            if(result == OtaManifestResult::Ready)
+            {
+                startOtaUpdate(manifest);
+            }
+            else
+            {
+                Log->println("Failed to retrieve OTA manifest, OTA update aborted.");
+            }
+        }
+    }
+}
+
+void NukiNetwork::publishLatestVersion(const OtaManifest& manifest)
+{
+    String currentVersion = NUKI_HUB_VERSION;
+    const char* latestVersion;
+
+    if(atof(manifest.release.version) >= atof(currentVersion.c_str()))
+    {
+        latestVersion = manifest.release.fullversion;
+    }
+    else if(currentVersion.indexOf("beta") > 0)
+    {
+        latestVersion = manifest.beta.fullversion;
+    }
+    else if(currentVersion.indexOf("master") > 0)
+    {
+        latestVersion = manifest.master.fullversion;
+    }
+    else
+    {
+        latestVersion = manifest.release.fullversion;
+    }
+
+    strlcpy(_latestVersion, latestVersion, sizeof(_latestVersion));
+    publishString(_maintenancePathPrefix, mqtt_topic_info_nuki_hub_latest, _latestVersion, true);
+
+    if(strcmp(_latestVersion, _preferences->getString(preference_latest_version).c_str()) != 0)
+    {
+        _preferences->putString(preference_latest_version, _latestVersion);
+    }
+}
+
+void NukiNetwork::startOtaUpdate(const OtaManifest& manifest)
+{
+    String currentVersion = NUKI_HUB_VERSION;
+
+    if(atof(manifest.release.version) >= atof(currentVersion.c_str()))
+    {
+        if(strcmp(NUKI_HUB_VERSION, manifest.release.fullversion) == 0 && strcmp(NUKI_HUB_BUILD, manifest.release.build) == 0 && strcmp(NUKI_HUB_DATE, manifest.release.time) == 0)
+        {
+            Log->println("Nuki Hub is already on the latest release version, OTA update aborted.");
+        }
+        else
+        {
+            _preferences->putString(preference_ota_updater_url, GITHUB_LATEST_UPDATER_BINARY_URL);
+            _preferences->putString(preference_ota_main_url, GITHUB_LATEST_RELEASE_BINARY_URL);
+            Log->println("Updating to latest release version.");
+            if (esp_task_wdt_status(NULL) == ESP_OK)
+            {
+                esp_task_wdt_reset();
+            }
+            vTaskDelay(200 / portTICK_PERIOD_MS);
+            restartEsp(RestartReason::OTAReboot);
+        }
+    }
+    else if(currentVersion.indexOf("beta") > 0)
+    {
+        if(strcmp(NUKI_HUB_VERSION, manifest.beta.fullversion) == 0 && strcmp(NUKI_HUB_BUILD, manifest.beta.build) == 0 && strcmp(NUKI_HUB_DATE, manifest.beta.time) == 0)
+        {
+            Log->println("Nuki Hub is already on the latest beta version, OTA update aborted.");
+        }
+        else
+        {
+            _preferences->putString(preference_ota_updater_url, GITHUB_BETA_UPDATER_BINARY_URL);
+            _preferences->putString(preference_ota_main_url, GITHUB_BETA_RELEASE_BINARY_URL);
+            Log->println("Updating to latest beta version.");
+            if (esp_task_wdt_status(NULL) == ESP_OK)
+            {
+                esp_task_wdt_reset();
+            }
+            vTaskDelay(200 / portTICK_PERIOD_MS);
+            restartEsp(RestartReason::OTAReboot);
+        }
+    }
+    else if(currentVersion.indexOf("master") > 0)
+    {
+        if(strcmp(NUKI_HUB_VERSION, manifest.master.fullversion) == 0 && strcmp(NUKI_HUB_BUILD, manifest.master.build) == 0 && strcmp(NUKI_HUB_DATE, manifest.master.time) == 0)
+        {
+            Log->println("Nuki Hub is already on the latest development version, OTA update aborted.");
+        }
+        else
+        {
+            _preferences->putString(preference_ota_updater_url, GITHUB_MASTER_UPDATER_BINARY_URL);
+            _preferences->putString(preference_ota_main_url, GITHUB_MASTER_RELEASE_BINARY_URL);
+            Log->println("Updating to latest developmemt version.");
+            if (esp_task_wdt_status(NULL) == ESP_OK)
+            {
+                esp_task_wdt_reset();
+            }
+            vTaskDelay(200 / portTICK_PERIOD_MS);
+            restartEsp(RestartReason::OTAReboot);
+        }
+    }
+    else
+    {
+        if(strcmp(NUKI_HUB_VERSION, manifest.release.fullversion) == 0 && strcmp(NUKI_HUB_BUILD, manifest.release.build) == 0 && strcmp(NUKI_HUB_DATE, manifest.release.time) == 0)
+        {
+            Log->println("Nuki Hub is already on the latest release version, OTA update aborted.");
+        }
+        else
+        {
+            _preferences->putString(preference_ota_updater_url, GITHUB_LATEST_UPDATER_BINARY_URL);
+            _preferences->putString(preference_ota_main_url, GITHUB_LATEST_RELEASE_BINARY_URL);
+            Log->println("Updating to latest release version.");
+            if (esp_task_wdt_status(NULL) == ESP_OK)
+            {
+                esp_task_wdt_reset();
+            }
+            vTaskDelay(200 / portTICK_PERIOD_MS);
+            restartEsp(RestartReason::OTAReboot);
+        }
+    }
+}
+
+void NukiNetwork::publishReachability()
 {
-    _hasInternet = Ping.ping("github.com", 3);
+    ReachabilityState state = _reachability->state();
+
+    JsonDocument json;
+    json["connected"] = state.reachable ? 1 : 0;
+    json["target"] = _reachability->targetName(state.target);
+    json["lastCheck"] = state.lastCheckTs / 1000;
+    json["lastChange"] = state.lastChangeTs / 1000;
+    json["failures"] = state.failures;
+
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    publishString(_maintenancePathPrefix, mqtt_topic_internet, buffer.data(), true);
+    _reachabilityPublished = true;
 }
 
 void NukiNetwork::onMqttConnect(const bool &sessionPresent)
@@ -708,6 +914,10 @@ void NukiNetwork::onMqttConnect(const bool &sessionPresent)
 void NukiNetwork::onMqttDisconnect(const espMqttClientTypes::DisconnectReason &reason)
 {
     _connectReplyReceived = false;
+    if(_reassembler != nullptr)
+    {
+        _reassembler->reset();
+    }
     Log->print("MQTT disconnected. Reason: ");
     switch(reason)
     {
@@ -749,7 +959,7 @@ bool NukiNetwork::reconnect(bool force)
     {
         if (force)
         {
-            _mqttReceivers.clear();
+            _router.removeOwned();
             _device->mqttRestart();
             setMQTTConnectionSettings();
         }
@@ -778,8 +988,7 @@ bool NukiNetwork::reconnect(bool force)
         }
         else
         {
-            Log->print("MQTT: Connecting with user: ");
-            Log->println(_mqttUser);
+            logEvent(LogEvent::MqttConnectUser, _mqttUser);
             _device->mqttSetCredentials(_mqttUser, _mqttPass);
         }
 
@@ -885,18 +1094,23 @@ bool NukiNetwork::reconnect(bool force)
                 {
                     setupHASS(0, 0, {0}, {0}, {0}, false, false);
                     _haSetupDone = true;
+                    subscribe(_config->get()->mqttHassDiscovery.c_str(), mqtt_topic_hass_status, [this](const char* topic, char* data) { onHassStatusReceived(data); });
                 }
 
                 initTopic(_maintenancePathPrefix, mqtt_topic_reset, "0");
-                subscribe(_maintenancePathPrefix, mqtt_topic_reset);
+                subscribe(_maintenancePathPrefix, mqtt_topic_reset, [this](const char* topic, char* data) { onResetReceived(data); });
                 initTopic(_maintenancePathPrefix, mqtt_topic_freeheap, "");
+                initTopic(_maintenancePathPrefix, mqtt_topic_scratch_usage, "");
+                initTopic(_maintenancePathPrefix, mqtt_topic_flash_writes, "");
+                initTopic(_maintenancePathPrefix, mqtt_topic_suppressed_publishes, "");
+                initTopic(_maintenancePathPrefix, mqtt_topic_mqtt_pool, "");
                 initTopic(_maintenancePathPrefix, mqtt_topic_log, "");
                 initTopic(_maintenancePathPrefix, mqtt_topic_wifi_rssi, "");
 
                 if(_preferences->getBool(preference_update_from_mqtt, false))
                 {
                     initTopic(_maintenancePathPrefix, mqtt_topic_update, "0");
-                    subscribe(_maintenancePathPrefix, mqtt_topic_update);
+                    subscribe(_maintenancePathPrefix, mqtt_topic_update, [this](const char* topic, char* data) { onUpdateReceived(data); });
                 }
 
                 if(_preferences->getBool(preference_publish_config, false))
@@ -907,12 +1121,12 @@ bool NukiNetwork::reconnect(bool force)
                 if(_preferences->getBool(preference_config_from_mqtt, false) || _preferences->getBool(preference_publish_config, false))
                 {
                     initTopic(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_action, "--");
-                    subscribe(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_action);
+                    subscribe(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_action, [this](const char* topic, char* data) { onConfigActionReceived(data); });
                     initTopic(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_action_command_result, "--");
                 }
 
                 initTopic(_maintenancePathPrefix, mqtt_topic_webserver_action, "--");
-                subscribe(_maintenancePathPrefix, mqtt_topic_webserver_action);
+                subscribe(_maintenancePathPrefix, mqtt_topic_webserver_action, [this](const char* topic, char* data) { onWebserverActionReceived(data); });
                 initTopic(_maintenancePathPrefix, mqtt_topic_webserver_state, (_preferences->getBool(preference_webserver_enabled, true) || forceEnableWebServer ? "1" : "0"));
 
                 for(const auto& it : _initTopics)
@@ -929,6 +1143,11 @@ bool NukiNetwork::reconnect(bool force)
             publishString(_maintenancePathPrefix, mqtt_topic_mqtt_connection_state, "online", true);
             publishString(_maintenancePathPrefix, mqtt_topic_info_nuki_hub_ip, _device->localIP().c_str(), true);
 
+            if(_device->isEncrypted())
+            {
+                publishMqttTlsStats();
+            }
+
             _mqttConnectionState = 2;
             for(const auto& callback : _reconnectedCallbacks)
             {
@@ -946,11 +1165,12 @@ bool NukiNetwork::reconnect(bool force)
     return _mqttConnectionState > 0;
 }
 
-void NukiNetwork::subscribe(const char* prefix, const char *path)
+void NukiNetwork::subscribe(const char* prefix, const char *path, MqttTopicHandler handler, const void* owner)
 {
     char prefixedPath[500];
     buildMqttPath(prefixedPath, { prefix, path });
     _subscribedTopics.push_back(prefixedPath);
+    _router.add(prefixedPath, path, handler, owner);
 }
 
 void NukiNetwork::initTopic(const char *prefix, const char *path, const char *value)
@@ -962,32 +1182,6 @@ void NukiNetwork::initTopic(const char *prefix, const char *path, const char *va
     _initTopics[pathStr] = valueStr;
 }
 
-void NukiNetwork::buildMqttPath(const char *path, char *outPath)
-{
-    int offset = 0;
-    char inPath[181] = {0};
-
-    memcpy(inPath, _nukiHubPath, sizeof(_nukiHubPath));
-
-    for(const char& c : inPath)
-    {
-        if(c == 0x00)
-        {
-            break;
-        }
-        outPath[offset] = c;
-        ++offset;
-    }
-    int i=0;
-    while(outPath[i] != 0x00)
-    {
-        outPath[offset] = path[i];
-        ++i;
-        ++offset;
-    }
-    outPath[i+1] = 0x00;
-}
-
 void NukiNetwork::buildMqttPath(char* outPath, std::initializer_list<const char*> paths)
 {
     int offset = 0;
@@ -1014,23 +1208,9 @@ void NukiNetwork::buildMqttPath(char* outPath, std::initializer_list<const char*
     outPath[offset] = 0x00;
 }
 
-void NukiNetwork::registerMqttReceiver(MqttReceiver* receiver)
-{
-    _mqttReceivers.push_back(receiver);
-}
-
 void NukiNetwork::onMqttDataReceivedCallback(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t len, size_t index, size_t total)
 {
-    uint8_t value[800] = {0};
-
-    size_t l = min(len, sizeof(value)-1);
-
-    for(int i=0; i<l; i++)
-    {
-        value[i] = payload[i];
-    }
-
-    _inst->onMqttDataReceived(properties, topic, value, len, index, total);
+    _inst->onMqttDataReceived(properties, topic, payload, len, index, total);
 }
 
 void NukiNetwork::onMqttDataReceived(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t& len, size_t& index, size_t& total)
@@ -1040,21 +1220,21 @@ void NukiNetwork::onMqttDataReceived(const espMqttClientTypes::MessageProperties
         return;
     }
 
-    parseGpioTopics(properties, topic, payload, len, index, total);
-
-    onMqttDataReceived(topic, (byte*)payload, index);
+    char* data = (char*)_reassembler->feed(topic, payload, len, index, total);
 
-    for(auto receiver : _mqttReceivers)
+    if(data == nullptr)
     {
-        receiver->onMqttDataReceived(topic, (byte*)payload, index);
+        return;
     }
+
+    parseGpioTopics(topic, data);
+
+    _router.dispatch(topic, data);
 }
 
-void NukiNetwork::onMqttDataReceived(const char* topic, byte* payload, const unsigned int length)
+void NukiNetwork::onResetReceived(const char* data)
 {
-    char* data = (char*)payload;
-
-    if(comparePrefixedPath(topic, mqtt_topic_reset) && strcmp(data, "1") == 0 && !mqttRecentlyConnected())
+    if(strcmp(data, "1") == 0 && !mqttRecentlyConnected())
     {
         Log->println("Restart requested via MQTT.");
         clearWifiFallback();
@@ -1065,128 +1245,20 @@ void NukiNetwork::onMqttDataReceived(const char* topic, byte* payload, const uns
         vTaskDelay(200 / portTICK_PERIOD_MS);
         restartEsp(RestartReason::RequestedViaMqtt);
     }
-    else if(comparePrefixedPath(topic, mqtt_topic_update) && strcmp(data, "1") == 0 && _preferences->getBool(preference_update_from_mqtt, false) && !mqttRecentlyConnected() && _hasInternet)
+}
+
+void NukiNetwork::onUpdateReceived(const char* data)
+{
+    if(strcmp(data, "1") == 0 && _preferences->getBool(preference_update_from_mqtt, false) && !mqttRecentlyConnected() && isInternetConnected())
     {
         Log->println("Update requested via MQTT.");
-
-        bool otaManifestSuccess = false;
-        JsonDocument doc;
-
-        NetworkClientSecure *client = new NetworkClientSecure;
-        if (client)
-        {
-            client->setCACertBundle(x509_crt_imported_bundle_bin_start, x509_crt_imported_bundle_bin_end - x509_crt_imported_bundle_bin_start);
-            {
-                HTTPClient https;
-                https.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-                https.useHTTP10(true);
-
-                if (https.begin(*client, GITHUB_OTA_MANIFEST_URL))
-                {
-                    int httpResponseCode = https.GET();
-
-                    if (httpResponseCode == HTTP_CODE_OK || httpResponseCode == HTTP_CODE_MOVED_PERMANENTLY)
-                    {
-                        DeserializationError jsonError = deserializeJson(doc, https.getStream());
-
-                        if (!jsonError)
-                        {
-                            otaManifestSuccess = true;
-                        }
-                    }
-                }
-                https.end();
-            }
-            delete client;
-        }
-
-        if (otaManifestSuccess)
-        {
-            String currentVersion = NUKI_HUB_VERSION;
-
-            if(atof(doc["release"]["version"]) >= atof(currentVersion.c_str()))
-            {
-                if(strcmp(NUKI_HUB_VERSION, doc["release"]["fullversion"].as<const char*>()) == 0 && strcmp(NUKI_HUB_BUILD, doc["release"]["build"].as<const char*>()) == 0 && strcmp(NUKI_HUB_DATE, doc["release"]["time"].as<const char*>()) == 0)
-                {
-                    Log->println("Nuki Hub is already on the latest release version, OTA update aborted.");
-                }
-                else
-                {
-                    _preferences->putString(preference_ota_updater_url, GITHUB_LATEST_UPDATER_BINARY_URL);
-                    _preferences->putString(preference_ota_main_url, GITHUB_LATEST_RELEASE_BINARY_URL);
-                    Log->println("Updating to latest release version.");
-                    if (esp_task_wdt_status(NULL) == ESP_OK)
-                    {
-                        esp_task_wdt_reset();
-                    }
-                    vTaskDelay(200 / portTICK_PERIOD_MS);
-                    restartEsp(RestartReason::OTAReboot);
-                }
-            }
-            else if(currentVersion.indexOf("beta") > 0)
-            {
-                if(strcmp(NUKI_HUB_VERSION, doc["beta"]["fullversion"].as<const char*>()) == 0 && strcmp(NUKI_HUB_BUILD, doc["beta"]["build"].as<const char*>()) == 0 && strcmp(NUKI_HUB_DATE, doc["beta"]["time"].as<const char*>()) == 0)
-                {
-                    Log->println("Nuki Hub is already on the latest beta version, OTA update aborted.");
-                }
-                else
-                {
-                    _preferences->putString(preference_ota_updater_url, GITHUB_BETA_UPDATER_BINARY_URL);
-                    _preferences->putString(preference_ota_main_url, GITHUB_BETA_RELEASE_BINARY_URL);
-                    Log->println("Updating to latest beta version.");
-                    if (esp_task_wdt_status(NULL) == ESP_OK)
-                    {
-                        esp_task_wdt_reset();
-                    }
-                    vTaskDelay(200 / portTICK_PERIOD_MS);
-                    restartEsp(RestartReason::OTAReboot);
-                }
-            }
-            else if(currentVersion.indexOf("master") > 0)
-            {
-                if(strcmp(NUKI_HUB_VERSION, doc["master"]["fullversion"].as<const char*>()) == 0 && strcmp(NUKI_HUB_BUILD, doc["master"]["build"].as<const char*>()) == 0 && strcmp(NUKI_HUB_DATE, doc["master"]["time"].as<const char*>()) == 0)
-                {
-                    Log->println("Nuki Hub is already on the latest development version, OTA update aborted.");
-                }
-                else
-                {
-                    _preferences->putString(preference_ota_updater_url, GITHUB_MASTER_UPDATER_BINARY_URL);
-                    _preferences->putString(preference_ota_main_url, GITHUB_MASTER_RELEASE_BINARY_URL);
-                    Log->println("Updating to latest developmemt version.");
-                    if (esp_task_wdt_status(NULL) == ESP_OK)
-                    {
-                        esp_task_wdt_reset();
-                    }
-                    vTaskDelay(200 / portTICK_PERIOD_MS);
-                    restartEsp(RestartReason::OTAReboot);
-                }
-            }
-            else
-            {
-                if(strcmp(NUKI_HUB_VERSION, doc["release"]["fullversion"].as<const char*>()) == 0 && strcmp(NUKI_HUB_BUILD, doc["release"]["build"].as<const char*>()) == 0 && strcmp(NUKI_HUB_DATE, doc["release"]["time"].as<const char*>()) == 0)
-                {
-                    Log->println("Nuki Hub is already on the latest release version, OTA update aborted.");
-                }
-                else
-                {
-                    _preferences->putString(preference_ota_updater_url, GITHUB_LATEST_UPDATER_BINARY_URL);
-                    _preferences->putString(preference_ota_main_url, GITHUB_LATEST_RELEASE_BINARY_URL);
-                    Log->println("Updating to latest release version.");
-                    if (esp_task_wdt_status(NULL) == ESP_OK)
-                    {
-                        esp_task_wdt_reset();
-                    }
-                    vTaskDelay(200 / portTICK_PERIOD_MS);
-                    restartEsp(RestartReason::OTAReboot);
-                }
-            }
-        }
-        else
-        {
-            Log->println("Failed to retrieve OTA manifest, OTA update aborted.");
-        }
+        _otaUpdateTicket = OtaManifestFetcher::get()->request();
     }
-    else if(comparePrefixedPath(topic, mqtt_topic_webserver_action) && !mqttRecentlyConnected())
+}
+
+void NukiNetwork::onWebserverActionReceived(const char* data)
+{
+    if(!mqttRecentlyConnected())
     {
         if(strcmp(data, "") == 0 ||
                 strcmp(data, "--") == 0)
@@ -1220,7 +1292,11 @@ void NukiNetwork::onMqttDataReceived(const char* topic, byte* payload, const uns
         vTaskDelay(200 / portTICK_PERIOD_MS);
         setRestartServices(false);
     }
-    else if(comparePrefixedPath(topic, mqtt_topic_nuki_hub_config_action) && !mqttRecentlyConnected())
+}
+
+void NukiNetwork::onConfigActionReceived(const char* data)
+{
+    if(!mqttRecentlyConnected())
     {
         if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
         {
@@ -1294,8 +1370,9 @@ void NukiNetwork::onMqttDataReceived(const char* topic, byte* payload, const uns
                         {
                             JsonDocument json;
                             _importExport->exportHttpsJson(json);
-                            serializeJson(json, _buffer, _bufferSize);
-                            publishString(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_json, _buffer, false);
+                            ScratchBuffer buffer(measureJson(json) + 1);
+                            serializeJson(json, buffer.data(), buffer.size());
+                            publishString(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_json, buffer.data(), false);
 
                             if (doc["exportHTTPS"].as<int>() > 0)
                             {
@@ -1320,8 +1397,9 @@ void NukiNetwork::onMqttDataReceived(const char* topic, byte* payload, const uns
                         {
                             JsonDocument json;
                             _importExport->exportMqttsJson(json);
-                            serializeJson(json, _buffer, _bufferSize);
-                            publishString(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_json, _buffer, false);
+                            ScratchBuffer buffer(measureJson(json) + 1);
+                            serializeJson(json, buffer.data(), buffer.size());
+                            publishString(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_json, buffer.data(), false);
 
                             if (doc["exportMQTTS"].as<int>() > 0)
                             {
@@ -1368,8 +1446,9 @@ void NukiNetwork::onMqttDataReceived(const char* topic, byte* payload, const uns
                         }
                         JsonDocument json;
                         _importExport->exportNukiHubJson(json, redacted, pairing, _preferences->getBool(preference_lock_enabled, true), _preferences->getBool(preference_opener_enabled, false));
-                        serializeJson(json, _buffer, _bufferSize);
-                        publishString(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_json, _buffer, false);
+                        ScratchBuffer buffer(measureJson(json) + 1);
+                        serializeJson(json, buffer.data(), buffer.size());
+                        publishString(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_json, buffer.data(), false);
 
                         if (doc["exportNH"].as<int>() > 0)
                         {
@@ -1387,8 +1466,9 @@ void NukiNetwork::onMqttDataReceived(const char* topic, byte* payload, const uns
                     {
                         JsonDocument json;
                         json = _importExport->importJson(doc);
-                        serializeJson(json, _buffer, _bufferSize);
-                        publishString(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_json, _buffer, false);
+                        ScratchBuffer buffer(measureJson(json) + 1);
+                        serializeJson(json, buffer.data(), buffer.size());
+                        publishString(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_json, buffer.data(), false);
                         publishString(_maintenancePathPrefix, mqtt_topic_nuki_hub_config_action, "--", true);
                         if (esp_task_wdt_status(NULL) == ESP_OK)
                         {
@@ -1408,7 +1488,20 @@ void NukiNetwork::onMqttDataReceived(const char* topic, byte* payload, const uns
     }
 }
 
-void NukiNetwork::parseGpioTopics(const espMqttClientTypes::MessageProperties &properties, const char *topic, const uint8_t *payload, size_t& len, size_t& index, size_t& total)
+void NukiNetwork::onHassStatusReceived(const char* data)
+{
+    // a retained birth message is delivered on every connect, only a restart of Home Assistant counts
+    if(strcmp(data, "online") == 0 && !mqttRecentlyConnected())
+    {
+        Log->println("Home Assistant online, republishing discovery configs.");
+        _hadiscovery->resetDiscoveryHashes();
+        setupHASS(0, 0, {0}, {0}, {0}, false, false);
+        ++_hassGeneration;
+        TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_QUERY);
+    }
+}
+
+void NukiNetwork::parseGpioTopics(const char *topic, const char *payload)
 {
     char gpioPath[250];
     buildMqttPath(gpioPath, {_lockPath.c_str(), mqtt_topic_gpio_prefix, mqtt_topic_gpio_pin});
@@ -1427,11 +1520,8 @@ void NukiNetwork::parseGpioTopics(const espMqttClientTypes::MessageProperties &p
 
         if(_gpio->getPinRole(pin) == PinRole::GeneralOutput)
         {
-            const uint8_t pinState = strcmp((const char*)payload, "1") == 0 ? HIGH : LOW;
-            Log->print("GPIO ");
-            Log->print(pin);
-            Log->print(" (Output) --> ");
-            Log->println(pinState);
+            const uint8_t pinState = strcmp(payload, "1") == 0 ? HIGH : LOW;
+            logEvent(LogEvent::GpioOutput, pin, pinState);
             _gpio->setPinOutput(pin, pinState);
         }
     }
@@ -1458,13 +1548,6 @@ const bool NukiNetwork::mqttRecentlyConnected() const
     return _mqttConnectedTs != -1 && (millis() - _mqttConnectedTs < 6000);
 }
 
-const bool NukiNetwork::pathEquals(const char* prefix, const char* path, const char* referencePath)
-{
-    char prefixedPath[500];
-    buildMqttPath(prefixedPath, { prefix, path });
-    return strcmp(prefixedPath, referencePath) == 0;
-}
-
 void NukiNetwork::publishFloat(const char* prefix, const char* topic, const float value, bool retain, const uint8_t precision)
 {
     char str[30];
@@ -1517,11 +1600,39 @@ void NukiNetwork::publish(const char* prefix, const char *topic, const char *val
     char path[200] = {0};
     buildMqttPath(path, { prefix, topic });
     _device->mqttPublish(path, MQTT_QOS_LEVEL, retain, value);
+
+    if(_publishBurstDepth == 0)
+    {
+        TaskScheduler::notify(SchedulerTask::Network, SCHEDULER_EVENT_MQTT_PUBLISH);
+    }
 }
 
 void NukiNetwork::publish(const char* path, const char *value, bool retain)
 {
     _device->mqttPublish(path, MQTT_QOS_LEVEL, retain, value);
+
+    if(_publishBurstDepth == 0)
+    {
+        TaskScheduler::notify(SchedulerTask::Network, SCHEDULER_EVENT_MQTT_PUBLISH);
+    }
+}
+
+void NukiNetwork::beginPublishBurst()
+{
+    ++_publishBurstDepth;
+}
+
+void NukiNetwork::endPublishBurst()
+{
+    if(--_publishBurstDepth == 0)
+    {
+        TaskScheduler::notify(SchedulerTask::Network, SCHEDULER_EVENT_MQTT_PUBLISH);
+    }
+}
+
+void NukiNetwork::countSuppressedPublish()
+{
+    ++_suppressedPublishCount;
 }
 
 void NukiNetwork::removeTopic(const String& mqttPath, const String& mqttTopic)
@@ -1546,6 +1657,11 @@ void NukiNetwork::disableHASS()
     _hadiscovery->disableHASS();
 }
 
+const uint32_t NukiNetwork::hassGeneration() const
+{
+    return _hassGeneration;
+}
+
 void NukiNetwork::publishHassTopic(const String& mqttDeviceType,
                                    const String& mqttDeviceName,
                                    const String& uidString,
@@ -1767,19 +1883,10 @@ void NukiNetwork::timeZoneIdToString(const Nuki::TimeZoneId timeZoneId, char* st
 
 const uint16_t NukiNetwork::subscribe(const char *topic, uint8_t qos)
 {
-    Log->print("Subscribing to MQTT topic: ");
-    Log->println(topic);
+    logEvent(LogEvent::MqttSubscribe, topic);
     return _device->mqttSubscribe(topic, qos);
 }
 
-const bool NukiNetwork::comparePrefixedPath(const char *fullPath, const char *subPath)
-{
-    char prefixedPath[500];
-    buildMqttPath(subPath, prefixedPath);
-
-    return strcmp(fullPath, prefixedPath) == 0;
-}
-
 void NukiNetwork::addReconnectedCallback(std::function<void()> reconnectedCallback)
 {
     _reconnectedCallbacks.push_back(reconnectedCallback);
@@ -3,6 +3,7 @@
 #include <Preferences.h>
 #include <vector>
 #include <map>
+#include <atomic>
 #include "networkDevices/NetworkDevice.h"
 #include "networkDevices/IPConfiguration.h"
 #include "enums/NetworkDeviceType.h"
@@ -10,13 +11,16 @@
 #include "EspMillis.h"
 
 #ifndef NUKI_HUB_UPDATER
-#include "MqttReceiver.h"
+#include "MqttTopicRouter.h"
+#include "MqttReassembler.h"
 #include "MqttTopics.h"
 #include "Gpio.h"
 #include <ArduinoJson.h>
 #include "NukiConstants.h"
 #include "HomeAssistantDiscovery.h"
 #include "ImportExport.h"
+#include "util/OtaManifestFetcher.h"
+#include "util/ReachabilityMonitor.h"
 #endif
 
 class NukiNetwork
@@ -48,14 +52,13 @@ public:
 #ifdef NUKI_HUB_UPDATER
     explicit NukiNetwork(Preferences* preferences);
 #else
-    explicit NukiNetwork(Preferences* preferences, Gpio* gpio, char* buffer, size_t bufferSize, ImportExport* importExport);
+    explicit NukiNetwork(Preferences* preferences, ConfigSnapshot* config, Gpio* gpio, ImportExport* importExport);
 
-    void registerMqttReceiver(MqttReceiver* receiver);
     void disableAutoRestarts(); // disable on OTA start
     void disableMqtt();
 
     bool reconnect(bool force = false);
-    void subscribe(const char* prefix, const char* path);
+    void subscribe(const char* prefix, const char* path, MqttTopicHandler handler = nullptr, const void* owner = nullptr);
     void initTopic(const char* prefix, const char* path, const char* value);
     void publishFloat(const char* prefix, const char* topic, const float value, bool retain, const uint8_t precision = 2);
     void publishInt(const char* prefix, const char* topic, const int value, bool retain);
@@ -66,6 +69,12 @@ public:
     void publishString(const char* prefix, const char* topic, const char* value, bool retain);
     void publish(const char* prefix, const char *topic, const char *value, bool retain);
     void publish(const char* path, const char *value, bool retain);
+    // defers the network task wakeup of publish() until the outermost endPublishBurst(),
+    // every publish is still queued in the MQTT client on its own
+    void beginPublishBurst();
+    void endPublishBurst();
+    // a state publish skipped because its value did not change, reported with the maintenance info
+    void countSuppressedPublish();
     void removeTopic(const String& mqttPath, const String& mqttTopic);
     void batteryTypeToString(const Nuki::BatteryType battype, char* str);
     void advertisingModeToString(const Nuki::AdvertisingMode advmode, char* str);
@@ -73,6 +82,8 @@ public:
 
     void setupHASS(int type, uint32_t nukiId, char* nukiName, const char* firmwareVersion, const char* hardwareVersion, bool hasDoorSensor, bool hasKeypad);
     void disableHASS();
+    // incremented when Home Assistant comes online, discovery configs are republished when it changed
+    const uint32_t hassGeneration() const;
     void publishHassTopic(const String& mqttDeviceType,
                           const String& mqttDeviceName,
                           const String& uidString,
@@ -92,7 +103,6 @@ public:
 
     const int mqttConnectionState() const;  // 0 = not connected; 1 = connected; 2 = connected and mqtt processed
     const bool mqttRecentlyConnected() const;
-    const bool pathEquals(const char* prefix, const char* path, const char* referencePath);
     const uint16_t subscribe(const char* topic, uint8_t qos);
     void addReconnectedCallback(std::function<void()> reconnectedCallback);
 #endif
@@ -102,8 +112,6 @@ private:
 
     static NukiNetwork* _inst;
 
-    const char* _latestVersion;
-
     Preferences* _preferences;
     IPConfiguration* _ipConfiguration = nullptr;
     String _hostname;
@@ -116,32 +124,44 @@ private:
     NetworkDeviceType _networkDeviceType  = (NetworkDeviceType)-1;
     bool _firstBootAfterDeviceChange = false;
     bool _webEnabled = true;
-    bool _hasInternet = false;
 
 #ifndef NUKI_HUB_UPDATER
     static void onMqttDataReceivedCallback(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t len, size_t index, size_t total);
     void onMqttDataReceived(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t& len, size_t& index, size_t& total);
-    void onMqttDataReceived(const char* topic, byte* payload, const unsigned int length);
+    void onResetReceived(const char* data);
+    void onUpdateReceived(const char* data);
+    void onWebserverActionReceived(const char* data);
+    void onConfigActionReceived(const char* data);
+    void onHassStatusReceived(const char* data);
     void onMqttConnect(const bool& sessionPresent);
     void onMqttDisconnect(const espMqttClientTypes::DisconnectReason& reason);
-    void parseGpioTopics(const espMqttClientTypes::MessageProperties& properties, const char* topic, const uint8_t* payload, size_t& len, size_t& index, size_t& total);
+    void parseGpioTopics(const char* topic, const char* payload);
     void gpioActionCallback(const GpioAction& action, const int& pin);
-    const bool comparePrefixedPath(const char* fullPath, const char* subPath);
-    void buildMqttPath(const char *path, char *outPath);
     void buildMqttPath(char* outPath, std::initializer_list<const char*> paths);
-    void checkInternetConnectivity();
+    void publishReachability();
+    void publishScratchUsage();
+    void publishFlashWrites();
+    void publishMqttPoolUsage();
+    void publishMqttTlsStats();
+    void processOtaManifest();
+    void publishLatestVersion(const OtaManifest& manifest);
+    void startOtaUpdate(const OtaManifest& manifest);
 
     const char* _lastWillPayload = "offline";
     char _mqttConnectionStateTopic[211] = {0};
     String _lockPath;
 
     HomeAssistantDiscovery* _hadiscovery = nullptr;
+    ConfigSnapshot* _config = nullptr;
     ImportExport* _importExport;
     Gpio* _gpio;
 
     int _restartServices = 0;
     int _mqttConnectionState = 0;
     int _mqttConnectCounter = 0;
+    int64_t _reconnectBackoffTs = 0;
+    std::atomic<int> _publishBurstDepth {0};
+    std::atomic<uint32_t> _suppressedPublishCount {0};
     int _mqttPort = 1883;
     long _mqttConnectedTs = -1;
     long _overwriteNukiHubConfigTS = -1;
@@ -155,7 +175,10 @@ private:
     char _mqttPass[41] = {0};
     char _maintenancePathPrefix[181] = {0};
     int _networkTimeout = 0;
-    std::vector<MqttReceiver*> _mqttReceivers;
+    MqttTopicRouter _router;
+    MqttReassembler* _reassembler = nullptr;
+    ReachabilityMonitor* _reachability = nullptr;
+    bool _reachabilityPublished = false;
     bool _restartOnDisconnect = false;
     bool _disableNetworkIfNotConnected = false;
     bool _checkUpdates = false;
@@ -165,11 +188,15 @@ private:
     bool _retainGpio = false;
     bool _haEnabled = false;
     bool _haSetupDone = false;
+    std::atomic<uint32_t> _hassGeneration {1};
     std::vector<String> _subscribedTopics;
     std::map<String, String> _initTopics;
     int64_t _lastConnectedTs = 0;
     int64_t _lastMaintenanceTs = 0;
     int64_t _lastUpdateCheckTs = 0;
+    uint32_t _updateCheckTicket = 0;
+    uint32_t _otaUpdateTicket = 0;
+    char _latestVersion[OTA_MANIFEST_FIELD_LENGTH] = {0};
     int64_t _lastRssiTs = 0;
     bool _mqttEnabled = true;
     int _rssiPublishInterval = 0;
@@ -178,8 +205,6 @@ private:
     std::vector<uint8_t> _pinsMqttConnected;
     std::vector<uint8_t> _pinsNetworkConnected;
 
-    char* _buffer;
-    const size_t _bufferSize;
 
     int8_t _lastRssi = 127;
 #endif
@@ -1,6 +1,8 @@
 #include "NukiNetworkLock.h"
 #include "Arduino.h"
 #include "Config.h"
+#include "util/ScratchArena.h"
+#include "util/WriteBehindStore.h"
 #include "MqttTopics.h"
 #include "PreferencesKeys.h"
 #include "Logger.h"
@@ -9,17 +11,17 @@
 #include <ctype.h>
 #include "hal/wdt_hal.h"
 #include "util/NukiHelper.h"
+#include "util/TaskScheduler.h"
 
 extern bool forceEnableWebServer;
 extern const uint8_t x509_crt_imported_bundle_bin_start[] asm("_binary_x509_crt_bundle_start");
 extern const uint8_t x509_crt_imported_bundle_bin_end[]   asm("_binary_x509_crt_bundle_end");
 
-NukiNetworkLock::NukiNetworkLock(NukiNetwork* network, NukiOfficial* nukiOfficial, Preferences* preferences, char* buffer, size_t bufferSize)
+NukiNetworkLock::NukiNetworkLock(NukiNetwork* network, NukiOfficial* nukiOfficial, Preferences* preferences, ConfigSnapshot* config)
     : _network(network),
       _nukiOfficial(nukiOfficial),
       _preferences(preferences),
-      _buffer(buffer),
-      _bufferSize(bufferSize)
+      _config(config)
 {
     _nukiPublisher = new NukiPublisher(network, _mqttPath);
     _nukiOfficial->setPublisher(_nukiPublisher);
@@ -27,7 +29,6 @@ NukiNetworkLock::NukiNetworkLock(NukiNetwork* network, NukiOfficial* nukiOfficia
     memset(_authName, 0, sizeof(_authName));
     _authName[0] = '\0';
 
-    _network->registerMqttReceiver(this);
 }
 
 NukiNetworkLock::~NukiNetworkLock()
@@ -37,7 +38,7 @@ NukiNetworkLock::~NukiNetworkLock()
 void NukiNetworkLock::initialize()
 {
     if (_preferences->getBool(preference_save_log_num, false)) {
-        _lastRollingLog = _preferences->getInt(preference_lock_log_num, 0);
+        _lastRollingLog = WriteBehindStore::get()->getInt(preference_lock_log_num, 0);
         _saveLogEnabled = true;
     }
 
@@ -50,26 +51,28 @@ void NukiNetworkLock::initialize()
         _mqttPath[i] = mqttPath.charAt(i);
     }
 
-    _haEnabled = _preferences->getString(preference_mqtt_hass_discovery, "") != "";
+    _nukiPublisher->initialize();
+
+    _haEnabled = _config->get()->mqttHassDiscovery != "";
     _disableNonJSON = _preferences->getBool(preference_disable_non_json, false);
     _hybridRebootOnDisconnect = _preferences->getBool(preference_hybrid_reboot_on_disconnect, false);
     _isUltra = _preferences->getBool(preference_lock_gemini_enabled, false);
 
     _network->initTopic(_mqttPath, mqtt_topic_lock_action, "--");
-    _network->subscribe(_mqttPath, mqtt_topic_lock_action);
+    subscribe(mqtt_topic_lock_action, &NukiNetworkLock::onLockActionReceived);
     _network->initTopic(_mqttPath, mqtt_topic_config_action, "--");
-    _network->subscribe(_mqttPath, mqtt_topic_config_action);
+    subscribe(mqtt_topic_config_action, &NukiNetworkLock::onConfigActionReceived);
 
     _network->initTopic(_mqttPath, mqtt_topic_query_keypad, "0");
     _network->initTopic(_mqttPath, mqtt_topic_query_config, "0");
     _network->initTopic(_mqttPath, mqtt_topic_query_lockstate, "0");
     _network->initTopic(_mqttPath, mqtt_topic_query_battery, "0");
-    _network->subscribe(_mqttPath, mqtt_topic_query_config);
-    _network->subscribe(_mqttPath, mqtt_topic_query_lockstate);
-    _network->subscribe(_mqttPath, mqtt_topic_query_battery);
+    subscribeQuery(mqtt_topic_query_config, QUERY_COMMAND_CONFIG);
+    subscribeQuery(mqtt_topic_query_lockstate, QUERY_COMMAND_LOCKSTATE);
+    subscribeQuery(mqtt_topic_query_battery, QUERY_COMMAND_BATTERY);
 
     _network->initTopic(_mqttPath, mqtt_topic_doorsensorOverride, "--");
-    _network->subscribe(_mqttPath, mqtt_topic_doorsensorOverride);
+    subscribe(mqtt_topic_doorsensorOverride, &NukiNetworkLock::onDoorSensorOverrideReceived);
 
     _network->initTopic(_mqttPath, mqtt_topic_auth_action, "--");
     _network->initTopic(_mqttPath, mqtt_topic_timecontrol_action, "--");
@@ -131,25 +134,25 @@ void NukiNetworkLock::initialize()
             _network->initTopic(_mqttPath, mqtt_topic_keypad_command_name, "--");
             _network->initTopic(_mqttPath, mqtt_topic_keypad_command_code, "000000");
             _network->initTopic(_mqttPath, mqtt_topic_keypad_command_enabled, "1");
-            _network->subscribe(_mqttPath, mqtt_topic_keypad_command_action);
-            _network->subscribe(_mqttPath, mqtt_topic_keypad_command_id);
-            _network->subscribe(_mqttPath, mqtt_topic_keypad_command_name);
-            _network->subscribe(_mqttPath, mqtt_topic_keypad_command_code);
-            _network->subscribe(_mqttPath, mqtt_topic_keypad_command_enabled);
+            subscribe(mqtt_topic_keypad_command_action, &NukiNetworkLock::onKeypadCommandActionReceived);
+            subscribe(mqtt_topic_keypad_command_id, &NukiNetworkLock::onKeypadCommandIdReceived);
+            subscribe(mqtt_topic_keypad_command_name, &NukiNetworkLock::onKeypadCommandNameReceived);
+            subscribe(mqtt_topic_keypad_command_code, &NukiNetworkLock::onKeypadCommandCodeReceived);
+            subscribe(mqtt_topic_keypad_command_enabled, &NukiNetworkLock::onKeypadCommandEnabledReceived);
         }
 
-        _network->subscribe(_mqttPath, mqtt_topic_query_keypad);
-        _network->subscribe(_mqttPath, mqtt_topic_keypad_json_action);
+        subscribeQuery(mqtt_topic_query_keypad, QUERY_COMMAND_KEYPAD);
+        subscribe(mqtt_topic_keypad_json_action, &NukiNetworkLock::onKeypadJsonActionReceived);
     }
 
     if(_preferences->getBool(preference_timecontrol_control_enabled))
     {
-        _network->subscribe(_mqttPath, mqtt_topic_timecontrol_action);
+        subscribe(mqtt_topic_timecontrol_action, &NukiNetworkLock::onTimeControlActionReceived);
     }
 
     if(_preferences->getBool(preference_auth_control_enabled))
     {
-        _network->subscribe(_mqttPath, mqtt_topic_auth_action);
+        subscribe(mqtt_topic_auth_action, &NukiNetworkLock::onAuthActionReceived);
     }
 
     if(_nukiOfficial->getOffEnabled())
@@ -158,13 +161,19 @@ void NukiNetworkLock::initialize()
 
         for(const auto& offTopic : _nukiOfficial->getOffTopics())
         {
-            _network->subscribe(_nukiOfficial->getMqttPath(), offTopic);
+            _network->subscribe(_nukiOfficial->getMqttPath(), offTopic, [this](const char* topic, char* data)
+            {
+                if(_nukiOfficial->getOffEnabled() && _officialUpdateReceivedCallback != nullptr)
+                {
+                    _officialUpdateReceivedCallback(topic, data);
+                }
+            }, this);
         }
     }
 
     if(_preferences->getBool(preference_publish_authdata, false))
     {
-        _network->subscribe(_mqttPath, mqtt_topic_lock_log_rolling_last);
+        subscribe(mqtt_topic_lock_log_rolling_last, &NukiNetworkLock::onLogRollingLastReceived);
     }
 }
 
@@ -202,228 +211,238 @@ bool NukiNetworkLock::update()
     return ret;
 }
 
-void NukiNetworkLock::onMqttDataReceived(const char* topic, byte* payload, const unsigned int length)
+void NukiNetworkLock::subscribe(const char* topic, void (NukiNetworkLock::*handler)(char* data))
 {
-    char* data = (char*)payload;
+    _network->subscribe(_mqttPath, topic, [this, handler](const char* topic, char* data)
+    {
+        (this->*handler)(data);
+    }, this);
+}
+
+void NukiNetworkLock::subscribeQuery(const char* topic, const uint8_t queryCommand)
+{
+    MqttTopicId topicId = _nukiPublisher->topicId(topic);
 
-    if(_network->mqttRecentlyConnected() && _network->pathEquals(_mqttPath, mqtt_topic_lock_action, topic))
+    _network->subscribe(_mqttPath, topic, [this, queryCommand, topicId](const char* topic, char* data)
+    {
+        if(strcmp(data, "1") == 0)
+        {
+            _queryCommands = _queryCommands | queryCommand;
+            TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_QUERY);
+            _nukiPublisher->publishInt(topicId, 0, true);
+        }
+    }, this);
+}
+
+void NukiNetworkLock::onLockActionReceived(char* data)
+{
+    if(_network->mqttRecentlyConnected())
     {
         Log->println("MQTT recently connected, ignoring lock action.");
         return;
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_lock_log_rolling_last) && !_saveLogEnabled)
+    if(strcmp(data, "") == 0 ||
+            strcmp(data, "--") == 0 ||
+            strcmp(data, "ack") == 0 ||
+            strcmp(data, "unknown_action") == 0 ||
+            strcmp(data, "denied") == 0 ||
+            strcmp(data, "error") == 0)
     {
-        if(strcmp(data, "") == 0 ||
-                strcmp(data, "--") == 0)
-        {
-            return;
-        }
-
-        if(atoi(data) > 0 && atoi(data) > _lastRollingLog)
-        {
-            _lastRollingLog = atoi(data);
-        }
+        return;
     }
 
-    if(_nukiOfficial->getOffEnabled())
+    Log->print("Lock action received: ");
+    Log->println(data);
+    LockActionResult lockActionResult = LockActionResult::Failed;
+    if(_lockActionReceivedCallback != NULL)
     {
-        for(auto offTopic : _nukiOfficial->getOffTopics())
-        {
-            if(_nukiOfficial->comparePrefixedPath(topic, offTopic))
-            {
-                if(_officialUpdateReceivedCallback != nullptr)
-                {
-                    _officialUpdateReceivedCallback(offTopic, data);
-                }
-            }
-        }
+        lockActionResult = _lockActionReceivedCallback(data);
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_lock_action))
+    switch(lockActionResult)
     {
-        if(strcmp(data, "") == 0 ||
-                strcmp(data, "--") == 0 ||
-                strcmp(data, "ack") == 0 ||
-                strcmp(data, "unknown_action") == 0 ||
-                strcmp(data, "denied") == 0 ||
-                strcmp(data, "error") == 0)
-        {
-            return;
-        }
+    case LockActionResult::Success:
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action), "ack", false);
+        break;
+    case LockActionResult::UnknownAction:
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action), "unknown_action", false);
+        break;
+    case LockActionResult::AccessDenied:
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action), "denied", false);
+        break;
+    case LockActionResult::Failed:
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action), "error", false);
+        break;
+    }
+}
 
-        Log->print("Lock action received: ");
-        Log->println(data);
-        LockActionResult lockActionResult = LockActionResult::Failed;
-        if(_lockActionReceivedCallback != NULL)
-        {
-            lockActionResult = _lockActionReceivedCallback(data);
-        }
+void NukiNetworkLock::onLogRollingLastReceived(char* data)
+{
+    if(_saveLogEnabled || strcmp(data, "") == 0 || strcmp(data, "--") == 0)
+    {
+        return;
+    }
 
-        switch(lockActionResult)
-        {
-        case LockActionResult::Success:
-            _nukiPublisher->publishString(mqtt_topic_lock_action, "ack", false);
-            break;
-        case LockActionResult::UnknownAction:
-            _nukiPublisher->publishString(mqtt_topic_lock_action, "unknown_action", false);
-            break;
-        case LockActionResult::AccessDenied:
-            _nukiPublisher->publishString(mqtt_topic_lock_action, "denied", false);
-            break;
-        case LockActionResult::Failed:
-            _nukiPublisher->publishString(mqtt_topic_lock_action, "error", false);
-            break;
-        }
+    if(atoi(data) > 0 && atoi(data) > _lastRollingLog)
+    {
+        _lastRollingLog = atoi(data);
     }
+}
 
-    if(comparePrefixedPath(topic, mqtt_topic_doorsensorOverride))
+void NukiNetworkLock::onDoorSensorOverrideReceived(char* data)
+{
+    if(strcmp(data, "0") == 0)
     {
-        if(strcmp(data, "0") == 0)
-        {
-            _requestDoorSensorOverride = DoorSensorOverride::DoorClosed;
-        }
-        if(strcmp(data, "1") == 0)
-        {
-            _requestDoorSensorOverride = DoorSensorOverride::DoorOpen;
-        }
+        _requestDoorSensorOverride = DoorSensorOverride::DoorClosed;
+        TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_QUERY);
+    }
+    if(strcmp(data, "1") == 0)
+    {
+        _requestDoorSensorOverride = DoorSensorOverride::DoorOpen;
+        TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_QUERY);
     }
+}
 
-    if(!_disableNonJSON)
+void NukiNetworkLock::onKeypadCommandActionReceived(char* data)
+{
+    if(_disableNonJSON || _keypadCommandReceivedReceivedCallback == nullptr || strcmp(data, "--") == 0)
     {
-        if(comparePrefixedPath(topic, mqtt_topic_keypad_command_action))
-        {
-            if(_keypadCommandReceivedReceivedCallback != nullptr)
-            {
-                if(strcmp(data, "--") == 0)
-                {
-                    return;
-                }
+        return;
+    }
 
-                _keypadCommandReceivedReceivedCallback(data, _keypadCommandId, _keypadCommandName, _keypadCommandCode, _keypadCommandEnabled);
+    _keypadCommandReceivedReceivedCallback(data, _keypadCommandId, _keypadCommandName, _keypadCommandCode, _keypadCommandEnabled);
 
-                _keypadCommandId = 0;
-                _keypadCommandName = "--";
-                _keypadCommandCode = "000000";
-                _keypadCommandEnabled = 1;
+    _keypadCommandId = 0;
+    _keypadCommandName = "--";
+    _keypadCommandCode = "000000";
+    _keypadCommandEnabled = 1;
 
-                if(strcmp(data, "--") != 0)
-                {
-                    _nukiPublisher->publishString(mqtt_topic_keypad_command_action, "--", true);
-                }
-                _nukiPublisher->publishInt(mqtt_topic_keypad_command_id, _keypadCommandId, true);
-                _nukiPublisher->publishString(mqtt_topic_keypad_command_name, _keypadCommandName, true);
-                _nukiPublisher->publishString(mqtt_topic_keypad_command_code, _keypadCommandCode, true);
-                _nukiPublisher->publishInt(mqtt_topic_keypad_command_enabled, _keypadCommandEnabled, true);
-            }
-        }
-        else if(comparePrefixedPath(topic, mqtt_topic_keypad_command_id))
-        {
-            _keypadCommandId = atoi(data);
-        }
-        else if(comparePrefixedPath(topic, mqtt_topic_keypad_command_name))
-        {
-            _keypadCommandName = data;
-        }
-        else if(comparePrefixedPath(topic, mqtt_topic_keypad_command_code))
-        {
-            _keypadCommandCode = data;
-        }
-        else if(comparePrefixedPath(topic, mqtt_topic_keypad_command_enabled))
-        {
-            _keypadCommandEnabled = atoi(data);
-        }
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_command_action), "--", true);
+    _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_keypad_command_id), _keypadCommandId, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_command_name), _keypadCommandName, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_command_code), _keypadCommandCode, true);
+    _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_keypad_command_enabled), _keypadCommandEnabled, true);
+}
+
+void NukiNetworkLock::onKeypadCommandIdReceived(char* data)
+{
+    if(!_disableNonJSON)
+    {
+        _keypadCommandId = atoi(data);
     }
+}
 
-    if(comparePrefixedPath(topic, mqtt_topic_query_config) && strcmp(data, "1") == 0)
+void NukiNetworkLock::onKeypadCommandNameReceived(char* data)
+{
+    if(!_disableNonJSON)
     {
-        _queryCommands = _queryCommands | QUERY_COMMAND_CONFIG;
-        _nukiPublisher->publishInt(mqtt_topic_query_config, 0, true);
+        _keypadCommandName = data;
     }
-    else if(comparePrefixedPath(topic, mqtt_topic_query_lockstate) && strcmp(data, "1") == 0)
+}
+
+void NukiNetworkLock::onKeypadCommandCodeReceived(char* data)
+{
+    if(!_disableNonJSON)
     {
-        _queryCommands = _queryCommands | QUERY_COMMAND_LOCKSTATE;
-        _nukiPublisher->publishInt(mqtt_topic_query_lockstate, 0, true);
+        _keypadCommandCode = data;
     }
-    else if(comparePrefixedPath(topic, mqtt_topic_query_keypad) && strcmp(data, "1") == 0)
+}
+
+void NukiNetworkLock::onKeypadCommandEnabledReceived(char* data)
+{
+    if(!_disableNonJSON)
     {
-        _queryCommands = _queryCommands | QUERY_COMMAND_KEYPAD;
-        _nukiPublisher->publishInt(mqtt_topic_query_keypad, 0, true);
+        _keypadCommandEnabled = atoi(data);
     }
-    else if(comparePrefixedPath(topic, mqtt_topic_query_battery) && strcmp(data, "1") == 0)
+}
+
+void NukiNetworkLock::onConfigActionReceived(char* data)
+{
+    if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
     {
-        _queryCommands = _queryCommands | QUERY_COMMAND_BATTERY;
-        _nukiPublisher->publishInt(mqtt_topic_query_battery, 0, true);
+        return;
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_config_action))
+    if(_configUpdateReceivedCallback != NULL)
     {
-        if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
-        {
-            return;
-        }
+        _configUpdateReceivedCallback(data);
+    }
 
-        if(_configUpdateReceivedCallback != NULL)
-        {
-            _configUpdateReceivedCallback(data);
-        }
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_config_action), "--", true);
+}
 
-        _nukiPublisher->publishString(mqtt_topic_config_action, "--", true);
+void NukiNetworkLock::onKeypadJsonActionReceived(char* data)
+{
+    if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
+    {
+        return;
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_keypad_json_action))
+    if(_keypadJsonCommandReceivedReceivedCallback != NULL)
     {
-        if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
-        {
-            return;
-        }
+        _keypadJsonCommandReceivedReceivedCallback(data);
+    }
 
-        if(_keypadJsonCommandReceivedReceivedCallback != NULL)
-        {
-            _keypadJsonCommandReceivedReceivedCallback(data);
-        }
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_json_action), "--", true);
+}
 
-        _nukiPublisher->publishString(mqtt_topic_keypad_json_action, "--", true);
+void NukiNetworkLock::onTimeControlActionReceived(char* data)
+{
+    if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
+    {
+        return;
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_timecontrol_action))
+    if(_timeControlCommandReceivedReceivedCallback != NULL)
     {
-        if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
-        {
-            return;
-        }
+        _timeControlCommandReceivedReceivedCallback(data);
+    }
 
-        if(_timeControlCommandReceivedReceivedCallback != NULL)
-        {
-            _timeControlCommandReceivedReceivedCallback(data);
-        }
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_timecontrol_action), "--", true);
+}
 
-        _nukiPublisher->publishString(mqtt_topic_timecontrol_action, "--", true);
+void NukiNetworkLock::onAuthActionReceived(char* data)
+{
+    if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
+    {
+        return;
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_auth_action))
+    if(_authCommandReceivedReceivedCallback != NULL)
     {
-        if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
-        {
-            return;
-        }
-
-        if(_authCommandReceivedReceivedCallback != NULL)
-        {
-            _authCommandReceivedReceivedCallback(data);
-        }
-
-        _nukiPublisher->publishString(mqtt_topic_auth_action, "--", true);
+        _authCommandReceivedReceivedCallback(data);
     }
+
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_auth_action), "--", true);
 }
 
-void NukiNetworkLock::publishKeyTurnerState(const NukiLock::KeyTurnerState& keyTurnerState, const NukiLock::KeyTurnerState& lastKeyTurnerState)
+void NukiNetworkLock::publishKeyTurnerState(const NukiLock::KeyTurnerState& keyTurnerState)
 {
+    PublishedKeyTurnerState current;
+    memset(&current, 0, sizeof(current));
+    current.state = keyTurnerState;
+    current.offConnected = _nukiOfficial->getOffConnected();
+
+    if(current.offConnected)
+    {
+        current.offState = _nukiOfficial->getOffState();
+        current.offTrigger = _nukiOfficial->getOffTrigger();
+        current.offLockAction = _nukiOfficial->getOffLockAction();
+        current.offDoorsensorState = _nukiOfficial->getOffDoorsensorState();
+    }
+
+    current.authId = getAuthId();
+    strncpy(current.authName, getAuthName(), sizeof(current.authName) - 1);
+
+    const NukiLock::KeyTurnerState& lastKeyTurnerState = _publishedKeyTurnerState.state;
+    bool forcePublish = _firstTunerStatePublish || current.offConnected != _publishedKeyTurnerState.offConnected;
+    bool changed = forcePublish || memcmp(&current, &_publishedKeyTurnerState, sizeof(current)) != 0;
+
     char str[50];
     memset(&str, 0, sizeof(str));
 
-    JsonDocument json;
-    JsonDocument jsonBattery;
+    _network->beginPublishBurst();
 
     if(!_nukiOfficial->getOffConnected())
     {
@@ -431,52 +450,135 @@ void NukiNetworkLock::publishKeyTurnerState(const NukiLock::KeyTurnerState& keyT
 
         if(keyTurnerState.lockState != NukiLock::LockState::Undefined)
         {
-
-            _nukiPublisher->publishString(mqtt_topic_lock_state, str, true);
+            bool lockStateChanged = forcePublish || keyTurnerState.lockState != lastKeyTurnerState.lockState;
+            publishIfChanged(lockStateChanged, MQTT_TOPIC_ID(mqtt_topic_lock_state), str);
 
             if(_haEnabled)
             {
-                publishState(keyTurnerState.lockState);
+                publishState(keyTurnerState.lockState, lockStateChanged);
             }
         }
-
-        json["lock_state"] = str;
     }
     else
     {
         lockstateToString((NukiLock::LockState)_nukiOfficial->getOffState(), str);
-        json["lock_state"] = str;
     }
 
-    if(strcmp(str, "undefined") == 0)
+    int8_t available = strcmp(str, "undefined") == 0 ? 0 : 1;
+
+    publishIfChanged(forcePublish || available != _publishedAvailability, MQTT_TOPIC_ID(mqtt_topic_lock_availability), available == 1 ? "online" : "offline");
+    _publishedAvailability = available;
+
+    if(!_nukiOfficial->getOffConnected())
+    {
+        memset(&str, 0, sizeof(str));
+        triggerToString(keyTurnerState.trigger, str);
+        publishIfChanged(forcePublish || keyTurnerState.trigger != lastKeyTurnerState.trigger, MQTT_TOPIC_ID(mqtt_topic_lock_trigger), str);
+
+        memset(&str, 0, sizeof(str));
+        lockactionToString(keyTurnerState.lastLockAction, str);
+        publishIfChanged(forcePublish || keyTurnerState.lastLockAction != lastKeyTurnerState.lastLockAction, MQTT_TOPIC_ID(mqtt_topic_lock_last_lock_action), str);
+    }
+
+    memset(&str, 0, sizeof(str));
+    NukiLock::completionStatusToString(keyTurnerState.lastLockActionCompletionStatus, str);
+    publishIfChanged(forcePublish || keyTurnerState.lastLockActionCompletionStatus != lastKeyTurnerState.lastLockActionCompletionStatus, MQTT_TOPIC_ID(mqtt_topic_lock_completionStatus), str);
+
+    if(!_nukiOfficial->getOffConnected())
+    {
+        memset(&str, 0, sizeof(str));
+        NukiLock::doorSensorStateToString(keyTurnerState.doorSensorState, str);
+        publishIfChanged(forcePublish || keyTurnerState.doorSensorState != lastKeyTurnerState.doorSensorState, MQTT_TOPIC_ID(mqtt_topic_lock_door_sensor_state), str);
+
+        bool critical = (keyTurnerState.criticalBatteryState & 1) == 1;
+        bool charging = (keyTurnerState.criticalBatteryState & 2) == 2;
+        uint8_t level = ((keyTurnerState.criticalBatteryState & 0b11111100) >> 1);
+        bool keypadCritical = keyTurnerState.accessoryBatteryState != 255 ? ((keyTurnerState.accessoryBatteryState & 1) == 1 ? (keyTurnerState.accessoryBatteryState & 3) == 3 : false) : false;
+        bool doorSensorCritical = keyTurnerState.accessoryBatteryState != 255 ? ((keyTurnerState.accessoryBatteryState & 4) == 4 ? (keyTurnerState.accessoryBatteryState & 12) == 12 : false) : false;
+
+        bool criticalBatteryChanged = forcePublish || keyTurnerState.criticalBatteryState != lastKeyTurnerState.criticalBatteryState;
+        bool accessoryBatteryChanged = forcePublish || keyTurnerState.accessoryBatteryState != lastKeyTurnerState.accessoryBatteryState;
+
+        if(!_disableNonJSON)
+        {
+            char levelStr[5];
+            itoa(level, levelStr, 10);
+
+            publishIfChanged(criticalBatteryChanged, MQTT_TOPIC_ID(mqtt_topic_battery_critical), critical ? "1" : "0");
+            publishIfChanged(criticalBatteryChanged, MQTT_TOPIC_ID(mqtt_topic_battery_charging), charging ? "1" : "0");
+            publishIfChanged(criticalBatteryChanged, MQTT_TOPIC_ID(mqtt_topic_battery_level), levelStr);
+            publishIfChanged(accessoryBatteryChanged, MQTT_TOPIC_ID(mqtt_topic_battery_keypad_critical), keypadCritical ? "1" : "0");
+            publishIfChanged(accessoryBatteryChanged, MQTT_TOPIC_ID(mqtt_topic_battery_doorsensor_critical), doorSensorCritical ? "1" : "0");
+        }
+
+        if(criticalBatteryChanged || accessoryBatteryChanged)
+        {
+            JsonDocument jsonBattery;
+            jsonBattery["critical"] = critical ? "1" : "0";
+            jsonBattery["charging"] = charging ? "1" : "0";
+            jsonBattery["level"] = level;
+            jsonBattery["keypadCritical"] = keypadCritical ? "1" : "0";
+            jsonBattery["doorSensorCritical"] = doorSensorCritical ? "1" : "0";
+
+            ScratchBuffer buffer(measureJson(jsonBattery) + 1);
+            serializeJson(jsonBattery, buffer.data(), buffer.size());
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_battery_basic_json), buffer.data(), true);
+        }
+        else
+        {
+            _network->countSuppressedPublish();
+        }
+    }
+
+    if(changed)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_availability, "offline", true);
+        JsonDocument json;
+        buildKeyTurnerStateJson(json, keyTurnerState);
+
+        ScratchBuffer buffer(measureJson(json) + 1);
+        serializeJson(json, buffer.data(), buffer.size());
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_json), buffer.data(), true);
     }
     else
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_availability, "online", true);
+        _network->countSuppressedPublish();
     }
 
-    json["lockngo_state"] = keyTurnerState.lockNgoTimer != 255 ? keyTurnerState.lockNgoTimer : 0;
+    _network->endPublishBurst();
 
+    // publishes are dropped while disconnected, resend everything once the broker is back
+    _firstTunerStatePublish = !_network->mqttConnected();
+    _publishedKeyTurnerState = current;
+}
+
+void NukiNetworkLock::buildKeyTurnerStateJson(JsonDocument& json, const NukiLock::KeyTurnerState& keyTurnerState)
+{
+    char str[50];
     memset(&str, 0, sizeof(str));
 
     if(!_nukiOfficial->getOffConnected())
     {
-        triggerToString(keyTurnerState.trigger, str);
+        lockstateToString(keyTurnerState.lockState, str);
+    }
+    else
+    {
+        lockstateToString((NukiLock::LockState)_nukiOfficial->getOffState(), str);
+    }
+    json["lock_state"] = str;
 
-        if(_firstTunerStatePublish || keyTurnerState.trigger != lastKeyTurnerState.trigger)
-        {
-            _nukiPublisher->publishString(mqtt_topic_lock_trigger, str, true);
-        }
+    json["lockngo_state"] = keyTurnerState.lockNgoTimer != 255 ? keyTurnerState.lockNgoTimer : 0;
+
+    memset(&str, 0, sizeof(str));
 
-        json["trigger"] = str;
+    if(!_nukiOfficial->getOffConnected())
+    {
+        triggerToString(keyTurnerState.trigger, str);
     }
     else
     {
         triggerToString((NukiLock::Trigger)_nukiOfficial->getOffTrigger(), str);
-        json["trigger"] = str;
     }
+    json["trigger"] = str;
 
     char curTime[20];
     sprintf(curTime, "%04d-%02d-%02d %02d:%02d:%02d", keyTurnerState.currentTimeYear, keyTurnerState.currentTimeMonth, keyTurnerState.currentTimeDay, keyTurnerState.currentTimeHour, keyTurnerState.currentTimeMinute, keyTurnerState.currentTimeSecond);
@@ -489,19 +591,12 @@ void NukiNetworkLock::publishKeyTurnerState(const NukiLock::KeyTurnerState& keyT
     if(!_nukiOfficial->getOffConnected())
     {
         lockactionToString(keyTurnerState.lastLockAction, str);
-
-        if(_firstTunerStatePublish || keyTurnerState.lastLockAction != lastKeyTurnerState.lastLockAction)
-        {
-            _nukiPublisher->publishString(mqtt_topic_lock_last_lock_action, str, true);
-        }
-
-        json["last_lock_action"] = str;
     }
     else
     {
         lockactionToString((NukiLock::LockAction)_nukiOfficial->getOffLockAction(), str);
-        json["last_lock_action"] = str;
     }
+    json["last_lock_action"] = str;
 
     memset(&str, 0, sizeof(str));
     triggerToString(keyTurnerState.lastLockActionTrigger, str);
@@ -509,65 +604,19 @@ void NukiNetworkLock::publishKeyTurnerState(const NukiLock::KeyTurnerState& keyT
 
     memset(&str, 0, sizeof(str));
     NukiLock::completionStatusToString(keyTurnerState.lastLockActionCompletionStatus, str);
-
-    if(_firstTunerStatePublish || keyTurnerState.lastLockActionCompletionStatus != lastKeyTurnerState.lastLockActionCompletionStatus)
-    {
-        _nukiPublisher->publishString(mqtt_topic_lock_completionStatus, str, true);
-    }
-
     json["lock_completion_status"] = str;
+
     memset(&str, 0, sizeof(str));
 
     if(!_nukiOfficial->getOffConnected())
     {
         NukiLock::doorSensorStateToString(keyTurnerState.doorSensorState, str);
-
-        if(_firstTunerStatePublish || keyTurnerState.doorSensorState != lastKeyTurnerState.doorSensorState)
-        {
-            _nukiPublisher->publishString(mqtt_topic_lock_door_sensor_state, str, true);
-        }
-
-        json["door_sensor_state"] = str;
-
-        bool critical = (keyTurnerState.criticalBatteryState & 1) == 1;
-        bool charging = (keyTurnerState.criticalBatteryState & 2) == 2;
-        uint8_t level = ((keyTurnerState.criticalBatteryState & 0b11111100) >> 1);
-        bool keypadCritical = keyTurnerState.accessoryBatteryState != 255 ? ((keyTurnerState.accessoryBatteryState & 1) == 1 ? (keyTurnerState.accessoryBatteryState & 3) == 3 : false) : false;
-
-        jsonBattery["critical"] = critical ? "1" : "0";
-        jsonBattery["charging"] = charging ? "1" : "0";
-        jsonBattery["level"] = level;
-        jsonBattery["keypadCritical"] = keypadCritical ? "1" : "0";
-
-        if((_firstTunerStatePublish || keyTurnerState.criticalBatteryState != lastKeyTurnerState.criticalBatteryState) && !_disableNonJSON)
-        {
-            _nukiPublisher->publishBool(mqtt_topic_battery_critical, critical, true);
-            _nukiPublisher->publishBool(mqtt_topic_battery_charging, charging, true);
-            _nukiPublisher->publishInt(mqtt_topic_battery_level, level, true);
-        }
-
-        if((_firstTunerStatePublish || keyTurnerState.accessoryBatteryState != lastKeyTurnerState.accessoryBatteryState) && !_disableNonJSON)
-        {
-            _nukiPublisher->publishBool(mqtt_topic_battery_keypad_critical, keypadCritical, true);
-        }
-
-        bool doorSensorCritical = keyTurnerState.accessoryBatteryState != 255 ? ((keyTurnerState.accessoryBatteryState & 4) == 4 ? (keyTurnerState.accessoryBatteryState & 12) == 12 : false) : false;
-
-        jsonBattery["doorSensorCritical"] = doorSensorCritical ? "1" : "0";
-
-        if((_firstTunerStatePublish || keyTurnerState.accessoryBatteryState != lastKeyTurnerState.accessoryBatteryState) && !_disableNonJSON)
-        {
-            _nukiPublisher->publishBool(mqtt_topic_battery_doorsensor_critical, doorSensorCritical, true);
-        }
-
-        serializeJson(jsonBattery, _buffer, _bufferSize);
-        _nukiPublisher->publishString(mqtt_topic_battery_basic_json, _buffer, true);
     }
     else
     {
         NukiLock::doorSensorStateToString((NukiLock::DoorSensorState)_nukiOfficial->getOffDoorsensorState(), str);
-        json["door_sensor_state"] = str;
     }
+    json["door_sensor_state"] = str;
 
     if (keyTurnerState.remoteAccessStatus != 255)
     {
@@ -608,47 +657,54 @@ void NukiNetworkLock::publishKeyTurnerState(const NukiLock::KeyTurnerState& keyT
 
     json["auth_id"] = getAuthId();
     json["auth_name"] = getAuthName();
+}
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_lock_json, _buffer, true);
-
-    _firstTunerStatePublish = false;
+void NukiNetworkLock::publishIfChanged(const bool changed, const MqttTopicId& topicId, const char* value)
+{
+    if(changed)
+    {
+        _nukiPublisher->publishString(topicId, value, true);
+    }
+    else
+    {
+        _network->countSuppressedPublish();
+    }
 }
 
-void NukiNetworkLock::publishState(NukiLock::LockState lockState)
+void NukiNetworkLock::publishState(NukiLock::LockState lockState, const bool changed)
 {
     switch(lockState)
     {
     case NukiLock::LockState::Locked:
-        _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "locked", true);
-        _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "locked", true);
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "locked");
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "locked");
         break;
     case NukiLock::LockState::Locking:
-        _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "locking", true);
-        _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "locked", true);
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "locking");
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "locked");
         break;
     case NukiLock::LockState::Unlocking:
-        _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "unlocking", true);
-        _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "unlocked", true);
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "unlocking");
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "unlocked");
         break;
     case NukiLock::LockState::Unlocked:
     case NukiLock::LockState::UnlockedLnga:
-        _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "unlocked", true);
-        _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "unlocked", true);
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "unlocked");
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "unlocked");
         break;
     case NukiLock::LockState::Unlatched:
-        _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "open", true);
-        _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "unlocked", true);
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "open");
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "unlocked");
         break;
     case NukiLock::LockState::Unlatching:
-        _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "opening", true);
-        _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "unlocked", true);
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "opening");
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "unlocked");
         break;
     case NukiLock::LockState::Uncalibrated:
     case NukiLock::LockState::Calibration:
     case NukiLock::LockState::BootRun:
     case NukiLock::LockState::MotorBlocked:
-        _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "jammed", true);
+        publishIfChanged(changed, MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "jammed");
         break;
     default:
         break;
@@ -798,57 +854,66 @@ void NukiNetworkLock::publishAuthorizationInfo(const std::list<NukiLock::LogEntr
         {
             _lastRollingLog = log.index;
             if (_saveLogEnabled) {
-                _preferences->putInt(preference_lock_log_num, _lastRollingLog);
+                WriteBehindStore::get()->putInt(preference_lock_log_num, _lastRollingLog);
             }
-            serializeJson(entry, _buffer, _bufferSize);
-            _nukiPublisher->publishString(mqtt_topic_lock_log_rolling, _buffer, true);
-            _nukiPublisher->publishInt(mqtt_topic_lock_log_rolling_last, log.index, true);
+            ScratchBuffer buffer(measureJson(entry) + 1);
+            serializeJson(entry, buffer.data(), buffer.size());
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_log_rolling), buffer.data(), true);
+            _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_lock_log_rolling_last), log.index, true);
         }
     }
 
-    serializeJson(json, _buffer, _bufferSize);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
 
     if(latest)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_log_latest, _buffer, true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_log_latest), buffer.data(), true);
     }
     else
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_log, _buffer, true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_log), buffer.data(), true);
     }
 
     if(authIndex > 0 || (_nukiOfficial->getOffConnected() && _nukiOfficial->hasAuthId()))
     {
-        _nukiPublisher->publishUInt(mqtt_topic_lock_auth_id, getAuthId(), true);
-        _nukiPublisher->publishString(mqtt_topic_lock_auth_name, getAuthName(), true);
+        _nukiPublisher->publishUInt(MQTT_TOPIC_ID(mqtt_topic_lock_auth_id), getAuthId(), true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_auth_name), getAuthName(), true);
     }
 }
 
 void NukiNetworkLock::clearAuthorizationInfo()
 {
-    _nukiPublisher->publishString(mqtt_topic_lock_log, "--", true);
-    _nukiPublisher->publishUInt(mqtt_topic_lock_auth_id, 0, true);
-    _nukiPublisher->publishString(mqtt_topic_lock_auth_name, "--", true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_log), "--", true);
+    _nukiPublisher->publishUInt(MQTT_TOPIC_ID(mqtt_topic_lock_auth_id), 0, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_auth_name), "--", true);
 }
 
 void NukiNetworkLock::publishCommandResult(const char *resultStr)
 {
-    _nukiPublisher->publishString(mqtt_topic_lock_action_command_result, resultStr, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action_command_result), resultStr, true);
+}
+
+void NukiNetworkLock::publishCommandLatency(const int64_t& lastUs, const int64_t& p50Us, const int64_t& p99Us)
+{
+    char str[80];
+    snprintf(str, sizeof(str), "{\"last\":%lld,\"p50\":%lld,\"p99\":%lld}", lastUs / 1000, p50Us / 1000, p99Us / 1000);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action_latency), str, false);
 }
 
 void NukiNetworkLock::publishLockstateCommandResult(const char *resultStr)
 {
-    _nukiPublisher->publishString(mqtt_topic_query_lockstate_command_result, resultStr, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_query_lockstate_command_result), resultStr, true);
 }
 
 void NukiNetworkLock::publishBatteryReport(const NukiLock::BatteryReport& batteryReport)
 {
     if(!_disableNonJSON)
     {
-        _nukiPublisher->publishFloat(mqtt_topic_battery_voltage, (float)batteryReport.batteryVoltage / 1000.0, true);
-        _nukiPublisher->publishInt(mqtt_topic_battery_drain, batteryReport.batteryDrain, true); // milliwatt seconds
-        _nukiPublisher->publishFloat(mqtt_topic_battery_max_turn_current, (float)batteryReport.maxTurnCurrent / 1000.0, true);
-        _nukiPublisher->publishInt(mqtt_topic_battery_lock_distance, batteryReport.lockDistance, true); // degrees
+        _nukiPublisher->publishFloat(MQTT_TOPIC_ID(mqtt_topic_battery_voltage), (float)batteryReport.batteryVoltage / 1000.0, true);
+        _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_battery_drain), batteryReport.batteryDrain, true); // milliwatt seconds
+        _nukiPublisher->publishFloat(MQTT_TOPIC_ID(mqtt_topic_battery_max_turn_current), (float)batteryReport.maxTurnCurrent / 1000.0, true);
+        _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_battery_lock_distance), batteryReport.lockDistance, true); // degrees
     }
 
     char str[50];
@@ -868,8 +933,9 @@ void NukiNetworkLock::publishBatteryReport(const NukiLock::BatteryReport& batter
     json["maxTurnCurrent"] = (float)batteryReport.maxTurnCurrent / 1000.0;
     json["batteryResistance"] = (float)batteryReport.batteryResistance / 1000.0;
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_battery_advanced_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_battery_advanced_json), buffer.data(), true);
 }
 
 void NukiNetworkLock::publishConfig(const NukiLock::Config &config)
@@ -927,19 +993,20 @@ void NukiNetworkLock::publishConfig(const NukiLock::Config &config)
     json["matterStatus"] = (config.matterStatus == 255 ? 0 : config.matterStatus);
     json["productVariant"] = (config.productVariant == 255 ? 0 : config.productVariant);
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_config_basic_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_config_basic_json), buffer.data(), true);
 
     if(!_disableNonJSON)
     {
-        _nukiPublisher->publishBool(mqtt_topic_config_button_enabled, config.buttonEnabled == 1, true);
-        _nukiPublisher->publishBool(mqtt_topic_config_led_enabled, config.ledEnabled == 1, true);
-        _nukiPublisher->publishInt(mqtt_topic_config_led_brightness, config.ledBrightness, true);
-        _nukiPublisher->publishBool(mqtt_topic_config_single_lock, config.singleLock == 1, true);
+        _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_config_button_enabled), config.buttonEnabled == 1, true);
+        _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_config_led_enabled), config.ledEnabled == 1, true);
+        _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_config_led_brightness), config.ledBrightness, true);
+        _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_config_single_lock), config.singleLock == 1, true);
     }
 
-    _nukiPublisher->publishString(mqtt_topic_info_firmware_version, std::to_string(config.firmwareVersion[0]) + "." + std::to_string(config.firmwareVersion[1]) + "." + std::to_string(config.firmwareVersion[2]), true);
-    _nukiPublisher->publishString(mqtt_topic_info_hardware_version, std::to_string(config.hardwareRevision[0]) + "." + std::to_string(config.hardwareRevision[1]), true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_info_firmware_version), std::to_string(config.firmwareVersion[0]) + "." + std::to_string(config.firmwareVersion[1]) + "." + std::to_string(config.firmwareVersion[2]), true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_info_hardware_version), std::to_string(config.hardwareRevision[0]) + "." + std::to_string(config.hardwareRevision[1]), true);
 }
 
 void NukiNetworkLock::publishAdvancedConfig(const NukiLock::AdvancedConfig &config)
@@ -995,29 +1062,30 @@ void NukiNetworkLock::publishAdvancedConfig(const NukiLock::AdvancedConfig &conf
     json["rebootNuki"] = 0;
     json["recalibrateNuki"] = 0;
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_config_advanced_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_config_advanced_json), buffer.data(), true);
 
     if(!_disableNonJSON)
     {
-        _nukiPublisher->publishBool(mqtt_topic_config_auto_unlock, config.autoUnLockDisabled == 0, true);
-        _nukiPublisher->publishBool(mqtt_topic_config_auto_lock, config.autoLockEnabled == 1, true);
+        _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_config_auto_unlock), config.autoUnLockDisabled == 0, true);
+        _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_config_auto_lock), config.autoLockEnabled == 1, true);
     }
 }
 
 void NukiNetworkLock::publishRssi(const int& rssi)
 {
-    _nukiPublisher->publishInt(mqtt_topic_lock_rssi, rssi, true);
+    _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_lock_rssi), rssi, true);
 }
 
 void NukiNetworkLock::publishRetry(const std::string& message)
 {
-    _nukiPublisher->publishString(mqtt_topic_lock_retry, message, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_retry), message, true);
 }
 
 void NukiNetworkLock::publishBleAddress(const std::string &address)
 {
-    _nukiPublisher->publishString(mqtt_topic_lock_address, address, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_address), address, true);
 }
 
 void NukiNetworkLock::publishKeypad(const std::list<NukiLock::KeypadEntry>& entries, uint maxKeypadCodeCount)
@@ -1083,8 +1151,9 @@ void NukiNetworkLock::publishKeypad(const std::list<NukiLock::KeypadEntry>& entr
             basePath.concat(std::to_string(index).c_str());
             jsonEntry["name_ha"] = entry.name;
             jsonEntry["index"] = index;
-            serializeJson(jsonEntry, _buffer, _bufferSize);
-            _nukiPublisher->publishString(basePath.c_str(), _buffer, true);
+            ScratchBuffer buffer(measureJson(jsonEntry) + 1);
+            serializeJson(jsonEntry, buffer.data(), buffer.size());
+            _nukiPublisher->publishString(basePath, buffer.data(), true);
 
             String basePathPrefix = "~";
             basePathPrefix.concat(basePath);
@@ -1126,8 +1195,9 @@ void NukiNetworkLock::publishKeypad(const std::list<NukiLock::KeypadEntry>& entr
         ++index;
     }
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_keypad_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_json), buffer.data(), true);
 
     if(!_disableNonJSON)
     {
@@ -1207,22 +1277,22 @@ void NukiNetworkLock::publishKeypadEntry(const String topic, NukiLock::KeypadEnt
     memset(codeName, 0, sizeof(codeName));
     memcpy(codeName, entry.name, sizeof(entry.name));
 
-    _nukiPublisher->publishInt(concat(topic, "/id").c_str(), entry.codeId, true);
-    _nukiPublisher->publishBool(concat(topic, "/enabled").c_str(), entry.enabled, true);
-    _nukiPublisher->publishString(concat(topic, "/name").c_str(), codeName, true);
+    _nukiPublisher->publishInt(concat(topic, "/id"), entry.codeId, true);
+    _nukiPublisher->publishBool(concat(topic, "/enabled"), entry.enabled, true);
+    _nukiPublisher->publishString(concat(topic, "/name"), codeName, true);
 
     if(_preferences->getBool(preference_keypad_publish_code, false))
     {
-        _nukiPublisher->publishInt(concat(topic, "/code").c_str(), entry.code, true);
+        _nukiPublisher->publishInt(concat(topic, "/code"), entry.code, true);
     }
 
-    _nukiPublisher->publishInt(concat(topic, "/createdYear").c_str(), entry.dateCreatedYear, true);
-    _nukiPublisher->publishInt(concat(topic, "/createdMonth").c_str(), entry.dateCreatedMonth, true);
-    _nukiPublisher->publishInt(concat(topic, "/createdDay").c_str(), entry.dateCreatedDay, true);
-    _nukiPublisher->publishInt(concat(topic, "/createdHour").c_str(), entry.dateCreatedHour, true);
-    _nukiPublisher->publishInt(concat(topic, "/createdMin").c_str(), entry.dateCreatedMin, true);
-    _nukiPublisher->publishInt(concat(topic, "/createdSec").c_str(), entry.dateCreatedSec, true);
-    _nukiPublisher->publishInt(concat(topic, "/lockCount").c_str(), entry.lockCount, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdYear"), entry.dateCreatedYear, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdMonth"), entry.dateCreatedMonth, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdDay"), entry.dateCreatedDay, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdHour"), entry.dateCreatedHour, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdMin"), entry.dateCreatedMin, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdSec"), entry.dateCreatedSec, true);
+    _nukiPublisher->publishInt(concat(topic, "/lockCount"), entry.lockCount, true);
 }
 
 void NukiNetworkLock::publishTimeControl(const std::list<NukiLock::TimeControlEntry>& timeControlEntries, uint maxTimeControlEntryCount)
@@ -1305,8 +1375,9 @@ void NukiNetworkLock::publishTimeControl(const std::list<NukiLock::TimeControlEn
             basePath.concat("/entries/");
             basePath.concat(std::to_string(index).c_str());
             jsonEntry["index"] = index;
-            serializeJson(jsonEntry, _buffer, _bufferSize);
-            _nukiPublisher->publishString(basePath.c_str(), _buffer, true);
+            ScratchBuffer buffer(measureJson(jsonEntry) + 1);
+            serializeJson(jsonEntry, buffer.data(), buffer.size());
+            _nukiPublisher->publishString(basePath, buffer.data(), true);
 
             String basePathPrefix = "~";
             basePathPrefix.concat(basePath);
@@ -1345,8 +1416,9 @@ void NukiNetworkLock::publishTimeControl(const std::list<NukiLock::TimeControlEn
         ++index;
     }
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_timecontrol_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_timecontrol_json), buffer.data(), true);
 
     for(int j=timeControlEntries.size(); j<maxTimeControlEntryCount; j++)
     {
@@ -1456,8 +1528,9 @@ void NukiNetworkLock::publishAuth(const std::list<NukiLock::AuthorizationEntry>&
             basePath.concat("/entries/");
             basePath.concat(std::to_string(index).c_str());
             jsonEntry["index"] = index;
-            serializeJson(jsonEntry, _buffer, _bufferSize);
-            _nukiPublisher->publishString(basePath.c_str(), _buffer, true);
+            ScratchBuffer buffer(measureJson(jsonEntry) + 1);
+            serializeJson(jsonEntry, buffer.data(), buffer.size());
+            _nukiPublisher->publishString(basePath, buffer.data(), true);
 
             String basePathPrefix = "~";
             basePathPrefix.concat(basePath);
@@ -1496,8 +1569,9 @@ void NukiNetworkLock::publishAuth(const std::list<NukiLock::AuthorizationEntry>&
         ++index;
     }
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_auth_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_auth_json), buffer.data(), true);
 
     for(int j=authEntries.size(); j<maxAuthEntryCount; j++)
     {
@@ -1512,7 +1586,7 @@ void NukiNetworkLock::publishAuth(const std::list<NukiLock::AuthorizationEntry>&
 
 void NukiNetworkLock::publishConfigCommandResult(const char* result)
 {
-    _nukiPublisher->publishString(mqtt_topic_config_action_command_result, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_config_action_command_result), result, true);
 }
 
 void NukiNetworkLock::publishKeypadCommandResult(const char* result)
@@ -1521,27 +1595,27 @@ void NukiNetworkLock::publishKeypadCommandResult(const char* result)
     {
         return;
     }
-    _nukiPublisher->publishString(mqtt_topic_keypad_command_result, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_command_result), result, true);
 }
 
 void NukiNetworkLock::publishKeypadJsonCommandResult(const char* result)
 {
-    _nukiPublisher->publishString(mqtt_topic_keypad_json_command_result, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_json_command_result), result, true);
 }
 
 void NukiNetworkLock::publishTimeControlCommandResult(const char* result)
 {
-    _nukiPublisher->publishString(mqtt_topic_timecontrol_command_result, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_timecontrol_command_result), result, true);
 }
 
 void NukiNetworkLock::publishAuthCommandResult(const char* result)
 {
-    _nukiPublisher->publishString(mqtt_topic_auth_command_result, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_auth_command_result), result, true);
 }
 
 void NukiNetworkLock::publishStatusUpdated(const bool statusUpdated)
 {
-    _nukiPublisher->publishBool(mqtt_topic_lock_status_updated, statusUpdated, true);
+    _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_lock_status_updated), statusUpdated, true);
 }
 
 DoorSensorOverride NukiNetworkLock::getRequestDoorSensorOverride()
@@ -1590,39 +1664,6 @@ void NukiNetworkLock::setAuthCommandReceivedCallback(void (*authCommandReceivedR
     _authCommandReceivedReceivedCallback = authCommandReceivedReceivedCallback;
 }
 
-void NukiNetworkLock::buildMqttPath(const char* path, char* outPath)
-{
-    int offset = 0;
-    char inPath[181] = {0};
-
-    memcpy(inPath, _mqttPath, sizeof(_mqttPath));
-
-    for(const char& c : inPath)
-    {
-        if(c == 0x00)
-        {
-            break;
-        }
-        outPath[offset] = c;
-        ++offset;
-    }
-    int i=0;
-    while(outPath[i] != 0x00)
-    {
-        outPath[offset] = path[i];
-        ++i;
-        ++offset;
-    }
-    outPath[i+1] = 0x00;
-}
-
-const bool NukiNetworkLock::comparePrefixedPath(const char *fullPath, const char *subPath)
-{
-    char prefixedPath[500];
-    buildMqttPath(subPath, prefixedPath);
-    return strcmp(fullPath, prefixedPath) == 0;
-}
-
 void NukiNetworkLock::publishOffAction(const int value)
 {
     _network->publishInt(_nukiOfficial->getMqttPath(), mqtt_topic_official_lock_action, value, false);
@@ -1630,7 +1671,7 @@ void NukiNetworkLock::publishOffAction(const int value)
 
 void NukiNetworkLock::publishOverrideDoorSensorOverrideResult(const char* result)
 {
-    _nukiPublisher->publishString(mqtt_topic_doorsensorOverride, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_doorsensorOverride), result, true);
 }
 
 String NukiNetworkLock::concat(String a, String b)
@@ -1657,6 +1698,11 @@ void NukiNetworkLock::setupHASS(int type, uint32_t nukiId, char* nukiName, const
     _network->setupHASS(type, nukiId, nukiName, firmwareVersion, hardwareVersion, hasDoorSensor, hasKeypad);
 }
 
+const uint32_t NukiNetworkLock::hassGeneration() const
+{
+    return _network->hassGeneration();
+}
+
 
 const uint32_t NukiNetworkLock::getAuthId() const
 {
@@ -7,6 +7,7 @@
 #include <Preferences.h>
 #include <vector>
 #include <list>
+#include <ArduinoJson.h>
 #include "NukiConstants.h"
 #include "NukiLockConstants.h"
 #include "NukiNetwork.h"
@@ -16,21 +17,23 @@
 #include "NukiPublisher.h"
 #include "EspMillis.h"
 #include "DoorSensorOverride.h"
+#include "ConfigSnapshot.h"
 
-class NukiNetworkLock : public MqttReceiver
+class NukiNetworkLock
 {
 public:
-    explicit NukiNetworkLock(NukiNetwork* network, NukiOfficial* nukiOfficial, Preferences* preferences, char* buffer, size_t bufferSize);
+    explicit NukiNetworkLock(NukiNetwork* network, NukiOfficial* nukiOfficial, Preferences* preferences, ConfigSnapshot* config);
     virtual ~NukiNetworkLock();
 
     void initialize();
     bool update();
 
-    void publishKeyTurnerState(const NukiLock::KeyTurnerState& keyTurnerState, const NukiLock::KeyTurnerState& lastKeyTurnerState);
-    void publishState(NukiLock::LockState lockState);
+    void publishKeyTurnerState(const NukiLock::KeyTurnerState& keyTurnerState);
+    void publishState(NukiLock::LockState lockState, const bool changed = true);
     void publishAuthorizationInfo(const std::list<NukiLock::LogEntry>& logEntries, bool latest);
     void clearAuthorizationInfo();
     void publishCommandResult(const char* resultStr);
+    void publishCommandLatency(const int64_t& lastUs, const int64_t& p50Us, const int64_t& p99Us);
     void publishLockstateCommandResult(const char* resultStr);
     void publishBatteryReport(const NukiLock::BatteryReport& batteryReport);
     void publishConfig(const NukiLock::Config& config);
@@ -59,8 +62,8 @@ public:
     void setKeypadJsonCommandReceivedCallback(void (*keypadJsonCommandReceivedReceivedCallback)(const char* value));
     void setTimeControlCommandReceivedCallback(void (*timeControlCommandReceivedReceivedCallback)(const char* value));
     void setAuthCommandReceivedCallback(void (*authCommandReceivedReceivedCallback)(const char* value));
-    void onMqttDataReceived(const char* topic, byte* payload, const unsigned int length) override;
     void setupHASS(int type, uint32_t nukiId, char* nukiName, const char* firmwareVersion, const char* hardwareVersion, bool hasDoorSensor, bool hasKeypad);
+    const uint32_t hassGeneration() const;
 
     const uint32_t getAuthId() const;
     const char* getAuthName();
@@ -68,25 +71,54 @@ public:
     const uint8_t queryCommands();
 
 private:
-    const bool comparePrefixedPath(const char* fullPath, const char* subPath);
+    struct PublishedKeyTurnerState
+    {
+        NukiLock::KeyTurnerState state;
+        bool offConnected;
+        uint8_t offState;
+        uint8_t offTrigger;
+        uint8_t offLockAction;
+        uint8_t offDoorsensorState;
+        uint32_t authId;
+        char authName[33];
+    };
 
     void publishKeypadEntry(const String topic, NukiLock::KeypadEntry entry);
+    void publishIfChanged(const bool changed, const MqttTopicId& topicId, const char* value);
+    void buildKeyTurnerStateJson(JsonDocument& json, const NukiLock::KeyTurnerState& keyTurnerState);
+
+    void subscribe(const char* topic, void (NukiNetworkLock::*handler)(char* data));
+    void subscribeQuery(const char* topic, const uint8_t queryCommand);
+    void onLockActionReceived(char* data);
+    void onLogRollingLastReceived(char* data);
+    void onDoorSensorOverrideReceived(char* data);
+    void onKeypadCommandActionReceived(char* data);
+    void onKeypadCommandIdReceived(char* data);
+    void onKeypadCommandNameReceived(char* data);
+    void onKeypadCommandCodeReceived(char* data);
+    void onKeypadCommandEnabledReceived(char* data);
+    void onConfigActionReceived(char* data);
+    void onKeypadJsonActionReceived(char* data);
+    void onTimeControlActionReceived(char* data);
+    void onAuthActionReceived(char* data);
 
     void (*_officialUpdateReceivedCallback)(const char* path, const char* value) = nullptr;
 
     String concat(String a, String b);
 
-    void buildMqttPath(const char* path, char* outPath);
 
     NukiNetwork* _network = nullptr;
     NukiPublisher* _nukiPublisher = nullptr;
     NukiOfficial* _nukiOfficial = nullptr;
     Preferences* _preferences = nullptr;
+    ConfigSnapshot* _config = nullptr;
 
     std::map<uint32_t, String> _authEntries;
     char _mqttPath[181] = {0};
 
     bool _firstTunerStatePublish = true;
+    PublishedKeyTurnerState _publishedKeyTurnerState;
+    int8_t _publishedAvailability = -1;
     bool _haEnabled = false;
     bool _saveLogEnabled = false;
     bool _disableNonJSON = false;
@@ -108,8 +140,6 @@ private:
     char _nukiName[33];
     char _authName[33];
 
-    char* _buffer;
-    size_t _bufferSize;
 
     LockActionResult (*_lockActionReceivedCallback)(const char* value) = nullptr;
     void (*_configUpdateReceivedCallback)(const char* value) = nullptr;
@@ -1,6 +1,7 @@
 #include "NukiNetworkOpener.h"
 #include "Arduino.h"
 #include "MqttTopics.h"
+#include "util/ScratchArena.h"
 #include "PreferencesKeys.h"
 #include "Logger.h"
 #include "Config.h"
@@ -8,19 +9,18 @@
 #include "hal/wdt_hal.h"
 #include "util/NukiHelper.h"
 #include "util/NukiOpenerHelper.h"
+#include "util/TaskScheduler.h"
 
-NukiNetworkOpener::NukiNetworkOpener(NukiNetwork* network, Preferences* preferences, char* buffer, size_t bufferSize)
+NukiNetworkOpener::NukiNetworkOpener(NukiNetwork* network, Preferences* preferences, ConfigSnapshot* config)
     : _preferences(preferences),
-      _network(network),
-      _buffer(buffer),
-      _bufferSize(bufferSize)
+      _config(config),
+      _network(network)
 {
     _nukiPublisher = new NukiPublisher(network, _mqttPath);
 
     memset(_authName, 0, sizeof(_authName));
     _authName[0] = '\0';
 
-    _network->registerMqttReceiver(this);
 }
 
 void NukiNetworkOpener::initialize()
@@ -39,13 +39,15 @@ void NukiNetworkOpener::initialize()
         _mqttPath[i] = mqttPath.charAt(i);
     }
 
-    _haEnabled = _preferences->getString(preference_mqtt_hass_discovery, "") != "";
+    _nukiPublisher->initialize();
+
+    _haEnabled = _config->get()->mqttHassDiscovery != "";
     _disableNonJSON = _preferences->getBool(preference_disable_non_json, false);
 
     _network->initTopic(_mqttPath, mqtt_topic_lock_action, "--");
-    _network->subscribe(_mqttPath, mqtt_topic_lock_action);
+    subscribe(mqtt_topic_lock_action, &NukiNetworkOpener::onLockActionReceived);
     _network->initTopic(_mqttPath, mqtt_topic_config_action, "--");
-    _network->subscribe(_mqttPath, mqtt_topic_config_action);
+    subscribe(mqtt_topic_config_action, &NukiNetworkOpener::onConfigActionReceived);
 
     _network->initTopic(_mqttPath, mqtt_topic_query_keypad, "0");
     _network->initTopic(_mqttPath, mqtt_topic_query_config, "0");
@@ -53,9 +55,9 @@ void NukiNetworkOpener::initialize()
     _network->initTopic(_mqttPath, mqtt_topic_query_battery, "0");
     _network->initTopic(_mqttPath, mqtt_topic_lock_binary_ring, "standby");
     _network->initTopic(_mqttPath, mqtt_topic_lock_ring, "standby");
-    _network->subscribe(_mqttPath, mqtt_topic_query_config);
-    _network->subscribe(_mqttPath, mqtt_topic_query_lockstate);
-    _network->subscribe(_mqttPath, mqtt_topic_query_battery);
+    subscribeQuery(mqtt_topic_query_config, QUERY_COMMAND_CONFIG);
+    subscribeQuery(mqtt_topic_query_lockstate, QUERY_COMMAND_LOCKSTATE);
+    subscribeQuery(mqtt_topic_query_battery, QUERY_COMMAND_BATTERY);
 
     _network->initTopic(_mqttPath, mqtt_topic_keypad_json_action, "--");
     _network->initTopic(_mqttPath, mqtt_topic_timecontrol_action, "--");
@@ -110,30 +112,30 @@ void NukiNetworkOpener::initialize()
             _network->initTopic(_mqttPath, mqtt_topic_keypad_command_name, "--");
             _network->initTopic(_mqttPath, mqtt_topic_keypad_command_code, "000000");
             _network->initTopic(_mqttPath, mqtt_topic_keypad_command_enabled, "1");
-            _network->subscribe(_mqttPath, mqtt_topic_keypad_command_action);
-            _network->subscribe(_mqttPath, mqtt_topic_keypad_command_id);
-            _network->subscribe(_mqttPath, mqtt_topic_keypad_command_name);
-            _network->subscribe(_mqttPath, mqtt_topic_keypad_command_code);
-            _network->subscribe(_mqttPath, mqtt_topic_keypad_command_enabled);
+            subscribe(mqtt_topic_keypad_command_action, &NukiNetworkOpener::onKeypadCommandActionReceived);
+            subscribe(mqtt_topic_keypad_command_id, &NukiNetworkOpener::onKeypadCommandIdReceived);
+            subscribe(mqtt_topic_keypad_command_name, &NukiNetworkOpener::onKeypadCommandNameReceived);
+            subscribe(mqtt_topic_keypad_command_code, &NukiNetworkOpener::onKeypadCommandCodeReceived);
+            subscribe(mqtt_topic_keypad_command_enabled, &NukiNetworkOpener::onKeypadCommandEnabledReceived);
         }
 
-        _network->subscribe(_mqttPath, mqtt_topic_query_keypad);
-        _network->subscribe(_mqttPath, mqtt_topic_keypad_json_action);
+        subscribeQuery(mqtt_topic_query_keypad, QUERY_COMMAND_KEYPAD);
+        subscribe(mqtt_topic_keypad_json_action, &NukiNetworkOpener::onKeypadJsonActionReceived);
     }
 
     if(_preferences->getBool(preference_timecontrol_control_enabled, false))
     {
-        _network->subscribe(_mqttPath, mqtt_topic_timecontrol_action);
+        subscribe(mqtt_topic_timecontrol_action, &NukiNetworkOpener::onTimeControlActionReceived);
     }
 
     if(_preferences->getBool(preference_auth_control_enabled))
     {
-        _network->subscribe(_mqttPath, mqtt_topic_auth_action);
+        subscribe(mqtt_topic_auth_action, &NukiNetworkOpener::onAuthActionReceived);
     }
 
     if(_preferences->getBool(preference_publish_authdata, false))
     {
-        _network->subscribe(_mqttPath, mqtt_topic_lock_log_rolling_last);
+        subscribe(mqtt_topic_lock_log_rolling_last, &NukiNetworkOpener::onLogRollingLastReceived);
     }
 }
 
@@ -147,198 +149,201 @@ void NukiNetworkOpener::update()
     if(_resetRingStateTs != 0 && espMillis() >= _resetRingStateTs)
     {
         _resetRingStateTs = 0;
-        _nukiPublisher->publishString(mqtt_topic_lock_binary_ring, "standby", true);
-        _nukiPublisher->publishString(mqtt_topic_lock_ring, "standby", true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_binary_ring), "standby", true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_ring), "standby", true);
     }
 }
 
-void NukiNetworkOpener::onMqttDataReceived(const char* topic, byte* payload, const unsigned int length)
+void NukiNetworkOpener::subscribe(const char* topic, void (NukiNetworkOpener::*handler)(char* data))
+{
+    _network->subscribe(_mqttPath, topic, [this, handler](const char* topic, char* data)
+    {
+        (this->*handler)(data);
+    }, this);
+}
+
+void NukiNetworkOpener::subscribeQuery(const char* topic, const uint8_t queryCommand)
 {
-    char* data = (char*)payload;
+    MqttTopicId topicId = _nukiPublisher->topicId(topic);
 
-    if(_network->mqttRecentlyConnected() && _network->pathEquals(_mqttPath, mqtt_topic_lock_action, topic))
+    _network->subscribe(_mqttPath, topic, [this, queryCommand, topicId](const char* topic, char* data)
+    {
+        if(strcmp(data, "1") == 0)
+        {
+            _queryCommands = _queryCommands | queryCommand;
+            TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_QUERY);
+            _nukiPublisher->publishInt(topicId, 0, true);
+        }
+    }, this);
+}
+
+void NukiNetworkOpener::onLockActionReceived(char* data)
+{
+    if(_network->mqttRecentlyConnected())
     {
         Log->println("MQTT recently connected, ignoring opener action.");
         return;
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_lock_log_rolling_last) && !_saveLogEnabled)
+    if(strcmp(data, "") == 0 ||
+            strcmp(data, "--") == 0 ||
+            strcmp(data, "ack") == 0 ||
+            strcmp(data, "unknown_action") == 0 ||
+            strcmp(data, "denied") == 0 ||
+            strcmp(data, "error") == 0)
     {
-        if(strcmp(data, "") == 0 ||
-                strcmp(data, "--") == 0)
-        {
-            return;
-        }
+        return;
+    }
 
-        if(atoi(data) > 0 && atoi(data) > _lastRollingLog)
-        {
-            _lastRollingLog = atoi(data);
-        }
+    Log->print("Opener action received: ");
+    Log->println(data);
+    LockActionResult lockActionResult = LockActionResult::Failed;
+    if(_lockActionReceivedCallback != NULL)
+    {
+        lockActionResult = _lockActionReceivedCallback(data);
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_lock_action))
+    switch(lockActionResult)
     {
-        if(strcmp(data, "") == 0 ||
-                strcmp(data, "--") == 0 ||
-                strcmp(data, "ack") == 0 ||
-                strcmp(data, "unknown_action") == 0 ||
-                strcmp(data, "denied") == 0 ||
-                strcmp(data, "error") == 0)
-        {
-            return;
-        }
+    case LockActionResult::Success:
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action), "ack", false);
+        break;
+    case LockActionResult::UnknownAction:
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action), "unknown_action", false);
+        break;
+    case LockActionResult::AccessDenied:
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action), "denied", false);
+        break;
+    case LockActionResult::Failed:
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action), "error", false);
+        break;
+    }
+}
 
-        Log->print("Opener action received: ");
-        Log->println(data);
-        LockActionResult lockActionResult = LockActionResult::Failed;
-        if(_lockActionReceivedCallback != NULL)
-        {
-            lockActionResult = _lockActionReceivedCallback(data);
-        }
+void NukiNetworkOpener::onLogRollingLastReceived(char* data)
+{
+    if(_saveLogEnabled || strcmp(data, "") == 0 || strcmp(data, "--") == 0)
+    {
+        return;
+    }
 
-        switch(lockActionResult)
-        {
-        case LockActionResult::Success:
-            _nukiPublisher->publishString(mqtt_topic_lock_action, "ack", false);
-            break;
-        case LockActionResult::UnknownAction:
-            _nukiPublisher->publishString(mqtt_topic_lock_action, "unknown_action", false);
-            break;
-        case LockActionResult::AccessDenied:
-            _nukiPublisher->publishString(mqtt_topic_lock_action, "denied", false);
-            break;
-        case LockActionResult::Failed:
-            _nukiPublisher->publishString(mqtt_topic_lock_action, "error", false);
-            break;
-        }
+    if(atoi(data) > 0 && atoi(data) > _lastRollingLog)
+    {
+        _lastRollingLog = atoi(data);
     }
+}
 
-    if(!_disableNonJSON)
+void NukiNetworkOpener::onKeypadCommandActionReceived(char* data)
+{
+    if(_disableNonJSON || _keypadCommandReceivedReceivedCallback == nullptr || strcmp(data, "--") == 0)
     {
-        if(comparePrefixedPath(topic, mqtt_topic_keypad_command_action))
-        {
-            if(_keypadCommandReceivedReceivedCallback != nullptr)
-            {
-                if(strcmp(data, "--") == 0)
-                {
-                    return;
-                }
+        return;
+    }
 
-                _keypadCommandReceivedReceivedCallback(data, _keypadCommandId, _keypadCommandName, _keypadCommandCode, _keypadCommandEnabled);
+    _keypadCommandReceivedReceivedCallback(data, _keypadCommandId, _keypadCommandName, _keypadCommandCode, _keypadCommandEnabled);
 
-                _keypadCommandId = 0;
-                _keypadCommandName = "--";
-                _keypadCommandCode = "000000";
-                _keypadCommandEnabled = 1;
+    _keypadCommandId = 0;
+    _keypadCommandName = "--";
+    _keypadCommandCode = "000000";
+    _keypadCommandEnabled = 1;
 
-                if(strcmp(data, "--") != 0)
-                {
-                    _nukiPublisher->publishString(mqtt_topic_keypad_command_action, "--", true);
-                }
-                _nukiPublisher->publishInt(mqtt_topic_keypad_command_id, _keypadCommandId, true);
-                _nukiPublisher->publishString(mqtt_topic_keypad_command_name, _keypadCommandName, true);
-                _nukiPublisher->publishString(mqtt_topic_keypad_command_code, _keypadCommandCode, true);
-                _nukiPublisher->publishInt(mqtt_topic_keypad_command_enabled, _keypadCommandEnabled, true);
-            }
-        }
-        else if(comparePrefixedPath(topic, mqtt_topic_keypad_command_id))
-        {
-            _keypadCommandId = atoi(data);
-        }
-        else if(comparePrefixedPath(topic, mqtt_topic_keypad_command_name))
-        {
-            _keypadCommandName = data;
-        }
-        else if(comparePrefixedPath(topic, mqtt_topic_keypad_command_code))
-        {
-            _keypadCommandCode = data;
-        }
-        else if(comparePrefixedPath(topic, mqtt_topic_keypad_command_enabled))
-        {
-            _keypadCommandEnabled = atoi(data);
-        }
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_command_action), "--", true);
+    _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_keypad_command_id), _keypadCommandId, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_command_name), _keypadCommandName, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_command_code), _keypadCommandCode, true);
+    _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_keypad_command_enabled), _keypadCommandEnabled, true);
+}
+
+void NukiNetworkOpener::onKeypadCommandIdReceived(char* data)
+{
+    if(!_disableNonJSON)
+    {
+        _keypadCommandId = atoi(data);
     }
+}
 
-    if(comparePrefixedPath(topic, mqtt_topic_query_config) && strcmp(data, "1") == 0)
+void NukiNetworkOpener::onKeypadCommandNameReceived(char* data)
+{
+    if(!_disableNonJSON)
     {
-        _queryCommands = _queryCommands | QUERY_COMMAND_CONFIG;
-        _nukiPublisher->publishInt(mqtt_topic_query_config, 0, true);
+        _keypadCommandName = data;
     }
-    else if(comparePrefixedPath(topic, mqtt_topic_query_lockstate) && strcmp(data, "1") == 0)
+}
+
+void NukiNetworkOpener::onKeypadCommandCodeReceived(char* data)
+{
+    if(!_disableNonJSON)
     {
-        _queryCommands = _queryCommands | QUERY_COMMAND_LOCKSTATE;
-        _nukiPublisher->publishInt(mqtt_topic_query_lockstate, 0, true);
+        _keypadCommandCode = data;
     }
-    else if(comparePrefixedPath(topic, mqtt_topic_query_keypad) && strcmp(data, "1") == 0)
+}
+
+void NukiNetworkOpener::onKeypadCommandEnabledReceived(char* data)
+{
+    if(!_disableNonJSON)
     {
-        _queryCommands = _queryCommands | QUERY_COMMAND_KEYPAD;
-        _nukiPublisher->publishInt(mqtt_topic_query_keypad, 0, true);
+        _keypadCommandEnabled = atoi(data);
     }
-    else if(comparePrefixedPath(topic, mqtt_topic_query_battery) && strcmp(data, "1") == 0)
+}
+
+void NukiNetworkOpener::onConfigActionReceived(char* data)
+{
+    if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
     {
-        _queryCommands = _queryCommands | QUERY_COMMAND_BATTERY;
-        _nukiPublisher->publishInt(mqtt_topic_query_battery, 0, true);
+        return;
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_config_action))
+    if(_configUpdateReceivedCallback != NULL)
     {
-        if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
-        {
-            return;
-        }
+        _configUpdateReceivedCallback(data);
+    }
 
-        if(_configUpdateReceivedCallback != NULL)
-        {
-            _configUpdateReceivedCallback(data);
-        }
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_config_action), "--", true);
+}
 
-        _nukiPublisher->publishString(mqtt_topic_config_action, "--", true);
+void NukiNetworkOpener::onKeypadJsonActionReceived(char* data)
+{
+    if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
+    {
+        return;
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_keypad_json_action))
+    if(_keypadJsonCommandReceivedReceivedCallback != NULL)
     {
-        if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
-        {
-            return;
-        }
+        _keypadJsonCommandReceivedReceivedCallback(data);
+    }
 
-        if(_keypadJsonCommandReceivedReceivedCallback != NULL)
-        {
-            _keypadJsonCommandReceivedReceivedCallback(data);
-        }
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_json_action), "--", true);
+}
 
-        _nukiPublisher->publishString(mqtt_topic_keypad_json_action, "--", true);
+void NukiNetworkOpener::onTimeControlActionReceived(char* data)
+{
+    if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
+    {
+        return;
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_timecontrol_action))
+    if(_timeControlCommandReceivedReceivedCallback != NULL)
     {
-        if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
-        {
-            return;
-        }
+        _timeControlCommandReceivedReceivedCallback(data);
+    }
 
-        if(_timeControlCommandReceivedReceivedCallback != NULL)
-        {
-            _timeControlCommandReceivedReceivedCallback(data);
-        }
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_timecontrol_action), "--", true);
+}
 
-        _nukiPublisher->publishString(mqtt_topic_timecontrol_action, "--", true);
+void NukiNetworkOpener::onAuthActionReceived(char* data)
+{
+    if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
+    {
+        return;
     }
 
-    if(comparePrefixedPath(topic, mqtt_topic_auth_action))
+    if(_authCommandReceivedReceivedCallback != NULL)
     {
-        if(strcmp(data, "") == 0 || strcmp(data, "--") == 0)
-        {
-            return;
-        }
-
-        if(_authCommandReceivedReceivedCallback != NULL)
-        {
-            _authCommandReceivedReceivedCallback(data);
-        }
-
-        _nukiPublisher->publishString(mqtt_topic_auth_action, "--", true);
+        _authCommandReceivedReceivedCallback(data);
     }
+
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_auth_action), "--", true);
 }
 
 void NukiNetworkOpener::publishKeyTurnerState(const NukiOpener::OpenerState& keyTurnerState, const NukiOpener::OpenerState& lastKeyTurnerState)
@@ -353,7 +358,7 @@ void NukiNetworkOpener::publishKeyTurnerState(const NukiOpener::OpenerState& key
 
     if((_firstTunerStatePublish || keyTurnerState.lockState != lastKeyTurnerState.lockState || keyTurnerState.nukiState != lastKeyTurnerState.nukiState) && keyTurnerState.lockState != NukiOpener::LockState::Undefined)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_state, str, true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_state), str, true);
 
         if(_haEnabled)
         {
@@ -363,23 +368,23 @@ void NukiNetworkOpener::publishKeyTurnerState(const NukiOpener::OpenerState& key
 
     if(strcmp(str, "undefined") == 0)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_availability, "offline", true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_availability), "offline", true);
     }
     else
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_availability, "online", true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_availability), "online", true);
     }
 
     json["lock_state"] = str;
 
     if(keyTurnerState.nukiState == NukiOpener::State::ContinuousMode)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_continuous_mode, "on", true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_continuous_mode), "on", true);
         json["continuous_mode"] = 1;
     }
     else
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_continuous_mode, "off", true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_continuous_mode), "off", true);
         json["continuous_mode"] = 0;
     }
 
@@ -388,7 +393,7 @@ void NukiNetworkOpener::publishKeyTurnerState(const NukiOpener::OpenerState& key
 
     if(_firstTunerStatePublish || keyTurnerState.trigger != lastKeyTurnerState.trigger)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_trigger, str, true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_trigger), str, true);
     }
 
     json["trigger"] = str;
@@ -403,7 +408,7 @@ void NukiNetworkOpener::publishKeyTurnerState(const NukiOpener::OpenerState& key
 
     if(_firstTunerStatePublish || keyTurnerState.lastLockAction != lastKeyTurnerState.lastLockAction)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_last_lock_action, str, true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_last_lock_action), str, true);
     }
 
     json["last_lock_action"] = str;
@@ -417,7 +422,7 @@ void NukiNetworkOpener::publishKeyTurnerState(const NukiOpener::OpenerState& key
 
     if(_firstTunerStatePublish || keyTurnerState.lastLockActionCompletionStatus != lastKeyTurnerState.lastLockActionCompletionStatus)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_completionStatus, str, true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_completionStatus), str, true);
     }
 
     json["lock_completion_status"] = str;
@@ -427,7 +432,7 @@ void NukiNetworkOpener::publishKeyTurnerState(const NukiOpener::OpenerState& key
 
     if((_firstTunerStatePublish || keyTurnerState.criticalBatteryState != lastKeyTurnerState.criticalBatteryState) && !_disableNonJSON)
     {
-        _nukiPublisher->publishBool(mqtt_topic_battery_critical, critical, true);
+        _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_battery_critical), critical, true);
     }
 
     bool keypadCritical = keyTurnerState.accessoryBatteryState != 255 ? ((keyTurnerState.accessoryBatteryState & 1) == 1 ? (keyTurnerState.accessoryBatteryState & 3) == 3 : false) : false;
@@ -435,17 +440,19 @@ void NukiNetworkOpener::publishKeyTurnerState(const NukiOpener::OpenerState& key
 
     if((_firstTunerStatePublish || keyTurnerState.accessoryBatteryState != lastKeyTurnerState.accessoryBatteryState) && !_disableNonJSON)
     {
-        _nukiPublisher->publishBool(mqtt_topic_battery_keypad_critical, keypadCritical, true);
+        _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_battery_keypad_critical), keypadCritical, true);
     }
 
     json["auth_id"] = _authId;
     json["auth_name"] = _authName;
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_lock_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_json), buffer.data(), true);
 
-    serializeJson(jsonBattery, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_battery_basic_json, _buffer, true);
+    ScratchBuffer batteryBuffer(measureJson(jsonBattery) + 1);
+    serializeJson(jsonBattery, batteryBuffer.data(), batteryBuffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_battery_basic_json), batteryBuffer.data(), true);
 
     _firstTunerStatePublish = false;
 }
@@ -454,14 +461,14 @@ void NukiNetworkOpener::publishRing(const bool locked)
 {
     if(locked)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_ring, "ringlocked", true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_ring), "ringlocked", true);
     }
     else
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_ring, "ring", true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_ring), "ring", true);
     }
 
-    _nukiPublisher->publishString(mqtt_topic_lock_binary_ring, "ring", true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_binary_ring), "ring", true);
     _resetRingStateTs = espMillis() + 2000;
 }
 
@@ -469,32 +476,32 @@ void NukiNetworkOpener::publishState(NukiOpener::OpenerState lockState)
 {
     if(lockState.nukiState == NukiOpener::State::ContinuousMode)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "unlocked", true);
-        _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "unlocked", true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "unlocked", true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "unlocked", true);
     }
     else
     {
         switch (lockState.lockState)
         {
         case NukiOpener::LockState::Locked:
-            _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "locked", true);
-            _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "locked", true);
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "locked", true);
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "locked", true);
             break;
         case NukiOpener::LockState::RTOactive:
-            _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "unlocked", true);
-            _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "unlocked", true);
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "unlocked", true);
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "unlocked", true);
             break;
         case NukiOpener::LockState::Open:
-            _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "open", true);
-            _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "unlocked", true);
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "open", true);
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "unlocked", true);
             break;
         case NukiOpener::LockState::Opening:
-            _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "opening", true);
-            _nukiPublisher->publishString(mqtt_topic_lock_binary_state, "unlocked", true);
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "opening", true);
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_binary_state), "unlocked", true);
             break;
         case NukiOpener::LockState::Undefined:
         case NukiOpener::LockState::Uncalibrated:
-            _nukiPublisher->publishString(mqtt_topic_lock_ha_state, "jammed", true);
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_ha_state), "jammed", true);
             break;
         default:
             break;
@@ -678,9 +685,10 @@ void NukiNetworkOpener::publishAuthorizationInfo(const std::list<NukiOpener::Log
 
         if(log.index > _lastRollingLog)
         {
-            serializeJson(entry, _buffer, _bufferSize);
-            _nukiPublisher->publishString(mqtt_topic_lock_log_rolling, _buffer, true);
-            _nukiPublisher->publishInt(mqtt_topic_lock_log_rolling_last, log.index, true);
+            ScratchBuffer buffer(measureJson(entry) + 1);
+            serializeJson(entry, buffer.data(), buffer.size());
+            _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_log_rolling), buffer.data(), true);
+            _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_lock_log_rolling_last), log.index, true);
 
             if(log.loggingType == NukiOpener::LoggingType::DoorbellRecognition && _lastRollingLog > 0)
             {
@@ -703,46 +711,54 @@ void NukiNetworkOpener::publishAuthorizationInfo(const std::list<NukiOpener::Log
         }
     }
 
-    serializeJson(json, _buffer, _bufferSize);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
 
     if(latest)
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_log_latest, _buffer, true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_log_latest), buffer.data(), true);
     }
     else
     {
-        _nukiPublisher->publishString(mqtt_topic_lock_log, _buffer, true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_log), buffer.data(), true);
     }
 
     if(authIndex > 0)
     {
-        _nukiPublisher->publishUInt(mqtt_topic_lock_auth_id, _authId, true);
-        _nukiPublisher->publishString(mqtt_topic_lock_auth_name, _authName, true);
+        _nukiPublisher->publishUInt(MQTT_TOPIC_ID(mqtt_topic_lock_auth_id), _authId, true);
+        _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_auth_name), _authName, true);
     }
 }
 
 void NukiNetworkOpener::clearAuthorizationInfo()
 {
-    _nukiPublisher->publishString(mqtt_topic_lock_log, "--", true);
-    _nukiPublisher->publishUInt(mqtt_topic_lock_auth_id, 0, true);
-    _nukiPublisher->publishString(mqtt_topic_lock_auth_name, "--", true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_log), "--", true);
+    _nukiPublisher->publishUInt(MQTT_TOPIC_ID(mqtt_topic_lock_auth_id), 0, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_auth_name), "--", true);
 }
 
 void NukiNetworkOpener::publishCommandResult(const char *resultStr)
 {
-    _nukiPublisher->publishString(mqtt_topic_lock_action_command_result, resultStr, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action_command_result), resultStr, true);
+}
+
+void NukiNetworkOpener::publishCommandLatency(const int64_t& lastUs, const int64_t& p50Us, const int64_t& p99Us)
+{
+    char str[80];
+    snprintf(str, sizeof(str), "{\"last\":%lld,\"p50\":%lld,\"p99\":%lld}", lastUs / 1000, p50Us / 1000, p99Us / 1000);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action_latency), str, false);
 }
 
 void NukiNetworkOpener::publishLockstateCommandResult(const char *resultStr)
 {
-    _nukiPublisher->publishString(mqtt_topic_query_lockstate_command_result, resultStr, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_query_lockstate_command_result), resultStr, true);
 }
 
 void NukiNetworkOpener::publishBatteryReport(const NukiOpener::BatteryReport& batteryReport)
 {
     if(!_disableNonJSON)
     {
-        _nukiPublisher->publishFloat(mqtt_topic_battery_voltage, (float)batteryReport.batteryVoltage / 1000.0, true);
+        _nukiPublisher->publishFloat(MQTT_TOPIC_ID(mqtt_topic_battery_voltage), (float)batteryReport.batteryVoltage / 1000.0, true);
     }
 
     char str[50];
@@ -757,8 +773,9 @@ void NukiNetworkOpener::publishBatteryReport(const NukiOpener::BatteryReport& ba
     json["startVoltage"] = (float)batteryReport.startVoltage / 1000.0;
     json["lowestVoltage"] = (float)batteryReport.lowestVoltage / 1000.0;
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_battery_advanced_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_battery_advanced_json), buffer.data(), true);
 }
 
 void NukiNetworkOpener::publishConfig(const NukiOpener::Config &config)
@@ -811,17 +828,18 @@ void NukiNetworkOpener::publishConfig(const NukiOpener::Config &config)
     _network->timeZoneIdToString(config.timeZoneId, str);
     json["timeZone"] = str;
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_config_basic_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_config_basic_json), buffer.data(), true);
 
     if(!_disableNonJSON)
     {
-        _nukiPublisher->publishBool(mqtt_topic_config_button_enabled, config.buttonEnabled == 1, true);
-        _nukiPublisher->publishBool(mqtt_topic_config_led_enabled, config.ledFlashEnabled == 1, true);
+        _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_config_button_enabled), config.buttonEnabled == 1, true);
+        _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_config_led_enabled), config.ledFlashEnabled == 1, true);
     }
 
-    _nukiPublisher->publishString(mqtt_topic_info_firmware_version, std::to_string(config.firmwareVersion[0]) + "." + std::to_string(config.firmwareVersion[1]) + "." + std::to_string(config.firmwareVersion[2]), true);
-    _nukiPublisher->publishString(mqtt_topic_info_hardware_version, std::to_string(config.hardwareRevision[0]) + "." + std::to_string(config.hardwareRevision[1]), true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_info_firmware_version), std::to_string(config.firmwareVersion[0]) + "." + std::to_string(config.firmwareVersion[1]) + "." + std::to_string(config.firmwareVersion[2]), true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_info_hardware_version), std::to_string(config.hardwareRevision[0]) + "." + std::to_string(config.hardwareRevision[1]), true);
 }
 
 void NukiNetworkOpener::publishAdvancedConfig(const NukiOpener::AdvancedConfig &config)
@@ -869,28 +887,29 @@ void NukiNetworkOpener::publishAdvancedConfig(const NukiOpener::AdvancedConfig &
     json["rebootNuki"] = 0;
     json["recalibrateNuki"] = 0;
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_config_advanced_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_config_advanced_json), buffer.data(), true);
 
     if(!_disableNonJSON)
     {
-        _nukiPublisher->publishUInt(mqtt_topic_config_sound_level, config.soundLevel, true);
+        _nukiPublisher->publishUInt(MQTT_TOPIC_ID(mqtt_topic_config_sound_level), config.soundLevel, true);
     }
 }
 
 void NukiNetworkOpener::publishRssi(const int &rssi)
 {
-    _nukiPublisher->publishInt(mqtt_topic_lock_rssi, rssi, true);
+    _nukiPublisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_lock_rssi), rssi, true);
 }
 
 void NukiNetworkOpener::publishRetry(const std::string& message)
 {
-    _nukiPublisher->publishString(mqtt_topic_lock_retry, message, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_retry), message, true);
 }
 
 void NukiNetworkOpener::publishBleAddress(const std::string &address)
 {
-    _nukiPublisher->publishString(mqtt_topic_lock_address, address, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_address), address, true);
 }
 
 void NukiNetworkOpener::publishKeypad(const std::list<NukiLock::KeypadEntry>& entries, uint maxKeypadCodeCount)
@@ -1000,8 +1019,9 @@ void NukiNetworkOpener::publishKeypad(const std::list<NukiLock::KeypadEntry>& en
             basePath.concat(std::to_string(index).c_str());
             jsonEntry["name_ha"] = entry.name;
             jsonEntry["index"] = index;
-            serializeJson(jsonEntry, _buffer, _bufferSize);
-            _nukiPublisher->publishString(basePath.c_str(), _buffer, true);
+            ScratchBuffer buffer(measureJson(jsonEntry) + 1);
+            serializeJson(jsonEntry, buffer.data(), buffer.size());
+            _nukiPublisher->publishString(basePath, buffer.data(), true);
 
             String basePathPrefix = "~";
             basePathPrefix.concat(basePath);
@@ -1043,8 +1063,9 @@ void NukiNetworkOpener::publishKeypad(const std::list<NukiLock::KeypadEntry>& en
         ++index;
     }
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_keypad_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_json), buffer.data(), true);
 
     if(!_disableNonJSON)
     {
@@ -1191,8 +1212,9 @@ void NukiNetworkOpener::publishTimeControl(const std::list<NukiOpener::TimeContr
             basePath.concat("/entries/");
             basePath.concat(std::to_string(index).c_str());
             jsonEntry["index"] = index;
-            serializeJson(jsonEntry, _buffer, _bufferSize);
-            _nukiPublisher->publishString(basePath.c_str(), _buffer, true);
+            ScratchBuffer buffer(measureJson(jsonEntry) + 1);
+            serializeJson(jsonEntry, buffer.data(), buffer.size());
+            _nukiPublisher->publishString(basePath, buffer.data(), true);
             String basePathPrefix = "~";
             basePathPrefix.concat(basePath);
             const char *basePathPrefixChr = basePathPrefix.c_str();
@@ -1229,8 +1251,9 @@ void NukiNetworkOpener::publishTimeControl(const std::list<NukiOpener::TimeContr
         ++index;
     }
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_timecontrol_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_timecontrol_json), buffer.data(), true);
 
     for(int j=timeControlEntries.size(); j<maxTimeControlEntryCount; j++)
     {
@@ -1296,8 +1319,9 @@ void NukiNetworkOpener::publishAuth(const std::list<NukiOpener::AuthorizationEnt
             basePath.concat("/entries/");
             basePath.concat(std::to_string(index).c_str());
             jsonEntry["index"] = index;
-            serializeJson(jsonEntry, _buffer, _bufferSize);
-            _nukiPublisher->publishString(basePath.c_str(), _buffer, true);
+            ScratchBuffer buffer(measureJson(jsonEntry) + 1);
+            serializeJson(jsonEntry, buffer.data(), buffer.size());
+            _nukiPublisher->publishString(basePath, buffer.data(), true);
 
             String basePathPrefix = "~";
             basePathPrefix.concat(basePath);
@@ -1336,8 +1360,9 @@ void NukiNetworkOpener::publishAuth(const std::list<NukiOpener::AuthorizationEnt
         ++index;
     }
 
-    serializeJson(json, _buffer, _bufferSize);
-    _nukiPublisher->publishString(mqtt_topic_auth_json, _buffer, true);
+    ScratchBuffer buffer(measureJson(json) + 1);
+    serializeJson(json, buffer.data(), buffer.size());
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_auth_json), buffer.data(), true);
 
     for(int j=authEntries.size(); j<maxAuthEntryCount; j++)
     {
@@ -1352,7 +1377,7 @@ void NukiNetworkOpener::publishAuth(const std::list<NukiOpener::AuthorizationEnt
 
 void NukiNetworkOpener::publishConfigCommandResult(const char* result)
 {
-    _nukiPublisher->publishString(mqtt_topic_config_action_command_result, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_config_action_command_result), result, true);
 }
 
 void NukiNetworkOpener::publishKeypadCommandResult(const char* result)
@@ -1361,27 +1386,27 @@ void NukiNetworkOpener::publishKeypadCommandResult(const char* result)
     {
         return;
     }
-    _nukiPublisher->publishString(mqtt_topic_keypad_command_result, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_command_result), result, true);
 }
 
 void NukiNetworkOpener::publishKeypadJsonCommandResult(const char* result)
 {
-    _nukiPublisher->publishString(mqtt_topic_keypad_json_command_result, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_keypad_json_command_result), result, true);
 }
 
 void NukiNetworkOpener::publishTimeControlCommandResult(const char* result)
 {
-    _nukiPublisher->publishString(mqtt_topic_timecontrol_command_result, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_timecontrol_command_result), result, true);
 }
 
 void NukiNetworkOpener::publishAuthCommandResult(const char* result)
 {
-    _nukiPublisher->publishString(mqtt_topic_auth_command_result, result, true);
+    _nukiPublisher->publishString(MQTT_TOPIC_ID(mqtt_topic_auth_command_result), result, true);
 }
 
 void NukiNetworkOpener::publishStatusUpdated(const bool statusUpdated)
 {
-    _nukiPublisher->publishBool(mqtt_topic_lock_status_updated, statusUpdated, true);
+    _nukiPublisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_lock_status_updated), statusUpdated, true);
 }
 
 void NukiNetworkOpener::setLockActionReceivedCallback(LockActionResult (*lockActionReceivedCallback)(const char *))
@@ -1429,59 +1454,22 @@ void NukiNetworkOpener::publishKeypadEntry(const String topic, NukiLock::KeypadE
     memset(codeName, 0, sizeof(codeName));
     memcpy(codeName, entry.name, sizeof(entry.name));
 
-    _nukiPublisher->publishInt(concat(topic, "/id").c_str(), entry.codeId, true);
-    _nukiPublisher->publishBool(concat(topic, "/enabled").c_str(), entry.enabled, true);
-    _nukiPublisher->publishString(concat(topic, "/name").c_str(), codeName, true);
+    _nukiPublisher->publishInt(concat(topic, "/id"), entry.codeId, true);
+    _nukiPublisher->publishBool(concat(topic, "/enabled"), entry.enabled, true);
+    _nukiPublisher->publishString(concat(topic, "/name"), codeName, true);
 
     if(_preferences->getBool(preference_keypad_publish_code, false))
     {
-        _nukiPublisher->publishInt(concat(topic, "/code").c_str(), entry.code, true);
+        _nukiPublisher->publishInt(concat(topic, "/code"), entry.code, true);
     }
 
-    _nukiPublisher->publishInt(concat(topic, "/createdYear").c_str(), entry.dateCreatedYear, true);
-    _nukiPublisher->publishInt(concat(topic, "/createdMonth").c_str(), entry.dateCreatedMonth, true);
-    _nukiPublisher->publishInt(concat(topic, "/createdDay").c_str(), entry.dateCreatedDay, true);
-    _nukiPublisher->publishInt(concat(topic, "/createdHour").c_str(), entry.dateCreatedHour, true);
-    _nukiPublisher->publishInt(concat(topic, "/createdMin").c_str(), entry.dateCreatedMin, true);
-    _nukiPublisher->publishInt(concat(topic, "/createdSec").c_str(), entry.dateCreatedSec, true);
-    _nukiPublisher->publishInt(concat(topic, "/lockCount").c_str(), entry.lockCount, true);
-}
-
-void NukiNetworkOpener::buildMqttPath(const char* path, char* outPath)
-{
-    int offset = 0;
-    for(const char& c : _mqttPath)
-    {
-        if(c == 0x00)
-        {
-            break;
-        }
-        outPath[offset] = c;
-        ++offset;
-    }
-    int i=0;
-    while(path[i] != 0x00)
-    {
-        outPath[offset] = path[i];
-        ++i;
-        ++offset;
-    }
-    outPath[offset] = 0x00;
-}
-
-void NukiNetworkOpener::subscribe(const char *path)
-{
-    char prefixedPath[500];
-    buildMqttPath(path, prefixedPath);
-    _network->subscribe(prefixedPath, MQTT_QOS_LEVEL);
-}
-
-bool NukiNetworkOpener::comparePrefixedPath(const char *fullPath, const char *subPath)
-{
-    char prefixedPath[500];
-    buildMqttPath(subPath, prefixedPath);
-
-    return strcmp(fullPath, prefixedPath) == 0;
+    _nukiPublisher->publishInt(concat(topic, "/createdYear"), entry.dateCreatedYear, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdMonth"), entry.dateCreatedMonth, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdDay"), entry.dateCreatedDay, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdHour"), entry.dateCreatedHour, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdMin"), entry.dateCreatedMin, true);
+    _nukiPublisher->publishInt(concat(topic, "/createdSec"), entry.dateCreatedSec, true);
+    _nukiPublisher->publishInt(concat(topic, "/lockCount"), entry.lockCount, true);
 }
 
 String NukiNetworkOpener::concat(String a, String b)
@@ -1506,4 +1494,9 @@ uint8_t NukiNetworkOpener::queryCommands()
 void NukiNetworkOpener::setupHASS(int type, uint32_t nukiId, char* nukiName, const char* firmwareVersion, const char* hardwareVersion, bool hasDoorSensor, bool hasKeypad)
 {
     _network->setupHASS(type, nukiId, nukiName, firmwareVersion, hardwareVersion, hasDoorSensor, hasKeypad);
+}
+
+const uint32_t NukiNetworkOpener::hassGeneration() const
+{
+    return _network->hassGeneration();
 }
\ No newline at end of file
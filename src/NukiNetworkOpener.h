@@ -8,10 +8,10 @@
 #include "NukiNetworkLock.h"
 #include "EspMillis.h"
 
-class NukiNetworkOpener : public MqttReceiver
+class NukiNetworkOpener
 {
 public:
-    explicit NukiNetworkOpener(NukiNetwork* network, Preferences* preferences, char* buffer, size_t bufferSize);
+    explicit NukiNetworkOpener(NukiNetwork* network, Preferences* preferences, ConfigSnapshot* config);
     virtual ~NukiNetworkOpener() = default;
 
     void initialize();
@@ -23,6 +23,7 @@ public:
     void publishAuthorizationInfo(const std::list<NukiOpener::LogEntry>& logEntries, bool latest);
     void clearAuthorizationInfo();
     void publishCommandResult(const char* resultStr);
+    void publishCommandLatency(const int64_t& lastUs, const int64_t& p50Us, const int64_t& p99Us);
     void publishLockstateCommandResult(const char* resultStr);
     void publishBatteryReport(const NukiOpener::BatteryReport& batteryReport);
     void publishConfig(const NukiOpener::Config& config);
@@ -46,24 +47,34 @@ public:
     void setKeypadJsonCommandReceivedCallback(void (*keypadJsonCommandReceivedReceivedCallback)(const char* value));
     void setTimeControlCommandReceivedCallback(void (*timeControlCommandReceivedReceivedCallback)(const char* value));
     void setAuthCommandReceivedCallback(void (*authCommandReceivedReceivedCallback)(const char* value));
-    void onMqttDataReceived(const char* topic, byte* payload, const unsigned int length) override;
     void setupHASS(int type, uint32_t nukiId, char* nukiName, const char* firmwareVersion, const char* hardwareVersion, bool hasDoorSensor, bool hasKeypad);
+    const uint32_t hassGeneration() const;
 
     int mqttConnectionState();
     uint8_t queryCommands();
     char _nukiName[33];
 
 private:
-    bool comparePrefixedPath(const char* fullPath, const char* subPath);
-
     void publishKeypadEntry(const String topic, NukiLock::KeypadEntry entry);
 
-    void buildMqttPath(const char* path, char* outPath);
-    void subscribe(const char* path);
+    void subscribe(const char* topic, void (NukiNetworkOpener::*handler)(char* data));
+    void subscribeQuery(const char* topic, const uint8_t queryCommand);
+    void onLockActionReceived(char* data);
+    void onLogRollingLastReceived(char* data);
+    void onKeypadCommandActionReceived(char* data);
+    void onKeypadCommandIdReceived(char* data);
+    void onKeypadCommandNameReceived(char* data);
+    void onKeypadCommandCodeReceived(char* data);
+    void onKeypadCommandEnabledReceived(char* data);
+    void onConfigActionReceived(char* data);
+    void onKeypadJsonActionReceived(char* data);
+    void onTimeControlActionReceived(char* data);
+    void onAuthActionReceived(char* data);
 
     String concat(String a, String b);
 
     Preferences* _preferences = nullptr;
+    ConfigSnapshot* _config = nullptr;
 
     NukiNetwork* _network = nullptr;
     NukiPublisher* _nukiPublisher = nullptr;
@@ -86,8 +97,6 @@ private:
     char _authName[33];
     uint32_t _lastRollingLog = 0;
 
-    char* _buffer;
-    const size_t _bufferSize;
 
     LockActionResult (*_lockActionReceivedCallback)(const char* value) = nullptr;
     void (*_configUpdateReceivedCallback)(const char* value) = nullptr;
@@ -2,6 +2,7 @@
 #include "NukiOfficial.h"
 #include "Logger.h"
 #include "PreferencesKeys.h"
+#include "util/TaskScheduler.h"
 #include "../lib/nuki_ble/src/NukiLockUtils.h"
 #include <stdlib.h>
 #include <ctype.h>
@@ -46,39 +47,6 @@ const char *NukiOfficial::getMqttPath() const
     return mqttPath;
 }
 
-void NukiOfficial::buildMqttPath(const char *path, char *outPath)
-{
-    int offset = 0;
-    char inPath[181] = {0};
-
-    memcpy(inPath, mqttPath, sizeof(mqttPath));
-
-    for(const char& c : inPath)
-    {
-        if(c == 0x00)
-        {
-            break;
-        }
-        outPath[offset] = c;
-        ++offset;
-    }
-    int i=0;
-    while(outPath[i] != 0x00)
-    {
-        outPath[offset] = path[i];
-        ++i;
-        ++offset;
-    }
-    outPath[i+1] = 0x00;
-}
-
-bool NukiOfficial::comparePrefixedPath(const char *fullPath, const char *subPath)
-{
-    char prefixedPath[500];
-    buildMqttPath(subPath, prefixedPath);
-    return strcmp(fullPath, prefixedPath) == 0;
-}
-
 void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value)
 {
     char str[50];
@@ -96,16 +64,17 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
         Log->print("Connected: ");
         Log->println(strcmp(value, "true") == 0 ? 1 : 0);
         offConnected = (strcmp(value, "true") == 0 ? 1 : 0);
-        _publisher->publishBool(mqtt_topic_hybrid_state, offConnected, true);
+        _publisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_hybrid_state), offConnected, true);
     }
     else if(strcmp(topic, mqtt_topic_official_state) == 0)
     {
         offState = atoi(value);
         _statusUpdated = true;
+        TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_QUERY);
         Log->println("Lock: Updating status on Hybrid state change");
-        _publisher->publishBool(mqtt_topic_hybrid_state, offConnected, true);
+        _publisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_hybrid_state), offConnected, true);
         NukiLock::lockstateToString((NukiLock::LockState)offState, str);
-        _publisher->publishString(mqtt_topic_lock_state, str, true);
+        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_state), str, true);
 
         Log->print("Lockstate: ");
         Log->println(str);
@@ -117,14 +86,15 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
     {
         offDoorsensorState = atoi(value);
         _statusUpdated = true;
+        TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_QUERY);
         Log->println("Lock: Updating status on Hybrid door sensor state change");
-        _publisher->publishBool(mqtt_topic_lock_status_updated, _statusUpdated, true);
+        _publisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_lock_status_updated), _statusUpdated, true);
         NukiLock::doorSensorStateToString((NukiLock::DoorSensorState)offDoorsensorState, str);
 
         Log->print("Doorsensor state: ");
         Log->println(str);
 
-        _publisher->publishString(mqtt_topic_lock_door_sensor_state, str, true);
+        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_door_sensor_state), str, true);
     }
     else if(strcmp(topic, mqtt_topic_official_batteryCritical) == 0)
     {
@@ -135,7 +105,7 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
 
         if(!_disableNonJSON)
         {
-            _publisher->publishBool(mqtt_topic_battery_critical, offCritical, true);
+            _publisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_battery_critical), offCritical, true);
         }
         publishBatteryJson = true;
     }
@@ -148,7 +118,7 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
 
         if(!_disableNonJSON)
         {
-            _publisher->publishBool(mqtt_topic_battery_charging, offCharging, true);
+            _publisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_battery_charging), offCharging, true);
         }
         publishBatteryJson = true;
     }
@@ -161,7 +131,7 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
 
         if(!_disableNonJSON)
         {
-            _publisher->publishInt(mqtt_topic_battery_level, offChargeState, true);
+            _publisher->publishInt(MQTT_TOPIC_ID(mqtt_topic_battery_level), offChargeState, true);
         }
         publishBatteryJson = true;
     }
@@ -170,7 +140,7 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
         offKeypadCritical = (strcmp(value, "true") == 0 ? 1 : 0);
         if(!_disableNonJSON)
         {
-            _publisher->publishBool(mqtt_topic_battery_keypad_critical, offKeypadCritical, true);
+            _publisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_battery_keypad_critical), offKeypadCritical, true);
         }
         publishBatteryJson = true;
     }
@@ -179,7 +149,7 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
         offDoorsensorCritical = (strcmp(value, "true") == 0 ? 1 : 0);
         if(!_disableNonJSON)
         {
-            _publisher->publishBool(mqtt_topic_battery_doorsensor_critical, offDoorsensorCritical, true);
+            _publisher->publishBool(MQTT_TOPIC_ID(mqtt_topic_battery_doorsensor_critical), offDoorsensorCritical, true);
         }
         publishBatteryJson = true;
     }
@@ -192,7 +162,7 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
         }
         char resultStr[15] = {0};
         NukiLock::cmdResultToString((Nuki::CmdResult)offCommandResponse, resultStr);
-        _publisher->publishString(mqtt_topic_lock_action_command_result, resultStr, true);
+        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_action_command_result), resultStr, true);
     }
     else if(strcmp(topic, mqtt_topic_official_lockActionEvent) == 0)
     {
@@ -214,11 +184,11 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
 
         memset(&str, 0, sizeof(str));
         lockactionToString((NukiLock::LockAction)offLockAction, str);
-        _publisher->publishString(mqtt_topic_lock_last_lock_action, str, true);
+        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_last_lock_action), str, true);
 
         memset(&str, 0, sizeof(str));
         triggerToString((NukiLock::Trigger)offTrigger, str);
-        _publisher->publishString(mqtt_topic_lock_trigger, str, true);
+        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_trigger), str, true);
 
         if(offAuthId > 0 || offCodeId > 0)
         {
@@ -229,16 +199,16 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
                 switch(offContext)
                 {
                 case 0:
-                    _publisher->publishString(mqtt_topic_lock_lock_action_context, "keypadBackKey", true);
+                    _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), "keypadBackKey", true);
                     break;
                 case 1:
-                    _publisher->publishString(mqtt_topic_lock_lock_action_context, "keypadCode", true);
+                    _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), "keypadCode", true);
                     break;
                 case 2:
-                    _publisher->publishString(mqtt_topic_lock_lock_action_context, "keypadFingerprint", true);
+                    _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), "keypadFingerprint", true);
                     break;
                 default:
-                    _publisher->publishString(mqtt_topic_lock_lock_action_context, "", true);
+                    _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), "", true);
                     break;
                 }
             }
@@ -251,35 +221,35 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
                 case 0:
                     if (offContext == 1)
                     {
-                        _publisher->publishString(mqtt_topic_lock_lock_action_context, "autoUnlock", true);
+                        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), "autoUnlock", true);
                     }
                     else
                     {
-                        _publisher->publishString(mqtt_topic_lock_lock_action_context, "", true);
+                        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), "", true);
                     }
                     break;
                 case 2:
                     if (offContext > 0)
                     {
-                        _publisher->publishString(mqtt_topic_lock_lock_action_context, String("button") + String(offContext) + "press", true);
+                        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), String("button") + String(offContext) + "press", true);
                     }
                     else
                     {
-                        _publisher->publishString(mqtt_topic_lock_lock_action_context, "", true);
+                        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), "", true);
                     }
                     break;
                 case 3:
                     if (offContext > 0)
                     {
-                        _publisher->publishString(mqtt_topic_lock_lock_action_context, String("fob") + String(offContext) + "press", true);
+                        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), String("fob") + String(offContext) + "press", true);
                     }
                     else
                     {
-                        _publisher->publishString(mqtt_topic_lock_lock_action_context, "", true);
+                        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), "", true);
                     }
                     break;
                 default:
-                    _publisher->publishString(mqtt_topic_lock_lock_action_context, "", true);
+                    _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), "", true);
                     break;
                 }
             }
@@ -287,7 +257,7 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
         }
         else
         {
-            _publisher->publishString(mqtt_topic_lock_lock_action_context, "", true);
+            _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_lock_lock_action_context), "", true);
         }
     }
 
@@ -301,7 +271,7 @@ void NukiOfficial::onOfficialUpdateReceived(const char *topic, const char *value
         jsonBattery["keypadCritical"] = offKeypadCritical ? "1" : "0";
         jsonBattery["doorSensorCritical"] = offDoorsensorCritical ? "1" : "0";
         serializeJson(jsonBattery, _resbuf, sizeof(_resbuf));
-        _publisher->publishString(mqtt_topic_battery_basic_json, _resbuf, true);
+        _publisher->publishString(MQTT_TOPIC_ID(mqtt_topic_battery_basic_json), _resbuf, true);
     }
 }
 
@@ -390,7 +360,7 @@ void NukiOfficial::clearOffCommandExecutedTs()
     offCommandExecutedTs = 0;
 }
 
-const std::vector<char *> NukiOfficial::getOffTopics() const
+const std::vector<char *>& NukiOfficial::getOffTopics() const
 {
     return offTopics;
 }
@@ -23,9 +23,6 @@ public:
     const bool hasAuthId() const;
     void clearAuthId();
 
-    void buildMqttPath(const char* path, char* outPath);
-    bool comparePrefixedPath(const char *fullPath, const char *subPath);
-
     void onOfficialUpdateReceived(const char* topic, const char* value);
 
     const bool getOffConnected() const;
@@ -35,7 +32,7 @@ public:
     const uint8_t getOffLockAction() const;
     const uint8_t getOffTrigger() const;
     const uint8_t getOffContext() const;
-    const std::vector<char*> getOffTopics() const;
+    const std::vector<char*>& getOffTopics() const;
 
     const int64_t getOffCommandExecutedTs() const;
     void setOffCommandExecutedTs(const int64_t& value);
@@ -1,7 +1,9 @@
 #include "NukiOpenerWrapper.h"
 #include "PreferencesKeys.h"
 #include "MqttTopics.h"
+#include "util/ScratchArena.h"
 #include "Logger.h"
+#include "LogEvents.h"
 #include "RestartReason.h"
 #include <NukiOpenerUtils.h>
 #include "Config.h"
@@ -16,7 +18,7 @@
 NukiOpenerWrapper* nukiOpenerInst;
 Preferences* nukiOpenerPreferences = nullptr;
 
-NukiOpenerWrapper::NukiOpenerWrapper(const std::string& deviceName, NukiDeviceId* deviceId, BleScanner::Scanner* scanner, NukiNetworkOpener* network, Gpio* gpio, Preferences* preferences, char* buffer, size_t bufferSize)
+NukiOpenerWrapper::NukiOpenerWrapper(const std::string& deviceName, NukiDeviceId* deviceId, BleScanner::Scanner* scanner, NukiNetworkOpener* network, Gpio* gpio, Preferences* preferences, ConfigSnapshot* config)
     : _deviceName(deviceName),
       _deviceId(deviceId),
       _nukiOpener(deviceName, _deviceId->get()),
@@ -24,8 +26,7 @@ NukiOpenerWrapper::NukiOpenerWrapper(const std::string& deviceName, NukiDeviceId
       _network(network),
       _gpio(gpio),
       _preferences(preferences),
-      _buffer(buffer),
-      _bufferSize(bufferSize)
+      _config(config)
 {
     Log->print("Device id opener: ");
     Log->println(_deviceId->get());
@@ -208,12 +209,7 @@ void NukiOpenerWrapper::readSettings()
         _preferences->putInt(preference_restart_ble_beacon_lost, _restartBeaconTimeout);
     }
 
-    Log->print("Opener state interval: ");
-    Log->print(_intervalLockstate);
-    Log->print(" | Battery interval: ");
-    Log->print(_intervalBattery);
-    Log->print(" | Publish auth data: ");
-    Log->println(_publishAuthData ? "yes" : "no");
+    logEvent(LogEvent::OpenerIntervals, _intervalLockstate, _intervalBattery, _publishAuthData ? "yes" : "no");
 
     if(!_publishAuthData)
     {
@@ -273,9 +269,7 @@ void NukiOpenerWrapper::update()
             _disableBleWatchdogTs < ts &&
             (ts - lastReceivedBeaconTs > _restartBeaconTimeout * 1000))
     {
-        Log->print("No BLE beacon received from the opener for ");
-        Log->print((ts - lastReceivedBeaconTs) / 1000);
-        Log->println(" seconds, signalling to restart BLE controller.");
+        logEvent(LogEvent::OpenerBeaconLost, (ts - lastReceivedBeaconTs) / 1000);
         if (esp_task_wdt_status(NULL) == ESP_OK)
         {
             esp_task_wdt_reset();
@@ -286,6 +280,15 @@ void NukiOpenerWrapper::update()
 
     _nukiOpener.updateConnectionState();
 
+    if(_nextLockAction == (NukiOpener::LockAction)0xff)
+    {
+        LockCommand command;
+        if(_commandQueue.pop(command))
+        {
+            _nextLockAction = command.action;
+            _commandReceivedUs = command.receivedUs;
+        }
+    }
     if(_nextLockAction != (NukiOpener::LockAction)0xff)
     {
         int retryCount = 0;
@@ -311,6 +314,8 @@ void NukiOpenerWrapper::update()
             return cmdResult;
         });
 
+        trackCommandLatency();
+
         if(result == Nuki::CmdResult::Success)
         {
             _nextLockAction = (NukiOpener::LockAction) 0xff;
@@ -366,7 +371,7 @@ void NukiOpenerWrapper::update()
                 _waitKeypadUpdateTs = 0;
                 updateKeypad(true);
             }
-            if(_preferences->getBool(preference_update_time, false) && ts > (120 * 1000) && ts > _nextTimeUpdateTs)
+            if(_config->get()->updateTime && ts > (120 * 1000) && ts > _nextTimeUpdateTs)
             {
                 _nextTimeUpdateTs = ts + (12 * 60 * 60 * 1000);
                 updateTime();
@@ -381,10 +386,10 @@ void NukiOpenerWrapper::update()
                 _waitAuthUpdateTs = 0;
                 updateAuth(true);
             }
-            if(_hassEnabled && _nukiConfigValid && _nukiAdvancedConfigValid && !_hassSetupCompleted)
+            if(_hassEnabled && _nukiConfigValid && _nukiAdvancedConfigValid && _hassSetupGeneration != _network->hassGeneration())
             {
+                _hassSetupGeneration = _network->hassGeneration();
                 _network->setupHASS(2, _nukiConfig.nukiId, (char*)_nukiConfig.name, _firmwareVersion.c_str(), _hardwareVersion.c_str(), false, hasKeypad());
-                _hassSetupCompleted = true;
             }
             if(_rssiPublishInterval > 0 && (_nextRssiTs == 0 || ts > _nextRssiTs))
             {
@@ -418,6 +423,25 @@ void NukiOpenerWrapper::update()
     memcpy(&_lastKeyTurnerState, &_keyTurnerState, sizeof(NukiOpener::OpenerState));
 }
 
+const int64_t NukiOpenerWrapper::nextDeadline()
+{
+    SchedulerDeadlines deadlines;
+    deadlines.actionPending = !_paired || _nextLockAction != (NukiOpener::LockAction)0xff || !_commandQueue.empty() || _statusUpdated;
+    deadlines.mqttConnected = _network->mqttConnectionState() == 2;
+    deadlines.lockStateUpdateTs = _nextLockStateUpdateTs;
+    deadlines.batteryReportTs = _nextBatteryReportTs;
+    deadlines.configUpdateTs = _nextConfigUpdateTs;
+    deadlines.waitAuthLogUpdateTs = _waitAuthLogUpdateTs;
+    deadlines.waitKeypadUpdateTs = _waitKeypadUpdateTs;
+    deadlines.waitTimeControlUpdateTs = _waitTimeControlUpdateTs;
+    deadlines.waitAuthUpdateTs = _waitAuthUpdateTs;
+    deadlines.rssiEnabled = _rssiPublishInterval > 0;
+    deadlines.rssiTs = _nextRssiTs;
+    deadlines.keypadEnabled = hasKeypad() && _keypadEnabled;
+    deadlines.keypadUpdateTs = _nextKeypadUpdateTs;
+
+    return TaskScheduler::nextDeadline(deadlines);
+}
 
 void NukiOpenerWrapper::electricStrikeActuation()
 {
@@ -458,7 +482,14 @@ void NukiOpenerWrapper::deactivateCM()
 
 bool NukiOpenerWrapper::isPinValid()
 {
-    return _preferences->getInt(preference_opener_pin_status, (int)NukiPinState::NotConfigured) == (int)NukiPinState::Valid;
+    return _config->get()->openerPinStatus == (int)NukiPinState::Valid;
+}
+
+void NukiOpenerWrapper::setPinStatus(const NukiPinState& pinStatus)
+{
+    ConfigValues config = _config->edit();
+    config.openerPinStatus = (int)pinStatus;
+    _config->commit(config);
 }
 
 void NukiOpenerWrapper::setPin(const uint16_t pin)
@@ -510,9 +541,7 @@ bool NukiOpenerWrapper::updateKeyTurnerState()
         postponeBleWatchdog();
         if(_retryLockstateCount < _nrOfRetries + 1)
         {
-            Log->print("Query opener state retrying in ");
-            Log->print(_retryDelay);
-            Log->println("ms");
+            logEvent(LogEvent::OpenerQueryRetry, _retryDelay);
             _nextLockStateUpdateTs = espMillis() + _retryDelay;
         }
         else
@@ -638,11 +667,7 @@ void NukiOpenerWrapper::updateConfig()
         {
             char uidString[20];
             itoa(_nukiConfig.nukiId, uidString, 16);
-            Log->print("Saving Opener Nuki ID to preferences (");
-            Log->print(_nukiConfig.nukiId);
-            Log->print(" / ");
-            Log->print(uidString);
-            Log->println(")");
+            logEvent(LogEvent::OpenerSaveNukiId, _nukiConfig.nukiId, uidString);
             _preferences->putUInt(preference_nuki_id_opener, _nukiConfig.nukiId);
         }
 
@@ -665,7 +690,7 @@ void NukiOpenerWrapper::updateConfig()
                 updateAuth(false);
             }
 
-            const int pinStatus = _preferences->getInt(preference_opener_pin_status, (int)NukiPinState::NotConfigured);
+            const int pinStatus = _config->get()->openerPinStatus;
 
             Nuki::CmdResult result = (Nuki::CmdResult)-1;
 
@@ -679,7 +704,7 @@ void NukiOpenerWrapper::updateConfig()
                 Log->println("Nuki opener PIN is invalid or not set");
                 if(pinStatus != 2)
                 {
-                    _preferences->putInt(preference_opener_pin_status, (int)NukiPinState::Invalid);
+                    setPinStatus(NukiPinState::Invalid);
                 }
             }
             else
@@ -687,7 +712,7 @@ void NukiOpenerWrapper::updateConfig()
                 Log->println("Nuki opener PIN is valid");
                 if(pinStatus != 1)
                 {
-                    _preferences->putInt(preference_opener_pin_status, (int)NukiPinState::Valid);
+                    setPinStatus(NukiPinState::Valid);
                 }
             }
         }
@@ -749,7 +774,7 @@ void NukiOpenerWrapper::updateAuthData(bool retrieved)
 
         result = _nukiRetryHandler->retryComm([&]()
         {
-            return _nukiOpener.retrieveLogEntries(0, _preferences->getInt(preference_authlog_max_entries, MAX_AUTHLOG), 1, false);
+            return _nukiOpener.retrieveLogEntries(0, _config->get()->authlogMaxEntries, 1, false);
         });
 
         Log->println(result);
@@ -766,9 +791,9 @@ void NukiOpenerWrapper::updateAuthData(bool retrieved)
             std::list<NukiOpener::LogEntry> log;
             _nukiOpener.getLogEntries(&log);
 
-            if(log.size() > _preferences->getInt(preference_authlog_max_entries, 3))
+            if(log.size() > _config->get()->authlogMaxEntries)
             {
-                log.resize(_preferences->getInt(preference_authlog_max_entries, 3));
+                log.resize(_config->get()->authlogMaxEntries);
             }
 
             log.sort([](const NukiOpener::LogEntry& a, const NukiOpener::LogEntry& b)
@@ -787,9 +812,9 @@ void NukiOpenerWrapper::updateAuthData(bool retrieved)
         std::list<NukiOpener::LogEntry> log;
         _nukiOpener.getLogEntries(&log);
 
-        if(log.size() > _preferences->getInt(preference_authlog_max_entries, MAX_AUTHLOG))
+        if(log.size() > _config->get()->authlogMaxEntries)
         {
-            log.resize(_preferences->getInt(preference_authlog_max_entries, MAX_AUTHLOG));
+            log.resize(_config->get()->authlogMaxEntries);
         }
 
         log.sort([](const NukiOpener::LogEntry& a, const NukiOpener::LogEntry& b)
@@ -964,7 +989,7 @@ void NukiOpenerWrapper::updateAuth(bool retrieved)
 
         result = _nukiRetryHandler->retryComm([&]()
         {
-            return _nukiOpener.retrieveAuthorizationEntries(0, _preferences->getInt(preference_auth_max_entries, MAX_AUTH));
+            return _nukiOpener.retrieveAuthorizationEntries(0, _config->get()->authMaxEntries);
         });
 
         if(result == Nuki::CmdResult::Success)
@@ -985,9 +1010,9 @@ void NukiOpenerWrapper::updateAuth(bool retrieved)
             return a.authId < b.authId;
         });
 
-        if(authEntries.size() > _preferences->getInt(preference_auth_max_entries, MAX_AUTH))
+        if(authEntries.size() > _config->get()->authMaxEntries)
         {
-            authEntries.resize(_preferences->getInt(preference_auth_max_entries, MAX_AUTH));
+            authEntries.resize(_config->get()->authMaxEntries);
         }
 
         uint authCount = authEntries.size();
@@ -1010,6 +1035,18 @@ void NukiOpenerWrapper::updateAuth(bool retrieved)
     postponeBleWatchdog();
 }
 
+void NukiOpenerWrapper::trackCommandLatency()
+{
+    if(_commandReceivedUs == 0)
+    {
+        return;
+    }
+
+    _commandLatency.addSample(esp_timer_get_time() - _commandReceivedUs);
+    _commandReceivedUs = 0;
+    _network->publishCommandLatency(_commandLatency.last(), _commandLatency.percentile(50), _commandLatency.percentile(99));
+}
+
 void NukiOpenerWrapper::postponeBleWatchdog()
 {
     _disableBleWatchdogTs = espMillis() + 15000;
@@ -1039,6 +1076,7 @@ LockActionResult NukiOpenerWrapper::onLockActionReceivedCallback(const char *val
         return LockActionResult::UnknownAction;
     }
 
+    int64_t receivedUs = esp_timer_get_time();
     nukiOpenerPreferences = new Preferences();
     nukiOpenerPreferences->begin("nukihub", true);
     uint32_t aclPrefs[17];
@@ -1047,7 +1085,11 @@ LockActionResult NukiOpenerWrapper::onLockActionReceivedCallback(const char *val
     if((action == NukiOpener::LockAction::ActivateRTO && (int)aclPrefs[9] == 1) || (action == NukiOpener::LockAction::DeactivateRTO && (int)aclPrefs[10] == 1) || (action == NukiOpener::LockAction::ElectricStrikeActuation && (int)aclPrefs[11] == 1) || (action == NukiOpener::LockAction::ActivateCM && (int)aclPrefs[12] == 1) || (action == NukiOpener::LockAction::DeactivateCM && (int)aclPrefs[13] == 1) || (action == NukiOpener::LockAction::FobAction1 && (int)aclPrefs[14] == 1) || (action == NukiOpener::LockAction::FobAction2 && (int)aclPrefs[15] == 1) || (action == NukiOpener::LockAction::FobAction3 && (int)aclPrefs[16] == 1))
     {
         nukiOpenerPreferences->end();
-        nukiOpenerInst->_nextLockAction = action;
+        if(!nukiOpenerInst->_commandQueue.push({action, receivedUs}))
+        {
+            return LockActionResult::Failed;
+        }
+        TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_LOCK_ACTION);
         return LockActionResult::Success;
     }
 
@@ -1067,16 +1109,18 @@ void NukiOpenerWrapper::onConfigUpdateReceived(const char *value)
     if(!_nukiConfigValid)
     {
         jsonResult["general"] = "configNotReady";
-        serializeJson(jsonResult, _buffer, _bufferSize);
-        _network->publishConfigCommandResult(_buffer);
+        ScratchBuffer buffer(measureJson(jsonResult) + 1);
+        serializeJson(jsonResult, buffer.data(), buffer.size());
+        _network->publishConfigCommandResult(buffer.data());
         return;
     }
 
     if(!isPinValid())
     {
         jsonResult["general"] = "noValidPinSet";
-        serializeJson(jsonResult, _buffer, _bufferSize);
-        _network->publishConfigCommandResult(_buffer);
+        ScratchBuffer buffer(measureJson(jsonResult) + 1);
+        serializeJson(jsonResult, buffer.data(), buffer.size());
+        _network->publishConfigCommandResult(buffer.data());
         return;
     }
 
@@ -1086,8 +1130,9 @@ void NukiOpenerWrapper::onConfigUpdateReceived(const char *value)
     if(jsonError)
     {
         jsonResult["general"] = "invalidJson";
-        serializeJson(jsonResult, _buffer, _bufferSize);
-        _network->publishConfigCommandResult(_buffer);
+        ScratchBuffer buffer(measureJson(jsonResult) + 1);
+        serializeJson(jsonResult, buffer.data(), buffer.size());
+        _network->publishConfigCommandResult(buffer.data());
         return;
     }
 
@@ -1952,8 +1997,9 @@ void NukiOpenerWrapper::onConfigUpdateReceived(const char *value)
 
     _nextConfigUpdateTs = espMillis() + 300;
 
-    serializeJson(jsonResult, _buffer, _bufferSize);
-    _network->publishConfigCommandResult(_buffer);
+    ScratchBuffer buffer(measureJson(jsonResult) + 1);
+    serializeJson(jsonResult, buffer.data(), buffer.size());
+    _network->publishConfigCommandResult(buffer.data());
 
     return;
 }
@@ -2001,6 +2047,8 @@ void NukiOpenerWrapper::gpioActionCallback(const GpioAction &action, const int&
         nukiOpenerInst->deactivateCM();
         break;
     }
+
+    TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_GPIO);
 }
 
 void NukiOpenerWrapper::onKeypadCommandReceived(const char *command, const uint &id, const String &name, const String &code, const int& enabled)
@@ -3371,7 +3419,7 @@ void NukiOpenerWrapper::onAuthCommandReceived(const char *value)
                         return;
                     }
 
-                    Nuki::CmdResult resultAuth = _nukiOpener.retrieveAuthorizationEntries(0, _preferences->getInt(preference_auth_max_entries, MAX_AUTH));
+                    Nuki::CmdResult resultAuth = _nukiOpener.retrieveAuthorizationEntries(0, _config->get()->authMaxEntries);
                     bool foundExisting = false;
 
                     if(resultAuth == Nuki::CmdResult::Success)
@@ -3601,11 +3649,12 @@ void NukiOpenerWrapper::notify(Nuki::EventType eventType)
             _statusUpdated = true;
             _statusUpdatedTs = espMillis();
             _network->publishStatusUpdated(_statusUpdated);
+            TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_BLE);
         }
     }
     else if(eventType == Nuki::EventType::ERROR_BAD_PIN)
     {
-        _preferences->putInt(preference_lock_pin_status, (int)NukiPinState::Invalid);
+        setPinStatus(NukiPinState::Invalid);
     }
     else if(eventType == Nuki::EventType::BLE_ERROR_ON_DISCONNECT)
     {
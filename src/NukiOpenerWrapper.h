@@ -6,13 +6,17 @@
 #include "NukiDataTypes.h"
 #include "BleScanner.h"
 #include "Gpio.h"
+#include "ConfigSnapshot.h"
 #include "NukiDeviceId.h"
 #include "util/NukiRetryHandler.h"
+#include "util/TaskScheduler.h"
+#include "util/SpscQueue.h"
+#include "util/LatencyTracker.h"
 
 class NukiOpenerWrapper : public NukiOpener::SmartlockEventHandler
 {
 public:
-    NukiOpenerWrapper(const std::string& deviceName, NukiDeviceId* deviceId, BleScanner::Scanner* scanner, NukiNetworkOpener* network, Gpio* gpio, Preferences* preferences, char* buffer, size_t bufferSize);
+    NukiOpenerWrapper(const std::string& deviceName, NukiDeviceId* deviceId, BleScanner::Scanner* scanner, NukiNetworkOpener* network, Gpio* gpio, Preferences* preferences, ConfigSnapshot* config);
     virtual ~NukiOpenerWrapper();
 
     void initialize();
@@ -39,6 +43,7 @@ public:
     const bool hasKeypad() const;
     const BLEAddress getBleAddress() const;
     const uint8_t restartController() const;
+    const int64_t nextDeadline();
 
     const std::string firmwareVersion() const;
     const std::string hardwareVersion() const;
@@ -48,6 +53,12 @@ public:
     void notify(NukiOpener::EventType eventType) override;
 
 private:
+    struct LockCommand
+    {
+        NukiOpener::LockAction action;
+        int64_t receivedUs;
+    };
+
     static LockActionResult onLockActionReceivedCallback(const char* value);
     static void onConfigUpdateReceivedCallback(const char* value);
     static void onKeypadCommandReceivedCallback(const char* command, const uint& id, const String& name, const String& code, const int& enabled);
@@ -70,6 +81,8 @@ private:
     void updateTimeControl(bool retrieved);
     void updateAuth(bool retrieved);
     void postponeBleWatchdog();
+    void setPinStatus(const NukiPinState& pinStatus);
+    void trackCommandLatency();
     void updateTime();
 
     void updateGpioOutputs();
@@ -83,6 +96,7 @@ private:
     BleScanner::Scanner* _bleScanner = nullptr;
     NukiNetworkOpener* _network = nullptr;
     Preferences* _preferences = nullptr;
+    ConfigSnapshot* _config = nullptr;
     Gpio* _gpio = nullptr;
     NukiRetryHandler* _nukiRetryHandler = nullptr;
 
@@ -119,7 +133,7 @@ private:
     bool _nukiConfigValid = false;
     bool _nukiAdvancedConfigValid = false;
     bool _hassEnabled = false;
-    bool _hassSetupCompleted = false;
+    uint32_t _hassSetupGeneration = 0;
 
     bool _paired = false;
     bool _statusUpdated = false;
@@ -152,8 +166,9 @@ private:
     uint32_t _advancedOpenerConfigAclPrefs[22];
     std::string _firmwareVersion = "";
     std::string _hardwareVersion = "";
-    NukiOpener::LockAction _nextLockAction = (NukiOpener::LockAction)0xff;
+    volatile NukiOpener::LockAction _nextLockAction = (NukiOpener::LockAction)0xff;
+    SpscQueue<LockCommand, 8> _commandQueue;
+    LatencyTracker _commandLatency;
+    int64_t _commandReceivedUs = 0;
 
-    char* _buffer;
-    const size_t _bufferSize;
 };
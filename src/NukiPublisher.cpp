@@ -1,60 +1,104 @@
 #include <cstring>
 #include "NukiPublisher.h"
+#include "MqttTopics.h"
 
+static_assert(mqttTopicCount <= MQTT_TOPIC_TABLE_SIZE, "mqttTopicList does not fit into MqttTopicTable");
 
 NukiPublisher::NukiPublisher(NukiNetwork *network, const char* mqttPath)
     : _network(network),
-      _mqttPath(mqttPath)
+      _mqttPath(mqttPath),
+      _topics(mqttPath)
 {
 }
 
-void NukiPublisher::publishFloat(const char *topic, const float value, bool retain, const uint8_t precision)
+void NukiPublisher::initialize()
 {
-    _network->publishFloat(_mqttPath, topic, value, retain, precision);
+    MqttTopics mqttTopics;
+    _topics.registerTopics(mqttTopics.getMqttTopics());
 }
 
-void NukiPublisher::publishInt(const char *topic, const int value, bool retain)
+MqttTopicId NukiPublisher::topicId(const char *topic)
 {
-    _network->publishInt(_mqttPath, topic, value, retain);
+    return _topics.find(topic);
 }
 
-void NukiPublisher::publishUInt(const char *topic, const unsigned int value, bool retain)
+void NukiPublisher::publishFloat(const MqttTopicId& topicId, const float value, bool retain, const uint8_t precision)
 {
-    _network->publishUInt(_mqttPath, topic, value, retain);
+    char str[30];
+    dtostrf(value, 0, precision, str);
+    publishString(topicId, str, retain);
 }
 
-void NukiPublisher::publishBool(const char *topic, const bool value, bool retain)
+void NukiPublisher::publishInt(const MqttTopicId& topicId, const int value, bool retain)
 {
-    _network->publishBool(_mqttPath, topic, value, retain);
+    char str[30];
+    itoa(value, str, 10);
+    publishString(topicId, str, retain);
 }
 
-void NukiPublisher::publishString(const char *topic, const String &value, bool retain)
+void NukiPublisher::publishUInt(const MqttTopicId& topicId, const unsigned int value, bool retain)
 {
-    char str[value.length() + 1];
-    memset(str, 0, sizeof(str));
-    memcpy(str, value.begin(), value.length());
-    publishString(topic, str, retain);
+    char str[30];
+    utoa(value, str, 10);
+    publishString(topicId, str, retain);
 }
 
-void NukiPublisher::publishString(const char *topic, const std::string &value, bool retain)
+void NukiPublisher::publishULong(const MqttTopicId& topicId, const unsigned long value, bool retain)
 {
-    char str[value.size() + 1];
-    memset(str, 0, sizeof(str));
-    memcpy(str, value.data(), value.length());
-    publishString(topic, str, retain);
+    char str[30];
+    ultoa(value, str, 10);
+    publishString(topicId, str, retain);
+}
+
+void NukiPublisher::publishLongLong(const MqttTopicId& topicId, int64_t value, bool retain)
+{
+    char str[30];
+    lltoa(value, str, 10);
+    publishString(topicId, str, retain);
+}
+
+void NukiPublisher::publishBool(const MqttTopicId& topicId, const bool value, bool retain)
+{
+    char str[2] = {0};
+    str[0] = value ? '1' : '0';
+    publishString(topicId, str, retain);
+}
+
+void NukiPublisher::publishString(const MqttTopicId& topicId, const String &value, bool retain)
+{
+    publishString(topicId, value.c_str(), retain);
+}
+
+void NukiPublisher::publishString(const MqttTopicId& topicId, const std::string &value, bool retain)
+{
+    publishString(topicId, value.c_str(), retain);
+}
+
+void NukiPublisher::publishString(const MqttTopicId& topicId, const char *value, bool retain)
+{
+    const char* path = _topics.path(topicId);
+
+    if(path != nullptr)
+    {
+        _network->publish(path, value, retain);
+    }
 }
 
-void NukiPublisher::publishString(const char *topic, const char *value, bool retain)
+void NukiPublisher::publishInt(const String& topic, const int value, bool retain)
 {
-    _network->publishString(_mqttPath, topic, value, retain);
+    char str[30];
+    itoa(value, str, 10);
+    publishString(topic, str, retain);
 }
 
-void NukiPublisher::publishULong(const char *topic, const unsigned long value, bool retain)
+void NukiPublisher::publishBool(const String& topic, const bool value, bool retain)
 {
-    _network->publishULong(_mqttPath, topic, value, retain);
+    char str[2] = {0};
+    str[0] = value ? '1' : '0';
+    publishString(topic, str, retain);
 }
 
-void NukiPublisher::publishLongLong(const char *topic, int64_t value, bool retain)
+void NukiPublisher::publishString(const String& topic, const char *value, bool retain)
 {
-    _network->publishLongLong(_mqttPath, topic, value, retain);
+    _network->publishString(_mqttPath, topic.c_str(), value, retain);
 }
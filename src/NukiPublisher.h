@@ -2,24 +2,39 @@
 
 #include <cstdint>
 #include "NukiNetwork.h"
+#include "MqttTopicTable.h"
 
 class NukiPublisher
 {
 public:
     NukiPublisher(NukiNetwork* _network, const char* mqttPath);
 
-    void publishFloat(const char* topic, const float value, bool retain, const uint8_t precision = 2);
-    void publishInt(const char* topic, const int value, bool retain);
-    void publishUInt(const char* topic, const unsigned int value, bool retain);
-    void publishULong(const char* topic, const unsigned long value, bool retain);
-    void publishLongLong(const char* topic, int64_t value, bool retain);
-    void publishBool(const char* topic, const bool value, bool retain);
-    void publishString(const char* topic, const String& value, bool retain);
-    void publishString(const char* topic, const std::string& value, bool retain);
-    void publishString(const char* topic, const char* value, bool retain);
+    void initialize();
+    MqttTopicId topicId(const char* topic);
+
+    // topics from mqttTopicList, resolve them with MQTT_TOPIC_ID
+    void publishFloat(const MqttTopicId& topicId, const float value, bool retain, const uint8_t precision = 2);
+    void publishInt(const MqttTopicId& topicId, const int value, bool retain);
+    void publishUInt(const MqttTopicId& topicId, const unsigned int value, bool retain);
+    void publishULong(const MqttTopicId& topicId, const unsigned long value, bool retain);
+    void publishLongLong(const MqttTopicId& topicId, int64_t value, bool retain);
+    void publishBool(const MqttTopicId& topicId, const bool value, bool retain);
+    void publishString(const MqttTopicId& topicId, const String& value, bool retain);
+    void publishString(const MqttTopicId& topicId, const std::string& value, bool retain);
+    void publishString(const MqttTopicId& topicId, const char* value, bool retain);
+
+    // topics built at runtime, e.g. keypad and authorization entries
+    void publishInt(const String& topic, const int value, bool retain);
+    void publishBool(const String& topic, const bool value, bool retain);
+    void publishString(const String& topic, const char* value, bool retain);
+
+    // a topic literal has to be published through its MQTT_TOPIC_ID
+    void publishInt(const char* topic, const int value, bool retain) = delete;
+    void publishBool(const char* topic, const bool value, bool retain) = delete;
+    void publishString(const char* topic, const char* value, bool retain) = delete;
 
 private:
     NukiNetwork* _network;
     const char* _mqttPath;
-
+    MqttTopicTable _topics;
 };
@@ -1,7 +1,10 @@
 #include "NukiWrapper.h"
 #include "PreferencesKeys.h"
 #include "MqttTopics.h"
+#include "util/ScratchArena.h"
+#include "util/WriteBehindStore.h"
 #include "Logger.h"
+#include "LogEvents.h"
 #include "RestartReason.h"
 #include <NukiLockUtils.h>
 #include "Config.h"
@@ -14,7 +17,7 @@
 
 NukiWrapper* nukiInst = nullptr;
 
-NukiWrapper::NukiWrapper(const std::string& deviceName, NukiDeviceId* deviceId, BleScanner::Scanner* scanner, NukiNetworkLock* network, NukiOfficial* nukiOfficial, Gpio* gpio, Preferences* preferences, char* buffer, size_t bufferSize)
+NukiWrapper::NukiWrapper(const std::string& deviceName, NukiDeviceId* deviceId, BleScanner::Scanner* scanner, NukiNetworkLock* network, NukiOfficial* nukiOfficial, Gpio* gpio, Preferences* preferences, ConfigSnapshot* config)
     : _deviceName(deviceName),
       _deviceId(deviceId),
       _bleScanner(scanner),
@@ -23,8 +26,7 @@ NukiWrapper::NukiWrapper(const std::string& deviceName, NukiDeviceId* deviceId,
       _nukiOfficial(nukiOfficial),
       _gpio(gpio),
       _preferences(preferences),
-      _buffer(buffer),
-      _bufferSize(bufferSize)
+      _config(config)
 {
 
     Log->print("Device id lock: ");
@@ -224,12 +226,7 @@ void NukiWrapper::readSettings()
         _preferences->putInt(preference_restart_ble_beacon_lost, _restartBeaconTimeout);
     }
 
-    Log->print("Lock state interval: ");
-    Log->print(_intervalLockstate);
-    Log->print(" | Battery interval: ");
-    Log->print(_intervalBattery);
-    Log->print(" | Publish auth data: ");
-    Log->println(_publishAuthData ? "yes" : "no");
+    logEvent(LogEvent::LockIntervals, _intervalLockstate, _intervalBattery, _publishAuthData ? "yes" : "no");
 
     if(!_publishAuthData)
     {
@@ -284,9 +281,7 @@ void NukiWrapper::checkRestartByBeacon(const int64_t& ts)
         _disableBleWatchdogTs < ts &&
         (ts - lastReceivedBeaconTs > _restartBeaconTimeout * 1000))
     {
-        Log->print("No BLE beacon received from the lock for ");
-        Log->print((ts - lastReceivedBeaconTs) / 1000);
-        Log->println(" seconds, signalling to restart BLE controller.");
+        logEvent(LogEvent::LockBeaconLost, (ts - lastReceivedBeaconTs) / 1000);
         if (esp_task_wdt_status(NULL) == ESP_OK)
         {
             esp_task_wdt_reset();
@@ -303,6 +298,15 @@ void NukiWrapper::checkLockAction(const int64_t& ts)
         _nextLockAction = _offCommand;
         _nukiOfficial->clearOffCommandExecutedTs();
     }
+    if(_nextLockAction == (NukiLock::LockAction)0xff)
+    {
+        LockCommand command;
+        if(_commandQueue.pop(command))
+        {
+            _nextLockAction = command.action;
+            _commandReceivedUs = command.receivedUs;
+        }
+    }
     if(_nextLockAction != (NukiLock::LockAction)0xff)
     {
         int retryCount = 0;
@@ -328,6 +332,8 @@ void NukiWrapper::checkLockAction(const int64_t& ts)
             return cmdResult;
         });
 
+        trackCommandLatency();
+
         if(result == Nuki::CmdResult::Success)
         {
             _nextLockAction = (NukiLock::LockAction) 0xff;
@@ -354,6 +360,18 @@ void NukiWrapper::checkLockAction(const int64_t& ts)
     }
 }
 
+void NukiWrapper::trackCommandLatency()
+{
+    if(_commandReceivedUs == 0)
+    {
+        return;
+    }
+
+    _commandLatency.addSample(esp_timer_get_time() - _commandReceivedUs);
+    _commandReceivedUs = 0;
+    _network->publishCommandLatency(_commandLatency.last(), _commandLatency.percentile(50), _commandLatency.percentile(99));
+}
+
 void NukiWrapper::checkDoorSensorOverride()
 {
     _requestDoorSensorOverride = _requestDoorSensorOverride == DoorSensorOverride::NoOverride ? _network->getRequestDoorSensorOverride() : _requestDoorSensorOverride;
@@ -428,10 +446,10 @@ void NukiWrapper::checkQueries(const int64_t& ts, const uint8_t& queryCommands)
         _waitAuthUpdateTs = 0;
         updateAuth(true);
     }
-    if(_hassEnabled && _nukiConfigValid && _nukiAdvancedConfigValid && !_hassSetupCompleted)
+    if(_hassEnabled && _nukiConfigValid && _nukiAdvancedConfigValid && _hassSetupGeneration != _network->hassGeneration())
     {
+        _hassSetupGeneration = _network->hassGeneration();
         _network->setupHASS(1, _nukiConfig.nukiId, (char*)_nukiConfig.name, _firmwareVersion.c_str(), _hardwareVersion.c_str(), hasDoorSensor(), hasKeypad());
-        _hassSetupCompleted = true;
     }
     if(_rssiPublishInterval > 0 && (_nextRssiTs == 0 || ts > _nextRssiTs))
     {
@@ -450,7 +468,7 @@ void NukiWrapper::checkQueries(const int64_t& ts, const uint8_t& queryCommands)
         _nextKeypadUpdateTs = ts + _intervalKeypad * 1000;
         updateKeypad(false);
     }
-    if(_preferences->getBool(preference_update_time, false) && ts > (120 * 1000) && ts > _nextTimeUpdateTs)
+    if(_config->get()->updateTime && ts > (120 * 1000) && ts > _nextTimeUpdateTs)
     {
         _nextTimeUpdateTs = ts + (12 * 60 * 60 * 1000);
         updateTime();
@@ -481,6 +499,7 @@ void NukiWrapper::update(bool reboot)
         if(!_statusUpdated)
         {
             checkQueries(ts, queryCommands);
+            checkLockAction(espMillis());
         }
         if(_clearAuthData)
         {
@@ -505,6 +524,27 @@ void NukiWrapper::update(bool reboot)
     memcpy(&_lastKeyTurnerState, &_keyTurnerState, sizeof(NukiLock::KeyTurnerState));
 }
 
+const int64_t NukiWrapper::nextDeadline()
+{
+    SchedulerDeadlines deadlines;
+    deadlines.actionPending = !_paired || _nextLockAction != (NukiLock::LockAction)0xff || !_commandQueue.empty() || gpioAction != GpioAction::None || _requestDoorSensorOverride != DoorSensorOverride::NoOverride || _statusUpdated;
+    deadlines.mqttConnected = _network->mqttConnectionState() == 2;
+    deadlines.lockStateUpdateTs = _nextLockStateUpdateTs;
+    deadlines.offCommandExecutedTs = _nukiOfficial->getOffCommandExecutedTs();
+    deadlines.batteryReportTs = _nextBatteryReportTs;
+    deadlines.configUpdateTs = _nextConfigUpdateTs;
+    deadlines.waitAuthLogUpdateTs = _waitAuthLogUpdateTs;
+    deadlines.waitKeypadUpdateTs = _waitKeypadUpdateTs;
+    deadlines.waitTimeControlUpdateTs = _waitTimeControlUpdateTs;
+    deadlines.waitAuthUpdateTs = _waitAuthUpdateTs;
+    deadlines.rssiEnabled = _rssiPublishInterval > 0;
+    deadlines.rssiTs = _nextRssiTs;
+    deadlines.keypadEnabled = hasKeypad() && _keypadEnabled;
+    deadlines.keypadUpdateTs = _nextKeypadUpdateTs;
+
+    return TaskScheduler::nextDeadline(deadlines);
+}
+
 void NukiWrapper::lock()
 {
     _nextLockAction = NukiLock::LockAction::Lock;
@@ -532,7 +572,14 @@ void NukiWrapper::lockngounlatch()
 
 const bool NukiWrapper::isPinValid()
 {
-    return _preferences->getInt(preference_lock_pin_status, (int)NukiPinState::NotConfigured) == (int)NukiPinState::Valid;
+    return _config->get()->lockPinStatus == (int)NukiPinState::Valid;
+}
+
+void NukiWrapper::setPinStatus(const NukiPinState& pinStatus)
+{
+    ConfigValues config = _config->edit();
+    config.lockPinStatus = (int)pinStatus;
+    _config->commit(config);
 }
 
 void NukiWrapper::setPin(const uint16_t pin)
@@ -558,7 +605,7 @@ const uint32_t NukiWrapper::getUltraPin()
 void NukiWrapper::unpair()
 {
     _nukiLock.unPairNuki();
-    _preferences->remove(preference_lock_log_num);    
+    WriteBehindStore::get()->remove(preference_lock_log_num);
     Preferences nukiBlePref;
     nukiBlePref.begin("NukiHub", false);
     nukiBlePref.clear();
@@ -596,16 +643,14 @@ bool NukiWrapper::updateKeyTurnerState()
         postponeBleWatchdog();
         if(_retryLockstateCount < _nrOfRetries + 1)
         {
-            Log->print("Query lock state retrying in ");
-            Log->print(_retryDelay);
-            Log->println("ms");
+            logEvent(LogEvent::LockQueryRetry, _retryDelay);
             _nextLockStateUpdateTs = espMillis() + _retryDelay;
         }
         else
         {
             _nextLockStateUpdateTs = espMillis() + (_retryLockstateCount * 333);
         }
-        _network->publishKeyTurnerState(_keyTurnerState, _lastKeyTurnerState);
+        _network->publishKeyTurnerState(_keyTurnerState);
         return false;
     }
     else if (!_hasConnected)
@@ -649,7 +694,7 @@ bool NukiWrapper::updateKeyTurnerState()
             _nextLockStateUpdateTs = espMillis() + 60000;
         }
     }
-    _network->publishKeyTurnerState(_keyTurnerState, _lastKeyTurnerState);
+    _network->publishKeyTurnerState(_keyTurnerState);
 
     char lockStateStr[20];
     lockstateToString(lockState, lockStateStr);
@@ -692,11 +737,7 @@ void NukiWrapper::updateConfig()
         {
             char uidString[20];
             itoa(_nukiConfig.nukiId, uidString, 16);
-            Log->print("Saving Lock Nuki ID to preferences (");
-            Log->print(_nukiConfig.nukiId);
-            Log->print(" / ");
-            Log->print(uidString);
-            Log->println(")");
+            logEvent(LogEvent::LockSaveNukiId, _nukiConfig.nukiId, uidString);
             _preferences->putUInt(preference_nuki_id_lock, _nukiConfig.nukiId);
         }
 
@@ -718,7 +759,7 @@ void NukiWrapper::updateConfig()
                 updateAuth(false);
             }
 
-            const int pinStatus = _preferences->getInt(preference_lock_pin_status, (int)NukiPinState::NotConfigured);
+            const int pinStatus = _config->get()->lockPinStatus;
 
             Nuki::CmdResult result = (Nuki::CmdResult)-1;
 
@@ -732,7 +773,7 @@ void NukiWrapper::updateConfig()
                 Log->println("Nuki Lock PIN is invalid or not set");
                 if(pinStatus != 2)
                 {
-                    _preferences->putInt(preference_lock_pin_status, (int)NukiPinState::Invalid);
+                    setPinStatus(NukiPinState::Invalid);
                 }
             }
             else
@@ -740,7 +781,7 @@ void NukiWrapper::updateConfig()
                 Log->println("Nuki Lock PIN is valid");
                 if(pinStatus != 1)
                 {
-                    _preferences->putInt(preference_lock_pin_status, (int)NukiPinState::Valid);
+                    setPinStatus(NukiPinState::Valid);
                 }
             }
         }
@@ -959,7 +1000,7 @@ void NukiWrapper::updateAuthData(bool retrieved)
 
         result = _nukiRetryHandler->retryComm([&]()
         {
-            return _nukiLock.retrieveLogEntries(0, _preferences->getInt(preference_authlog_max_entries, MAX_AUTHLOG), 1, false);
+            return _nukiLock.retrieveLogEntries(0, _config->get()->authlogMaxEntries, 1, false);
         });
 
         NukiHelper::printCommandResult(result);
@@ -975,9 +1016,9 @@ void NukiWrapper::updateAuthData(bool retrieved)
             std::list<NukiLock::LogEntry> log;
             _nukiLock.getLogEntries(&log);
 
-            if(log.size() > _preferences->getInt(preference_authlog_max_entries, 3))
+            if(log.size() > _config->get()->authlogMaxEntries)
             {
-                log.resize(_preferences->getInt(preference_authlog_max_entries, 3));
+                log.resize(_config->get()->authlogMaxEntries);
             }
 
             log.sort([](const NukiLock::LogEntry& a, const NukiLock::LogEntry& b)
@@ -996,9 +1037,9 @@ void NukiWrapper::updateAuthData(bool retrieved)
         std::list<NukiLock::LogEntry> log;
         _nukiLock.getLogEntries(&log);
 
-        if(log.size() > _preferences->getInt(preference_authlog_max_entries, MAX_AUTHLOG))
+        if(log.size() > _config->get()->authlogMaxEntries)
         {
-            log.resize(_preferences->getInt(preference_authlog_max_entries, MAX_AUTHLOG));
+            log.resize(_config->get()->authlogMaxEntries);
         }
 
         log.sort([](const NukiLock::LogEntry& a, const NukiLock::LogEntry& b)
@@ -1175,7 +1216,7 @@ void NukiWrapper::updateAuth(bool retrieved)
 
         result = _nukiRetryHandler->retryComm([&]()
         {
-            return _nukiLock.retrieveAuthorizationEntries(0, _preferences->getInt(preference_auth_max_entries, MAX_AUTH));
+            return _nukiLock.retrieveAuthorizationEntries(0, _config->get()->authMaxEntries);
         });
 
         NukiHelper::printCommandResult(result);
@@ -1197,9 +1238,9 @@ void NukiWrapper::updateAuth(bool retrieved)
             return a.authId < b.authId;
         });
 
-        if(authEntries.size() > _preferences->getInt(preference_auth_max_entries, MAX_AUTH))
+        if(authEntries.size() > _config->get()->authMaxEntries)
         {
-            authEntries.resize(_preferences->getInt(preference_auth_max_entries, MAX_AUTH));
+            authEntries.resize(_config->get()->authMaxEntries);
         }
 
         uint authCount = authEntries.size();
@@ -1256,6 +1297,7 @@ LockActionResult NukiWrapper::onLockActionReceived(const char *value)
         return LockActionResult::UnknownAction;
     }
 
+    int64_t receivedUs = esp_timer_get_time();
     uint32_t aclPrefs[17];
     _preferences->getBytes(preference_acl, &aclPrefs, sizeof(aclPrefs));
 
@@ -1263,7 +1305,10 @@ LockActionResult NukiWrapper::onLockActionReceived(const char *value)
     {
         if(!_nukiOfficial->getOffConnected())
         {
-            nukiInst->_nextLockAction = action;
+            if(!_commandQueue.push({action, receivedUs}))
+            {
+                return LockActionResult::Failed;
+            }
         }
         else
         {
@@ -1276,11 +1321,12 @@ LockActionResult NukiWrapper::onLockActionReceived(const char *value)
                 }
                 _network->publishOffAction((int)action);
             }
-            else
+            else if(!_commandQueue.push({action, receivedUs}))
             {
-                nukiInst->_nextLockAction = action;
+                return LockActionResult::Failed;
             }
         }
+        TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_LOCK_ACTION);
         return LockActionResult::Success;
     }
 
@@ -1315,16 +1361,18 @@ void NukiWrapper::onConfigUpdateReceived(const char *value)
     if(!_nukiConfigValid)
     {
         jsonResult["general"] = "configNotReady";
-        serializeJson(jsonResult, _buffer, _bufferSize);
-        _network->publishConfigCommandResult(_buffer);
+        ScratchBuffer buffer(measureJson(jsonResult) + 1);
+        serializeJson(jsonResult, buffer.data(), buffer.size());
+        _network->publishConfigCommandResult(buffer.data());
         return;
     }
 
     if(!isPinValid())
     {
         jsonResult["general"] = "noValidPinSet";
-        serializeJson(jsonResult, _buffer, _bufferSize);
-        _network->publishConfigCommandResult(_buffer);
+        ScratchBuffer buffer(measureJson(jsonResult) + 1);
+        serializeJson(jsonResult, buffer.data(), buffer.size());
+        _network->publishConfigCommandResult(buffer.data());
         return;
     }
 
@@ -1334,8 +1382,9 @@ void NukiWrapper::onConfigUpdateReceived(const char *value)
     if(jsonError)
     {
         jsonResult["general"] = "invalidJson";
-        serializeJson(jsonResult, _buffer, _bufferSize);
-        _network->publishConfigCommandResult(_buffer);
+        ScratchBuffer buffer(measureJson(jsonResult) + 1);
+        serializeJson(jsonResult, buffer.data(), buffer.size());
+        _network->publishConfigCommandResult(buffer.data());
         return;
     }
 
@@ -2324,8 +2373,9 @@ void NukiWrapper::onConfigUpdateReceived(const char *value)
 
     _nextConfigUpdateTs = espMillis() + 300;
 
-    serializeJson(jsonResult, _buffer, _bufferSize);
-    _network->publishConfigCommandResult(_buffer);
+    ScratchBuffer buffer(measureJson(jsonResult) + 1);
+    serializeJson(jsonResult, buffer.data(), buffer.size());
+    _network->publishConfigCommandResult(buffer.data());
 
     return;
 }
@@ -2359,6 +2409,7 @@ void NukiWrapper::gpioActionCallback(const GpioAction &action, const int& pin)
 void NukiWrapper::onGpioActionReceived(const GpioAction &action)
 {
     gpioAction = action;
+    TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_GPIO);
 }
 
 void NukiWrapper::checkGpioAction()
@@ -3817,7 +3868,7 @@ void NukiWrapper::onAuthCommandReceived(const char *value)
                         return;
                     }
 
-                    Nuki::CmdResult resultAuth = _nukiLock.retrieveAuthorizationEntries(0, _preferences->getInt(preference_auth_max_entries, MAX_AUTH));
+                    Nuki::CmdResult resultAuth = _nukiLock.retrieveAuthorizationEntries(0, _config->get()->authMaxEntries);
                     bool foundExisting = false;
 
                     if(resultAuth == Nuki::CmdResult::Success)
@@ -4034,6 +4085,7 @@ void NukiWrapper::notify(Nuki::EventType eventType)
         {
             Log->println("OffKeyTurnerStatusUpdated");
             _statusUpdated = true;
+            TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_BLE);
         }
         else
         {
@@ -4051,11 +4103,12 @@ void NukiWrapper::notify(Nuki::EventType eventType)
                     _statusUpdated = true;
                     _statusUpdatedTs = espMillis();
                     _network->publishStatusUpdated(_statusUpdated);
+                    TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_BLE);
                 }
             }
             else if(eventType == Nuki::EventType::ERROR_BAD_PIN)
             {
-                _preferences->putInt(preference_lock_pin_status, (int)NukiPinState::Invalid);
+                setPinStatus(NukiPinState::Invalid);
             }
             else if(eventType == Nuki::EventType::BLE_ERROR_ON_DISCONNECT)
             {
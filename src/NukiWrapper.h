@@ -6,16 +6,20 @@
 #include "BleScanner.h"
 #include "NukiLock.h"
 #include "Gpio.h"
+#include "ConfigSnapshot.h"
 #include "LockActionResult.h"
 #include "NukiDeviceId.h"
 #include "NukiOfficial.h"
 #include "EspMillis.h"
 #include "util/NukiRetryHandler.h"
+#include "util/TaskScheduler.h"
+#include "util/SpscQueue.h"
+#include "util/LatencyTracker.h"
 
 class NukiWrapper : public Nuki::SmartlockEventHandler
 {
 public:
-    NukiWrapper(const std::string& deviceName, NukiDeviceId* deviceId, BleScanner::Scanner* scanner, NukiNetworkLock* network, NukiOfficial* nukiOfficial, Gpio* gpio, Preferences* preferences, char* buffer, size_t bufferSize);
+    NukiWrapper(const std::string& deviceName, NukiDeviceId* deviceId, BleScanner::Scanner* scanner, NukiNetworkLock* network, NukiOfficial* nukiOfficial, Gpio* gpio, Preferences* preferences, ConfigSnapshot* config);
     virtual ~NukiWrapper();
 
     void initialize();
@@ -45,6 +49,7 @@ public:
     const bool offConnected();
     const BLEAddress getBleAddress() const;
     const uint8_t restartController() const;
+    const int64_t nextDeadline();
 
     const std::string firmwareVersion() const;
     const std::string hardwareVersion() const;
@@ -53,6 +58,12 @@ public:
     void notify(Nuki::EventType eventType) override;
 
 private:
+    struct LockCommand
+    {
+        NukiLock::LockAction action;
+        int64_t receivedUs;
+    };
+
     static LockActionResult onLockActionReceivedCallback(const char* value);
     static void onOfficialUpdateReceivedCallback(const char* topic, const char* value);
     static void onConfigUpdateReceivedCallback(const char* value);
@@ -66,6 +77,7 @@ private:
     bool checkPaired();
     void checkRestartByBeacon(const int64_t& ts);
     void checkLockAction(const int64_t& ts);
+    void trackCommandLatency();
     void checkDoorSensorOverride();
     void checkLockStateUpdate(const int64_t& ts, const uint8_t& queryCommands);
     void checkQueries(const int64_t& ts, const uint8_t& queryCommands);
@@ -88,6 +100,7 @@ private:
     void updateTimeControl(bool retrieved);
     void updateAuth(bool retrieved);
     void postponeBleWatchdog();
+    void setPinStatus(const NukiPinState& pinStatus);
     void updateTime();
 
     void updateGpioOutputs();
@@ -105,6 +118,7 @@ private:
     NukiRetryHandler* _nukiRetryHandler = nullptr;
 
     Preferences* _preferences;
+    ConfigSnapshot* _config = nullptr;
     int _intervalLockstate = 0; // seconds
     int _intervalHybridLockstate = 0; // seconds
     int _intervalBattery = 0; // seconds
@@ -134,7 +148,7 @@ private:
     bool _nukiConfigValid = false;
     bool _nukiAdvancedConfigValid = false;
     bool _hassEnabled = false;
-    bool _hassSetupCompleted = false;
+    uint32_t _hassSetupGeneration = 0;
     bool _disableNonJSON = false;
     bool _pairedAsApp = false;
     bool _paired = false;
@@ -177,8 +191,9 @@ private:
     std::string _hardwareVersion = "";
     DoorSensorOverride _requestDoorSensorOverride = DoorSensorOverride::NoOverride;
     volatile NukiLock::LockAction _nextLockAction = (NukiLock::LockAction)0xff;
-    GpioAction gpioAction = GpioAction::None;
+    SpscQueue<LockCommand, 8> _commandQueue;
+    LatencyTracker _commandLatency;
+    int64_t _commandReceivedUs = 0;
+    volatile GpioAction gpioAction = GpioAction::None;
 
-    char* _buffer;
-    const size_t _bufferSize;
 };
@@ -0,0 +1,287 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include "PreferencesKeys.h"
+
+enum class PreferenceType : uint8_t
+{
+    String,
+    Bool,
+    Int,
+    UInt,
+    UInt64,
+    Bytes
+};
+
+enum class PreferenceApply : uint8_t
+{
+    Immediately,
+    ServicesReload,
+    Reboot,
+    Internal
+};
+
+#define PREFERENCE_FLAG_REDACT 1
+#define PREFERENCE_FLAG_NO_EXPORT 2
+#define PREFERENCE_FLAG_NO_IMPORT 4
+// login, MFA and bypass settings, only changed through the credentials form
+#define PREFERENCE_FLAG_CREDENTIAL 8
+
+struct PreferenceEntry
+{
+    const char* key;
+    PreferenceType type;
+    PreferenceApply apply;
+    uint8_t flags;
+    int64_t defaultValue;
+    const char* defaultString;
+};
+
+// export order, byte arrays last
+static constexpr PreferenceEntry preferenceRegistry[] =
+{
+    { preference_started_before, PreferenceType::Bool, PreferenceApply::Internal, 0, 0, "" },
+    { preference_config_version, PreferenceType::Int, PreferenceApply::Internal, 0, 0, "" },
+    { preference_device_id_lock, PreferenceType::UInt, PreferenceApply::Internal, 0, 0, "" },
+    { preference_device_id_opener, PreferenceType::UInt, PreferenceApply::Internal, 0, 0, "" },
+    { preference_nuki_id_lock, PreferenceType::UInt, PreferenceApply::Internal, PREFERENCE_FLAG_REDACT, 0, "" },
+    { preference_nuki_id_opener, PreferenceType::UInt, PreferenceApply::Internal, PREFERENCE_FLAG_REDACT, 0, "" },
+    { preference_mqtt_broker, PreferenceType::String, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_mqtt_broker_port, PreferenceType::Int, PreferenceApply::ServicesReload, 0, 1883, "" },
+    { preference_mqtt_user, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT, 0, "" },
+    { preference_mqtt_password, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT, 0, "" },
+    { preference_mqtt_log_enabled, PreferenceType::Bool, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_check_updates, PreferenceType::Bool, PreferenceApply::Immediately, 0, 1, "" },
+    { preference_webserver_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 1, "" },
+    { preference_lock_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 1, "" },
+    { preference_lock_pin_status, PreferenceType::Int, PreferenceApply::Internal, 0, 0, "" },
+    { preference_mqtt_lock_path, PreferenceType::String, PreferenceApply::ServicesReload, 0, 0, "nukihub" },
+    { preference_opener_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_opener_pin_status, PreferenceType::Int, PreferenceApply::Internal, 0, 0, "" },
+    { preference_opener_continuous_mode, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_lock_max_keypad_code_count, PreferenceType::Int, PreferenceApply::Internal, 0, 0, "" },
+    { preference_opener_max_keypad_code_count, PreferenceType::Int, PreferenceApply::Internal, 0, 0, "" },
+    { preference_update_time, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_time_server, PreferenceType::String, PreferenceApply::Reboot, 0, 0, "pool.ntp.org" },
+    { preference_lock_max_timecontrol_entry_count, PreferenceType::Int, PreferenceApply::Internal, 0, 0, "" },
+    { preference_opener_max_timecontrol_entry_count, PreferenceType::Int, PreferenceApply::Internal, 0, 0, "" },
+    { preference_enable_bootloop_reset, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_mqtt_hass_discovery, PreferenceType::String, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_mqtt_hass_cu_url, PreferenceType::String, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_buffer_size, PreferenceType::Int, PreferenceApply::Reboot, 0, CHAR_BUFFER_SIZE, "" },
+    { preference_ip_dhcp_enabled, PreferenceType::Bool, PreferenceApply::Reboot, 0, 1, "" },
+    { preference_ip_address, PreferenceType::String, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_ip_subnet, PreferenceType::String, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_ip_gateway, PreferenceType::String, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_ip_dns_server, PreferenceType::String, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_network_hardware, PreferenceType::Int, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_http_auth_type, PreferenceType::Int, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_lock_gemini_pin, PreferenceType::Int, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT, 0, "" },
+    { preference_rssi_publish_interval, PreferenceType::Int, PreferenceApply::Immediately, 0, 60, "" },
+    { preference_hostname, PreferenceType::String, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_network_timeout, PreferenceType::Int, PreferenceApply::Immediately, 0, 60, "" },
+    { preference_internet_check_hosts, PreferenceType::String, PreferenceApply::Reboot, 0, 0, "github.com" },
+    { preference_restart_on_disconnect, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_hybrid_reboot_on_disconnect, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_restart_ble_beacon_lost, PreferenceType::Int, PreferenceApply::Immediately, 0, 60, "" },
+    { preference_query_interval_lockstate, PreferenceType::Int, PreferenceApply::Immediately, 0, 1800, "" },
+    { preference_timecontrol_topic_per_entry, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_keypad_topic_per_entry, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_query_interval_configuration, PreferenceType::Int, PreferenceApply::Immediately, 0, 3600, "" },
+    { preference_query_interval_battery, PreferenceType::Int, PreferenceApply::Immediately, 0, 1800, "" },
+    { preference_query_interval_keypad, PreferenceType::Int, PreferenceApply::Immediately, 0, 1800, "" },
+    { preference_keypad_control_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_keypad_info_enabled, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_keypad_publish_code, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_timecontrol_control_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_timecontrol_info_enabled, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_conf_info_enabled, PreferenceType::Bool, PreferenceApply::Immediately, 0, 1, "" },
+    { preference_register_as_app, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_register_opener_as_app, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_command_nr_of_retries, PreferenceType::Int, PreferenceApply::Immediately, 0, 3, "" },
+    { preference_command_retry_delay, PreferenceType::Int, PreferenceApply::Immediately, 0, 100, "" },
+    { preference_cred_user, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_cred_password, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_disable_non_json, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_publish_authdata, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_publish_debug_info, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_mqtt_ssl_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_enable_debug_mode, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_official_hybrid_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_query_interval_hybrid_lockstate, PreferenceType::Int, PreferenceApply::Immediately, 0, 600, "" },
+    { preference_official_hybrid_actions, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_official_hybrid_retry, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_task_size_network, PreferenceType::Int, PreferenceApply::Reboot, 0, NETWORK_TASK_SIZE, "" },
+    { preference_task_size_nuki, PreferenceType::Int, PreferenceApply::Reboot, 0, NUKI_TASK_SIZE, "" },
+    { preference_authlog_max_entries, PreferenceType::Int, PreferenceApply::Immediately, 0, MAX_AUTHLOG, "" },
+    { preference_keypad_max_entries, PreferenceType::Int, PreferenceApply::Immediately, 0, MAX_KEYPAD, "" },
+    { preference_timecontrol_max_entries, PreferenceType::Int, PreferenceApply::Immediately, 0, MAX_TIMECONTROL, "" },
+    { preference_update_from_mqtt, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_show_secrets, PreferenceType::Bool, PreferenceApply::Immediately, PREFERENCE_FLAG_NO_EXPORT | PREFERENCE_FLAG_NO_IMPORT, 0, "" },
+    { preference_ble_tx_power, PreferenceType::Int, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_webserial_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_find_best_rssi, PreferenceType::Bool, PreferenceApply::Immediately, 0, 1, "" },
+    { preference_lock_gemini_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_network_custom_mdc, PreferenceType::Int, PreferenceApply::Reboot, 0, -1, "" },
+    { preference_network_custom_clk, PreferenceType::Int, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_network_custom_phy, PreferenceType::Int, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_network_custom_addr, PreferenceType::Int, PreferenceApply::Reboot, 0, -1, "" },
+    { preference_network_custom_irq, PreferenceType::Int, PreferenceApply::Reboot, 0, -1, "" },
+    { preference_network_custom_rst, PreferenceType::Int, PreferenceApply::Reboot, 0, -1, "" },
+    { preference_network_custom_cs, PreferenceType::Int, PreferenceApply::Reboot, 0, -1, "" },
+    { preference_network_custom_sck, PreferenceType::Int, PreferenceApply::Reboot, 0, -1, "" },
+    { preference_network_custom_miso, PreferenceType::Int, PreferenceApply::Reboot, 0, -1, "" },
+    { preference_network_custom_mosi, PreferenceType::Int, PreferenceApply::Reboot, 0, -1, "" },
+    { preference_network_custom_pwr, PreferenceType::Int, PreferenceApply::Reboot, 0, -1, "" },
+    { preference_network_custom_mdio, PreferenceType::Int, PreferenceApply::Reboot, 0, -1, "" },
+    { preference_lock_max_auth_entry_count, PreferenceType::UInt, PreferenceApply::Internal, 0, 0, "" },
+    { preference_opener_max_auth_entry_count, PreferenceType::UInt, PreferenceApply::Internal, 0, 0, "" },
+    { preference_auth_control_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_auth_topic_per_entry, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_auth_info_enabled, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_wifi_ssid, PreferenceType::String, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_wifi_pass, PreferenceType::String, PreferenceApply::Reboot, PREFERENCE_FLAG_REDACT, 0, "" },
+    { preference_keypad_check_code_enabled, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_disable_network_not_connected, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_mqtt_hass_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_hass_device_discovery, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_retain_gpio, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_debug_connect, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_debug_communication, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_debug_readable_data, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_debug_hex_data, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_debug_command, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_lock_force_id, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_lock_force_doorsensor, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_lock_force_keypad, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_opener_force_id, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_opener_force_keypad, PreferenceType::Bool, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_nukihub_id, PreferenceType::UInt64, PreferenceApply::Internal, 0, 0, "" },
+    { preference_cred_duo_host, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_cred_duo_ikey, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_cred_duo_skey, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_cred_duo_user, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_cred_duo_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_https_fqdn, PreferenceType::String, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_bypass_proxy, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_cred_session_lifetime, PreferenceType::Int, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, 3600, "" },
+    { preference_cred_session_lifetime_remember, PreferenceType::Int, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, 720, "" },
+    { preference_cred_session_lifetime_duo, PreferenceType::Int, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, 3600, "" },
+    { preference_cred_session_lifetime_duo_remember, PreferenceType::Int, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, 720, "" },
+    { preference_cred_duo_approval, PreferenceType::Bool, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_cred_bypass_boot_btn_enabled, PreferenceType::Bool, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_cred_bypass_gpio_high, PreferenceType::Int, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, -1, "" },
+    { preference_cred_bypass_gpio_low, PreferenceType::Int, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, -1, "" },
+    { preference_publish_config, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_config_from_mqtt, PreferenceType::Bool, PreferenceApply::ServicesReload, 0, 0, "" },
+    { preference_totp_secret, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_NO_EXPORT | PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_cred_session_lifetime_totp, PreferenceType::Int, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, 3600, "" },
+    { preference_cred_session_lifetime_totp_remember, PreferenceType::Int, PreferenceApply::ServicesReload, PREFERENCE_FLAG_CREDENTIAL, 720, "" },
+    { preference_bypass_secret, PreferenceType::String, PreferenceApply::ServicesReload, PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_NO_EXPORT | PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_admin_secret, PreferenceType::String, PreferenceApply::Immediately, PREFERENCE_FLAG_REDACT | PREFERENCE_FLAG_NO_EXPORT | PREFERENCE_FLAG_CREDENTIAL, 0, "" },
+    { preference_ble_general_timeout, PreferenceType::Int, PreferenceApply::ServicesReload, 0, 10000, "" },
+    { preference_ble_command_timeout, PreferenceType::Int, PreferenceApply::ServicesReload, 0, 3000, "" },
+    { preference_force_hosted_update, PreferenceType::Bool, PreferenceApply::Reboot, 0, 0, "" },
+    { preference_acl, PreferenceType::Bytes, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_conf_lock_basic_acl, PreferenceType::Bytes, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_conf_lock_advanced_acl, PreferenceType::Bytes, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_conf_opener_basic_acl, PreferenceType::Bytes, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_conf_opener_advanced_acl, PreferenceType::Bytes, PreferenceApply::Immediately, 0, 0, "" },
+    { preference_gpio_configuration, PreferenceType::Bytes, PreferenceApply::Reboot, 0, 0, "" },
+};
+
+static constexpr size_t PREFERENCE_REGISTRY_SIZE = sizeof(preferenceRegistry) / sizeof(preferenceRegistry[0]);
+static constexpr size_t PREFERENCE_INDEX_SIZE = 512;
+
+struct PreferenceIndex
+{
+    int16_t slots[PREFERENCE_INDEX_SIZE];
+};
+
+constexpr uint32_t preferenceKeyHash(const char* key)
+{
+    // FNV-1a
+    uint32_t value = 2166136261u;
+
+    while(*key != 0)
+    {
+        value ^= (uint8_t)*key;
+        value *= 16777619u;
+        ++key;
+    }
+
+    return value;
+}
+
+constexpr bool preferenceKeyEquals(const char* a, const char* b)
+{
+    while(*a != 0 && *a == *b)
+    {
+        ++a;
+        ++b;
+    }
+
+    return *a == *b;
+}
+
+constexpr bool preferenceKeysUnique()
+{
+    for(size_t i = 0; i < PREFERENCE_REGISTRY_SIZE; i++)
+    {
+        for(size_t j = i + 1; j < PREFERENCE_REGISTRY_SIZE; j++)
+        {
+            if(preferenceKeyEquals(preferenceRegistry[i].key, preferenceRegistry[j].key))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+constexpr PreferenceIndex buildPreferenceIndex()
+{
+    PreferenceIndex index{};
+
+    for(size_t i = 0; i < PREFERENCE_INDEX_SIZE; i++)
+    {
+        index.slots[i] = -1;
+    }
+
+    for(size_t i = 0; i < PREFERENCE_REGISTRY_SIZE; i++)
+    {
+        size_t slot = preferenceKeyHash(preferenceRegistry[i].key) & (PREFERENCE_INDEX_SIZE - 1);
+        while(index.slots[slot] != -1)
+        {
+            slot = (slot + 1) & (PREFERENCE_INDEX_SIZE - 1);
+        }
+        index.slots[slot] = i;
+    }
+
+    return index;
+}
+
+static constexpr PreferenceIndex preferenceIndex = buildPreferenceIndex();
+
+static_assert(PREFERENCE_REGISTRY_SIZE * 2 <= PREFERENCE_INDEX_SIZE, "Preference index too small");
+static_assert(preferenceKeysUnique(), "Duplicate NVS key in preference registry");
+
+inline const PreferenceEntry* findPreference(const char* key)
+{
+    size_t slot = preferenceKeyHash(key) & (PREFERENCE_INDEX_SIZE - 1);
+
+    while(preferenceIndex.slots[slot] != -1)
+    {
+        const PreferenceEntry& entry = preferenceRegistry[preferenceIndex.slots[slot]];
+        if(strcmp(entry.key, key) == 0)
+        {
+            return &entry;
+        }
+        slot = (slot + 1) & (PREFERENCE_INDEX_SIZE - 1);
+    }
+
+    return nullptr;
+}
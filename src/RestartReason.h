@@ -1,5 +1,7 @@
 #pragma once
 
+#include "util/WriteBehindStore.h"
+
 enum class RestartReason
 {
     RequestedViaMqtt,
@@ -47,6 +49,10 @@ inline static void restartEsp(RestartReason reason)
     }
     restartReason = (int)reason;
     restartReasonValidDetect = RESTART_REASON_VALID_DETECT;
+    if(WriteBehindStore::get() != nullptr)
+    {
+        WriteBehindStore::get()->flush();
+    }
     ESP.restart();
 }
 
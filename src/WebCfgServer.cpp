@@ -1,9 +1,11 @@
 #include "WebCfgServer.h"
 #include "WebCfgServerConstants.h"
 #include "PreferencesKeys.h"
+#include "PreferencesRegistry.h"
 #include "Logger.h"
 #include "RestartReason.h"
 #include "util/CertUtil.h"
+#include "util/WriteBehindStore.h"
 #include <esp_task_wdt.h>
 #include "FS.h"
 #include "SPIFFS.h"
@@ -21,8 +23,6 @@
 #include <Update.h>
 #include "driver/gpio.h"
 
-extern const uint8_t x509_crt_imported_bundle_bin_start[] asm("_binary_x509_crt_bundle_start");
-extern const uint8_t x509_crt_imported_bundle_bin_end[]   asm("_binary_x509_crt_bundle_end");
 extern bool timeSynced;
 
 #if defined(CONFIG_ESP_HOSTED_ENABLE_BT_NIMBLE) || defined(CONFIG_ESP_WIFI_REMOTE_ENABLED)
@@ -40,8 +40,7 @@ static esp_hosted_coprocessor_fwver_t host_version_struct = {
 #endif
 
 #ifndef NUKI_HUB_UPDATER
-#include <HTTPClient.h>
-#include <NetworkClientSecure.h>
+#include "util/OtaManifestFetcher.h"
 #include "ArduinoJson.h"
 #include <freertos/queue.h>
 
@@ -54,12 +53,13 @@ typedef struct
 
 QueueHandle_t wsMessages;
 
-WebCfgServer::WebCfgServer(NukiWrapper* nuki, NukiOpenerWrapper* nukiOpener, NukiNetwork* network, Gpio* gpio, Preferences* preferences, bool allowRestartToPortal, uint8_t partitionType, PsychicHttpServer* psychicServer, ImportExport* importExport)
+WebCfgServer::WebCfgServer(NukiWrapper* nuki, NukiOpenerWrapper* nukiOpener, NukiNetwork* network, Gpio* gpio, Preferences* preferences, ConfigSnapshot* config, bool allowRestartToPortal, uint8_t partitionType, PsychicHttpServer* psychicServer, ImportExport* importExport)
     : _nuki(nuki),
       _nukiOpener(nukiOpener),
       _network(network),
       _gpio(gpio),
       _preferences(preferences),
+      _config(config),
       _allowRestartToPortal(allowRestartToPortal),
       _partitionType(partitionType),
       _psychicServer(psychicServer),
@@ -121,26 +121,31 @@ WebCfgServer::WebCfgServer(NukiNetwork* network, Preferences* preferences, bool
 
 bool WebCfgServer::isAuthenticated(PsychicRequest *request, int type)
 {
-    String cookieKey = "sessionId";
+    const char* cookieKey = "sessionId";
+    SessionTable* sessions = &_httpSessions;
 
     if (type == 1)
     {
         cookieKey = "duoId";
+        sessions = &_importExport->_duoSessions;
     }
     else if (type == 2)
     {
         cookieKey = "totpId";
+        sessions = &_importExport->_totpSessions;
     }
     else if (type == 3)
     {
         cookieKey = "bypassId";
+        sessions = &_importExport->_bypassSessions;
     }
 
-    if (request->hasCookie(cookieKey.c_str()))
+    if (request->hasCookie(cookieKey))
     {
-        String cookie = request->getCookie(cookieKey.c_str());
+        String cookie = request->getCookie(cookieKey);
+        int64_t expiry = 0;
 
-        if ((type == 0 && _httpSessions[cookie].is<JsonVariant>()) || (type == 1 && _importExport->_duoSessions[cookie].is<JsonVariant>()) || (type == 2 && _importExport->_totpSessions[cookie].is<JsonVariant>()) || (type == 3 && _importExport->_bypassSessions[cookie].is<JsonVariant>()))
+        if (sessions->find(cookie.c_str(), expiry))
         {
             struct timeval time;
             gettimeofday(&time, NULL);
@@ -151,13 +156,14 @@ bool WebCfgServer::isAuthenticated(PsychicRequest *request, int type)
                 time_us = (int64_t)time.tv_sec * 1000000L + (int64_t)time.tv_usec;
             }
 
-            if ((type == 0 && _httpSessions[cookie].as<signed long long>() > time_us) || (type == 1 && _importExport->_duoSessions[cookie].as<signed long long>() > time_us) || (type == 2 && _importExport->_totpSessions[cookie].as<signed long long>() > time_us) || (type == 3 && _importExport->_bypassSessions[cookie].as<signed long long>() > time_us))
+            if (expiry > time_us)
             {
                 return true;
             }
             else
             {
                 Log->println("Cookie found, but not valid anymore");
+                sessions->remove(cookie.c_str());
             }
         }
     }
@@ -180,8 +186,8 @@ esp_err_t WebCfgServer::logoutSession(PsychicRequest *request, PsychicResponse*
     if (request->hasCookie("sessionId"))
     {
         String cookie = request->getCookie("sessionId");
-        _httpSessions.remove(cookie);
-        saveSessions();
+        _httpSessions.remove(cookie.c_str());
+        saveSessions(0, true);
     }
     else
     {
@@ -202,8 +208,8 @@ esp_err_t WebCfgServer::logoutSession(PsychicRequest *request, PsychicResponse*
         if (request->hasCookie("duoId"))
         {
             String cookie2 = request->getCookie("duoId");
-            _importExport->_duoSessions.remove(cookie2);
-            saveSessions(1);
+            _importExport->_duoSessions.remove(cookie2.c_str());
+            saveSessions(1, true);
         }
         else
         {
@@ -225,8 +231,8 @@ esp_err_t WebCfgServer::logoutSession(PsychicRequest *request, PsychicResponse*
         if (request->hasCookie("totpId"))
         {
             String cookie2 = request->getCookie("totpId");
-            _importExport->_totpSessions.remove(cookie2);
-            saveSessions(2);
+            _importExport->_totpSessions.remove(cookie2.c_str());
+            saveSessions(2, true);
         }
         else
         {
@@ -248,41 +254,28 @@ esp_err_t WebCfgServer::logoutSession(PsychicRequest *request, PsychicResponse*
         if (request->hasCookie("bypassId"))
         {
             String cookie2 = request->getCookie("bypassId");
-            _importExport->_bypassSessions.remove(cookie2);
+            _importExport->_bypassSessions.remove(cookie2.c_str());
         }
     }
 
     return buildConfirmHtml(request, resp, "Logging out", 3, true);
 }
 
-void WebCfgServer::saveSessions(int type)
+void WebCfgServer::saveSessions(int type, bool urgent)
 {
     if(_preferences->getBool(preference_update_time, false))
     {
-        if (!SPIFFS.begin(true))
+        if (type == 0)
         {
-            Log->println("SPIFFS Mount Failed");
+            WriteBehindStore::get()->writeFile("/sessions.bin", _httpSessions.snapshot(), urgent);
         }
-        else
+        else if (type == 1)
         {
-            File file;
-
-            if (type == 0)
-            {
-                file = SPIFFS.open("/sessions.json", "w");
-                serializeJson(_httpSessions, file);
-            }
-            else if (type == 1)
-            {
-                file = SPIFFS.open("/duosessions.json", "w");
-                serializeJson(_importExport->_duoSessions, file);
-            }
-            else if (type == 2)
-            {
-                file = SPIFFS.open("/totpsessions.json", "w");
-                serializeJson(_importExport->_totpSessions, file);
-            }
-            file.close();
+            WriteBehindStore::get()->writeFile("/duosessions.bin", _importExport->_duoSessions.snapshot(), urgent);
+        }
+        else if (type == 2)
+        {
+            WriteBehindStore::get()->writeFile("/totpsessions.bin", _importExport->_totpSessions.snapshot(), urgent);
         }
     }
 }
@@ -297,74 +290,77 @@ void WebCfgServer::loadSessions(int type)
         }
         else
         {
-            File file;
+            const char* path = "/sessions.bin";
+            const char* legacyPath = "/sessions.json";
+            SessionTable* sessions = &_httpSessions;
 
-            if (type == 0)
+            if (type == 1)
             {
-                file = SPIFFS.open("/sessions.json", "r");
-
-                if (!file || file.isDirectory())
-                {
-                    Log->println("sessions.json not found");
-                }
-                else
-                {
-                    deserializeJson(_httpSessions, file);
-                }
+                path = "/duosessions.bin";
+                legacyPath = "/duosessions.json";
+                sessions = &_importExport->_duoSessions;
+            }
+            else if (type == 2)
+            {
+                path = "/totpsessions.bin";
+                legacyPath = "/totpsessions.json";
+                sessions = &_importExport->_totpSessions;
             }
-            else if (type == 1)
+
+            File file = SPIFFS.open(path, "r");
+
+            if (file && !file.isDirectory())
             {
-                file = SPIFFS.open("/duosessions.json", "r");
+                size_t length = file.size();
+                uint8_t* data = (uint8_t*)malloc(length);
 
-                if (!file || file.isDirectory())
+                if (data != nullptr && file.read(data, length) == length && sessions->restore(data, length))
                 {
-                    Log->println("duosessions.json not found");
+                    sessions->removeExpired(timeSynced ? (int64_t)time(nullptr) * 1000000L : 0);
                 }
                 else
                 {
-                    deserializeJson(_importExport->_duoSessions, file);
+                    Log->print("Invalid session snapshot ");
+                    Log->println(path);
                 }
+                free(data);
+                file.close();
             }
-            else if (type == 2)
+            else if (SPIFFS.exists(legacyPath))
             {
-                file = SPIFFS.open("/totpsessions.json", "r");
+                // sessions saved as JSON by earlier versions
+                file = SPIFFS.open(legacyPath, "r");
+                JsonDocument json;
 
-                if (!file || file.isDirectory())
+                if (deserializeJson(json, file) == DeserializationError::Ok)
                 {
-                    Log->println("totpsessions.json not found");
-                }
-                else
-                {
-                    deserializeJson(_importExport->_totpSessions, file);
+                    for (JsonPair kv : json.as<JsonObject>())
+                    {
+                        sessions->add(kv.key().c_str(), kv.value().as<int64_t>());
+                    }
                 }
+                file.close();
+                SPIFFS.remove(legacyPath);
+                saveSessions(type);
+            }
+            else
+            {
+                Log->print(path + 1);
+                Log->println(" not found");
             }
-            file.close();
         }
     }
 }
 
 void WebCfgServer::clearSessions()
 {
-    if (!SPIFFS.begin(true))
-    {
-        Log->println("SPIFFS Mount Failed");
-    }
-    else
-    {
-        _httpSessions.clear();
-        _importExport->_duoSessions.clear();
-        _importExport->_totpSessions.clear();
-        File file;
-        file = SPIFFS.open("/sessions.json", "w");
-        serializeJson(_httpSessions, file);
-        file.close();
-        file = SPIFFS.open("/duosessions.json", "w");
-        serializeJson(_importExport->_duoSessions, file);
-        file.close();
-        file = SPIFFS.open("/totpsessions.json", "w");
-        serializeJson(_importExport->_totpSessions, file);
-        file.close();
-    }
+    _httpSessions.clear();
+    _importExport->_duoSessions.clear();
+    _importExport->_totpSessions.clear();
+    String content = _httpSessions.snapshot();
+    WriteBehindStore::get()->writeFile("/sessions.bin", content, true);
+    WriteBehindStore::get()->writeFile("/duosessions.bin", content, true);
+    WriteBehindStore::get()->writeFile("/totpsessions.bin", content, true);
 }
 
 int WebCfgServer::doAuthentication(PsychicRequest *request)
@@ -450,261 +446,631 @@ int WebCfgServer::doAuthentication(PsychicRequest *request)
     return 4;
 }
 
-void WebCfgServer::initialize()
+constexpr WebRoute WebCfgServer::_getRoutes[] =
 {
-    //_psychicServer->onOpen([&](PsychicClient* client) { Log->printf("[http] connection #%u connected from %s\n", client->socket(), client->localIP().toString().c_str()); });
-    //_psychicServer->onClose([&](PsychicClient* client) { Log->printf("[http] connection #%u closed from %s\n", client->socket(), client->localIP().toString().c_str()); });
+    { "login", WebAuthLevel::None, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildLoginHtml(request, resp); } },
+    { "totp", WebAuthLevel::TotpPending, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildTOTPHtml(request, resp, 0); } },
+    { "bypass", WebAuthLevel::None, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildBypassHtml(request, resp); } },
+    { "newbypass", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildNewBypassHtml(request, resp); } },
+    { "logout", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->logoutSession(request, resp); } },
+    { "duoauth", WebAuthLevel::DuoPending, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildDuoHtml(request, resp, 0); } },
+    { "duocheck", WebAuthLevel::None, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildDuoCheckHtml(request, resp); } },
+    { "coredump", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildCoredumpHtml(request, resp); } },
+    { "reboot", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processReboot(request, resp, false); } },
+#ifndef NUKI_HUB_UPDATER
+    { "restartservices", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processRestartServices(request, resp); } },
+    { "info", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildInfoHtml(request, resp); } },
+    { "debugon", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processDebugMode(request, resp, true); } },
+    { "debugoff", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processDebugMode(request, resp, false); } },
+    { "export", WebAuthLevel::User, WebCachePolicy::NoStore, WEB_ROUTE_ADMIN_KEY, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processExport(request, resp, adminKeyValid); } },
+    { "impexpcfg", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildImportExportHtml(request, resp); } },
+    { "status", WebAuthLevel::StatusJson, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildStatusHtml(request, resp); } },
+    { "acclvl", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildAccLvlHtml(request, resp); } },
+    { "custntw", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildCustomNetworkConfigHtml(request, resp); } },
+    { "advanced", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildAdvancedConfigHtml(request, resp); } },
+    { "cred", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildCredHtml(request, resp); } },
+    { "ntwconfig", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildNetworkConfigHtml(request, resp); } },
+    { "mqttconfig", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildMqttConfigHtml(request, resp); } },
+    { "mqttcaconfig", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildMqttSSLConfigHtml(request, resp, 0); } },
+    { "mqttcrtconfig", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildMqttSSLConfigHtml(request, resp, 1); } },
+    { "mqttkeyconfig", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildMqttSSLConfigHtml(request, resp, 2); } },
+    { "httpcrtconfig", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildHttpSSLConfigHtml(request, resp, 1); } },
+    { "httpkeyconfig", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildHttpSSLConfigHtml(request, resp, 2); } },
+    { "selfsignhttps", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildHttpSSLConfigHtml(request, resp, 3); } },
+    { "nukicfg", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildNukiConfigHtml(request, resp); } },
+    { "gpiocfg", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildGpioConfigHtml(request, resp); } },
+    { "settingsapp", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->sendSettingsApp(request, resp); } },
+#ifndef CONFIG_IDF_TARGET_ESP32H2
+    { "wifi", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildConfigureWifiHtml(request, resp); } },
+    { "wifimanager", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processWifiManager(request, resp); } },
+#endif
+#endif
+    { "ota", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildOtaHtml(request, resp); } },
+    { "otadebug", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildOtaHtml(request, resp); } },
+    { "reboottoota", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processReboot(request, resp, true); } },
+#ifndef NUKI_HUB_UPDATER
+    { "autoupdate", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processUpdate(request, resp); } },
+#endif
+};
 
-    _psychicServer->on("/style.css", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
-    {
-        return sendCss(request, resp);
-    });
+constexpr WebRoute WebCfgServer::_postRoutes[] =
+{
+    { "login", WebAuthLevel::None, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processLoginPost(request, resp, 0); } },
+    { "totp", WebAuthLevel::None, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processLoginPost(request, resp, 2); } },
+    { "bypass", WebAuthLevel::None, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processLoginPost(request, resp, 3); } },
+#ifndef NUKI_HUB_UPDATER
+    { "savecfg", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processSaveConfig(request, resp); } },
+    { "savegpiocfg", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processSaveGpioConfig(request, resp); } },
+    { "unpairlock", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processUnpair(request, resp, false); } },
+    { "unpairopener", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processUnpair(request, resp, true); } },
+    { "factoryreset", WebAuthLevel::User, WebCachePolicy::NoStore, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processFactoryReset(request, resp); } },
+    { "import", WebAuthLevel::User, WebCachePolicy::NoStore, WEB_ROUTE_ADMIN_KEY, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->processImportPost(request, resp, adminKeyValid); } },
+#endif
+};
 
+constexpr WebRoute WebCfgServer::_getFallbackRoute = { "", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid)
+{
+    Log->println("Page not found, loading index");
+    resp->setCode(302);
+    resp->addHeader("Cache-Control", "no-cache");
+    return resp->redirect("/");
+} };
 
-    if(_preferences->getBool(preference_webserial_enabled, false))
-    {
-#ifndef NUKI_HUB_UPDATER
-        if (websocketHandler == nullptr)
-        {
-            websocketHandler = new PsychicWebSocketHandler;
-        }
+constexpr WebRoute WebCfgServer::_postFallbackRoute = { "", WebAuthLevel::User, WebCachePolicy::Default, 0, [](WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid) { return server->buildIndexHtml(request, resp); } };
 
-        _psychicServer->on("/webserial", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
-        {
-            int authReq = doAuthentication(request);
+constexpr PerfectHashTable<WEB_GET_ROUTE_SLOTS> WebCfgServer::_getRouteIndex = buildPerfectHash<WEB_GET_ROUTE_SLOTS>(_getRoutes, [](const WebRoute& route) { return route.page; });
+constexpr PerfectHashTable<WEB_POST_ROUTE_SLOTS> WebCfgServer::_postRouteIndex = buildPerfectHash<WEB_POST_ROUTE_SLOTS>(_postRoutes, [](const WebRoute& route) { return route.page; });
 
-            switch (authReq)
-            {
-            case 0:
-                return request->requestAuthentication(BASIC_AUTH, "Nuki Hub", "You must log in.");
-                break;
-            case 1:
-                return request->requestAuthentication(DIGEST_AUTH, "Nuki Hub", "You must log in.");
-                break;
-            case 2:
-                resp->setCode(302);
-                resp->addHeader("Cache-Control", "no-cache");
-                return resp->redirect("/get?page=login");
-                break;
-            case 3:
-            case 5:
-            case 4:
-            default:
-                break;
-            }
+const WebRoute* WebCfgServer::findRoute(const char* page, const bool post) const
+{
+    static_assert(_getRouteIndex.valid && _postRouteIndex.valid, "No collision free seed found for the web routes, increase WEB_GET_ROUTE_SLOTS or WEB_POST_ROUTE_SLOTS");
 
-            return sendWebSerial(request, resp);
-        });
+    int index = post ? perfectHashCandidate(_postRouteIndex, page) : perfectHashCandidate(_getRouteIndex, page);
 
-        //prepare our message queue of 10 messages
-        wsMessages = xQueueCreate(10, sizeof(WebsocketMessage));
-        if (wsMessages == 0)
+    if(index >= 0)
+    {
+        const WebRoute* route = post ? &_postRoutes[index] : &_getRoutes[index];
+        if(strcmp(route->page, page) == 0)
         {
-            Log->printf("Failed to create queue= %p\n", wsMessages);
+            return route;
         }
+    }
+    return post ? &_postFallbackRoute : &_getFallbackRoute;
+}
 
-        websocketHandler->onOpen([](PsychicWebSocketClient *client)
-        {
-            Log->printf("[socket] connection #%u connected from %s\n", client->socket(), client->remoteIP().toString());
-            client->sendMessage("NukiHub WebSerial started");
-        });
-        websocketHandler->onFrame([](PsychicWebSocketRequest *request, httpd_ws_frame *frame)
-        {
-            if(strcmp((char *)frame->payload, "ping") == 0)
-            {
-                WebsocketMessage wm;
-                wm.socket = request->client()->socket();
-                wm.len = frame->len;
-                wm.buffer = (char *)malloc(frame->len);
-
-                if (wm.buffer == NULL)
-                {
-                    Log->printf("Queue message: unable to allocate %d bytes\n", frame->len);
-                    return ESP_FAIL;
-                }
-
-                memcpy(wm.buffer, "pong", frame->len);
-
-                if (xQueueSend(wsMessages, &wm, 1) != pdTRUE)
-                {
-                    Log->printf("[socket] queue full #%d\n", wm.socket);
-                    free(wm.buffer);
-                }
+bool WebCfgServer::checkAdminKey(PsychicRequest *request)
+{
+    if(!timeSynced || !request->hasParam("adminkey") || !request->hasParam("totpkey") || !_importExport->getTOTPEnabled())
+    {
+        return false;
+    }
 
-                if (!uxQueueSpacesAvailable(wsMessages))
-                {
-                    return request->reply("Queue Full");
-                }
-            }
-            else
-            {
-                Log->printf("[socket] #%d sent: %s\n", request->client()->socket(), (char *)frame->payload);
-            }
-            return ESP_OK;
-        });
-        websocketHandler->onClose([](PsychicWebSocketClient *client)
-        {
-            Log->printf("[socket] connection #%u closed from %s\n", client->socket(), client->remoteIP().toString());
-        });
+    String adminKey = request->getParam("adminkey")->value();
+    String totpKey = request->getParam("totpkey")->value();
 
-        _psychicServer->on("/ws", websocketHandler);
-#endif
+    return adminKey.length() > 0 && adminKey == _preferences->getString(preference_admin_secret, "") && _importExport->checkTOTP(&totpKey);
+}
 
+esp_err_t WebCfgServer::dispatchPage(PsychicRequest *request, PsychicResponse* resp, const bool post)
+{
+    String page = "";
+    if(request->hasParam("page"))
+    {
+        page = request->getParam("page")->value();
     }
 
-    _psychicServer->on("/favicon.ico", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
-    {
-        return sendFavicon(request, resp);
-    });
+    const WebRoute* route = findRoute(page.c_str(), post);
+    bool adminKeyValid = (route->flags & WEB_ROUTE_ADMIN_KEY) != 0 && checkAdminKey(request);
 
-    if(_network->isApOpen())
+    if(route->auth == WebAuthLevel::StatusJson)
     {
-#ifndef CONFIG_IDF_TARGET_ESP32H2
-        _psychicServer->on("/get", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
+        if (doAuthentication(request) != 4)
         {
-            String value = "";
-            if(request->hasParam("page"))
-            {
-                const PsychicWebParameter* p = request->getParam("page");
-                if(p->value() != "")
-                {
-                    value = p->value();
-                }
-            }
-            if (value != "login")
-            {
-                int authReq = doAuthentication(request);
+            resp->setCode(200);
+            resp->setContentType("application/json");
+            resp->setContent("{}");
+            return resp->send();
+        }
+    }
+    else if(!adminKeyValid && route->auth != WebAuthLevel::None)
+    {
+        int authReq = doAuthentication(request);
 
-                switch (authReq)
-                {
-                case 0:
-                    return request->requestAuthentication(BASIC_AUTH, "Nuki Hub", "You must log in.");
-                    break;
-                case 1:
-                    return request->requestAuthentication(DIGEST_AUTH, "Nuki Hub", "You must log in.");
-                    break;
-                case 2:
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/get?page=login");
-                    break;
-                case 4:
-                default:
-                    break;
-                }
-            }
-            if (value == "login")
+        switch (authReq)
+        {
+        case 0:
+            return request->requestAuthentication(BASIC_AUTH, "Nuki Hub", "You must log in.");
+            break;
+        case 1:
+            return request->requestAuthentication(DIGEST_AUTH, "Nuki Hub", "You must log in.");
+            break;
+        case 2:
+            resp->setCode(302);
+            resp->addHeader("Cache-Control", "no-cache");
+            return resp->redirect("/get?page=login");
+            break;
+        case 3:
+            if (route->auth != WebAuthLevel::DuoPending)
             {
-                return buildLoginHtml(request, resp);
+                resp->setCode(302);
+                resp->addHeader("Cache-Control", "no-cache");
+                return resp->redirect("/get?page=duoauth");
             }
-            else
+            break;
+        case 5:
+            if (route->auth != WebAuthLevel::TotpPending)
             {
-                Log->println("Page not found, loading index");
                 resp->setCode(302);
                 resp->addHeader("Cache-Control", "no-cache");
-                return resp->redirect("/");
+                return resp->redirect("/get?page=totp");
             }
-        });
+            break;
+        case 4:
+        default:
+            break;
+        }
 
-        _psychicServer->on("/post", HTTP_POST, [&](PsychicRequest *request, PsychicResponse* resp)
+        if(post && !isApproved(request))
         {
-            String value = "";
-            if(request->hasParam("page"))
+            // the approval page posts back to import or to the settings form
+            int posttype = (route->flags & WEB_ROUTE_ADMIN_KEY) != 0 ? 2 : 3;
+
+            if(_importExport->_sessionsOpts[request->client()->localIP().toString() + "totp"] && _importExport->getTOTPEnabled())
             {
-                const PsychicWebParameter* p = request->getParam("page");
-                if(p->value() != "")
-                {
-                    value = p->value();
-                }
+                return buildTOTPHtml(request, resp, posttype);
             }
-
-            if(value != "login")
+            else
             {
-                int authReq = doAuthentication(request);
+                return buildDuoHtml(request, resp, posttype);
+            }
+        }
+    }
 
-                switch (authReq)
-                {
-                case 0:
-                    return request->requestAuthentication(BASIC_AUTH, "Nuki Hub", "You must log in.");
-                    break;
-                case 1:
-                    return request->requestAuthentication(DIGEST_AUTH, "Nuki Hub", "You must log in.");
-                    break;
-                case 2:
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/get?page=login");
-                    break;
-                    break;
-                case 4:
-                default:
-                    break;
-                }
-            }
+    if(route->cache == WebCachePolicy::NoStore)
+    {
+        resp->addHeader("Cache-Control", "no-store");
+    }
 
-            if (value == "login")
-            {
-                bool loggedIn = processLogin(request, resp);
-                if (loggedIn)
-                {
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/");
-                }
-                else
-                {
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/get?page=login");
-                }
-            }
-            else
+    return route->handler(this, request, resp, adminKeyValid);
+}
+
+bool WebCfgServer::isApproved(PsychicRequest *request)
+{
+    if(!_preferences->getBool(preference_cred_duo_approval, false) || (!_importExport->getTOTPEnabled() && !_duoEnabled))
+    {
+        return true;
+    }
+
+    String approveKey = request->client()->localIP().toString() + "approve";
+
+    if(_importExport->_sessionsOpts[approveKey])
+    {
+        _importExport->_sessionsOpts[approveKey] = false;
+        return true;
+    }
+
+    if(timeSynced && request->hasParam("totpkey") && _importExport->getTOTPEnabled())
+    {
+        const PsychicWebParameter* pass = request->getParam("totpkey");
+        if(pass->value() != "")
+        {
+            String totpkey = pass->value();
+            return _importExport->checkTOTP(&totpkey);
+        }
+    }
+    else if(!timeSynced && _importExport->getBypassEnabled() && isAuthenticated(request, 3))
+    {
+        return true;
+    }
+
+    return false;
+}
+
+esp_err_t WebCfgServer::buildIndexHtml(PsychicRequest *request, PsychicResponse* resp)
+{
+#ifndef CONFIG_IDF_TARGET_ESP32H2
+    if(!_network->isApOpen())
+    {
+#endif
+#ifndef NUKI_HUB_UPDATER
+        return buildHtml(request, resp);
+#else
+        return buildOtaHtml(request, resp);
+#endif
+#ifndef CONFIG_IDF_TARGET_ESP32H2
+    }
+    else
+    {
+        return buildWifiConnectHtml(request, resp);
+    }
+#endif
+}
+
+esp_err_t WebCfgServer::buildNewBypassHtml(PsychicRequest *request, PsychicResponse* resp)
+{
+    if(!_newBypass)
+    {
+        Log->println("Page not found, loading index");
+        resp->setCode(302);
+        resp->addHeader("Cache-Control", "no-cache");
+        return resp->redirect("/");
+    }
+
+    _newBypass = false;
+    return buildConfirmHtml(request, resp, "Logged in using Bypass. New bypass: " + _preferences->getString(preference_bypass_secret, "") + " <br/><br/><a href=\"/\">Home page</a>", 3, false);
+}
+
+esp_err_t WebCfgServer::processLoginPost(PsychicRequest *request, PsychicResponse* resp, int type)
+{
+    bool loggedIn = false;
+    const char* retry = "/get?page=login";
+
+    if (type == 2)
+    {
+        loggedIn = processTOTP(request, resp);
+        retry = "/get?page=totp";
+    }
+    else if (type == 3)
+    {
+        loggedIn = processBypass(request, resp);
+        retry = "/";
+    }
+    else
+    {
+        loggedIn = processLogin(request, resp);
+    }
+
+    resp->setCode(302);
+    resp->addHeader("Cache-Control", "no-cache");
+
+    if (!loggedIn)
+    {
+        return resp->redirect(retry);
+    }
+    if (type == 3)
+    {
+        _newBypass = true;
+        return resp->redirect("/get?page=newbypass");
+    }
+    return resp->redirect("/");
+}
+
+esp_err_t WebCfgServer::processReboot(PsychicRequest *request, PsychicResponse* resp, bool otherPartition)
+{
+    String value = "";
+    if(request->hasParam("CONFIRMTOKEN"))
+    {
+        const PsychicWebParameter* p = request->getParam("CONFIRMTOKEN");
+        if(p->value() != "")
+        {
+            value = p->value();
+        }
+    }
+    else
+    {
+        return buildConfirmHtml(request, resp, "No confirm code set.", 3, true);
+    }
+
+    if(value != _confirmCode)
+    {
+        resp->setCode(302);
+        resp->addHeader("Cache-Control", "no-cache");
+        return resp->redirect("/");
+    }
+
+    if(otherPartition)
+    {
+        esp_err_t res = buildConfirmHtml(request, resp, "Rebooting to other partition...", 2, true);
+        waitAndProcess(true, 1000);
+        esp_ota_set_boot_partition(esp_ota_get_next_update_partition(NULL));
+        restartEsp(RestartReason::OTAReboot);
+        return res;
+    }
+
+    esp_err_t res = buildConfirmHtml(request, resp, "Rebooting...", 2, true);
+    waitAndProcess(true, 1000);
+    restartEsp(RestartReason::RequestedViaWebServer);
+    return res;
+}
+
+#ifndef NUKI_HUB_UPDATER
+esp_err_t WebCfgServer::processRestartServices(PsychicRequest *request, PsychicResponse* resp)
+{
+    String value = "";
+    if(request->hasParam("CONFIRMTOKEN"))
+    {
+        const PsychicWebParameter* p = request->getParam("CONFIRMTOKEN");
+        if(p->value() != "")
+        {
+            value = p->value();
+        }
+    }
+    else
+    {
+        return buildConfirmHtml(request, resp, "No confirm code set.", 3, true);
+    }
+
+    if(value != _confirmCode)
+    {
+        resp->setCode(302);
+        resp->addHeader("Cache-Control", "no-cache");
+        return resp->redirect("/");
+    }
+    esp_err_t res = buildConfirmHtml(request, resp, "Restarting services...", 2, true);
+    _network->setRestartServices(_restartServicesRequired == 1 ? false : true);
+    _restartServicesRequired = 0;
+    waitAndProcess(true, 1000);
+    return res;
+}
+
+esp_err_t WebCfgServer::processDebugMode(PsychicRequest *request, PsychicResponse* resp, bool enabled)
+{
+    _preferences->putBool(preference_enable_debug_mode, enabled);
+    return buildConfirmHtml(request, resp, enabled ? "Debug On" : "Debug Off", 3, true);
+}
+
+esp_err_t WebCfgServer::processExport(PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid)
+{
+    if(!_preferences->getBool(preference_cred_duo_approval, false) || (!_importExport->getTOTPEnabled() && !_duoEnabled))
+    {
+        return sendSettings(request, resp);
+    }
+
+    if(adminKeyValid)
+    {
+        return sendSettings(request, resp, true);
+    }
+
+    if(_importExport->_sessionsOpts[request->client()->localIP().toString() + "approve"])
+    {
+        _importExport->_sessionsOpts[request->client()->localIP().toString() + "approve"] = false;
+        return sendSettings(request, resp);
+    }
+    else if(timeSynced && request->hasParam("totpkey") && _importExport->getTOTPEnabled())
+    {
+        const PsychicWebParameter* pass = request->getParam("totpkey");
+        if(pass->value() != "")
+        {
+            String totpkey = pass->value();
+            if (_importExport->checkTOTP(&totpkey))
             {
-                return buildWifiConnectHtml(request, resp);
+                _importExport->_sessionsOpts[request->client()->localIP().toString() + "approve"] = false;
+                return sendSettings(request, resp);
             }
-        });
+        }
+    }
+
+    if(_importExport->_sessionsOpts[request->client()->localIP().toString() + "totp"] && _importExport->getTOTPEnabled())
+    {
+        return buildTOTPHtml(request, resp, 1);
+    }
+    else
+    {
+        return buildDuoHtml(request, resp, 1);
+    }
+}
+
+#ifndef CONFIG_IDF_TARGET_ESP32H2
+esp_err_t WebCfgServer::processWifiManager(PsychicRequest *request, PsychicResponse* resp)
+{
+    String value = "";
+    if(request->hasParam("CONFIRMTOKEN"))
+    {
+        const PsychicWebParameter* p = request->getParam("CONFIRMTOKEN");
+        if(p->value() != "")
+        {
+            value = p->value();
+        }
+    }
+    else
+    {
+        return buildConfirmHtml(request, resp, "No confirm code set.", 3, true);
+    }
+    if(value != _confirmCode)
+    {
+        resp->setCode(302);
+        resp->addHeader("Cache-Control", "no-cache");
+        return resp->redirect("/");
+    }
+    if(!_allowRestartToPortal)
+    {
+        return buildConfirmHtml(request, resp, "Can't reset WiFi when network device is Ethernet", 3, true);
+    }
+    esp_err_t res = buildConfirmHtml(request, resp, "Restarting. Connect to ESP access point (\"NukiHub\" with password \"NukiHubESP32\") to reconfigure Wi-Fi.", 0);
+    waitAndProcess(false, 1000);
+    _network->reconfigureDevice();
+    return res;
+}
+#endif
+
+esp_err_t WebCfgServer::processSaveConfig(PsychicRequest *request, PsychicResponse* resp)
+{
+    String message = "";
+    bool restart = processArgs(request, resp, message);
+    if(request->hasParam("mqttssl"))
+    {
+        return buildConfirmHtml(request, resp, message, 3, true, "/get?page=mqttconfig");
+    }
+    else if(request->hasParam("httpssl"))
+    {
+        return buildConfirmHtml(request, resp, message, 3, true, "/get?page=ntwconfig");
+    }
+    else
+    {
+        return buildConfirmHtml(request, resp, message, 3, true);
+    }
+}
+
+esp_err_t WebCfgServer::processSaveGpioConfig(PsychicRequest *request, PsychicResponse* resp)
+{
+    processGpioArgs(request, resp);
+    esp_err_t res = buildConfirmHtml(request, resp, "Saving GPIO configuration. Restarting.", 3, true);
+    Log->println("Restarting");
+    waitAndProcess(true, 1000);
+    restartEsp(RestartReason::GpioConfigurationUpdated);
+    return res;
+}
+
+esp_err_t WebCfgServer::processImportPost(PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid)
+{
+    String message = "";
+    bool restart = processImport(request, resp, message);
+
+    if(adminKeyValid)
+    {
+        resp->setCode(200);
+        resp->setContentType("application/json");
+        resp->setContent("{ \"result\": \"success\"}");
+        esp_err_t res = resp->send();
+        if(restart)
+        {
+            restartEsp(RestartReason::RequestedViaWebServer);
+        }
+        return res;
+    }
+    else
+    {
+        return buildConfirmHtml(request, resp, message, 3, true);
+    }
+}
+
+esp_err_t WebCfgServer::sendSettingsApp(PsychicRequest *request, PsychicResponse* resp)
+{
+    return sendStaticAsset(request, resp, settings_html, sizeof(settings_html), settings_html_gzip, settings_html_etag, "text/html", "private, max-age=3600");
+}
+
+esp_err_t WebCfgServer::sendSettingsApi(PsychicRequest *request, PsychicResponse* resp)
+{
+    JsonDocument json;
+    _importExport->exportSettingsApi(json);
+
+    bool msgPack = request->header("Accept").indexOf("application/msgpack") >= 0;
+    resp->addHeader("Cache-Control", "no-store");
+    resp->addHeader("Vary", "Accept");
+
+    PsychicStreamResponse response(resp, msgPack ? "application/msgpack" : "application/json");
+    response.beginSend();
+    if(msgPack)
+    {
+        serializeMsgPack(json, response);
+    }
+    else
+    {
+        serializeJson(json, response);
+    }
+    return response.endSend();
+}
+
+esp_err_t WebCfgServer::sendApprovalRequired(PsychicRequest *request, PsychicResponse* resp)
+{
+    JsonDocument json;
+    json["result"] = "approval required";
+
+    if(!timeSynced)
+    {
+        json["result"] = "NTP time not synced yet, approval not available";
+    }
+    else if(_importExport->_sessionsOpts[request->client()->localIP().toString() + "totp"] && _importExport->getTOTPEnabled())
+    {
+        json["approval"] = "totp";
+    }
+    else if(_importExport->startDuoAuth((char*)"Approve Nuki Hub save"))
+    {
+        char buffer[33];
+        for (int i = 0; i < 4; i++)
+        {
+            sprintf(buffer + (i * 8), "%08lx", (unsigned long int)esp_random());
+        }
+        _importExport->setDuoCheckIP(request->client()->localIP().toString());
+        _importExport->setDuoCheckId(buffer);
+        json["approval"] = "duo";
+        json["id"] = buffer;
+    }
+    else
+    {
+        json["result"] = "Duo check failed";
+    }
+
+    String jsonStr;
+    serializeJson(json, jsonStr);
+    resp->addHeader("Cache-Control", "no-store");
+    return resp->send(403, "application/json", jsonStr.c_str());
+}
+
+esp_err_t WebCfgServer::processSettingsApi(PsychicRequest *request, PsychicResponse* resp)
+{
+    // same MFA approval as the settings forms
+    if(!isApproved(request))
+    {
+        return sendApprovalRequired(request, resp);
+    }
+
+    // only JSON or MessagePack bodies, browsers preflight these content types on cross origin requests
+    String contentType = request->contentType();
+    JsonDocument doc;
+    DeserializationError error;
+
+    if(contentType.startsWith("application/json"))
+    {
+        error = deserializeJson(doc, request->body());
+    }
+    else if(contentType.startsWith("application/msgpack"))
+    {
+        error = deserializeMsgPack(doc, request->body());
+    }
+    else
+    {
+        return resp->send(415, "application/json", "{\"result\": \"unsupported content type\"}");
+    }
+
+    if(error || !doc.is<JsonObject>())
+    {
+        Log->println("Invalid settings update");
+        return resp->send(400, "application/json", "{\"result\": \"invalid\"}");
+    }
+
+    PreferenceApply apply;
+    JsonDocument json;
+    json["result"] = _importExport->importSettingsApi(doc, apply);
+    json["apply"] = (int)apply;
+
+    if(apply == PreferenceApply::Reboot)
+    {
+        _rebootRequired = true;
+    }
+    else if(apply == PreferenceApply::ServicesReload)
+    {
+        _restartServicesRequired = 2;
+    }
+    reloadSettings();
+
+    String jsonStr;
+    serializeJson(json, jsonStr);
+    resp->addHeader("Cache-Control", "no-store");
+    return resp->send(200, "application/json", jsonStr.c_str());
+}
+#endif
 
-        _psychicServer->on("/ssidlist", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
-        {
-            return buildSSIDListHtml(request, resp);
-        });
-        _psychicServer->on("/savewifi", HTTP_POST, [&](PsychicRequest *request, PsychicResponse* resp)
-        {
-            int authReq = doAuthentication(request);
+void WebCfgServer::initialize()
+{
+    //_psychicServer->onOpen([&](PsychicClient* client) { Log->printf("[http] connection #%u connected from %s\n", client->socket(), client->localIP().toString().c_str()); });
+    //_psychicServer->onClose([&](PsychicClient* client) { Log->printf("[http] connection #%u closed from %s\n", client->socket(), client->localIP().toString().c_str()); });
 
-            switch (authReq)
-            {
-            case 0:
-                return request->requestAuthentication(BASIC_AUTH, "Nuki Hub", "You must log in.");
-                break;
-            case 1:
-                return request->requestAuthentication(DIGEST_AUTH, "Nuki Hub", "You must log in.");
-                break;
-            case 2:
-                resp->setCode(302);
-                resp->addHeader("Cache-Control", "no-cache");
-                return resp->redirect("/get?page=login");
-                break;
-            case 3:
-            case 5:
-            case 4:
-            default:
-                break;
-            }
+    _psychicServer->on("/style.css", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
+    {
+        return sendCss(request, resp);
+    });
 
-            String message = "";
-            bool connected = processWiFi(request, resp, message);
-            esp_err_t res = buildConfirmHtml(request, resp, message, 10, true);
 
-            if(connected)
-            {
-                waitAndProcess(true, 3000);
-                restartEsp(RestartReason::ReconfigureWifi);
-                //abort();
-            }
-            return res;
-        });
-        _psychicServer->on("/reboot", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
+    if(_preferences->getBool(preference_webserial_enabled, false))
+    {
+#ifndef NUKI_HUB_UPDATER
+        if (websocketHandler == nullptr)
+        {
+            websocketHandler = new PsychicWebSocketHandler;
+        }
+
+        _psychicServer->on("/webserial", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
         {
             int authReq = doAuthentication(request);
 
@@ -728,412 +1094,109 @@ void WebCfgServer::initialize()
                 break;
             }
 
-            String value = "";
-            if(request->hasParam("CONFIRMTOKEN"))
-            {
-                const PsychicWebParameter* p = request->getParam("CONFIRMTOKEN");
-                if(p->value() != "")
-                {
-                    value = p->value();
-                }
-            }
-            else
-            {
-                return buildConfirmHtml(request, resp, "No confirm code set.", 3, true);
-            }
-
-            if(value != _confirmCode)
-            {
-                resp->setCode(302);
-                resp->addHeader("Cache-Control", "no-cache");
-                return resp->redirect("/");
-            }
-            esp_err_t res = buildConfirmHtml(request, resp, "Rebooting...", 2, true);
-            waitAndProcess(true, 1000);
-            restartEsp(RestartReason::RequestedViaWebServer);
-            return res;
+            return sendWebSerial(request, resp);
         });
-#endif
-    }
-    else
-    {
-        _psychicServer->on("/get", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
-        {
-            String value = "";
-            if(request->hasParam("page"))
-            {
-                const PsychicWebParameter* p = request->getParam("page");
-                if(p->value() != "")
-                {
-                    value = p->value();
-                }
-            }
-
-            bool adminKeyValid = false;
-            if(value == "export" && timeSynced && request->hasParam("adminkey") && request->hasParam("totpkey") && _importExport->getTOTPEnabled())
-            {
-                String value2 = "";
-                if(request->hasParam("adminkey"))
-                {
-                    const PsychicWebParameter* p = request->getParam("adminkey");
-                    if(p->value() != "")
-                    {
-                        value2 = p->value();
-                    }
-                }
-                String value3 = "";
-                if(request->hasParam("totpkey"))
-                {
-                    const PsychicWebParameter* p = request->getParam("totpkey");
-                    if(p->value() != "")
-                    {
-                        value3 = p->value();
-                    }
-                }
-                if (value2.length() > 0 && value2 == _preferences->getString(preference_admin_secret, "") && _importExport->checkTOTP(&value3))
-                {
-                    adminKeyValid = true;
-                }
-            }
-
-            if (!adminKeyValid && value != "status" && value != "login" && value != "duocheck" && value != "bypass")
-            {
-                int authReq = doAuthentication(request);
-
-                switch (authReq)
-                {
-                case 0:
-                    return request->requestAuthentication(BASIC_AUTH, "Nuki Hub", "You must log in.");
-                    break;
-                case 1:
-                    return request->requestAuthentication(DIGEST_AUTH, "Nuki Hub", "You must log in.");
-                    break;
-                case 2:
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/get?page=login");
-                    break;
-                case 3:
-                    if (value != "duoauth")
-                    {
-                        resp->setCode(302);
-                        resp->addHeader("Cache-Control", "no-cache");
-                        return resp->redirect("/get?page=duoauth");
-                    }
-                    break;
-                case 5:
-                    if (value != "totp")
-                    {
-                        resp->setCode(302);
-                        resp->addHeader("Cache-Control", "no-cache");
-                        return resp->redirect("/get?page=totp");
-                    }
-                    break;
-                case 4:
-                default:
-                    break;
-                }
-            }
-            else if (value == "status")
-            {
-                if (doAuthentication(request) != 4)
-                {
-                    resp->setCode(200);
-                    resp->setContentType("application/json");
-                    resp->setContent("{}");
-                    return resp->send();
-                }
-            }
-            if (value == "login")
-            {
-                return buildLoginHtml(request, resp);
-            }
-            else if (value == "totp")
-            {
-                return buildTOTPHtml(request, resp, 0);
-            }
-            else if (value == "bypass")
-            {
-                return buildBypassHtml(request, resp);
-            }
-            else if (value == "newbypass" && _newBypass)
-            {
-                _newBypass = false;
-                return buildConfirmHtml(request, resp, "Logged in using Bypass. New bypass: " + _preferences->getString(preference_bypass_secret, "") + " <br/><br/><a href=\"/\">Home page</a>", 3, false);
-            }
-            else if (value == "logout")
-            {
-                return logoutSession(request, resp);
-            }
-            else if (value == "duoauth")
-            {
-                return buildDuoHtml(request, resp, 0);
-            }
-            else if (value == "duocheck")
-            {
-                return buildDuoCheckHtml(request, resp);
-            }
-            else if (value == "coredump")
-            {
-                return buildCoredumpHtml(request, resp);
-            }
-            else if (value == "reboot")
-            {
-                String value2 = "";
-                if(request->hasParam("CONFIRMTOKEN"))
-                {
-                    const PsychicWebParameter* p = request->getParam("CONFIRMTOKEN");
-                    if(p->value() != "")
-                    {
-                        value2 = p->value();
-                    }
-                }
-                else
-                {
-                    return buildConfirmHtml(request, resp, "No confirm code set.", 3, true);
-                }
-
-                if(value2 != _confirmCode)
-                {
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/");
-                }
-                esp_err_t res = buildConfirmHtml(request, resp, "Rebooting...", 2, true);
-                waitAndProcess(true, 1000);
-                restartEsp(RestartReason::RequestedViaWebServer);
-                return res;
-            }
-#ifndef NUKI_HUB_UPDATER
-            else if (value == "restartservices")
-            {
-                String value2 = "";
-                if(request->hasParam("CONFIRMTOKEN"))
-                {
-                    const PsychicWebParameter* p = request->getParam("CONFIRMTOKEN");
-                    if(p->value() != "")
-                    {
-                        value2 = p->value();
-                    }
-                }
-                else
-                {
-                    return buildConfirmHtml(request, resp, "No confirm code set.", 3, true);
-                }
-
-                if(value2 != _confirmCode)
-                {
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/");
-                }
-                esp_err_t res = buildConfirmHtml(request, resp, "Restarting services...", 2, true);
-                _network->setRestartServices(_restartServicesRequired == 1 ? false : true);
-                _restartServicesRequired = 0;
-                waitAndProcess(true, 1000);
-                return res;
-            }
-            else if (value == "info")
-            {
-                return buildInfoHtml(request, resp);
-            }
-            else if (value == "debugon")
-            {
-                _preferences->putBool(preference_enable_debug_mode, true);
-                return buildConfirmHtml(request, resp, "Debug On", 3, true);
-            }
-            else if (value == "debugoff")
-            {
-                _preferences->putBool(preference_enable_debug_mode, false);
-                return buildConfirmHtml(request, resp, "Debug Off", 3, true);
-            }
-            else if (value == "export")
-            {
-                if(!_preferences->getBool(preference_cred_duo_approval, false) || (!_importExport->getTOTPEnabled() && !_duoEnabled))
-                {
-                    return sendSettings(request, resp);
-                }
-
-                if(adminKeyValid)
-                {
-                    return sendSettings(request, resp, true);
-                }
-
-                if(_importExport->_sessionsOpts[request->client()->localIP().toString() + "approve"])
-                {
-                    _importExport->_sessionsOpts[request->client()->localIP().toString() + "approve"] = false;
-                    return sendSettings(request, resp);
-                }
-                else if(timeSynced && request->hasParam("totpkey") && _importExport->getTOTPEnabled())
-                {
-                    const PsychicWebParameter* pass = request->getParam("totpkey");
-                    if(pass->value() != "")
-                    {
-                        String totpkey = pass->value();
-                        if (_importExport->checkTOTP(&totpkey))
-                        {
-                            _importExport->_sessionsOpts[request->client()->localIP().toString() + "approve"] = false;
-                            return sendSettings(request, resp);
-                        }
-                    }
-                }
 
-                if(_importExport->_sessionsOpts[request->client()->localIP().toString() + "totp"] && _importExport->getTOTPEnabled())
-                {
-                    return buildTOTPHtml(request, resp, 1);
-                }
-                else
-                {
-                    return buildDuoHtml(request, resp, 1);
-                }
-            }
-            else if (value == "impexpcfg")
-            {
-                return buildImportExportHtml(request, resp);
-            }
-            else if (value == "status")
-            {
-                return buildStatusHtml(request, resp);
-            }
-            else if (value == "acclvl")
-            {
-                return buildAccLvlHtml(request, resp);
-            }
-            else if (value == "custntw")
-            {
-                return buildCustomNetworkConfigHtml(request, resp);
-            }
-            else if (value == "advanced")
-            {
-                return buildAdvancedConfigHtml(request, resp);
-            }
-            else if (value == "cred")
-            {
-                return buildCredHtml(request, resp);
-            }
-            else if (value == "ntwconfig")
-            {
-                return buildNetworkConfigHtml(request, resp);
-            }
-            else if (value == "mqttconfig")
-            {
-                return buildMqttConfigHtml(request, resp);
-            }
-            else if (value == "mqttcaconfig")
-            {
-                return buildMqttSSLConfigHtml(request, resp, 0);
-            }
-            else if (value == "mqttcrtconfig")
-            {
-                return buildMqttSSLConfigHtml(request, resp, 1);
-            }
-            else if (value == "mqttkeyconfig")
-            {
-                return buildMqttSSLConfigHtml(request, resp, 2);
-            }
-            else if (value == "httpcrtconfig")
-            {
-                return buildHttpSSLConfigHtml(request, resp, 1);
-            }
-            else if (value == "httpkeyconfig")
-            {
-                return buildHttpSSLConfigHtml(request, resp, 2);
-            }
-            else if (value == "selfsignhttps")
-            {
-                return buildHttpSSLConfigHtml(request, resp, 3);
-            }
-            else if (value == "nukicfg")
-            {
-                return buildNukiConfigHtml(request, resp);
-            }
-            else if (value == "gpiocfg")
-            {
-                return buildGpioConfigHtml(request, resp);
-            }
-#ifndef CONFIG_IDF_TARGET_ESP32H2
-            else if (value == "wifi")
-            {
-                return buildConfigureWifiHtml(request, resp);
-            }
-            else if (value == "wifimanager")
+        //prepare our message queue of 10 messages
+        wsMessages = xQueueCreate(10, sizeof(WebsocketMessage));
+        if (wsMessages == 0)
+        {
+            Log->printf("Failed to create queue= %p\n", wsMessages);
+        }
+
+        websocketHandler->onOpen([](PsychicWebSocketClient *client)
+        {
+            Log->printf("[socket] connection #%u connected from %s\n", client->socket(), client->remoteIP().toString());
+            client->sendMessage("NukiHub WebSerial started");
+        });
+        websocketHandler->onFrame([](PsychicWebSocketRequest *request, httpd_ws_frame *frame)
+        {
+            if(strcmp((char *)frame->payload, "ping") == 0)
             {
-                String value2 = "";
-                if(request->hasParam("CONFIRMTOKEN"))
-                {
-                    const PsychicWebParameter* p = request->getParam("CONFIRMTOKEN");
-                    if(p->value() != "")
-                    {
-                        value2 = p->value();
-                    }
-                }
-                else
+                WebsocketMessage wm;
+                wm.socket = request->client()->socket();
+                wm.len = frame->len;
+                wm.buffer = (char *)malloc(frame->len);
+
+                if (wm.buffer == NULL)
                 {
-                    return buildConfirmHtml(request, resp, "No confirm code set.", 3, true);
+                    Log->printf("Queue message: unable to allocate %d bytes\n", frame->len);
+                    return ESP_FAIL;
                 }
-                if(value2 != _confirmCode)
+
+                memcpy(wm.buffer, "pong", frame->len);
+
+                if (xQueueSend(wsMessages, &wm, 1) != pdTRUE)
                 {
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/");
+                    Log->printf("[socket] queue full #%d\n", wm.socket);
+                    free(wm.buffer);
                 }
-                if(!_allowRestartToPortal)
+
+                if (!uxQueueSpacesAvailable(wsMessages))
                 {
-                    return buildConfirmHtml(request, resp, "Can't reset WiFi when network device is Ethernet", 3, true);
+                    return request->reply("Queue Full");
                 }
-                esp_err_t res = buildConfirmHtml(request, resp, "Restarting. Connect to ESP access point (\"NukiHub\" with password \"NukiHubESP32\") to reconfigure Wi-Fi.", 0);
-                waitAndProcess(false, 1000);
-                _network->reconfigureDevice();
-                return res;
             }
-#endif
-#endif
-            else if (value == "ota")
-            {
-                return buildOtaHtml(request, resp);
-            }
-            else if (value == "otadebug")
+            else
             {
-                return buildOtaHtml(request, resp);
-                //return buildOtaHtml(request, resp, true);
+                Log->printf("[socket] #%d sent: %s\n", request->client()->socket(), (char *)frame->payload);
             }
-            else if (value == "reboottoota")
+            return ESP_OK;
+        });
+        websocketHandler->onClose([](PsychicWebSocketClient *client)
+        {
+            Log->printf("[socket] connection #%u closed from %s\n", client->socket(), client->remoteIP().toString());
+        });
+
+        _psychicServer->on("/ws", websocketHandler);
+#endif
+
+    }
+
+    _psychicServer->on("/favicon.ico", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
+    {
+        return sendFavicon(request, resp);
+    });
+
+    if(_network->isApOpen())
+    {
+#ifndef CONFIG_IDF_TARGET_ESP32H2
+        _psychicServer->on("/get", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
+        {
+            String value = "";
+            if(request->hasParam("page"))
             {
-                String value2 = "";
-                if(request->hasParam("CONFIRMTOKEN"))
-                {
-                    const PsychicWebParameter* p = request->getParam("CONFIRMTOKEN");
-                    if(p->value() != "")
-                    {
-                        value2 = p->value();
-                    }
-                }
-                else
+                const PsychicWebParameter* p = request->getParam("page");
+                if(p->value() != "")
                 {
-                    return buildConfirmHtml(request, resp, "No confirm code set.", 3, true);
+                    value = p->value();
                 }
+            }
+            if (value != "login")
+            {
+                int authReq = doAuthentication(request);
 
-                if(value2 != _confirmCode)
+                switch (authReq)
                 {
+                case 0:
+                    return request->requestAuthentication(BASIC_AUTH, "Nuki Hub", "You must log in.");
+                    break;
+                case 1:
+                    return request->requestAuthentication(DIGEST_AUTH, "Nuki Hub", "You must log in.");
+                    break;
+                case 2:
                     resp->setCode(302);
                     resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/");
+                    return resp->redirect("/get?page=login");
+                    break;
+                case 4:
+                default:
+                    break;
                 }
-                esp_err_t res = buildConfirmHtml(request, resp, "Rebooting to other partition...", 2, true);
-                waitAndProcess(true, 1000);
-                esp_ota_set_boot_partition(esp_ota_get_next_update_partition(NULL));
-                restartEsp(RestartReason::OTAReboot);
-                return res;
             }
-            else if (value == "autoupdate")
+            if (value == "login")
             {
-#ifndef NUKI_HUB_UPDATER
-                return processUpdate(request, resp);
-#else
-                resp->setCode(302);
-                resp->addHeader("Cache-Control", "no-cache");
-                return resp->redirect("/");
-#endif
+                return buildLoginHtml(request, resp);
             }
             else
             {
@@ -1143,6 +1206,7 @@ void WebCfgServer::initialize()
                 return resp->redirect("/");
             }
         });
+
         _psychicServer->on("/post", HTTP_POST, [&](PsychicRequest *request, PsychicResponse* resp)
         {
             String value = "";
@@ -1155,33 +1219,7 @@ void WebCfgServer::initialize()
                 }
             }
 
-            bool adminKeyValid = false;
-            if(value == "import" && timeSynced && request->hasParam("adminkey") && request->hasParam("totpkey") && _importExport->getTOTPEnabled())
-            {
-                String value2 = "";
-                if(request->hasParam("adminkey"))
-                {
-                    const PsychicWebParameter* p = request->getParam("adminkey");
-                    if(p->value() != "")
-                    {
-                        value2 = p->value();
-                    }
-                }
-                String value3 = "";
-                if(request->hasParam("totpkey"))
-                {
-                    const PsychicWebParameter* p = request->getParam("totpkey");
-                    if(p->value() != "")
-                    {
-                        value3 = p->value();
-                    }
-                }
-                if (value2.length() > 0 && value2 == _preferences->getString(preference_admin_secret, "") && _importExport->checkTOTP(&value3))
-                {
-                    adminKeyValid = true;
-                }
-            }
-            if(!adminKeyValid && value != "login" && value != "totp" && value != "bypass")
+            if(value != "login")
             {
                 int authReq = doAuthentication(request);
 
@@ -1198,70 +1236,11 @@ void WebCfgServer::initialize()
                     resp->addHeader("Cache-Control", "no-cache");
                     return resp->redirect("/get?page=login");
                     break;
-                case 3:
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/get?page=duoauth");
-                    break;
-                case 5:
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/get?page=totp");
                     break;
                 case 4:
                 default:
                     break;
                 }
-
-                if(_preferences->getBool(preference_cred_duo_approval, false) && (_importExport->getTOTPEnabled() || _duoEnabled))
-                {
-                    if(!_importExport->_sessionsOpts[request->client()->localIP().toString() + "approve"])
-                    {
-                        bool approved = false;
-                        if(timeSynced && request->hasParam("totpkey") && _importExport->getTOTPEnabled())
-                        {
-                            const PsychicWebParameter* pass = request->getParam("totpkey");
-                            if(pass->value() != "")
-                            {
-                                String totpkey = pass->value();
-                                if (_importExport->checkTOTP(&totpkey))
-                                {
-                                    _importExport->_sessionsOpts[request->client()->localIP().toString() + "approve"] = false;
-                                    approved = true;
-                                }
-                            }
-                        }
-                        else if(!timeSynced && _importExport->getBypassEnabled() && isAuthenticated(request, 3))
-                        {
-                            _importExport->_sessionsOpts[request->client()->localIP().toString() + "approve"] = false;
-                            approved = true;
-                        }
-
-                        if (!approved)
-                        {
-                            int posttype = 3;
-
-                            if (value == "import")
-                            {
-                                posttype = 2;
-                            }
-
-                            if(_importExport->_sessionsOpts[request->client()->localIP().toString() + "totp"] && _importExport->getTOTPEnabled())
-                            {
-
-                                return buildTOTPHtml(request, resp, posttype);
-                            }
-                            else
-                            {
-                                return buildDuoHtml(request, resp, posttype);
-                            }
-                        }
-                    }
-                    else
-                    {
-                        _importExport->_sessionsOpts[request->client()->localIP().toString() + "approve"] = false;
-                    }
-                }
             }
 
             if (value == "login")
@@ -1280,120 +1259,112 @@ void WebCfgServer::initialize()
                     return resp->redirect("/get?page=login");
                 }
             }
-            else if (value == "totp")
-            {
-                bool loggedIn = processTOTP(request, resp);
-                if (loggedIn)
-                {
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/");
-                }
-                else
-                {
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/get?page=totp");
-                }
-            }
-            else if (value == "bypass")
-            {
-                bool loggedIn = processBypass(request, resp);
-                if (loggedIn)
-                {
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    _newBypass = true;
-                    return resp->redirect("/get?page=newbypass");
-                }
-                else
-                {
-                    resp->setCode(302);
-                    resp->addHeader("Cache-Control", "no-cache");
-                    return resp->redirect("/");
-                }
-            }
-#ifndef NUKI_HUB_UPDATER
-            else if (value == "savecfg")
-            {
-                String message = "";
-                bool restart = processArgs(request, resp, message);
-                if(request->hasParam("mqttssl"))
-                {
-                    return buildConfirmHtml(request, resp, message, 3, true, "/get?page=mqttconfig");
-                }
-                else if(request->hasParam("httpssl"))
-                {
-                    return buildConfirmHtml(request, resp, message, 3, true, "/get?page=ntwconfig");
-                }
-                else
-                {
-                    return buildConfirmHtml(request, resp, message, 3, true);
-                }
-            }
-            else if (value == "savegpiocfg")
-            {
-                processGpioArgs(request, resp);
-                esp_err_t res = buildConfirmHtml(request, resp, "Saving GPIO configuration. Restarting.", 3, true);
-                Log->println("Restarting");
-                waitAndProcess(true, 1000);
-                restartEsp(RestartReason::GpioConfigurationUpdated);
-                return res;
-            }
-            else if (value == "unpairlock")
+            else
             {
-                return processUnpair(request, resp, false);
+                return buildWifiConnectHtml(request, resp);
             }
-            else if (value == "unpairopener")
+        });
+
+        _psychicServer->on("/ssidlist", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
+        {
+            return buildSSIDListHtml(request, resp);
+        });
+        _psychicServer->on("/savewifi", HTTP_POST, [&](PsychicRequest *request, PsychicResponse* resp)
+        {
+            int authReq = doAuthentication(request);
+
+            switch (authReq)
             {
-                return processUnpair(request, resp, true);
+            case 0:
+                return request->requestAuthentication(BASIC_AUTH, "Nuki Hub", "You must log in.");
+                break;
+            case 1:
+                return request->requestAuthentication(DIGEST_AUTH, "Nuki Hub", "You must log in.");
+                break;
+            case 2:
+                resp->setCode(302);
+                resp->addHeader("Cache-Control", "no-cache");
+                return resp->redirect("/get?page=login");
+                break;
+            case 3:
+            case 5:
+            case 4:
+            default:
+                break;
             }
-            else if (value == "factoryreset")
+
+            String message = "";
+            bool connected = processWiFi(request, resp, message);
+            esp_err_t res = buildConfirmHtml(request, resp, message, 10, true);
+
+            if(connected)
             {
-                return processFactoryReset(request, resp);
+                waitAndProcess(true, 3000);
+                restartEsp(RestartReason::ReconfigureWifi);
+                //abort();
             }
-            else if (value == "import")
-            {
-                String message = "";
-                bool restart = processImport(request, resp, message);
+            return res;
+        });
+        _psychicServer->on("/reboot", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
+        {
+            int authReq = doAuthentication(request);
 
-                if(adminKeyValid)
-                {
-                    resp->setCode(200);
-                    resp->setContentType("application/json");
-                    resp->setContent("{ \"result\": \"success\"}");
-                    esp_err_t res = resp->send();
-                    if(restart)
-                    {
-                        restartEsp(RestartReason::RequestedViaWebServer);
-                    }
-                    return res;
-                }
-                else
+            switch (authReq)
+            {
+            case 0:
+                return request->requestAuthentication(BASIC_AUTH, "Nuki Hub", "You must log in.");
+                break;
+            case 1:
+                return request->requestAuthentication(DIGEST_AUTH, "Nuki Hub", "You must log in.");
+                break;
+            case 2:
+                resp->setCode(302);
+                resp->addHeader("Cache-Control", "no-cache");
+                return resp->redirect("/get?page=login");
+                break;
+            case 3:
+            case 5:
+            case 4:
+            default:
+                break;
+            }
+
+            String value = "";
+            if(request->hasParam("CONFIRMTOKEN"))
+            {
+                const PsychicWebParameter* p = request->getParam("CONFIRMTOKEN");
+                if(p->value() != "")
                 {
-                    return buildConfirmHtml(request, resp, message, 3, true);
+                    value = p->value();
                 }
             }
-#endif
             else
             {
-#ifndef CONFIG_IDF_TARGET_ESP32H2
-                if(!_network->isApOpen())
-                {
-#endif
-#ifndef NUKI_HUB_UPDATER
-                    return buildHtml(request, resp);
-#else
-                    return buildOtaHtml(request, resp);
-#endif
-#ifndef CONFIG_IDF_TARGET_ESP32H2
-                }
-                else
-                {
-                    return buildWifiConnectHtml(request, resp);
-                }
-#endif
+                return buildConfirmHtml(request, resp, "No confirm code set.", 3, true);
+            }
+
+            if(value != _confirmCode)
+            {
+                resp->setCode(302);
+                resp->addHeader("Cache-Control", "no-cache");
+                return resp->redirect("/");
             }
+            esp_err_t res = buildConfirmHtml(request, resp, "Rebooting...", 2, true);
+            waitAndProcess(true, 1000);
+            restartEsp(RestartReason::RequestedViaWebServer);
+            return res;
+        });
+#endif
+    }
+    else
+    {
+        _psychicServer->on("/get", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
+        {
+            return dispatchPage(request, resp, false);
+        });
+        _psychicServer->on("/post", HTTP_POST, [&](PsychicRequest *request, PsychicResponse* resp)
+        {
+            return dispatchPage(request, resp, true);
         });
 
         PsychicUploadHandler *updateHandler = new PsychicUploadHandler();
@@ -1485,6 +1456,43 @@ void WebCfgServer::initialize()
         //Update.onProgress(printProgress);
     }
 
+#ifndef NUKI_HUB_UPDATER
+    _statusEvents = new PsychicEventSource;
+    _statusEvents->onOpen([&](PsychicEventSourceClient *client)
+    {
+        JsonDocument json;
+        String jsonStr;
+        buildStatusJson(json);
+        serializeJson(json, jsonStr);
+        client->send(jsonStr.c_str(), "status", 0, 5000);
+    });
+    _psychicServer->on("/statusevents", HTTP_GET, _statusEvents)->addMiddleware([&](PsychicRequest *request, PsychicResponse* resp, PsychicMiddlewareNext next)
+    {
+        if(doAuthentication(request) != 4)
+        {
+            return resp->send(401);
+        }
+        return next();
+    });
+
+    _psychicServer->on("/api/settings", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
+    {
+        if(doAuthentication(request) != 4)
+        {
+            return resp->send(401);
+        }
+        return sendSettingsApi(request, resp);
+    });
+    _psychicServer->on("/api/settings", HTTP_POST, [&](PsychicRequest *request, PsychicResponse* resp)
+    {
+        if(doAuthentication(request) != 4)
+        {
+            return resp->send(401);
+        }
+        return processSettingsApi(request, resp);
+    });
+#endif
+
     _psychicServer->on("/", HTTP_GET, [&](PsychicRequest *request, PsychicResponse* resp)
     {
         int authReq = doAuthentication(request);
@@ -1517,22 +1525,7 @@ void WebCfgServer::initialize()
             break;
         }
 
-#ifndef CONFIG_IDF_TARGET_ESP32H2
-        if(!_network->isApOpen())
-        {
-#endif
-#ifndef NUKI_HUB_UPDATER
-            return buildHtml(request, resp);
-#else
-            return buildOtaHtml(request, resp);
-#endif
-#ifndef CONFIG_IDF_TARGET_ESP32H2
-        }
-        else
-        {
-            return buildWifiConnectHtml(request, resp);
-        }
-#endif
+        return buildIndexHtml(request, resp);
     });
 
 }
@@ -1827,37 +1820,12 @@ esp_err_t WebCfgServer::buildOtaHtml(PsychicRequest *request, PsychicResponse* r
 
 #ifndef NUKI_HUB_UPDATER
     bool manifestSuccess = false;
-    JsonDocument doc;
-    
+    OtaManifest manifest;
+
     if(_network->isInternetConnected())
     {
-        NetworkClientSecure *clientOTAUpdate = new NetworkClientSecure;
-        if (clientOTAUpdate)
-        {
-            clientOTAUpdate->setCACertBundle(x509_crt_imported_bundle_bin_start, x509_crt_imported_bundle_bin_end - x509_crt_imported_bundle_bin_start);
-            {
-                HTTPClient httpsOTAClient;
-                httpsOTAClient.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-                httpsOTAClient.setTimeout(2500);
-                httpsOTAClient.useHTTP10(true);
-
-                if (httpsOTAClient.begin(*clientOTAUpdate, GITHUB_OTA_MANIFEST_URL))
-                {
-                    int httpResponseCodeOTA = httpsOTAClient.GET();
-
-                    if (httpResponseCodeOTA == HTTP_CODE_OK || httpResponseCodeOTA == HTTP_CODE_MOVED_PERMANENTLY)
-                    {
-                        DeserializationError jsonError = deserializeJson(doc, httpsOTAClient.getStream());
-                        if (!jsonError)
-                        {
-                            manifestSuccess = true;
-                        }
-                    }
-                    httpsOTAClient.end();
-                }
-            }
-            delete clientOTAUpdate;
-        }
+        OtaManifestFetcher* fetcher = OtaManifestFetcher::get();
+        manifestSuccess = fetcher->waitFor(fetcher->request(), manifest, 2500) == OtaManifestResult::Ready;
     }
 
     response.print("<div id=\"msgdiv\" style=\"visibility:hidden\">Initiating Over-the-air update. This will take about two minutes, please be patient.<br>You will be forwarded automatically when the update is complete.</div>");
@@ -1926,53 +1894,53 @@ esp_err_t WebCfgServer::buildOtaHtml(PsychicRequest *request, PsychicResponse* r
     else
     {
         response.print("<b>Latest release version: </b><span id=\"latestver\">");
-        response.print(doc["release"]["fullversion"].as<const char*>());
+        response.print(manifest.release.fullversion);
         response.print(" (");
-        response.print(doc["release"]["build"].as<const char*>());
+        response.print(manifest.release.build);
         response.print(")</span>, ");
-        response.print(doc["release"]["time"].as<const char*>());
+        response.print(manifest.release.time);
         response.print("<br>");
         response.print("<b>Latest beta version: </b><span id=\"betaver\">");
-        if(doc["beta"]["fullversion"] != "No beta available")
+        if(strcmp(manifest.beta.fullversion, "No beta available") != 0)
         {
-            response.print(doc["beta"]["fullversion"].as<const char*>());
+            response.print(manifest.beta.fullversion);
             response.print(" (");
-            response.print(doc["beta"]["build"].as<const char*>());
+            response.print(manifest.beta.build);
             response.print(")</span>, ");
-            response.print(doc["beta"]["time"].as<const char*>());
+            response.print(manifest.beta.time);
         }
         else
         {
-            response.print(doc["beta"]["fullversion"].as<const char*>());
+            response.print(manifest.beta.fullversion);
             response.print("</span>");
         }
         response.print("<br>");
         response.print("<b>Latest development version: </b><span id=\"devver\">");
-        response.print(doc["master"]["fullversion"].as<const char*>());
+        response.print(manifest.master.fullversion);
         response.print(" (");
-        response.print(doc["master"]["build"].as<const char*>());
+        response.print(manifest.master.build);
         response.print(")</span>, ");
-        response.print(doc["master"]["time"].as<const char*>());
+        response.print(manifest.master.time);
         response.print("<br>");
 
         String currentVersion = NUKI_HUB_VERSION;
         const char* latestVersion;
 
-        if(atof(doc["release"]["version_int"]) >= NUKI_HUB_VERSION_INT)
+        if(atof(manifest.release.versionInt) >= NUKI_HUB_VERSION_INT)
         {
-            latestVersion = doc["release"]["fullversion"];
+            latestVersion = manifest.release.fullversion;
         }
         else if(currentVersion.indexOf("beta") > 0)
         {
-            latestVersion = doc["beta"]["fullversion"];
+            latestVersion = manifest.beta.fullversion;
         }
         else if(currentVersion.indexOf("master") > 0)
         {
-            latestVersion = doc["master"]["fullversion"];
+            latestVersion = manifest.master.fullversion;
         }
         else
         {
-            latestVersion = doc["release"]["fullversion"];
+            latestVersion = manifest.release.fullversion;
         }
 
         if(strcmp(latestVersion, _preferences->getString(preference_latest_version).c_str()) != 0)
@@ -2211,23 +2179,96 @@ esp_err_t WebCfgServer::buildConfirmHtml(PsychicRequest *request, PsychicRespons
 
 esp_err_t WebCfgServer::sendCss(PsychicRequest* request, PsychicResponse* resp)
 {
-    // escaped by https://www.cescaper.com/
-    resp->addHeader("Cache-Control", "public, max-age=3600");
-    resp->setCode(200);
-    resp->setContentType("text/css");
-    resp->setContent(stylecss);
-    return resp->send();
+    return sendStaticAsset(request, resp, stylecss, sizeof(stylecss), stylecss_gzip, stylecss_etag, "text/css", "public, max-age=3600");
 }
 
 esp_err_t WebCfgServer::sendFavicon(PsychicRequest* request, PsychicResponse* resp)
 {
-    resp->addHeader("Cache-Control", "public, max-age=604800");
+    return sendStaticAsset(request, resp, favicon_32x32, sizeof(favicon_32x32), favicon_32x32_gzip, favicon_32x32_etag, "image/png", "public, max-age=604800");
+}
+
+esp_err_t WebCfgServer::sendStaticAsset(PsychicRequest* request, PsychicResponse* resp, const uint8_t* data, size_t len, bool gzip, const char* etag, const char* contentType, const char* cacheControl)
+{
+    resp->addHeader("Cache-Control", cacheControl);
+    resp->addHeader("ETag", etag);
+    if(gzip)
+    {
+        resp->addHeader("Vary", "Accept-Encoding");
+    }
+
+    if(request->hasHeader("If-None-Match") && strstr(request->header("If-None-Match").c_str(), etag) != nullptr)
+    {
+        resp->setCode(304);
+        return resp->send();
+    }
+
+    if(gzip)
+    {
+        // only the gzip stream is stored in flash, there is no identity representation to fall back to
+        if(!acceptsGzip(request))
+        {
+            resp->setCode(406);
+            resp->setContentType("text/plain");
+            resp->setContent("This resource is only available with Content-Encoding gzip");
+            return resp->send();
+        }
+        resp->addHeader("Content-Encoding", "gzip");
+    }
     resp->setCode(200);
-    resp->setContentType("image/png");
-    resp->setContent((const uint8_t *)favicon_32x32, sizeof(favicon_32x32));
+    resp->setContentType(contentType);
+    resp->setContent(data, len);
     return resp->send();
 }
 
+bool WebCfgServer::acceptsGzip(PsychicRequest* request)
+{
+    // without Accept-Encoding any content coding is acceptable (RFC 9110, 12.5.3)
+    if(!request->hasHeader("Accept-Encoding"))
+    {
+        return true;
+    }
+
+    String acceptEncoding = request->header("Accept-Encoding");
+    acceptEncoding.toLowerCase();
+    bool wildcard = false;
+    int start = 0;
+
+    while(start < (int)acceptEncoding.length())
+    {
+        int end = acceptEncoding.indexOf(',', start);
+        if(end < 0)
+        {
+            end = acceptEncoding.length();
+        }
+        String coding = acceptEncoding.substring(start, end);
+        start = end + 1;
+
+        float quality = 1;
+        int parameters = coding.indexOf(';');
+        if(parameters >= 0)
+        {
+            int qualityPos = coding.indexOf("q=", parameters);
+            if(qualityPos >= 0)
+            {
+                quality = coding.substring(qualityPos + 2).toFloat();
+            }
+            coding = coding.substring(0, parameters);
+        }
+        coding.trim();
+
+        if(coding == "gzip" || coding == "x-gzip")
+        {
+            return quality > 0;
+        }
+        if(coding == "*")
+        {
+            wildcard = quality > 0;
+        }
+    }
+
+    return wildcard;
+}
+
 String WebCfgServer::generateConfirmCode()
 {
     int code = random(1000,9999);
@@ -2592,7 +2633,7 @@ bool WebCfgServer::processLogin(PsychicRequest *request, PsychicResponse* resp)
                 struct timeval time;
                 gettimeofday(&time, NULL);
                 int64_t time_us = (int64_t)time.tv_sec * 1000000L + (int64_t)time.tv_usec;
-                _httpSessions[buffer] = time_us + (durationLength*1000000L);
+                _httpSessions.add(buffer, time_us + (durationLength*1000000L));
                 saveSessions();
 
                 _importExport->_sessionsOpts[request->client()->localIP().toString() + "totp"] = request->hasParam("totp");
@@ -2633,7 +2674,7 @@ bool WebCfgServer::processBypass(PsychicRequest *request, PsychicResponse* resp)
                 struct timeval time;
                 gettimeofday(&time, NULL);
                 int64_t time_us = (int64_t)time.tv_sec * 1000000L + (int64_t)time.tv_usec;
-                _importExport->_bypassSessions[buffer] = time_us + ((int64_t)3600*1000000L);
+                _importExport->_bypassSessions.add(buffer, time_us + ((int64_t)3600*1000000L));
 
                 char randomstr2[33];
                 randomSeed(esp_random());
@@ -2687,7 +2728,7 @@ bool WebCfgServer::processTOTP(PsychicRequest *request, PsychicResponse* resp)
                 struct timeval time;
                 gettimeofday(&time, NULL);
                 int64_t time_us = (int64_t)time.tv_sec * 1000000L + (int64_t)time.tv_usec;
-                _importExport->_totpSessions[buffer] = time_us + (durationLength*1000000L);
+                _importExport->_totpSessions.add(buffer, time_us + (durationLength*1000000L));
                 saveSessions(2);
                 return true;
             }
@@ -2699,12 +2740,7 @@ bool WebCfgServer::processTOTP(PsychicRequest *request, PsychicResponse* resp)
 #ifndef NUKI_HUB_UPDATER
 esp_err_t WebCfgServer::sendWebSerial(PsychicRequest* request, PsychicResponse* resp)
 {
-    // escaped by https://www.cescaper.com/
-    resp->addHeader("Cache-Control", "public, max-age=3600");
-    resp->setCode(200);
-    resp->setContentType("text/html");
-    resp->setContent((const uint8_t *)WEBSERIAL_HTML, sizeof(WEBSERIAL_HTML));
-    return resp->send();
+    return sendStaticAsset(request, resp, WEBSERIAL_HTML, sizeof(WEBSERIAL_HTML), WEBSERIAL_HTML_gzip, WEBSERIAL_HTML_etag, "text/html", "public, max-age=3600");
 }
 
 void WebCfgServer::updateWebSerial()
@@ -3598,6 +3634,16 @@ bool WebCfgServer::processArgs(PsychicRequest *request, PsychicResponse* resp, S
                 configChanged = true;
             }
         }
+        else if(key == "INETCHKHOSTS")
+        {
+            if(_preferences->getString(preference_internet_check_hosts, "github.com") != value)
+            {
+                _preferences->putString(preference_internet_check_hosts, value);
+                Log->print("Setting changed: ");
+                Log->println(key);
+                configChanged = true;
+            }
+        }
         else if(key == "CHECKUPDATE")
         {
             if(_preferences->getBool(preference_check_updates, false) != (value == "1"))
@@ -5072,6 +5118,14 @@ bool WebCfgServer::processArgs(PsychicRequest *request, PsychicResponse* resp, S
         message = "Configuration saved.";
     }
 
+    reloadSettings();
+
+    return configChanged;
+}
+
+void WebCfgServer::reloadSettings()
+{
+    _config->reload();
     _importExport->readSettings();
 
     _network->readSettings();
@@ -5083,8 +5137,6 @@ bool WebCfgServer::processArgs(PsychicRequest *request, PsychicResponse* resp, S
     {
         _nukiOpener->readSettings();
     }
-
-    return configChanged;
 }
 
 bool WebCfgServer::processImport(PsychicRequest *request, PsychicResponse* resp, String& message)
@@ -5215,7 +5267,7 @@ esp_err_t WebCfgServer::buildCustomNetworkConfigHtml(PsychicRequest *request, Ps
 
 esp_err_t WebCfgServer::buildHtml(PsychicRequest *request, PsychicResponse* resp)
 {
-    String header = (String)"<script>let intervalId; window.onload = function() { updateInfo(); intervalId = setInterval(updateInfo, 3000); }; function updateInfo() { var request = new XMLHttpRequest(); request.open('GET', '/get?page=status', true); request.onload = () => { const obj = JSON.parse(request.responseText); if (obj.stop == 1) { clearInterval(intervalId); } for (var key of Object.keys(obj)) { if(key=='ota' && document.getElementById(key) !== null) { document.getElementById(key).innerText = \"<a href='/ota'>\" + obj[key] + \"</a>\"; } else if(document.getElementById(key) !== null) { document.getElementById(key).innerText = obj[key]; } } }; request.send(); }</script>";
+    String header = (String)"<script>let intervalId; window.onload = function() { if (window.EventSource) { var source = new EventSource('/statusevents'); source.addEventListener('status', (e) => { showInfo(JSON.parse(e.data)); }); } else { updateInfo(); intervalId = setInterval(updateInfo, 3000); } }; function updateInfo() { var request = new XMLHttpRequest(); request.open('GET', '/get?page=status', true); request.onload = () => { const obj = JSON.parse(request.responseText); if (obj.stop == 1) { clearInterval(intervalId); } showInfo(obj); }; request.send(); } function showInfo(obj) { for (var key of Object.keys(obj)) { if(key=='ota' && document.getElementById(key) !== null) { document.getElementById(key).innerText = \"<a href='/ota'>\" + obj[key] + \"</a>\"; } else if(document.getElementById(key) !== null) { document.getElementById(key).innerText = obj[key]; } } }</script>";
     PsychicStreamResponse response(resp, "text/html");
     response.beginSend();
     buildHtmlHeader(&response, header);
@@ -5243,7 +5295,7 @@ esp_err_t WebCfgServer::buildHtml(PsychicRequest *request, PsychicResponse* resp
 
         if(_nuki->isPaired())
         {
-            const String lockState = pinStateToString((NukiPinState)_preferences->getInt(preference_lock_pin_status, (int)NukiPinState::NotConfigured));
+            const String lockState = pinStateToString((NukiPinState)_config->get()->lockPinStatus);
             printParameter(&response, "Nuki Lock PIN status", lockState.c_str(), "", "lockPin");
 
             if(_preferences->getBool(preference_official_hybrid_enabled, false))
@@ -5269,7 +5321,7 @@ esp_err_t WebCfgServer::buildHtml(PsychicRequest *request, PsychicResponse* resp
         }
         if(_nukiOpener->isPaired())
         {
-            String openerState = pinStateToString((NukiPinState)_preferences->getInt(preference_opener_pin_status, (int)NukiPinState::NotConfigured));
+            String openerState = pinStateToString((NukiPinState)_config->get()->openerPinStatus);
             printParameter(&response, "Nuki Opener PIN status", openerState.c_str(), "", "openerPin");
         }
     }
@@ -5289,6 +5341,7 @@ esp_err_t WebCfgServer::buildHtml(PsychicRequest *request, PsychicResponse* resp
     buildNavigationMenuEntry(&response, "GPIO Configuration", "/get?page=gpiocfg");
     buildNavigationMenuEntry(&response, "Firmware update", "/get?page=ota");
     buildNavigationMenuEntry(&response, "Import/Export Configuration", "/get?page=impexpcfg");
+    buildNavigationMenuEntry(&response, "All Settings", "/get?page=settingsapp");
     if(_preferences->getInt(preference_network_hardware, 0) == 11)
     {
         buildNavigationMenuEntry(&response, "Custom Ethernet Configuration", "/get?page=custntw");
@@ -5480,6 +5533,7 @@ esp_err_t WebCfgServer::buildNetworkConfigHtml(PsychicRequest *request, PsychicR
 #endif
     printCheckBox(&response, "RSTDISC", "Restart on disconnect", _preferences->getBool(preference_restart_on_disconnect), "");
     printCheckBox(&response, "CHECKUPDATE", "Check for Firmware Updates every 24h", _preferences->getBool(preference_check_updates), "");
+    printInputField(&response, "INETCHKHOSTS", "Internet check hosts (comma separated, host or host:port)", _preferences->getString(preference_internet_check_hosts, "github.com").c_str(), 255, "");
     printCheckBox(&response, "FINDBESTRSSI", "Find WiFi AP with strongest signal", _preferences->getBool(preference_find_best_rssi, false), "");
     if(nuki_hub_https_server_enabled)
     {
@@ -5507,46 +5561,7 @@ esp_err_t WebCfgServer::buildMqttConfigHtml(PsychicRequest *request, PsychicResp
 {
     PsychicStreamResponse response(resp, "text/html");
     response.beginSend();
-    buildHtmlHeader(&response);
-    response.print("<form class=\"adapt\" method=\"post\" action=\"post\">");
-    response.print("<input type=\"hidden\" name=\"page\" value=\"savecfg\">");
-    response.print("<h3>Basic MQTT Configuration</h3>");
-    response.print("<table>");
-    printInputField(&response, "MQTTSERVER", "MQTT Broker", _preferences->getString(preference_mqtt_broker).c_str(), 100, "");
-    printInputField(&response, "MQTTPORT", "MQTT Broker port", _preferences->getInt(preference_mqtt_broker_port), 5, "");
-    printInputField(&response, "MQTTUSER", "MQTT User (# to clear)", _preferences->getString(preference_mqtt_user).c_str(), 30, "", false, true);
-    printInputField(&response, "MQTTPASS", "MQTT Password", "*", 40, "", true, true);
-    printInputField(&response, "MQTTPATH", "MQTT Nuki Hub Path", _preferences->getString(preference_mqtt_lock_path).c_str(), 180, "");
-    printCheckBox(&response, "ENHADISC", "Enable Home Assistant auto discovery", _preferences->getBool(preference_mqtt_hass_enabled), "chkHass");
-    response.print("</table><br>");
-
-    response.print("<h3>Advanced MQTT Configuration</h3>");
-    response.print("<table>");
-    printInputField(&response, "HASSDISCOVERY", "Home Assistant discovery topic (usually \"homeassistant\")", _preferences->getString(preference_mqtt_hass_discovery).c_str(), 30, "class=\"chkHass\"");
-    //printCheckBox(&response, "HADEVDISC", "Use Home Assistant device based discovery (2024.11+)", _preferences->getBool(preference_hass_device_discovery), "");
-    if(_preferences->getBool(preference_opener_enabled, false))
-    {
-        printCheckBox(&response, "OPENERCONT", "Set Nuki Opener Lock/Unlock action in Home Assistant to Continuous mode", _preferences->getBool(preference_opener_continuous_mode), "");
-    }
-    printCheckBox(&response, "MQTTSENA", "Enable MQTT SSL", _preferences->getBool(preference_mqtt_ssl_enabled, false), "");
-    response.print("<tr><td>Set MQTT SSL CA Certificate</td><td><button title=\"Set MQTT SSL CA Certificate\" onclick=\" window.open('/get?page=mqttcaconfig', '_self'); return false;\">Change</button></td></tr>");
-    response.print("<tr><td>Set MQTT SSL Client Certificate</td><td><button title=\"Set MQTT Client Certificate\" onclick=\" window.open('/get?page=mqttcrtconfig', '_self'); return false;\">Change</button></td></tr>");
-    response.print("<tr><td>Set MQTT SSL Client Key</td><td><button title=\"Set MQTT SSL Client Key\" onclick=\" window.open('/get?page=mqttkeyconfig', '_self'); return false;\">Change</button></td></tr>");
-    printInputField(&response, "NETTIMEOUT", "MQTT Timeout until restart (seconds; -1 to disable)", _preferences->getInt(preference_network_timeout), 5, "");
-    printCheckBox(&response, "MQTTLOG", "Enable MQTT logging", _preferences->getBool(preference_mqtt_log_enabled), "");
-    printCheckBox(&response, "UPDATEMQTT", "Allow updating using MQTT", _preferences->getBool(preference_update_from_mqtt), "");
-    printCheckBox(&response, "DISNONJSON", "Disable some extraneous non-JSON topics", _preferences->getBool(preference_disable_non_json), "");
-    printCheckBox(&response, "OFFHYBRID", "Enable hybrid official MQTT and Nuki Hub setup", _preferences->getBool(preference_official_hybrid_enabled), "");
-    printCheckBox(&response, "HYBRIDACT", "Enable sending actions through official MQTT", _preferences->getBool(preference_official_hybrid_actions), "");
-    printInputField(&response, "HYBRIDTIMER", "Time between status updates when official MQTT is offline (seconds)", _preferences->getInt(preference_query_interval_hybrid_lockstate), 5, "");
-    printCheckBox(&response, "HYBRIDRETRY", "Retry command sent using official MQTT over BLE if failed", _preferences->getBool(preference_official_hybrid_retry), "");
-    printCheckBox(&response, "HYBRIDREBOOT", "Reboot Nuki lock on official MQTT failure", _preferences->getBool(preference_hybrid_reboot_on_disconnect, false), "");
-    response.print("</table>");
-    response.print("<br><input type=\"submit\" name=\"submit\" value=\"Save\">");
-    response.print("</form>");
-    response.print("</body>");
-    response.print("<script>window.onload = function() { var hassChk; var hassTxt; for (var el of document.getElementsByClassName('chkHass')) { if (el.constructor.name === 'HTMLInputElement' && el.type === 'checkbox') { hassChk = el; el.addEventListener('change', hassChkChange); } else if (el.constructor.name==='HTMLInputElement' && el.type==='text') { hassTxt=el; el.addEventListener('keyup', hassTxtChange); } } function hassChkChange() { if(hassChk.checked == true) { if(hassTxt.value.length == 0) { hassTxt.value = 'homeassistant'; } } else { hassTxt.value = ''; } } function hassTxtChange() { if(hassTxt.value.length == 0) { hassChk.checked = false; } else { hassChk.checked = true; } } };</script>");
-    response.print("</html>");
+    renderPage(&response, mqttconfig_page);
     return response.endSend();
 }
 
@@ -5772,77 +5787,7 @@ esp_err_t WebCfgServer::buildAdvancedConfigHtml(PsychicRequest *request, Psychic
 {
     PsychicStreamResponse response(resp, "text/html");
     response.beginSend();
-    buildHtmlHeader(&response);
-    response.print("<form class=\"adapt\" method=\"post\" action=\"post\">");
-    response.print("<input type=\"hidden\" name=\"page\" value=\"savecfg\">");
-    response.print("<h3>Advanced Configuration</h3>");
-    response.print("<h4 class=\"warning\">Warning: Changing these settings can lead to bootloops that might require you to erase the ESP32 and reflash Nuki Hub using USB/serial</h4>");
-    response.print("<table>");
-    response.print("<tr><td>Current bootloop prevention state</td><td>");
-    response.print(_preferences->getBool(preference_enable_bootloop_reset, false) ? "Enabled" : "Disabled");
-    response.print("</td></tr>");
-    printCheckBox(&response, "DISNTWNOCON", "Disable Network if not connected within 60s", _preferences->getBool(preference_disable_network_not_connected, false), "");
-    printCheckBox(&response, "WEBLOG", "Enable WebSerial logging", _preferences->getBool(preference_force_hosted_update, false), "");    
-    printCheckBox(&response, "FRCHSTUPD", "Force slave Hosted update on next boot", _preferences->getBool(preference_webserial_enabled), "");
-    printCheckBox(&response, "BTLPRST", "Enable Bootloop prevention (Try to reset these settings to default on bootloop)", true, "");
-    printInputField(&response, "BUFFSIZE", "Char buffer size (min 4096, max 65536)", _preferences->getInt(preference_buffer_size, CHAR_BUFFER_SIZE), 6, "");
-    response.print("<tr><td>Advised minimum char buffer size based on current settings</td><td id=\"mincharbuffer\"></td>");
-    printInputField(&response, "TSKNTWK", "Task size Network (min 12288, max 65536)", _preferences->getInt(preference_task_size_network, NETWORK_TASK_SIZE), 6, "");
-    response.print("<tr><td>Advised minimum network task size based on current settings</td><td id=\"minnetworktask\"></td>");
-    printInputField(&response, "TSKNUKI", "Task size Nuki (min 8192, max 65536)", _preferences->getInt(preference_task_size_nuki, NUKI_TASK_SIZE), 6, "");
-    printInputField(&response, "BLEGENTIMEOUT", "BLE General timeout in ms (min 10000, max 65536)", _preferences->getInt(preference_ble_general_timeout, 10000), 6, "");
-    printInputField(&response, "BLECMDTIMEOUT", "BLE Command timeout in ms (min 3000, max 65536)", _preferences->getInt(preference_ble_command_timeout, 3000), 6, "");
-    printInputField(&response, "ALMAX", "Max auth log entries (min 1, max 100)", _preferences->getInt(preference_authlog_max_entries, MAX_AUTHLOG), 3, "id=\"inputmaxauthlog\"");
-    printInputField(&response, "KPMAX", "Max keypad entries (min 1, max 200)", _preferences->getInt(preference_keypad_max_entries, MAX_KEYPAD), 3, "id=\"inputmaxkeypad\"");
-    printInputField(&response, "TCMAX", "Max timecontrol entries (min 1, max 100)", _preferences->getInt(preference_timecontrol_max_entries, MAX_TIMECONTROL), 3, "id=\"inputmaxtimecontrol\"");
-    printInputField(&response, "AUTHMAX", "Max authorization entries (min 1, max 100)", _preferences->getInt(preference_auth_max_entries, MAX_AUTH), 3, "id=\"inputmaxauth\"");
-    printCheckBox(&response, "SHOWSECRETS", "Show Pairing secrets on Info page", _preferences->getBool(preference_show_secrets), "");
-    if(_preferences->getBool(preference_lock_enabled, true))
-    {
-        printCheckBox(&response, "LCKMANPAIR", "Manually set lock pairing data (enable to save values below)", false, "");
-        printInputField(&response, "LCKBLEADDR", "currentBleAddress", "", 12, "");
-        printInputField(&response, "LCKSECRETK", "secretKeyK", "", 64, "");
-        printInputField(&response, "LCKAUTHID", "authorizationId", "", 8, "");
-        printCheckBox(&response, "LCKISULTRA", "isUltra", false, "");
-    }
-    if(_preferences->getBool(preference_opener_enabled, false))
-    {
-        printCheckBox(&response, "OPNMANPAIR", "Manually set opener pairing data (enable to save values below)", false, "");
-        printInputField(&response, "OPNBLEADDR", "currentBleAddress", "", 12, "");
-        printInputField(&response, "OPNSECRETK", "secretKeyK", "", 64, "");
-        printInputField(&response, "OPNAUTHID", "authorizationId", "", 8, "");
-    }
-    printInputField(&response, "OTAUPD", "Custom URL to update Nuki Hub updater", "", 255, "");
-    printInputField(&response, "OTAMAIN", "Custom URL to update Nuki Hub", "", 255, "");
-
-    if(_nuki != nullptr)
-    {
-        char uidString[20];
-        itoa(_preferences->getUInt(preference_nuki_id_lock, 0), uidString, 16);
-        printCheckBox(&response, "LCKFORCEID", ((String)"Force Lock ID to current ID (" + uidString + ")").c_str(), _preferences->getBool(preference_lock_force_id, false), "");
-        printCheckBox(&response, "LCKFORCEKP", "Force Lock Keypad connected", _preferences->getBool(preference_lock_force_keypad, false), "");
-        printCheckBox(&response, "LCKFORCEDS", "Force Lock Doorsensor connected", _preferences->getBool(preference_lock_force_doorsensor, false), "");
-    }
-
-    if(_nukiOpener != nullptr)
-    {
-        char uidString[20];
-        itoa(_preferences->getUInt(preference_nuki_id_opener, 0), uidString, 16);
-        printCheckBox(&response, "OPFORCEID", ((String)"Force Opener ID to current ID (" + uidString + ")").c_str(), _preferences->getBool(preference_opener_force_id, false), "");
-        printCheckBox(&response, "OPFORCEKP", "Force Opener Keypad", _preferences->getBool(preference_opener_force_keypad, false), "");
-    }
-
-    printCheckBox(&response, "DBGCONN", "Enable Nuki connect debug logging", _preferences->getBool(preference_debug_connect, false), "");
-    printCheckBox(&response, "DBGCOMMU", "Enable Nuki communication debug logging", _preferences->getBool(preference_debug_communication, false), "");
-    printCheckBox(&response, "DBGREAD", "Enable Nuki readable data debug logging", _preferences->getBool(preference_debug_readable_data, false), "");
-    printCheckBox(&response, "DBGHEX", "Enable Nuki hex data debug logging", _preferences->getBool(preference_debug_hex_data, false), "");
-    printCheckBox(&response, "DBGCOMM", "Enable Nuki command debug logging", _preferences->getBool(preference_debug_command, false), "");
-    printCheckBox(&response, "DBGHEAP", "Publish free heap over MQTT", _preferences->getBool(preference_publish_debug_info, false), "");
-    response.print("</table>");
-
-    response.print("<br><input type=\"submit\" name=\"submit\" value=\"Save\">");
-    response.print("</form>");
-    response.print("</body><script>window.onload = function() { document.getElementById(\"inputmaxauthlog\").addEventListener(\"keyup\", calculate);document.getElementById(\"inputmaxkeypad\").addEventListener(\"keyup\", calculate);document.getElementById(\"inputmaxtimecontrol\").addEventListener(\"keyup\", calculate);document.getElementById(\"inputmaxauth\").addEventListener(\"keyup\", calculate); calculate(); }; function calculate() { var auth = document.getElementById(\"inputmaxauth\").value; var authlog = document.getElementById(\"inputmaxauthlog\").value; var keypad = document.getElementById(\"inputmaxkeypad\").value; var timecontrol = document.getElementById(\"inputmaxtimecontrol\").value; var charbuf = 0; var networktask = 0; var sizeauth = 0; var sizeauthlog = 0; var sizekeypad = 0; var sizetimecontrol = 0; if(auth > 0) { sizeauth = 300 * auth; } if(authlog > 0) { sizeauthlog = 280 * authlog; } if(keypad > 0) { sizekeypad = 350 * keypad; } if(timecontrol > 0) { sizetimecontrol = 120 * timecontrol; } charbuf = sizetimecontrol; networktask = 10240 + sizetimecontrol; if(sizeauthlog>sizekeypad && sizeauthlog>sizetimecontrol && sizeauthlog>sizeauth) { charbuf = sizeauthlog; networktask = 10240 + sizeauthlog;} else if(sizekeypad>sizeauthlog && sizekeypad>sizetimecontrol && sizekeypad>sizeauth) { charbuf = sizekeypad; networktask = 10240 + sizekeypad;} else if(sizeauth>sizeauthlog && sizeauth>sizetimecontrol && sizeauth>sizekeypad) { charbuf = sizeauth; networktask = 10240 + sizeauth;} if(charbuf<4096) { charbuf = 4096; } else if (charbuf>65536) { charbuf = 65536; } if(networktask<12288) { networktask = 12288; } else if (networktask>65536) { networktask = 65536; } document.getElementById(\"mincharbuffer\").innerHTML = charbuf; document.getElementById(\"minnetworktask\").innerHTML = networktask; }</script></html>");
+    renderPage(&response, advanced_page);
     return response.endSend();
 }
 
@@ -5850,12 +5795,22 @@ esp_err_t WebCfgServer::buildStatusHtml(PsychicRequest *request, PsychicResponse
 {
     JsonDocument json;
     String jsonStr;
+
+    json["stop"] = buildStatusJson(json) ? 1 : 0;
+
+    serializeJson(json, jsonStr);
+    resp->setCode(200);
+    resp->setContentType("application/json");
+    resp->setContent(jsonStr.c_str());
+    return resp->send();
+}
+
+bool WebCfgServer::buildStatusJson(JsonDocument& json)
+{
     bool mqttDone = false;
     bool lockDone = false;
     bool openerDone = false;
 
-    json["stop"] = 0;
-
     if(_network->mqttConnectionState() > 0)
     {
         json["mqttState"] = "Yes";
@@ -5877,7 +5832,11 @@ esp_err_t WebCfgServer::buildStatusHtml(PsychicRequest *request, PsychicResponse
 
         if(_nuki->isPaired())
         {
-            json["lockPin"] = pinStateToString((NukiPinState)_preferences->getInt(preference_lock_pin_status, (int)NukiPinState::NotConfigured));
+            json["lockPin"] = pinStateToString((NukiPinState)_config->get()->lockPinStatus);
+            if(_preferences->getBool(preference_official_hybrid_enabled, false))
+            {
+                json["lockHybrid"] = _nuki->offConnected() ? "Yes" : "No";
+            }
             if(strcmp(lockStateArr, "undefined") != 0)
             {
                 lockDone = true;
@@ -5911,7 +5870,7 @@ esp_err_t WebCfgServer::buildStatusHtml(PsychicRequest *request, PsychicResponse
 
         if(_nukiOpener->isPaired())
         {
-            json["openerPin"] = pinStateToString((NukiPinState)_preferences->getInt(preference_opener_pin_status, (int)NukiPinState::NotConfigured));
+            json["openerPin"] = pinStateToString((NukiPinState)_config->get()->openerPinStatus);
             if(strcmp(openerStateArr, "undefined") != 0)
             {
                 openerDone = true;
@@ -5932,16 +5891,42 @@ esp_err_t WebCfgServer::buildStatusHtml(PsychicRequest *request, PsychicResponse
         json["latestFirmware"] = _preferences->getString(preference_latest_version);
     }
 
-    if(mqttDone && lockDone && openerDone)
+    return mqttDone && lockDone && openerDone;
+}
+
+void WebCfgServer::updateStatusEvents()
+{
+    if(_statusEvents == nullptr || _statusEvents->count() == 0)
     {
-        json["stop"] = 1;
+        _statusEventsSent.clear();
+        return;
     }
 
-    serializeJson(json, jsonStr);
-    resp->setCode(200);
-    resp->setContentType("application/json");
-    resp->setContent(jsonStr.c_str());
-    return resp->send();
+    if(espMillis() - _statusEventsTs < WEB_STATUS_EVENTS_INTERVAL)
+    {
+        return;
+    }
+    _statusEventsTs = espMillis();
+
+    JsonDocument json;
+    JsonDocument changed;
+    buildStatusJson(json);
+
+    for(JsonPair kv : json.as<JsonObject>())
+    {
+        if(_statusEventsSent[kv.key()] != kv.value())
+        {
+            changed[kv.key()] = kv.value();
+            _statusEventsSent[kv.key()] = kv.value();
+        }
+    }
+
+    if(changed.size() > 0)
+    {
+        String jsonStr;
+        serializeJson(changed, jsonStr);
+        _statusEvents->send(jsonStr.c_str(), "status");
+    }
 }
 
 const String WebCfgServer::pinStateToString(const NukiPinState& value) const
@@ -6155,49 +6140,97 @@ esp_err_t WebCfgServer::buildNukiConfigHtml(PsychicRequest *request, PsychicResp
 {
     PsychicStreamResponse response(resp, "text/html");
     response.beginSend();
-    buildHtmlHeader(&response);
-    response.print("<form class=\"adapt\" method=\"post\" action=\"post\">");
-    response.print("<input type=\"hidden\" name=\"page\" value=\"savecfg\">");
-    response.print("<h3>Basic Nuki Configuration</h3>");
-    response.print("<table>");
-    printCheckBox(&response, "LOCKENA", "Nuki Lock enabled", _preferences->getBool(preference_lock_enabled, true), "");
-    printCheckBox(&response, "GEMINIENA", "Nuki Smartlock Ultra/Go/5th gen enabled", _preferences->getBool(preference_lock_gemini_enabled, false), "");
-    printCheckBox(&response, "OPENA", "Nuki Opener enabled", _preferences->getBool(preference_opener_enabled, false), "");
-    response.print("</table><br>");
-    response.print("<h3>Advanced Nuki Configuration</h3>");
-    response.print("<table>");
+    renderPage(&response, nukicfg_page);
+    return response.endSend();
+}
 
-    printInputField(&response, "LSTINT", "Query interval lock state (seconds)", _preferences->getInt(preference_query_interval_lockstate), 10, "");
-    printInputField(&response, "CFGINT", "Query interval configuration (seconds)", _preferences->getInt(preference_query_interval_configuration), 10, "");
-    printInputField(&response, "BATINT", "Query interval battery (seconds)", _preferences->getInt(preference_query_interval_battery), 10, "");
-    if((_nuki != nullptr && _nuki->hasKeypad()) || (_nukiOpener != nullptr && _nukiOpener->hasKeypad()))
-    {
-        printInputField(&response, "KPINT", "Query interval keypad (seconds)", _preferences->getInt(preference_query_interval_keypad), 10, "");
-    }
-    printInputField(&response, "NRTRY", "Number of retries if command failed", _preferences->getInt(preference_command_nr_of_retries), 10, "");
-    printInputField(&response, "TRYDLY", "Delay between retries (milliseconds)", _preferences->getInt(preference_command_retry_delay), 10, "");
-    if(_preferences->getBool(preference_lock_enabled, true) && !_preferences->getBool(preference_lock_gemini_enabled, false))
-    {
-        printCheckBox(&response, "REGAPP", "Lock: Nuki Bridge is running alongside Nuki Hub (needs re-pairing if changed)", _preferences->getBool(preference_register_as_app), "");
-    }
-    if(_preferences->getBool(preference_opener_enabled, false))
-    {
-        printCheckBox(&response, "REGAPPOPN", "Opener: Nuki Bridge is running alongside Nuki Hub (needs re-pairing if changed)", _preferences->getBool(preference_register_opener_as_app), "");
-    }
-    printInputField(&response, "RSBC", "Restart if bluetooth beacons not received (seconds; -1 to disable)", _preferences->getInt(preference_restart_ble_beacon_lost), 10, "");
+bool WebCfgServer::checkPageCondition(const WebPageCondition condition)
+{
+    switch(condition)
+    {
+    case WebPageCondition::LockActive:
+        return _nuki != nullptr;
+    case WebPageCondition::OpenerActive:
+        return _nukiOpener != nullptr;
+    case WebPageCondition::KeypadAvailable:
+        return (_nuki != nullptr && _nuki->hasKeypad()) || (_nukiOpener != nullptr && _nukiOpener->hasKeypad());
+    case WebPageCondition::TargetEsp32:
 #if defined(CONFIG_IDF_TARGET_ESP32)
-    printInputField(&response, "TXPWR", "BLE transmit power in dB (minimum -12, maximum 9)", _preferences->getInt(preference_ble_tx_power, 0), 10, "");
+        return true;
 #else
-    printInputField(&response, "TXPWR", "BLE transmit power in dB (minimum -12, maximum 20)", _preferences->getInt(preference_ble_tx_power, 9), 10, "");
+        return false;
 #endif
-    printCheckBox(&response, "UPTIME", "Update Nuki Hub and Lock/Opener time using NTP", _preferences->getBool(preference_update_time, false), "");
-    printInputField(&response, "TIMESRV", "NTP server", _preferences->getString(preference_time_server, "pool.ntp.org").c_str(), 255, "");
+    }
+    return false;
+}
 
-    response.print("</table>");
-    response.print("<br><input type=\"submit\" name=\"submit\" value=\"Save\">");
-    response.print("</form>");
-    response.print("</body></html>");
-    return response.endSend();
+void WebCfgServer::renderPage(PsychicStreamResponse *response, const WebPageTemplate& page)
+{
+    char buffer[20];
+    size_t index = 0;
+
+    while(index < page.count)
+    {
+        const WebPageOp& op = page.ops[index++];
+
+        switch(op.type)
+        {
+        case WebPageOpType::Fragment:
+            response->write((const uint8_t*)op.data, op.value);
+            break;
+        case WebPageOpType::String:
+            response->print(_preferences->getString(op.data, op.fallback != nullptr ? op.fallback : ""));
+            break;
+        case WebPageOpType::ValueAttribute:
+        {
+            String value = _preferences->getString(op.data, op.fallback != nullptr ? op.fallback : "");
+            if(value.length() > 0)
+            {
+                response->print(" value=\"");
+                response->print(value);
+            }
+            break;
+        }
+        case WebPageOpType::Int:
+            itoa(_preferences->getInt(op.data, op.value), buffer, 10);
+            response->print(buffer);
+            break;
+        case WebPageOpType::HexUInt:
+            itoa(_preferences->getUInt(op.data, op.value), buffer, 16);
+            response->print(buffer);
+            break;
+        case WebPageOpType::Checked:
+            if(_preferences->getBool(op.data, op.value))
+            {
+                response->print(" checked=\"checked\"");
+            }
+            break;
+        case WebPageOpType::EnabledText:
+            response->print(_preferences->getBool(op.data, op.value) ? "Enabled" : "Disabled");
+            break;
+        case WebPageOpType::IfBool:
+            if(!_preferences->getBool(op.data, op.value))
+            {
+                index = op.next;
+            }
+            break;
+        case WebPageOpType::IfNotBool:
+            if(_preferences->getBool(op.data, op.value))
+            {
+                index = op.next;
+            }
+            break;
+        case WebPageOpType::IfCondition:
+            if(!checkPageCondition((WebPageCondition)op.value))
+            {
+                index = op.next;
+            }
+            break;
+        case WebPageOpType::Jump:
+            index = op.next;
+            break;
+        }
+    }
 }
 
 esp_err_t WebCfgServer::buildGpioConfigHtml(PsychicRequest *request, PsychicResponse* resp)
@@ -7075,12 +7108,16 @@ esp_err_t WebCfgServer::processUnpair(PsychicRequest *request, PsychicResponse*
     if(!opener && _nuki != nullptr)
     {
         _nuki->unpair();
-        _preferences->putInt(preference_lock_pin_status, (int)NukiPinState::NotConfigured);
+        ConfigValues config = _config->edit();
+        config.lockPinStatus = (int)NukiPinState::NotConfigured;
+        _config->commit(config);
     }
     if(opener && _nukiOpener != nullptr)
     {
         _nukiOpener->unpair();
-        _preferences->putInt(preference_opener_pin_status, (int)NukiPinState::NotConfigured);
+        ConfigValues config = _config->edit();
+        config.openerPinStatus = (int)NukiPinState::NotConfigured;
+        _config->commit(config);
     }
 
     _network->disableHASS();
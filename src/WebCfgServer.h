@@ -9,6 +9,8 @@
 #endif
 #include "esp_ota_ops.h"
 #include "Config.h"
+#include "util/PerfectHash.h"
+#include "util/WebPageTemplate.h"
 
 #ifndef NUKI_HUB_UPDATER
 #include "NukiWrapper.h"
@@ -39,12 +41,43 @@ enum class TokenType
 
 extern TaskHandle_t networkTaskHandle;
 
+#define WEB_GET_ROUTE_SLOTS 256
+#define WEB_POST_ROUTE_SLOTS 64
+#define WEB_ROUTE_ADMIN_KEY 0x01
+
+class WebCfgServer;
+
+enum class WebAuthLevel : uint8_t
+{
+    None,
+    StatusJson,
+    DuoPending,
+    TotpPending,
+    User
+};
+
+enum class WebCachePolicy : uint8_t
+{
+    Default,
+    NoStore
+};
+
+struct WebRoute
+{
+    const char* page;
+    WebAuthLevel auth;
+    WebCachePolicy cache;
+    uint8_t flags;
+    esp_err_t (*handler)(WebCfgServer* server, PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid);
+};
+
 class WebCfgServer
 {
 public:
 #ifndef NUKI_HUB_UPDATER
-    WebCfgServer(NukiWrapper* nuki, NukiOpenerWrapper* nukiOpener, NukiNetwork* network, Gpio* gpio, Preferences* preferences, bool allowRestartToPortal, uint8_t partitionType, PsychicHttpServer* psychicServer, ImportExport* importExport);
+    WebCfgServer(NukiWrapper* nuki, NukiOpenerWrapper* nukiOpener, NukiNetwork* network, Gpio* gpio, Preferences* preferences, ConfigSnapshot* config, bool allowRestartToPortal, uint8_t partitionType, PsychicHttpServer* psychicServer, ImportExport* importExport);
     void updateWebSerial();
+    void updateStatusEvents();
 #else
     WebCfgServer(NukiNetwork* network, Preferences* preferences, bool allowRestartToPortal, uint8_t partitionType, PsychicHttpServer* psychicServer, ImportExport* importExport);
 #endif
@@ -58,6 +91,7 @@ private:
     bool processArgs(PsychicRequest *request, PsychicResponse* resp, String& message);
     bool processImport(PsychicRequest *request, PsychicResponse* resp, String& message);
     void processGpioArgs(PsychicRequest *request, PsychicResponse* resp);
+    void reloadSettings();
     esp_err_t buildHtml(PsychicRequest *request, PsychicResponse* resp);
     esp_err_t buildAccLvlHtml(PsychicRequest *request, PsychicResponse* resp);
     esp_err_t buildCredHtml(PsychicRequest *request, PsychicResponse* resp);
@@ -67,9 +101,12 @@ private:
     esp_err_t buildMqttSSLConfigHtml(PsychicRequest *request, PsychicResponse* resp, int type=0);
     esp_err_t buildHttpSSLConfigHtml(PsychicRequest *request, PsychicResponse* resp, int type=0);
     esp_err_t buildStatusHtml(PsychicRequest *request, PsychicResponse* resp);
+    bool buildStatusJson(JsonDocument& json);
     esp_err_t buildAdvancedConfigHtml(PsychicRequest *request, PsychicResponse* resp);
     esp_err_t buildNukiConfigHtml(PsychicRequest *request, PsychicResponse* resp);
     esp_err_t buildGpioConfigHtml(PsychicRequest *request, PsychicResponse* resp);
+    bool checkPageCondition(const WebPageCondition condition);
+    void renderPage(PsychicStreamResponse *response, const WebPageTemplate& page);
 #ifndef CONFIG_IDF_TARGET_ESP32H2
     esp_err_t buildConfigureWifiHtml(PsychicRequest *request, PsychicResponse* resp);
 #endif
@@ -78,6 +115,19 @@ private:
     esp_err_t processUnpair(PsychicRequest *request, PsychicResponse* resp, bool opener);
     esp_err_t processUpdate(PsychicRequest *request, PsychicResponse* resp);
     esp_err_t processFactoryReset(PsychicRequest *request, PsychicResponse* resp);
+    esp_err_t processRestartServices(PsychicRequest *request, PsychicResponse* resp);
+    esp_err_t processDebugMode(PsychicRequest *request, PsychicResponse* resp, bool enabled);
+    esp_err_t processExport(PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid);
+#ifndef CONFIG_IDF_TARGET_ESP32H2
+    esp_err_t processWifiManager(PsychicRequest *request, PsychicResponse* resp);
+#endif
+    esp_err_t processSaveConfig(PsychicRequest *request, PsychicResponse* resp);
+    esp_err_t processSaveGpioConfig(PsychicRequest *request, PsychicResponse* resp);
+    esp_err_t processImportPost(PsychicRequest *request, PsychicResponse* resp, bool adminKeyValid);
+    esp_err_t sendSettingsApp(PsychicRequest *request, PsychicResponse* resp);
+    esp_err_t sendSettingsApi(PsychicRequest *request, PsychicResponse* resp);
+    esp_err_t processSettingsApi(PsychicRequest *request, PsychicResponse* resp);
+    esp_err_t sendApprovalRequired(PsychicRequest *request, PsychicResponse* resp);
     void printTextarea(PsychicStreamResponse *response, const char *token, const char *description, const char *value, const size_t& maxLength, const bool& enabled = true, const bool& showLengthRestriction = false);
     void printDropDown(PsychicStreamResponse *response, const char *token, const char *description, const String preselectedValue, std::vector<std::pair<String, String>> options, const String className);
     void buildNavigationMenuEntry(PsychicStreamResponse *response, const char *title, const char *targetPath, const char* warningMessage = "");
@@ -98,10 +148,14 @@ private:
 
     NukiWrapper* _nuki = nullptr;
     NukiOpenerWrapper* _nukiOpener = nullptr;
+    ConfigSnapshot* _config = nullptr;
     Gpio* _gpio = nullptr;
     bool _brokerConfigured = false;
     bool _rebootRequired = false;
     int _restartServicesRequired = 0;
+    PsychicEventSource* _statusEvents = nullptr;
+    JsonDocument _statusEventsSent;
+    int64_t _statusEventsTs = 0;
 #endif
 
     std::vector<String> _ssidList;
@@ -109,7 +163,7 @@ private:
     String generateConfirmCode();
     String _confirmCode = "----";
 
-    void saveSessions(int type = 0);
+    void saveSessions(int type = 0, bool urgent = false);
     void loadSessions(int type = 0);
     void clearSessions();
     esp_err_t logoutSession(PsychicRequest *request, PsychicResponse* resp);
@@ -118,6 +172,14 @@ private:
     bool processTOTP(PsychicRequest *request, PsychicResponse* resp);
     bool processBypass(PsychicRequest *request, PsychicResponse* resp);
     int doAuthentication(PsychicRequest *request);
+    esp_err_t dispatchPage(PsychicRequest *request, PsychicResponse* resp, const bool post);
+    bool isApproved(PsychicRequest *request);
+    const WebRoute* findRoute(const char* page, const bool post) const;
+    bool checkAdminKey(PsychicRequest *request);
+    esp_err_t buildIndexHtml(PsychicRequest *request, PsychicResponse* resp);
+    esp_err_t buildNewBypassHtml(PsychicRequest *request, PsychicResponse* resp);
+    esp_err_t processLoginPost(PsychicRequest *request, PsychicResponse* resp, int type);
+    esp_err_t processReboot(PsychicRequest *request, PsychicResponse* resp, bool otherPartition);
     esp_err_t buildCoredumpHtml(PsychicRequest *request, PsychicResponse* resp);
     esp_err_t buildLoginHtml(PsychicRequest *request, PsychicResponse* resp);
     esp_err_t buildBypassHtml(PsychicRequest *request, PsychicResponse* resp);
@@ -130,6 +192,8 @@ private:
     esp_err_t sendCss(PsychicRequest *request, PsychicResponse* resp);
     esp_err_t sendWebSerial(PsychicRequest *request, PsychicResponse* resp);
     esp_err_t sendFavicon(PsychicRequest *request, PsychicResponse* resp);
+    esp_err_t sendStaticAsset(PsychicRequest *request, PsychicResponse* resp, const uint8_t* data, size_t len, bool gzip, const char* etag, const char* contentType, const char* cacheControl);
+    bool acceptsGzip(PsychicRequest *request);
     void createSsidList();
     void buildHtmlHeader(PsychicStreamResponse *response, String additionalHeader = "");
     void waitAndProcess(const bool blocking, const uint32_t duration);
@@ -143,6 +207,13 @@ private:
     void printInputField(PsychicStreamResponse *response, const char* token, const char* description, const char* value, const size_t& maxLength, const char* args, const bool& isPassword = false, const bool& showLengthRestriction = false);
     void printInputField(PsychicStreamResponse *response, const char* token, const char* description, const int value, size_t maxLength, const char* args);
 
+    static const WebRoute _getRoutes[];
+    static const WebRoute _postRoutes[];
+    static const WebRoute _getFallbackRoute;
+    static const WebRoute _postFallbackRoute;
+    static const PerfectHashTable<WEB_GET_ROUTE_SLOTS> _getRouteIndex;
+    static const PerfectHashTable<WEB_POST_ROUTE_SLOTS> _postRouteIndex;
+
     PsychicHttpServer* _psychicServer = nullptr;
     NukiNetwork* _network = nullptr;
     Preferences* _preferences = nullptr;
@@ -155,7 +226,7 @@ private:
     uint8_t _partitionType = 0;
     size_t _otaContentLen = 0;
     String _hostname;
-    JsonDocument _httpSessions;
+    SessionTable _httpSessions;
     bool _duoEnabled = false;
     bool _bypassGPIO = false;
     bool _newBypass = false;
@@ -1,20 +1,12 @@
 #pragma once
 
-// converted to char array by bin2array
-const char stylecss[] =
-{
+// converted to gzip compressed arrays with ETags by compress_assets.py
 #include "webServerConstants/style.h"
-};
-
-// converted to char array by bin2array
-const uint8_t favicon_32x32[]  =
-{
 #include "webServerConstants/favicon-32x32.h"
-};
 
 #ifndef NUKI_HUB_UPDATER
-const uint8_t WEBSERIAL_HTML[] =
-{
 #include "webServerConstants/webSerial.h"
-};
-#endif
\ No newline at end of file
+#include "webServerConstants/settings.h"
+// settings pages compiled from resources/pages by compile_pages.py
+#include "webServerConstants/webPages.h"
+#endif
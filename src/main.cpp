@@ -42,7 +42,7 @@ bool nuki_hub_https_server_enabled = false;
 #include "NukiOpenerWrapper.h"
 #include "Gpio.h"
 #include "Gpio.h"
-#include "CharBuffer.h"
+#include "util/ScratchArena.h"
 #include "NukiDeviceId.h"
 #include "WebCfgServer.h"
 #include "Logger.h"
@@ -51,8 +51,12 @@ bool nuki_hub_https_server_enabled = false;
 #include "EspMillis.h"
 #include "NimBLEDevice.h"
 #include "ImportExport.h"
+#include "util/TaskScheduler.h"
+#include "util/WriteBehindStore.h"
+#include "util/OtaManifestFetcher.h"
 
 NukiNetworkLock* networkLock = nullptr;
+ConfigSnapshot* config = nullptr;
 NukiNetworkOpener* networkOpener = nullptr;
 BleScanner::Scanner* bleScanner = nullptr;
 NukiWrapper* nuki = nullptr;
@@ -84,6 +88,8 @@ int64_t restartTs = (pow(2,63) - (5 * 1000 * 60000)) / 1000;
 #include "../../src/NukiNetwork.h"
 #include "../../src/EspMillis.h"
 #include "../../src/ImportExport.h"
+#include "../../src/util/TaskScheduler.h"
+#include "../../src/util/WriteBehindStore.h"
 
 int64_t restartTs = 10 * 60 * 1000;
 
@@ -603,6 +609,28 @@ void cbSyncTime(struct timeval *tv)
     timeSynced = true;
 }
 
+void configureWebServer(httpd_config_t& httpd)
+{
+    // when all sockets are taken, close the least recently used connection instead of refusing the new one
+    httpd.stack_size = HTTPD_TASK_SIZE;
+    httpd.lru_purge_enable = HTTPD_LRU_PURGE_ENABLE;
+    httpd.keep_alive_enable = HTTPD_KEEP_ALIVE_ENABLE;
+    httpd.keep_alive_idle = HTTPD_KEEP_ALIVE_IDLE;
+    httpd.keep_alive_interval = HTTPD_KEEP_ALIVE_INTERVAL;
+    httpd.keep_alive_count = HTTPD_KEEP_ALIVE_COUNT;
+}
+
+void configureWebServer(PsychicHttpsServer* server)
+{
+    // PsychicHttpsServer starts from ssl_config.httpd, its config member is not used
+    configureWebServer(server->ssl_config.httpd);
+    server->ssl_config.httpd.max_open_sockets = HTTPD_SSL_MAX_OPEN_SOCKETS;
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_TICKETS
+    // resumed sessions skip the key exchange, the expensive part of a handshake on the ESP32
+    server->ssl_config.session_tickets = HTTPD_SSL_SESSION_TICKETS;
+#endif
+}
+
 #ifndef NUKI_HUB_UPDATER
 void startWebServer()
 {
@@ -668,10 +696,9 @@ void startWebServer()
                     });
                     psychicServerRedirect->begin();
                     psychicSSLServer = new PsychicHttpsServer;
-                    psychicSSLServer->ssl_config.httpd.max_open_sockets = 8;
+                    configureWebServer(psychicSSLServer);
                     psychicSSLServer->setCertificate(cert, key);
-                    psychicSSLServer->config.stack_size = HTTPD_TASK_SIZE;
-                    webCfgServerSSL = new WebCfgServer(nuki, nukiOpener, network, gpio, preferences, network->networkDeviceType() == NetworkDeviceType::WiFi, partitionType, psychicSSLServer, importExport);
+                    webCfgServerSSL = new WebCfgServer(nuki, nukiOpener, network, gpio, preferences, config, network->networkDeviceType() == NetworkDeviceType::WiFi, partitionType, psychicSSLServer, importExport);
                     webCfgServerSSL->initialize();
                     psychicSSLServer->onNotFound([](PsychicRequest* request, PsychicResponse* response)
                     {
@@ -688,8 +715,8 @@ void startWebServer()
     if (failed)
     {
         psychicServer = new PsychicHttpServer;
-        psychicServer->config.stack_size = HTTPD_TASK_SIZE;
-        webCfgServer = new WebCfgServer(nuki, nukiOpener, network, gpio, preferences, network->networkDeviceType() == NetworkDeviceType::WiFi, partitionType, psychicServer, importExport);
+        configureWebServer(psychicServer->config);
+        webCfgServer = new WebCfgServer(nuki, nukiOpener, network, gpio, preferences, config, network->networkDeviceType() == NetworkDeviceType::WiFi, partitionType, psychicServer, importExport);
         webCfgServer->initialize();
         psychicServer->onNotFound([](PsychicRequest* request, PsychicResponse* response)
         {
@@ -705,7 +732,7 @@ void startNuki(bool lock)
     if (lock)
     {
         nukiOfficial = new NukiOfficial(preferences);
-        networkLock = new NukiNetworkLock(network, nukiOfficial, preferences, CharBuffer::get(), buffer_size);
+        networkLock = new NukiNetworkLock(network, nukiOfficial, preferences, config);
 
         if(!disableNetwork)
         {
@@ -716,7 +743,7 @@ void startNuki(bool lock)
     }
     else
     {
-        networkOpener = new NukiNetworkOpener(network, preferences, CharBuffer::get(), buffer_size);
+        networkOpener = new NukiNetworkOpener(network, preferences, config);
 
         if(!disableNetwork)
         {
@@ -732,6 +759,7 @@ void restartServices(bool reconnect)
     bleDone = false;
     lockEnabled = preferences->getBool(preference_lock_enabled);
     openerEnabled = preferences->getBool(preference_opener_enabled);
+    config->reload();
     importExport->readSettings();
     network->readSettings();
     gpio->setPins();
@@ -853,7 +881,7 @@ void restartServices(bool reconnect)
             startNuki(true);
         }
 
-        nuki = new NukiWrapper("NukiHub", deviceIdLock, bleScanner, networkLock, nukiOfficial, gpio, preferences, CharBuffer::get(), buffer_size);
+        nuki = new NukiWrapper("NukiHub", deviceIdLock, bleScanner, networkLock, nukiOfficial, gpio, preferences, config);
         nuki->initialize();
         bleScanner->whitelist(nuki->getBleAddress());
         Log->println("Restarting Nuki lock done");
@@ -868,7 +896,7 @@ void restartServices(bool reconnect)
             startNuki(false);
         }
 
-        nukiOpener = new NukiOpenerWrapper("NukiHub", deviceIdOpener, bleScanner, networkOpener, gpio, preferences, CharBuffer::get(), buffer_size);
+        nukiOpener = new NukiOpenerWrapper("NukiHub", deviceIdOpener, bleScanner, networkOpener, gpio, preferences, config);
         nukiOpener->initialize();
         bleScanner->whitelist(nukiOpener->getBleAddress());
         Log->println("Restarting Nuki opener done");
@@ -902,6 +930,8 @@ void restartServices(bool reconnect)
 
 void networkTask(void *pvParameters)
 {
+    // registered by the task before its first pass, events raised earlier are picked up by that pass
+    TaskScheduler::registerTask(SchedulerTask::Network, xTaskGetCurrentTaskHandle());
     int64_t networkLoopTs = 0;
     bool reroute = true;
     if(preferences->getBool(preference_show_secrets, false))
@@ -910,6 +940,9 @@ void networkTask(void *pvParameters)
     }
     while(true)
     {
+#ifndef NUKI_HUB_UPDATER
+        ScratchArena::get(SchedulerTask::Network)->reset();
+#endif
         int64_t ts = espMillis();
         if(ts > 120000 && ts < 125000)
         {
@@ -927,11 +960,7 @@ void networkTask(void *pvParameters)
         }
 #endif
         network->update();
-        if (esp_task_wdt_status(NULL) == ESP_OK)
-        {
-            esp_task_wdt_reset();
-        }
-        vTaskDelay(50 / portTICK_PERIOD_MS);
+        WriteBehindStore::get()->update();
         bool connected = network->isConnected();
 
         if(connected && reroute)
@@ -1003,34 +1032,30 @@ void networkTask(void *pvParameters)
         }
         else
         {
-            if(connected && webSerialEnabled && (webSSLStarted || webStarted))
+            WebCfgServer* activeWebCfgServer = webSSLStarted ? webCfgServerSSL : webCfgServer;
+
+            if(connected && webSerialEnabled && activeWebCfgServer != nullptr)
             {
-                webCfgServerSSL->updateWebSerial();
-                if (esp_task_wdt_status(NULL) == ESP_OK)
-                {
-                    esp_task_wdt_reset();
-                }
-                vTaskDelay(50 / portTICK_PERIOD_MS);
+                activeWebCfgServer->updateWebSerial();
+            }
+
+            if(activeWebCfgServer != nullptr)
+            {
+                activeWebCfgServer->updateStatusEvents();
             }
 
             if(connected && lockStarted)
             {
                 rebootLock = networkLock->update();
-                if (esp_task_wdt_status(NULL) == ESP_OK)
+                if(rebootLock)
                 {
-                    esp_task_wdt_reset();
+                    TaskScheduler::notify(SchedulerTask::Nuki, SCHEDULER_EVENT_RESTART);
                 }
-                vTaskDelay(50 / portTICK_PERIOD_MS);
             }
 
             if(connected && openerStarted)
             {
                 networkOpener->update();
-                if (esp_task_wdt_status(NULL) == ESP_OK)
-                {
-                    esp_task_wdt_reset();
-                }
-                vTaskDelay(50 / portTICK_PERIOD_MS);
             }
         }
 #endif
@@ -1053,11 +1078,7 @@ void networkTask(void *pvParameters)
             restartEsp(RestartReason::RestartTimer);
         }
 
-        if (esp_task_wdt_status(NULL) == ESP_OK)
-        {
-            esp_task_wdt_reset();
-        }
-        vTaskDelay(50 / portTICK_PERIOD_MS);
+        TaskScheduler::waitUntil(SchedulerTask::Network, espMillis() + NETWORK_TASK_MAX_IDLE, NETWORK_TASK_MAX_IDLE);
     }
 }
 
@@ -1110,6 +1131,7 @@ static void print_all_tasks_info(void)
 #endif
 void nukiTask(void *pvParameters)
 {
+    TaskScheduler::registerTask(SchedulerTask::Nuki, xTaskGetCurrentTaskHandle());
     esp_task_wdt_add(NULL);
 
     if (preferences->getBool(preference_mqtt_ssl_enabled, false))
@@ -1137,16 +1159,13 @@ void nukiTask(void *pvParameters)
     bool whiteListed = false;
     while(true)
     {
+        ScratchArena::get(SchedulerTask::Nuki)->reset();
+
         if((disableNetwork || wifiConnected) && bleDone)
         {
             if(bleScannerStarted)
             {
                 bleScanner->update();
-                if (esp_task_wdt_status(NULL) == ESP_OK)
-                {
-                    esp_task_wdt_reset();
-                }
-                vTaskDelay(20 / portTICK_PERIOD_MS);
             }
 
             bool needsPairing = (lockStarted && !nuki->isPaired()) || (openerStarted && !nukiOpener->isPaired());
@@ -1244,11 +1263,22 @@ void nukiTask(void *pvParameters)
             Log->println("nukiTask is running");
             nukiLoopTs = espMillis();
         }
-        if (esp_task_wdt_status(NULL) == ESP_OK)
+
+        int64_t deadline = espMillis() + NUKI_TASK_MAX_IDLE;
+
+        if((disableNetwork || wifiConnected) && bleDone)
         {
-            esp_task_wdt_reset();
+            if(lockStarted && nuki != nullptr)
+            {
+                deadline = TaskScheduler::earliest(deadline, nuki->nextDeadline());
+            }
+            if(openerStarted && nukiOpener != nullptr)
+            {
+                deadline = TaskScheduler::earliest(deadline, nukiOpener->nextDeadline());
+            }
         }
-        vTaskDelay(50 / portTICK_PERIOD_MS);
+
+        TaskScheduler::waitUntil(SchedulerTask::Nuki, deadline, NUKI_TASK_MAX_IDLE);
     }
 }
 
@@ -1590,6 +1620,7 @@ void setup()
         preferences->putString(preference_updater_date, NUKI_HUB_DATE);
     }
 
+    WriteBehindStore::initialize(preferences);
     importExport = new ImportExport(preferences);
 
     network = new NukiNetwork(preferences);
@@ -1657,9 +1688,8 @@ void setup()
                         });
                         psychicServer->begin();
                         psychicSSLServer = new PsychicHttpsServer;
-                        psychicSSLServer->ssl_config.httpd.max_open_sockets = 8;
+                        configureWebServer(psychicSSLServer);
                         psychicSSLServer->setCertificate(cert, key);
-                        psychicSSLServer->config.stack_size = HTTPD_TASK_SIZE;
                         webCfgServerSSL = new WebCfgServer(network, preferences, network->networkDeviceType() == NetworkDeviceType::WiFi, partitionType, psychicSSLServer, importExport);
                         webCfgServerSSL->initialize();
                         psychicSSLServer->onNotFound([](PsychicRequest* request, PsychicResponse* response)
@@ -1677,7 +1707,7 @@ void setup()
         if (failed)
         {
             psychicServer = new PsychicHttpServer;
-            psychicServer->config.stack_size = HTTPD_TASK_SIZE;
+            configureWebServer(psychicServer->config);
             webCfgServer = new WebCfgServer(network, preferences, network->networkDeviceType() == NetworkDeviceType::WiFi, partitionType, psychicServer, importExport);
             webCfgServer->initialize();
             psychicServer->onNotFound([](PsychicRequest* request, PsychicResponse* response)
@@ -1711,16 +1741,19 @@ void setup()
     }
 
     buffer_size = preferences->getInt(preference_buffer_size, CHAR_BUFFER_SIZE);
-    CharBuffer::initialize(buffer_size);
+    ScratchArena::initialize(buffer_size);
 
     gpio = new Gpio(preferences);
     String gpioDesc;
     gpio->getConfigurationText(gpioDesc, gpio->pinConfiguration(), "\n\r");
     Log->print(gpioDesc.c_str());
 
+    config = new ConfigSnapshot(preferences);
+    WriteBehindStore::initialize(preferences);
+    OtaManifestFetcher::initialize(GITHUB_OTA_MANIFEST_URL);
     importExport = new ImportExport(preferences);
 
-    network = new NukiNetwork(preferences, gpio, CharBuffer::get(), buffer_size, importExport);
+    network = new NukiNetwork(preferences, config, gpio, importExport);
     network->initialize();
 
     lockEnabled = preferences->getBool(preference_lock_enabled);
@@ -1752,7 +1785,7 @@ void setup()
     {
         startNuki(true);
 
-        nuki = new NukiWrapper("NukiHub", deviceIdLock, bleScanner, networkLock, nukiOfficial, gpio, preferences, CharBuffer::get(), buffer_size);
+        nuki = new NukiWrapper("NukiHub", deviceIdLock, bleScanner, networkLock, nukiOfficial, gpio, preferences, config);
         nuki->initialize();
     }
 
@@ -1761,7 +1794,7 @@ void setup()
     {
         startNuki(false);
 
-        nukiOpener = new NukiOpenerWrapper("NukiHub", deviceIdOpener, bleScanner, networkOpener, gpio, preferences, CharBuffer::get(), buffer_size);
+        nukiOpener = new NukiOpenerWrapper("NukiHub", deviceIdOpener, bleScanner, networkOpener, gpio, preferences, config);
         nukiOpener->initialize();
     }
 
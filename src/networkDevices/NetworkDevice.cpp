@@ -7,6 +7,67 @@
 #include "SPIFFS.h"
 #include "../MqttTopics.h"
 #include "PreferencesKeys.h"
+#include "../LogEvents.h"
+
+static char* readPemFile(const char* path)
+{
+    File file = SPIFFS.open(path);
+    if (!file || file.isDirectory())
+    {
+        return nullptr;
+    }
+
+    size_t size = file.size();
+    char* buffer = nullptr;
+
+    if(size > 1)
+    {
+        buffer = (char*)malloc(size + 1);
+        if(buffer != nullptr)
+        {
+            size_t read = file.read((uint8_t*)buffer, size);
+            buffer[read] = 0;
+        }
+    }
+    file.close();
+
+    return buffer;
+}
+
+void NetworkDevice::loadTlsCredentials()
+{
+    if(_tlsCredentialsLoaded)
+    {
+        return;
+    }
+
+    if (!SPIFFS.begin(true))
+    {
+        Log->println("SPIFFS Mount Failed");
+        return;
+    }
+
+    _tlsCredentialsLoaded = true;
+
+    Log->println("Reading mqtt_ssl.ca");
+    _caCert = readPemFile("/mqtt_ssl.ca");
+    if(_caCert == nullptr)
+    {
+        Log->println("mqtt_ssl.ca not found");
+        return;
+    }
+
+    _clientCert = readPemFile("/mqtt_ssl.crt");
+    _clientKey = readPemFile("/mqtt_ssl.key");
+    if(_clientCert == nullptr || _clientKey == nullptr)
+    {
+        Log->println("mqtt_ssl.crt or mqtt_ssl.key not found");
+        free(_clientCert);
+        free(_clientKey);
+        _clientCert = nullptr;
+        _clientKey = nullptr;
+    }
+}
 
 void NetworkDevice::init()
 {
@@ -14,68 +75,27 @@ void NetworkDevice::init()
 
     if(_preferences->getBool(preference_mqtt_ssl_enabled, false))
     {
-        if (!SPIFFS.begin(true))
-        {
-            Log->println("SPIFFS Mount Failed");
-        }
-        else
+        loadTlsCredentials();
+
+        if(_caCert != nullptr)
         {
-            File file = SPIFFS.open("/mqtt_ssl.ca");
-            if (!file || file.isDirectory())
+            _useEncryption = true;
+            Log->println("MQTT over TLS.");
+            if(_mqttInternal)
             {
-                Log->println("mqtt_ssl.ca not found");
+                _mqttClientSecure = new espMqttClientSecure(espMqttClientTypes::UseInternalTask::YES);
             }
             else
             {
-                Log->println("Reading mqtt_ssl.ca");
-                String ca_cert = file.readString();
-                file.close();
-                char* caDest;
-                caDest = (char *)malloc(sizeof(char) * (ca_cert.length()+1));
-                strcpy(caDest, ca_cert.c_str());
-
-                if(ca_cert.length() > 1)
-                {
-                    _useEncryption = true;
-                    Log->println("MQTT over TLS.");
-                    if(_mqttInternal)
-                    {
-                        _mqttClientSecure = new espMqttClientSecure(espMqttClientTypes::UseInternalTask::YES);
-                    }
-                    else
-                    {
-                        _mqttClientSecure = new espMqttClientSecure(espMqttClientTypes::UseInternalTask::NO);
-                    }
-                    _mqttClientSecure->setCACert(caDest);
-
-                    File file2 = SPIFFS.open("/mqtt_ssl.crt");
-                    File file3 = SPIFFS.open("/mqtt_ssl.key");
-                    if (!file2 || file2.isDirectory() || !file3 || file3.isDirectory())
-                    {
-                        Log->println("mqtt_ssl.crt or mqtt_ssl.key not found");
-                    }
-                    else
-                    {
-                        String cert = file2.readString();
-                        file2.close();
-                        char* certDest;
-                        certDest = (char *)malloc(sizeof(char) * (cert.length()+1));
-                        strcpy(certDest, cert.c_str());
-
-                        String key = file3.readString();
-                        file3.close();
-                        char* keyDest;
-                        keyDest = (char *)malloc(sizeof(char) * (key.length()+1));
-                        strcpy(keyDest, key.c_str());
-
-                        if(cert.length() > 1 && key.length() > 1)
-                        {
-                            Log->println("MQTT with client certificate.");
-                            _mqttClientSecure->setCertificate(certDest);
-                            _mqttClientSecure->setPrivateKey(keyDest);
-                        }
-                    }
-                }
+                _mqttClientSecure = new espMqttClientSecure(espMqttClientTypes::UseInternalTask::NO);
+            }
+            _mqttClientSecure->setCACert(_caCert);
+
+            if(_clientCert != nullptr && _clientKey != nullptr)
+            {
+                Log->println("MQTT with client certificate.");
+                _mqttClientSecure->setCertificate(_clientCert);
+                _mqttClientSecure->setPrivateKey(_clientKey);
             }
         }
     }
@@ -110,13 +130,33 @@ void NetworkDevice::init()
             mode = MqttLoggerMode::MqttAndSerial;
         }
 
-        _path = new char[200];
-        memset(_path, 0, sizeof(_path));
-
-        String pathStr = _preferences->getString(preference_mqtt_lock_path);
-        pathStr.concat(mqtt_topic_log);
-        strcpy(_path, pathStr.c_str());
-        Log = new MqttLogger(*getMqttClient(), _path, mode);
+        // the logger owns a drain task, keep it across mqttRestart()
+        if(_mqttLogger == nullptr)
+        {
+            _path = new char[200];
+            memset(_path, 0, sizeof(_path));
+
+            String pathStr = _preferences->getString(preference_mqtt_lock_path);
+            pathStr.concat(mqtt_topic_log);
+            strcpy(_path, pathStr.c_str());
+            _mqttLogger = new MqttLogger(*getMqttClient(), _path, mode);
+            _mqttLogger->setEventFormats(logEventFormats, (uint16_t)LogEvent::Count);
+#ifdef NUKI_HUB_BINARY_LOG
+            // raw events for scripts/decodelog
+            char* binaryPath = new char[200];
+            String binaryPathStr = _preferences->getString(preference_mqtt_lock_path);
+            binaryPathStr.concat(mqtt_topic_log_binary);
+            strlcpy(binaryPath, binaryPathStr.c_str(), 200);
+            _mqttLogger->setBinaryTopic(binaryPath);
+#endif
+        }
+        else
+        {
+            _mqttLogger->setClient(*getMqttClient());
+            _mqttLogger->setMode(mode);
+        }
+        Log = _mqttLogger;
+        EventLog = _mqttLogger;
     }
 }
 void NetworkDevice::update()
@@ -166,6 +206,18 @@ void NetworkDevice::mqttSetKeepAlive(uint16_t keepAlive)
     }
 }
 
+void NetworkDevice::mqttSetPublishCoalescing(bool coalesce)
+{
+    if (_useEncryption)
+    {
+        _mqttClientSecure->setPublishCoalescing(coalesce);
+    }
+    else
+    {
+        _mqttClient->setPublishCoalescing(coalesce);
+    }
+}
+
 uint16_t NetworkDevice::mqttPublish(const char *topic, uint8_t qos, bool retain, const char *payload)
 {
     MqttClient* client = getMqttClient();
@@ -193,6 +245,60 @@ bool NetworkDevice::mqttConnected() const
     return client->connected();
 }
 
+espMqttClientTypes::PoolStats NetworkDevice::mqttPoolStats()
+{
+    MqttClient* client = getMqttClient();
+    if (client == nullptr) {
+        return espMqttClientTypes::PoolStats();
+    }
+    return client->poolStats();
+}
+
+uint32_t NetworkDevice::mqttCoalescedPublishes()
+{
+    MqttClient* client = getMqttClient();
+    if (client == nullptr) {
+        return 0;
+    }
+    return client->coalescedPublishes();
+}
+
+uint32_t NetworkDevice::mqttTlsHandshakeTime()
+{
+    if (!_useEncryption || _mqttClientSecure == nullptr)
+    {
+        return 0;
+    }
+    return _mqttClientSecure->tlsHandshakeTime();
+}
+
+bool NetworkDevice::mqttTlsSessionResumed()
+{
+    if (!_useEncryption || _mqttClientSecure == nullptr)
+    {
+        return false;
+    }
+    return _mqttClientSecure->tlsSessionResumed();
+}
+
+uint32_t NetworkDevice::mqttTlsHandshakes()
+{
+    if (!_useEncryption || _mqttClientSecure == nullptr)
+    {
+        return 0;
+    }
+    return _mqttClientSecure->tlsHandshakes();
+}
+
+uint32_t NetworkDevice::mqttTlsResumedHandshakes()
+{
+    if (!_useEncryption || _mqttClientSecure == nullptr)
+    {
+        return 0;
+    }
+    return _mqttClientSecure->tlsResumedHandshakes();
+}
+
 void NetworkDevice::mqttSetServer(const char *host, uint16_t port)
 {
     if (_useEncryption)
@@ -307,6 +413,11 @@ void NetworkDevice::mqttRestart()
         xSemaphoreTake(_mqttClientMutex, portMAX_DELAY);
     }
 
+    if (_mqttLogger != nullptr)
+    {
+        _mqttLogger->clearClient();
+    }
+
     if (_useEncryption)
     {
         delete _mqttClientSecure;
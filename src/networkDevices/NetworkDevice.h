@@ -2,6 +2,7 @@
 
 #ifndef NUKI_HUB_UPDATER
 #include "espMqttClient.h"
+#include "MqttLogger.h"
 #endif
 #include "IPConfiguration.h"
 
@@ -47,6 +48,12 @@ public:
     virtual void mqttDisable();
     virtual void mqttRestart();
     virtual bool mqttConnected() const;
+    virtual espMqttClientTypes::PoolStats mqttPoolStats();
+    virtual uint32_t mqttCoalescedPublishes();
+    virtual uint32_t mqttTlsHandshakeTime();
+    virtual bool mqttTlsSessionResumed();
+    virtual uint32_t mqttTlsHandshakes();
+    virtual uint32_t mqttTlsResumedHandshakes();
 
     virtual uint16_t mqttPublish(const char* topic, uint8_t qos, bool retain, const char* payload);
     virtual uint16_t mqttPublish(const char* topic, uint8_t qos, bool retain, const uint8_t* payload, size_t length);
@@ -56,6 +63,7 @@ public:
     virtual void mqttSetClientId(const char* clientId);
     virtual void mqttSetCleanSession(bool cleanSession);
     virtual void mqttSetKeepAlive(uint16_t keepAlive);
+    virtual void mqttSetPublishCoalescing(bool coalesce);
     virtual void mqttSetWill(const char* topic, uint8_t qos, bool retain, const char* payload);
     virtual void mqttSetCredentials(const char* username, const char* password);
 
@@ -74,6 +82,7 @@ protected:
     SemaphoreHandle_t _mqttClientMutex = nullptr;
 
     void init();
+    void loadTlsCredentials();
 
     MqttClient *getMqttClient() const;
 
@@ -81,6 +90,13 @@ protected:
     bool _mqttEnabled = true;
     bool _mqttInternal = false;
     char* _path;
+    MqttLogger* _mqttLogger = nullptr;
+
+    // kept for the lifetime of the device, the TLS client only stores the pointers
+    bool _tlsCredentialsLoaded = false;
+    char* _caCert = nullptr;
+    char* _clientCert = nullptr;
+    char* _clientKey = nullptr;
 #endif
 
     const String _hostname;
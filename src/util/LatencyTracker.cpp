@@ -0,0 +1,48 @@
+#include "LatencyTracker.h"
+#include <algorithm>
+
+void LatencyTracker::addSample(const int64_t& latencyUs)
+{
+    _samples[_next] = latencyUs;
+    _next = (_next + 1) % LATENCY_TRACKER_SAMPLES;
+    _last = latencyUs;
+
+    if(_count < LATENCY_TRACKER_SAMPLES)
+    {
+        _count++;
+    }
+}
+
+const int64_t LatencyTracker::percentile(const uint8_t& percent) const
+{
+    if(_count == 0)
+    {
+        return 0;
+    }
+
+    int64_t sorted[LATENCY_TRACKER_SAMPLES];
+    std::copy(_samples, _samples + _count, sorted);
+    std::sort(sorted, sorted + _count);
+
+    size_t index = (_count * percent + 99) / 100;
+    if(index > 0)
+    {
+        index--;
+    }
+    if(index >= _count)
+    {
+        index = _count - 1;
+    }
+
+    return sorted[index];
+}
+
+const int64_t LatencyTracker::last() const
+{
+    return _last;
+}
+
+const size_t LatencyTracker::count() const
+{
+    return _count;
+}
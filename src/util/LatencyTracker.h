@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#define LATENCY_TRACKER_SAMPLES 32
+
+class LatencyTracker
+{
+public:
+    void addSample(const int64_t& latencyUs);
+    const int64_t percentile(const uint8_t& percent) const;
+    const int64_t last() const;
+    const size_t count() const;
+
+private:
+    int64_t _samples[LATENCY_TRACKER_SAMPLES] = {0};
+    size_t _count = 0;
+    size_t _next = 0;
+    int64_t _last = 0;
+};
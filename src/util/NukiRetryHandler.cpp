@@ -1,5 +1,5 @@
 #include "NukiRetryHandler.h"
-#include "Logger.h"
+#include "LogEvents.h"
 
 NukiRetryHandler::NukiRetryHandler(std::string reference, Gpio* gpio, std::vector<uint8_t> pinsComm, std::vector<uint8_t> pinsCommError, int nrOfRetries, int retryDelay)
 : _reference(reference),
@@ -33,13 +33,7 @@ const Nuki::CmdResult NukiRetryHandler::retryComm(std::function<Nuki::CmdResult(
             setCommErrorPins(HIGH);
             ++retryCount;
 
-            Log->print(_reference.c_str());
-            Log->print(": Last command failed, retrying after ");
-            Log->print(_retryDelay);
-            Log->print(" milliseconds. Retry ");
-            Log->print(retryCount);
-            Log->print(" of ");
-            Log->println(_nrOfRetries);
+            logEvent(LogEvent::CommandRetry, _reference.c_str(), _retryDelay, retryCount, _nrOfRetries);
 
             vTaskDelay(_retryDelay / portTICK_PERIOD_MS);
         }
@@ -0,0 +1,247 @@
+#include "OtaManifestFetcher.h"
+#include <HTTPClient.h>
+#include <NetworkClientSecure.h>
+#include "ArduinoJson.h"
+#include "../Logger.h"
+
+extern const uint8_t x509_crt_imported_bundle_bin_start[] asm("_binary_x509_crt_bundle_start");
+extern const uint8_t x509_crt_imported_bundle_bin_end[]   asm("_binary_x509_crt_bundle_end");
+
+OtaManifestFetcher* OtaManifestFetcher::_instance = nullptr;
+
+static void copyField(JsonVariantConst src, char* dst, const size_t length)
+{
+    // version fields may be published as numbers
+    String value = src.isNull() ? String() : src.as<String>();
+    strlcpy(dst, value.c_str(), length);
+}
+
+static void copyChannel(JsonVariantConst src, OtaManifestChannel& dst)
+{
+    copyField(src["version"], dst.version, sizeof(dst.version));
+    copyField(src["version_int"], dst.versionInt, sizeof(dst.versionInt));
+    copyField(src["fullversion"], dst.fullversion, sizeof(dst.fullversion));
+    copyField(src["build"], dst.build, sizeof(dst.build));
+    copyField(src["time"], dst.time, sizeof(dst.time));
+}
+
+OtaManifestFetcher::OtaManifestFetcher(const char* url)
+    : _url(url)
+{
+    _mutex = xSemaphoreCreateMutex();
+}
+
+void OtaManifestFetcher::initialize(const char* url)
+{
+    if(_instance == nullptr)
+    {
+        _instance = new OtaManifestFetcher(url);
+    }
+}
+
+OtaManifestFetcher* OtaManifestFetcher::get()
+{
+    return _instance;
+}
+
+uint32_t OtaManifestFetcher::request()
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    uint32_t ticket = ++_requested;
+    if(_taskHandle == nullptr)
+    {
+        xTaskCreatePinnedToCore(&OtaManifestFetcher::taskEntry, "otamanifest", OTA_MANIFEST_TASK_SIZE, this, OTA_MANIFEST_TASK_PRIORITY, &_taskHandle, tskNO_AFFINITY);
+    }
+    TaskHandle_t handle = _taskHandle;
+    xSemaphoreGive(_mutex);
+
+    if(handle == nullptr)
+    {
+        Log->println("Failed to start OTA manifest task");
+        return 0;
+    }
+
+    xTaskNotifyGive(handle);
+    return ticket;
+}
+
+OtaManifestResult OtaManifestFetcher::poll(const uint32_t ticket, OtaManifest& manifest)
+{
+    if(ticket == 0)
+    {
+        return OtaManifestResult::Failed;
+    }
+
+    OtaManifestResult result = OtaManifestResult::Pending;
+
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    if(_completed >= ticket)
+    {
+        if(_lastFailed)
+        {
+            result = OtaManifestResult::Failed;
+        }
+        else
+        {
+            manifest = _manifest;
+            result = OtaManifestResult::Ready;
+        }
+    }
+    xSemaphoreGive(_mutex);
+
+    return result;
+}
+
+OtaManifestResult OtaManifestFetcher::waitFor(const uint32_t ticket, OtaManifest& manifest, const uint32_t timeoutMs)
+{
+    uint32_t waited = 0;
+    OtaManifestResult result = poll(ticket, manifest);
+
+    while(result == OtaManifestResult::Pending && waited < timeoutMs)
+    {
+        vTaskDelay(50 / portTICK_PERIOD_MS);
+        waited += 50;
+        result = poll(ticket, manifest);
+    }
+
+    return result;
+}
+
+const uint32_t OtaManifestFetcher::fetchCount() const
+{
+    return _fetchCount;
+}
+
+const uint32_t OtaManifestFetcher::notModifiedCount() const
+{
+    return _notModifiedCount;
+}
+
+void OtaManifestFetcher::taskEntry(void* param)
+{
+    static_cast<OtaManifestFetcher*>(param)->run();
+}
+
+void OtaManifestFetcher::run()
+{
+    while(true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // requests arriving during the fetch are answered by it or by the next iteration
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        uint32_t target = _requested;
+        xSemaphoreGive(_mutex);
+
+        bool notModified = false;
+        bool success = fetch(notModified);
+
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        _completed = target;
+        _lastFailed = !success;
+        _fetchCount++;
+        if(notModified)
+        {
+            _notModifiedCount++;
+        }
+        xSemaphoreGive(_mutex);
+    }
+}
+
+bool OtaManifestFetcher::fetch(bool& notModified)
+{
+    bool success = false;
+    OtaManifest manifest;
+
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    bool conditional = _manifestValid;
+    String etag = _etag;
+    String lastModified = _lastModified;
+    xSemaphoreGive(_mutex);
+
+    // plain http is accepted so the fetcher can be pointed at a local stand-in server
+    NetworkClient *client = nullptr;
+    if(strncmp(_url, "https://", 8) == 0)
+    {
+        NetworkClientSecure *secureClient = new NetworkClientSecure;
+        if(secureClient)
+        {
+            secureClient->setCACertBundle(x509_crt_imported_bundle_bin_start, x509_crt_imported_bundle_bin_end - x509_crt_imported_bundle_bin_start);
+        }
+        client = secureClient;
+    }
+    else
+    {
+        client = new NetworkClient;
+    }
+
+    if (client)
+    {
+        {
+            HTTPClient https;
+            https.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+            https.setTimeout(OTA_MANIFEST_HTTP_TIMEOUT);
+            https.useHTTP10(true);
+
+            if (https.begin(*client, _url))
+            {
+                const char* headerKeys[] = {"ETag", "Last-Modified"};
+                https.collectHeaders(headerKeys, 2);
+
+                if(conditional)
+                {
+                    if(etag.length() > 0)
+                    {
+                        https.addHeader("If-None-Match", etag);
+                    }
+                    if(lastModified.length() > 0)
+                    {
+                        https.addHeader("If-Modified-Since", lastModified);
+                    }
+                }
+
+                int httpResponseCode = https.GET();
+
+                if (httpResponseCode == HTTP_CODE_NOT_MODIFIED && conditional)
+                {
+                    notModified = true;
+                    success = true;
+                }
+                else if (httpResponseCode == HTTP_CODE_OK || httpResponseCode == HTTP_CODE_MOVED_PERMANENTLY)
+                {
+                    JsonDocument doc;
+                    DeserializationError jsonError = deserializeJson(doc, https.getStream());
+
+                    if (!jsonError)
+                    {
+                        copyChannel(doc["release"], manifest.release);
+                        copyChannel(doc["beta"], manifest.beta);
+                        copyChannel(doc["master"], manifest.master);
+                        etag = https.header("ETag");
+                        lastModified = https.header("Last-Modified");
+                        success = true;
+                    }
+                }
+                else
+                {
+                    Log->print("OTA manifest request failed: ");
+                    Log->println(httpResponseCode);
+                }
+            }
+            https.end();
+        }
+        delete client;
+    }
+
+    if(success && !notModified)
+    {
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        _manifest = manifest;
+        _manifestValid = true;
+        _etag = etag;
+        _lastModified = lastModified;
+        xSemaphoreGive(_mutex);
+    }
+
+    return success;
+}
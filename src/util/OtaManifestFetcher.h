@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define OTA_MANIFEST_TASK_SIZE 8192
+#define OTA_MANIFEST_TASK_PRIORITY 1
+#define OTA_MANIFEST_HTTP_TIMEOUT 5000
+#define OTA_MANIFEST_FIELD_LENGTH 32
+
+struct OtaManifestChannel
+{
+    char version[OTA_MANIFEST_FIELD_LENGTH] = {0};
+    char versionInt[OTA_MANIFEST_FIELD_LENGTH] = {0};
+    char fullversion[OTA_MANIFEST_FIELD_LENGTH] = {0};
+    char build[OTA_MANIFEST_FIELD_LENGTH] = {0};
+    char time[OTA_MANIFEST_FIELD_LENGTH] = {0};
+};
+
+struct OtaManifest
+{
+    OtaManifestChannel release;
+    OtaManifestChannel beta;
+    OtaManifestChannel master;
+};
+
+enum class OtaManifestResult : uint8_t
+{
+    Pending = 0,
+    Ready = 1,
+    Failed = 2
+};
+
+// Fetches the OTA manifest on a background task so the network task never blocks on the TLS handshake.
+// Callers request a fetch, keep the returned ticket and poll for the result.
+class OtaManifestFetcher
+{
+public:
+    static void initialize(const char* url);
+    static OtaManifestFetcher* get();
+
+    uint32_t request();
+    OtaManifestResult poll(const uint32_t ticket, OtaManifest& manifest);
+    OtaManifestResult waitFor(const uint32_t ticket, OtaManifest& manifest, const uint32_t timeoutMs);
+
+    const uint32_t fetchCount() const;
+    const uint32_t notModifiedCount() const;
+
+private:
+    explicit OtaManifestFetcher(const char* url);
+    static void taskEntry(void* param);
+    void run();
+    bool fetch(bool& notModified);
+
+    const char* _url;
+    SemaphoreHandle_t _mutex;
+    TaskHandle_t _taskHandle = nullptr;
+
+    OtaManifest _manifest;
+    bool _manifestValid = false;
+    String _etag;
+    String _lastModified;
+
+    uint32_t _requested = 0;
+    uint32_t _completed = 0;
+    bool _lastFailed = false;
+    uint32_t _fetchCount = 0;
+    uint32_t _notModifiedCount = 0;
+
+    static OtaManifestFetcher* _instance;
+};
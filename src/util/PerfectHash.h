@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#define PERFECT_HASH_MAX_SEEDS 4096
+#define PERFECT_HASH_EMPTY 0xFF
+
+// Collision free hash for a fixed set of string keys, built at compile time.
+// buildPerfectHash() searches a seed for which every key lands in its own slot,
+// a lookup is then one hash, one slot read and one compare by the caller.
+
+template<size_t Slots>
+struct PerfectHashTable
+{
+    uint32_t seed = 0;
+    uint8_t slots[Slots] = {};
+    bool valid = false;
+};
+
+constexpr uint32_t perfectHash(const char* key, const uint32_t seed)
+{
+    // seeded FNV-1a, high bits folded down since only the low bits select the slot
+    uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+    while(*key != 0)
+    {
+        hash ^= (uint8_t)*key++;
+        hash *= 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
+template<size_t Slots, typename T, size_t N, typename KeyOf>
+constexpr PerfectHashTable<Slots> buildPerfectHash(const T (&items)[N], KeyOf keyOf)
+{
+    static_assert((Slots & (Slots - 1)) == 0, "Slots must be a power of two");
+    static_assert(N < Slots && N < PERFECT_HASH_EMPTY, "Too many keys for the table");
+
+    PerfectHashTable<Slots> table;
+
+    for(uint32_t seed = 0; seed < PERFECT_HASH_MAX_SEEDS; seed++)
+    {
+        for(size_t i = 0; i < Slots; i++)
+        {
+            table.slots[i] = PERFECT_HASH_EMPTY;
+        }
+
+        bool collision = false;
+        for(size_t i = 0; i < N && !collision; i++)
+        {
+            uint32_t slot = perfectHash(keyOf(items[i]), seed) & (Slots - 1);
+            collision = table.slots[slot] != PERFECT_HASH_EMPTY;
+            table.slots[slot] = i;
+        }
+
+        if(!collision)
+        {
+            table.seed = seed;
+            table.valid = true;
+            return table;
+        }
+    }
+
+    return table;
+}
+
+// index of the only item that can match key, -1 if none; the caller still has to compare the key
+template<size_t Slots>
+inline int perfectHashCandidate(const PerfectHashTable<Slots>& table, const char* key)
+{
+    uint8_t index = table.slots[perfectHash(key, table.seed) & (Slots - 1)];
+    return index == PERFECT_HASH_EMPTY ? -1 : index;
+}
@@ -0,0 +1,157 @@
+#include "ReachabilityMonitor.h"
+#include <NetworkClient.h>
+#include <ESP32Ping.h>
+#include "../EspMillis.h"
+#include "../Logger.h"
+
+ReachabilityMonitor::ReachabilityMonitor(const String& targets)
+{
+    int start = 0;
+
+    while(start < targets.length() && _targetCount < REACHABILITY_MAX_TARGETS)
+    {
+        int end = targets.indexOf(',', start);
+        if(end < 0)
+        {
+            end = targets.length();
+        }
+
+        String target = targets.substring(start, end);
+        target.trim();
+        start = end + 1;
+
+        if(target.length() == 0)
+        {
+            continue;
+        }
+
+        int colon = target.lastIndexOf(':');
+        if(colon > 0)
+        {
+            _hosts[_targetCount] = target.substring(0, colon);
+            _ports[_targetCount] = target.substring(colon + 1).toInt();
+        }
+        else
+        {
+            _hosts[_targetCount] = target;
+            _ports[_targetCount] = 0;
+        }
+        _targetCount++;
+    }
+
+    if(_targetCount == 0)
+    {
+        _hosts[0] = "github.com";
+        _targetCount = 1;
+    }
+}
+
+void ReachabilityMonitor::trigger()
+{
+    if(_taskHandle == nullptr)
+    {
+        xTaskCreatePinnedToCore(&ReachabilityMonitor::taskEntry, "reach", REACHABILITY_TASK_SIZE, this, REACHABILITY_TASK_PRIORITY, &_taskHandle, tskNO_AFFINITY);
+
+        if(_taskHandle == nullptr)
+        {
+            Log->println("Failed to start reachability task");
+        }
+        // the task probes right away when started
+        return;
+    }
+
+    xTaskNotifyGive(_taskHandle);
+}
+
+ReachabilityState ReachabilityMonitor::state()
+{
+    portENTER_CRITICAL(&_mux);
+    ReachabilityState state = _state;
+    portEXIT_CRITICAL(&_mux);
+    return state;
+}
+
+bool ReachabilityMonitor::takeTransition()
+{
+    portENTER_CRITICAL(&_mux);
+    bool transition = _transition;
+    _transition = false;
+    portEXIT_CRITICAL(&_mux);
+    return transition;
+}
+
+const char* ReachabilityMonitor::targetName(const int8_t index) const
+{
+    if(index < 0 || index >= _targetCount)
+    {
+        return "";
+    }
+    return _hosts[index].c_str();
+}
+
+void ReachabilityMonitor::taskEntry(void* param)
+{
+    static_cast<ReachabilityMonitor*>(param)->run();
+}
+
+void ReachabilityMonitor::run()
+{
+    while(true)
+    {
+        int8_t reachedTarget = -1;
+
+        for(uint8_t i = 0; i < _targetCount; i++)
+        {
+            if(probe(i))
+            {
+                reachedTarget = i;
+                break;
+            }
+        }
+
+        int64_t ts = espMillis();
+        bool reachable = reachedTarget >= 0;
+
+        portENTER_CRITICAL(&_mux);
+        if(!_state.checked || _state.reachable != reachable)
+        {
+            _state.lastChangeTs = ts;
+            _transition = true;
+        }
+        _state.checked = true;
+        _state.reachable = reachable;
+        _state.lastCheckTs = ts;
+        _state.target = reachedTarget;
+        _state.failures = reachable ? 0 : _state.failures + 1;
+        uint32_t failures = _state.failures;
+        portEXIT_CRITICAL(&_mux);
+
+        uint32_t waitMs = REACHABILITY_CHECK_INTERVAL;
+
+        if(!reachable)
+        {
+            uint8_t shift = failures > 7 ? 6 : failures - 1;
+            waitMs = REACHABILITY_MIN_BACKOFF << shift;
+            if(waitMs > REACHABILITY_MAX_BACKOFF)
+            {
+                waitMs = REACHABILITY_MAX_BACKOFF;
+            }
+        }
+
+        // trigger() cuts the wait short, e.g. after the network reconnected
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+    }
+}
+
+bool ReachabilityMonitor::probe(const uint8_t index)
+{
+    if(_ports[index] == 0)
+    {
+        return Ping.ping(_hosts[index].c_str(), 3);
+    }
+
+    NetworkClient client;
+    bool success = client.connect(_hosts[index].c_str(), _ports[index], REACHABILITY_TCP_TIMEOUT);
+    client.stop();
+    return success;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define REACHABILITY_MAX_TARGETS 4
+#define REACHABILITY_TASK_SIZE 4096
+#define REACHABILITY_TASK_PRIORITY 1
+#define REACHABILITY_CHECK_INTERVAL 300000
+#define REACHABILITY_MIN_BACKOFF 5000
+#define REACHABILITY_MAX_BACKOFF 300000
+#define REACHABILITY_TCP_TIMEOUT 3000
+
+struct ReachabilityState
+{
+    bool checked = false;
+    bool reachable = false;
+    int64_t lastCheckTs = 0;
+    int64_t lastChangeTs = 0;
+    uint32_t failures = 0;
+    int8_t target = -1;
+};
+
+// Probes the configured targets on a background task and caches the result.
+// Targets are a comma separated list; "host" is pinged, "host:port" gets a TCP connect.
+class ReachabilityMonitor
+{
+public:
+    explicit ReachabilityMonitor(const String& targets);
+
+    void trigger();
+    ReachabilityState state();
+    bool takeTransition();
+    const char* targetName(const int8_t index) const;
+
+private:
+    static void taskEntry(void* param);
+    void run();
+    bool probe(const uint8_t index);
+
+    String _hosts[REACHABILITY_MAX_TARGETS];
+    uint16_t _ports[REACHABILITY_MAX_TARGETS] = {0};
+    uint8_t _targetCount = 0;
+
+    TaskHandle_t _taskHandle = nullptr;
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+    ReachabilityState _state;
+    bool _transition = false;
+};
@@ -0,0 +1,131 @@
+#include "ScratchArena.h"
+
+ScratchArena* ScratchArena::_arenas[2] = {nullptr, nullptr};
+
+ScratchArena::ScratchArena(const size_t& size)
+    : _size(size)
+{
+    _buffer = new char[size];
+}
+
+void ScratchArena::initialize(const size_t& size)
+{
+    for(uint8_t i = 0; i < 2; i++)
+    {
+        if(_arenas[i] == nullptr)
+        {
+            _arenas[i] = new ScratchArena(size);
+        }
+    }
+}
+
+ScratchArena* ScratchArena::get(const SchedulerTask& task)
+{
+    return _arenas[(uint8_t)task];
+}
+
+ScratchArena* ScratchArena::current()
+{
+    if(TaskScheduler::isCurrentTask(SchedulerTask::Network))
+    {
+        return _arenas[(uint8_t)SchedulerTask::Network];
+    }
+    if(TaskScheduler::isCurrentTask(SchedulerTask::Nuki))
+    {
+        return _arenas[(uint8_t)SchedulerTask::Nuki];
+    }
+    return nullptr;
+}
+
+char* ScratchArena::allocate(const size_t& size)
+{
+    if(size > _size - _offset)
+    {
+        _overflowCount++;
+        return nullptr;
+    }
+
+    char* ptr = _buffer + _offset;
+    _offset += size;
+
+    if(_offset > _highWaterMark)
+    {
+        _highWaterMark = _offset;
+    }
+
+    return ptr;
+}
+
+const size_t ScratchArena::mark() const
+{
+    return _offset;
+}
+
+void ScratchArena::rewind(const size_t& mark)
+{
+    if(mark < _offset)
+    {
+        _offset = mark;
+    }
+}
+
+void ScratchArena::reset()
+{
+    _offset = 0;
+}
+
+const size_t ScratchArena::size() const
+{
+    return _size;
+}
+
+const size_t ScratchArena::highWaterMark() const
+{
+    return _highWaterMark;
+}
+
+const uint32_t ScratchArena::overflowCount() const
+{
+    return _overflowCount;
+}
+
+ScratchBuffer::ScratchBuffer(const size_t& size)
+    : _size(size)
+{
+    _arena = ScratchArena::current();
+
+    if(_arena != nullptr)
+    {
+        _mark = _arena->mark();
+        _data = _arena->allocate(size);
+    }
+
+    // tasks without an arena and payloads larger than the arena fall back to the heap
+    if(_data == nullptr)
+    {
+        _arena = nullptr;
+        _data = new char[size];
+    }
+}
+
+ScratchBuffer::~ScratchBuffer()
+{
+    if(_arena != nullptr)
+    {
+        _arena->rewind(_mark);
+    }
+    else
+    {
+        delete[] _data;
+    }
+}
+
+char* ScratchBuffer::data() const
+{
+    return _data;
+}
+
+const size_t ScratchBuffer::size() const
+{
+    return _size;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "TaskScheduler.h"
+
+class ScratchArena
+{
+public:
+    static void initialize(const size_t& size);
+    static ScratchArena* get(const SchedulerTask& task);
+    static ScratchArena* current();
+
+    char* allocate(const size_t& size);
+    const size_t mark() const;
+    void rewind(const size_t& mark);
+    void reset();
+
+    const size_t size() const;
+    const size_t highWaterMark() const;
+    const uint32_t overflowCount() const;
+
+private:
+    explicit ScratchArena(const size_t& size);
+
+    char* _buffer = nullptr;
+    size_t _size = 0;
+    size_t _offset = 0;
+    size_t _highWaterMark = 0;
+    uint32_t _overflowCount = 0;
+
+    static ScratchArena* _arenas[2];
+};
+
+class ScratchBuffer
+{
+public:
+    explicit ScratchBuffer(const size_t& size);
+    ~ScratchBuffer();
+
+    ScratchBuffer(const ScratchBuffer&) = delete;
+    ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+    char* data() const;
+    const size_t size() const;
+
+private:
+    ScratchArena* _arena = nullptr;
+    size_t _mark = 0;
+    char* _data = nullptr;
+    size_t _size = 0;
+};
@@ -0,0 +1,222 @@
+#include "SessionTable.h"
+
+#define SESSION_TABLE_MASK (SESSION_TABLE_CAPACITY - 1)
+#define SESSION_SNAPSHOT_VERSION 1
+
+static_assert((SESSION_TABLE_CAPACITY & SESSION_TABLE_MASK) == 0, "SESSION_TABLE_CAPACITY must be a power of two");
+
+uint32_t SessionTable::hash(const char* id)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    while(*id != 0)
+    {
+        hash ^= (uint8_t)*id++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+int SessionTable::indexOf(const char* id) const
+{
+    size_t index = hash(id) & SESSION_TABLE_MASK;
+
+    for(size_t i = 0; i < SESSION_TABLE_CAPACITY; i++)
+    {
+        const Entry& entry = _entries[index];
+        if(!entry.used)
+        {
+            return -1;
+        }
+        if(strcmp(entry.id, id) == 0)
+        {
+            return index;
+        }
+        index = (index + 1) & SESSION_TABLE_MASK;
+    }
+    return -1;
+}
+
+void SessionTable::add(const char* id, const int64_t& expiry)
+{
+    if(strlen(id) == 0 || strlen(id) > SESSION_ID_MAX_LENGTH)
+    {
+        return;
+    }
+
+    int existing = indexOf(id);
+    if(existing >= 0)
+    {
+        _entries[existing].expiry = expiry;
+        return;
+    }
+
+    if(_count == SESSION_TABLE_CAPACITY)
+    {
+        size_t oldest = 0;
+        for(size_t i = 1; i < SESSION_TABLE_CAPACITY; i++)
+        {
+            if(_entries[i].expiry < _entries[oldest].expiry)
+            {
+                oldest = i;
+            }
+        }
+        removeAt(oldest);
+    }
+
+    size_t index = hash(id) & SESSION_TABLE_MASK;
+    while(_entries[index].used)
+    {
+        index = (index + 1) & SESSION_TABLE_MASK;
+    }
+
+    strcpy(_entries[index].id, id);
+    _entries[index].expiry = expiry;
+    _entries[index].used = true;
+    _count++;
+}
+
+bool SessionTable::find(const char* id, int64_t& expiry) const
+{
+    int index = indexOf(id);
+    if(index < 0)
+    {
+        return false;
+    }
+    expiry = _entries[index].expiry;
+    return true;
+}
+
+void SessionTable::remove(const char* id)
+{
+    int index = indexOf(id);
+    if(index >= 0)
+    {
+        removeAt(index);
+    }
+}
+
+void SessionTable::removeAt(size_t index)
+{
+    // backward shift deletion, keeps probe chains intact without tombstones
+    size_t next = index;
+
+    while(true)
+    {
+        _entries[index].used = false;
+
+        while(true)
+        {
+            next = (next + 1) & SESSION_TABLE_MASK;
+            if(!_entries[next].used)
+            {
+                _count--;
+                return;
+            }
+
+            size_t home = hash(_entries[next].id) & SESSION_TABLE_MASK;
+            bool inChain = index <= next ? (index < home && home <= next) : (index < home || home <= next);
+            if(!inChain)
+            {
+                break;
+            }
+        }
+
+        _entries[index] = _entries[next];
+        index = next;
+    }
+}
+
+void SessionTable::removeExpired(const int64_t& now)
+{
+    for(size_t i = 0; i < SESSION_TABLE_CAPACITY;)
+    {
+        // removeAt may shift a later entry into slot i, so only advance when it is kept
+        if(_entries[i].used && _entries[i].expiry <= now)
+        {
+            removeAt(i);
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+void SessionTable::clear()
+{
+    for(auto& entry : _entries)
+    {
+        entry.used = false;
+    }
+    _count = 0;
+}
+
+const size_t SessionTable::count() const
+{
+    return _count;
+}
+
+String SessionTable::snapshot() const
+{
+    String content;
+    content.reserve(4 + _count * (1 + SESSION_ID_MAX_LENGTH + sizeof(int64_t)));
+    content.concat("NHS", 3);
+    content.concat((char)SESSION_SNAPSHOT_VERSION);
+
+    for(const auto& entry : _entries)
+    {
+        if(!entry.used)
+        {
+            continue;
+        }
+
+        uint8_t length = strlen(entry.id);
+        uint8_t expiry[sizeof(int64_t)];
+        for(size_t i = 0; i < sizeof(int64_t); i++)
+        {
+            expiry[i] = (uint8_t)((uint64_t)entry.expiry >> (i * 8));
+        }
+
+        content.concat((char)length);
+        content.concat(entry.id, length);
+        content.concat((const char*)expiry, sizeof(expiry));
+    }
+
+    return content;
+}
+
+bool SessionTable::restore(const uint8_t* data, const size_t length)
+{
+    if(length < 4 || memcmp(data, "NHS", 3) != 0 || data[3] != SESSION_SNAPSHOT_VERSION)
+    {
+        return false;
+    }
+
+    clear();
+
+    size_t pos = 4;
+    while(pos < length)
+    {
+        uint8_t idLength = data[pos++];
+        if(idLength > SESSION_ID_MAX_LENGTH || pos + idLength + sizeof(int64_t) > length)
+        {
+            return false;
+        }
+
+        char id[SESSION_ID_MAX_LENGTH + 1];
+        memcpy(id, data + pos, idLength);
+        id[idLength] = 0;
+        pos += idLength;
+
+        uint64_t expiry = 0;
+        for(size_t i = 0; i < sizeof(int64_t); i++)
+        {
+            expiry |= (uint64_t)data[pos++] << (i * 8);
+        }
+
+        add(id, (int64_t)expiry);
+    }
+
+    return true;
+}
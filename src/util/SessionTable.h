@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <Arduino.h>
+
+#define SESSION_TABLE_CAPACITY 32
+#define SESSION_ID_MAX_LENGTH 32
+
+// Fixed capacity session store, open addressing with linear probing.
+// Expired sessions are dropped lazily when they are looked up or when the table
+// is full; a full table evicts the session that expires first.
+class SessionTable
+{
+public:
+    void add(const char* id, const int64_t& expiry);
+    bool find(const char* id, int64_t& expiry) const;
+    void remove(const char* id);
+    void removeExpired(const int64_t& now);
+    void clear();
+    const size_t count() const;
+
+    // binary snapshot: "NHS" + version, then per session the id length, id and expiry (little endian)
+    String snapshot() const;
+    bool restore(const uint8_t* data, const size_t length);
+
+private:
+    struct Entry
+    {
+        char id[SESSION_ID_MAX_LENGTH + 1] = {0};
+        int64_t expiry = 0;
+        bool used = false;
+    };
+
+    static uint32_t hash(const char* id);
+    int indexOf(const char* id) const;
+    void removeAt(size_t index);
+
+    Entry _entries[SESSION_TABLE_CAPACITY];
+    size_t _count = 0;
+};
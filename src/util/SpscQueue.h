@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// Lock-free queue for exactly one producer task and one consumer task.
+template<typename T, size_t N>
+class SpscQueue
+{
+public:
+    bool push(const T& item)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        const size_t next = (head + 1) % (N + 1);
+
+        if(next == _tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        _items[head] = item;
+        _head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& item)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+
+        if(tail == _head.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        item = _items[tail];
+        _tail.store((tail + 1) % (N + 1), std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const
+    {
+        return _tail.load(std::memory_order_acquire) == _head.load(std::memory_order_acquire);
+    }
+
+private:
+    T _items[N + 1];
+    std::atomic<size_t> _head {0};
+    std::atomic<size_t> _tail {0};
+};
@@ -0,0 +1,175 @@
+#include "TaskScheduler.h"
+#include "esp_timer.h"
+#include "esp_task_wdt.h"
+#include "../EspMillis.h"
+
+TaskHandle_t TaskScheduler::_taskHandles[2] = {nullptr, nullptr};
+int64_t TaskScheduler::_pendingSinceUs[2] = {0, 0};
+int64_t TaskScheduler::_lastDispatchLatencyUs[2] = {0, 0};
+int64_t TaskScheduler::_maxDispatchLatencyUs[2] = {0, 0};
+portMUX_TYPE TaskScheduler::_mux = portMUX_INITIALIZER_UNLOCKED;
+
+void TaskScheduler::registerTask(const SchedulerTask& task, TaskHandle_t handle)
+{
+    _taskHandles[(uint8_t)task] = handle;
+}
+
+void TaskScheduler::unregisterTask(const SchedulerTask& task)
+{
+    _taskHandles[(uint8_t)task] = nullptr;
+}
+
+bool TaskScheduler::isCurrentTask(const SchedulerTask& task)
+{
+    TaskHandle_t handle = _taskHandles[(uint8_t)task];
+    return handle != nullptr && handle == xTaskGetCurrentTaskHandle();
+}
+
+void TaskScheduler::notify(const SchedulerTask& task, const uint32_t& events)
+{
+    TaskHandle_t handle = _taskHandles[(uint8_t)task];
+
+    if(handle == nullptr)
+    {
+        return;
+    }
+
+    if(xPortInIsrContext())
+    {
+        portENTER_CRITICAL_ISR(&_mux);
+        if(_pendingSinceUs[(uint8_t)task] == 0)
+        {
+            _pendingSinceUs[(uint8_t)task] = esp_timer_get_time();
+        }
+        portEXIT_CRITICAL_ISR(&_mux);
+
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        xTaskNotifyFromISR(handle, events, eSetBits, &higherPriorityTaskWoken);
+        if(higherPriorityTaskWoken == pdTRUE)
+        {
+            portYIELD_FROM_ISR();
+        }
+        return;
+    }
+
+    if(handle == xTaskGetCurrentTaskHandle())
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&_mux);
+    if(_pendingSinceUs[(uint8_t)task] == 0)
+    {
+        _pendingSinceUs[(uint8_t)task] = esp_timer_get_time();
+    }
+    portEXIT_CRITICAL(&_mux);
+
+    xTaskNotify(handle, events, eSetBits);
+}
+
+uint32_t TaskScheduler::waitUntil(const SchedulerTask& task, const int64_t& deadlineTs, const uint32_t& maxWaitMs)
+{
+    int64_t waitMs = deadlineTs - espMillis();
+
+    if(waitMs < SCHEDULER_MIN_WAIT_MS)
+    {
+        waitMs = SCHEDULER_MIN_WAIT_MS;
+    }
+    if(waitMs > maxWaitMs)
+    {
+        waitMs = maxWaitMs;
+    }
+
+    if (esp_task_wdt_status(NULL) == ESP_OK)
+    {
+        esp_task_wdt_reset();
+    }
+
+    uint32_t events = 0;
+
+    // returns immediately if an event was signalled since the last wait
+    xTaskNotifyWait(0, UINT32_MAX, &events, pdMS_TO_TICKS(waitMs));
+
+    if(events != 0)
+    {
+        portENTER_CRITICAL(&_mux);
+        int64_t pendingSince = _pendingSinceUs[(uint8_t)task];
+        _pendingSinceUs[(uint8_t)task] = 0;
+        portEXIT_CRITICAL(&_mux);
+
+        if(pendingSince > 0)
+        {
+            int64_t latency = esp_timer_get_time() - pendingSince;
+            _lastDispatchLatencyUs[(uint8_t)task] = latency;
+            if(latency > _maxDispatchLatencyUs[(uint8_t)task])
+            {
+                _maxDispatchLatencyUs[(uint8_t)task] = latency;
+            }
+        }
+    }
+
+    return events;
+}
+
+int64_t TaskScheduler::earliest(const int64_t& a, const int64_t& b)
+{
+    return a < b ? a : b;
+}
+
+int64_t TaskScheduler::nextDeadline(const SchedulerDeadlines& deadlines)
+{
+    if(deadlines.actionPending)
+    {
+        return 0;
+    }
+
+    int64_t deadline = deadlines.lockStateUpdateTs;
+
+    if(deadlines.offCommandExecutedTs > 0)
+    {
+        deadline = earliest(deadline, deadlines.offCommandExecutedTs);
+    }
+
+    if(deadlines.mqttConnected)
+    {
+        deadline = earliest(deadline, deadlines.batteryReportTs);
+        deadline = earliest(deadline, deadlines.configUpdateTs);
+
+        if(deadlines.waitAuthLogUpdateTs != 0)
+        {
+            deadline = earliest(deadline, deadlines.waitAuthLogUpdateTs);
+        }
+        if(deadlines.waitKeypadUpdateTs != 0)
+        {
+            deadline = earliest(deadline, deadlines.waitKeypadUpdateTs);
+        }
+        if(deadlines.waitTimeControlUpdateTs != 0)
+        {
+            deadline = earliest(deadline, deadlines.waitTimeControlUpdateTs);
+        }
+        if(deadlines.waitAuthUpdateTs != 0)
+        {
+            deadline = earliest(deadline, deadlines.waitAuthUpdateTs);
+        }
+        if(deadlines.rssiEnabled)
+        {
+            deadline = earliest(deadline, deadlines.rssiTs);
+        }
+        if(deadlines.keypadEnabled)
+        {
+            deadline = earliest(deadline, deadlines.keypadUpdateTs);
+        }
+    }
+
+    return deadline;
+}
+
+const int64_t TaskScheduler::lastDispatchLatencyUs(const SchedulerTask& task)
+{
+    return _lastDispatchLatencyUs[(uint8_t)task];
+}
+
+const int64_t TaskScheduler::maxDispatchLatencyUs(const SchedulerTask& task)
+{
+    return _maxDispatchLatencyUs[(uint8_t)task];
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define SCHEDULER_EVENT_LOCK_ACTION 1
+#define SCHEDULER_EVENT_BLE 2
+#define SCHEDULER_EVENT_GPIO 4
+#define SCHEDULER_EVENT_QUERY 8
+#define SCHEDULER_EVENT_MQTT_PUBLISH 16
+#define SCHEDULER_EVENT_RESTART 32
+
+#define SCHEDULER_MIN_WAIT_MS 10
+
+enum class SchedulerTask : uint8_t
+{
+    Network = 0,
+    Nuki = 1
+};
+
+// timestamps (espMillis) at which a device wrapper has work to do, 0 for the wait timestamps means none scheduled
+struct SchedulerDeadlines
+{
+    bool actionPending = false;
+    bool mqttConnected = false;
+    int64_t lockStateUpdateTs = 0;
+    int64_t offCommandExecutedTs = 0;
+    int64_t batteryReportTs = 0;
+    int64_t configUpdateTs = 0;
+    int64_t waitAuthLogUpdateTs = 0;
+    int64_t waitKeypadUpdateTs = 0;
+    int64_t waitTimeControlUpdateTs = 0;
+    int64_t waitAuthUpdateTs = 0;
+    bool rssiEnabled = false;
+    int64_t rssiTs = 0;
+    bool keypadEnabled = false;
+    int64_t keypadUpdateTs = 0;
+};
+
+class TaskScheduler
+{
+public:
+    static void registerTask(const SchedulerTask& task, TaskHandle_t handle);
+    static void unregisterTask(const SchedulerTask& task);
+    static bool isCurrentTask(const SchedulerTask& task);
+
+    static void notify(const SchedulerTask& task, const uint32_t& events);
+    static uint32_t waitUntil(const SchedulerTask& task, const int64_t& deadlineTs, const uint32_t& maxWaitMs);
+
+    static int64_t earliest(const int64_t& a, const int64_t& b);
+    static int64_t nextDeadline(const SchedulerDeadlines& deadlines);
+    static const int64_t lastDispatchLatencyUs(const SchedulerTask& task);
+    static const int64_t maxDispatchLatencyUs(const SchedulerTask& task);
+
+private:
+    static TaskHandle_t _taskHandles[2];
+    static int64_t _pendingSinceUs[2];
+    static int64_t _lastDispatchLatencyUs[2];
+    static int64_t _maxDispatchLatencyUs[2];
+    static portMUX_TYPE _mux;
+};
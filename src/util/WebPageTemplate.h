@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Settings pages compiled by resources/compile_pages.py: the static HTML of a page
+// is split into fragments kept in flash, the values read at request time are slots.
+// A page is a flat list of ops; conditional blocks jump to the op after their end.
+
+enum class WebPageOpType : uint8_t
+{
+    Fragment,        // static html, value holds the length
+    String,          // preference string, fallback is the default
+    ValueAttribute,  // ' value="<preference string>' if not empty
+    Int,             // preference int, value is the default
+    HexUInt,         // preference uint printed as hex, value is the default
+    Checked,         // ' checked="checked"' if the preference bool is set
+    EnabledText,     // "Enabled" / "Disabled" for a preference bool
+    IfBool,          // continue with next unless the preference bool is set
+    IfNotBool,       // continue with next if the preference bool is set
+    IfCondition,     // continue with next unless the WebPageCondition in value holds
+    Jump             // continue with next
+};
+
+enum class WebPageCondition : uint8_t
+{
+    LockActive,
+    OpenerActive,
+    KeypadAvailable,
+    TargetEsp32
+};
+
+struct WebPageOp
+{
+    WebPageOpType type;
+    uint16_t next;
+    int32_t value;
+    const char* data;      // fragment or preference key
+    const char* fallback;
+};
+
+struct WebPageTemplate
+{
+    const WebPageOp* ops;
+    size_t count;
+};
@@ -0,0 +1,263 @@
+#include "WriteBehindStore.h"
+#include "esp_timer.h"
+#include "SPIFFS.h"
+#include "../EspMillis.h"
+#include "../Logger.h"
+
+WriteBehindStore* WriteBehindStore::_instance = nullptr;
+
+WriteBehindStore::WriteBehindStore(Preferences* preferences)
+    : _preferences(preferences)
+{
+    _mutex = xSemaphoreCreateMutex();
+}
+
+void WriteBehindStore::initialize(Preferences* preferences)
+{
+    if(_instance == nullptr)
+    {
+        _instance = new WriteBehindStore(preferences);
+    }
+}
+
+WriteBehindStore* WriteBehindStore::get()
+{
+    return _instance;
+}
+
+int32_t WriteBehindStore::getInt(const char* key, const int32_t defaultValue)
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    PendingInt* entry = findInt(key);
+    if(entry != nullptr && entry->dirty)
+    {
+        int32_t value = entry->value;
+        xSemaphoreGive(_mutex);
+        return value;
+    }
+    xSemaphoreGive(_mutex);
+
+    return _preferences->getInt(key, defaultValue);
+}
+
+void WriteBehindStore::putInt(const char* key, const int32_t value)
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    PendingInt* entry = findInt(key);
+
+    if(entry == nullptr)
+    {
+        for(auto& slot : _ints)
+        {
+            if(slot.key == nullptr)
+            {
+                slot.key = key;
+                entry = &slot;
+                break;
+            }
+        }
+    }
+
+    if(entry == nullptr)
+    {
+        _flashWrites++;
+        xSemaphoreGive(_mutex);
+        _preferences->putInt(key, value);
+        return;
+    }
+
+    if(entry->dirty)
+    {
+        _coalescedWrites++;
+    }
+    entry->value = value;
+    entry->dirty = true;
+    markDirty(false);
+    xSemaphoreGive(_mutex);
+}
+
+void WriteBehindStore::remove(const char* key)
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    PendingInt* entry = findInt(key);
+    if(entry != nullptr)
+    {
+        entry->dirty = false;
+    }
+    xSemaphoreGive(_mutex);
+
+    _preferences->remove(key);
+}
+
+void WriteBehindStore::writeFile(const char* path, const String& content, const bool urgent)
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    PendingFile* entry = nullptr;
+
+    for(auto& slot : _files)
+    {
+        if(slot.path != nullptr && strcmp(slot.path, path) == 0)
+        {
+            entry = &slot;
+            break;
+        }
+        if(slot.path == nullptr && entry == nullptr)
+        {
+            entry = &slot;
+        }
+    }
+
+    if(entry == nullptr)
+    {
+        xSemaphoreGive(_mutex);
+        Log->print("Write-behind file slots exhausted, dropping write to ");
+        Log->println(path);
+        return;
+    }
+
+    if(entry->dirty)
+    {
+        _coalescedWrites++;
+    }
+    entry->path = path;
+    entry->content = content;
+    entry->dirty = true;
+    markDirty(urgent);
+    xSemaphoreGive(_mutex);
+}
+
+void WriteBehindStore::update()
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    bool due = _firstDirtyTs != 0 && (_flushRequested || espMillis() - _firstDirtyTs >= WRITE_BEHIND_FLUSH_INTERVAL);
+    xSemaphoreGive(_mutex);
+
+    if(due)
+    {
+        flush();
+    }
+}
+
+void WriteBehindStore::flush()
+{
+    PendingInt ints[WRITE_BEHIND_MAX_KEYS];
+    PendingFile files[WRITE_BEHIND_MAX_FILES];
+
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    for(uint8_t i = 0; i < WRITE_BEHIND_MAX_KEYS; i++)
+    {
+        if(_ints[i].dirty)
+        {
+            ints[i] = _ints[i];
+            _ints[i].dirty = false;
+        }
+    }
+    for(uint8_t i = 0; i < WRITE_BEHIND_MAX_FILES; i++)
+    {
+        if(_files[i].dirty)
+        {
+            files[i].path = _files[i].path;
+            files[i].content = std::move(_files[i].content);
+            files[i].dirty = true;
+            _files[i].content = "";
+            _files[i].dirty = false;
+        }
+    }
+    _firstDirtyTs = 0;
+    _dirtyChanges = 0;
+    _flushRequested = false;
+    xSemaphoreGive(_mutex);
+
+    uint32_t writes = 0;
+
+    for(const auto& entry : ints)
+    {
+        if(entry.dirty)
+        {
+            _preferences->putInt(entry.key, entry.value);
+            writes++;
+        }
+    }
+
+    bool mounted = false;
+
+    for(const auto& entry : files)
+    {
+        if(!entry.dirty)
+        {
+            continue;
+        }
+        if(!mounted && !SPIFFS.begin(true))
+        {
+            Log->println("SPIFFS Mount Failed");
+            break;
+        }
+        mounted = true;
+
+        File file = SPIFFS.open(entry.path, "w");
+        file.print(entry.content);
+        file.close();
+        writes++;
+    }
+
+    if(writes > 0)
+    {
+        xSemaphoreTake(_mutex, portMAX_DELAY);
+        _flashWrites += writes;
+        xSemaphoreGive(_mutex);
+    }
+}
+
+const uint32_t WriteBehindStore::flashWrites() const
+{
+    return _flashWrites;
+}
+
+const uint32_t WriteBehindStore::coalescedWrites() const
+{
+    return _coalescedWrites;
+}
+
+const uint32_t WriteBehindStore::pendingWrites()
+{
+    uint32_t pending = 0;
+
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    for(const auto& entry : _ints)
+    {
+        pending += entry.dirty ? 1 : 0;
+    }
+    for(const auto& entry : _files)
+    {
+        pending += entry.dirty ? 1 : 0;
+    }
+    xSemaphoreGive(_mutex);
+
+    return pending;
+}
+
+WriteBehindStore::PendingInt* WriteBehindStore::findInt(const char* key)
+{
+    for(auto& entry : _ints)
+    {
+        if(entry.key != nullptr && strcmp(entry.key, key) == 0)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void WriteBehindStore::markDirty(const bool urgent)
+{
+    if(_firstDirtyTs == 0)
+    {
+        _firstDirtyTs = espMillis();
+    }
+    _dirtyChanges++;
+
+    if(urgent || _dirtyChanges >= WRITE_BEHIND_FLUSH_THRESHOLD)
+    {
+        _flushRequested = true;
+    }
+}
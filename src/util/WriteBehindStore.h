@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#define WRITE_BEHIND_MAX_KEYS 8
+#define WRITE_BEHIND_MAX_FILES 4
+#define WRITE_BEHIND_FLUSH_INTERVAL 60000
+#define WRITE_BEHIND_FLUSH_THRESHOLD 32
+
+class WriteBehindStore
+{
+public:
+    static void initialize(Preferences* preferences);
+    static WriteBehindStore* get();
+
+    int32_t getInt(const char* key, const int32_t defaultValue);
+    void putInt(const char* key, const int32_t value);
+    void remove(const char* key);
+    void writeFile(const char* path, const String& content, const bool urgent = false);
+
+    void update();
+    void flush();
+
+    const uint32_t flashWrites() const;
+    const uint32_t coalescedWrites() const;
+    const uint32_t pendingWrites();
+
+private:
+    explicit WriteBehindStore(Preferences* preferences);
+
+    struct PendingInt
+    {
+        const char* key = nullptr;
+        int32_t value = 0;
+        bool dirty = false;
+    };
+
+    struct PendingFile
+    {
+        const char* path = nullptr;
+        String content;
+        bool dirty = false;
+    };
+
+    PendingInt* findInt(const char* key);
+    void markDirty(const bool urgent);
+
+    Preferences* _preferences;
+    SemaphoreHandle_t _mutex;
+    PendingInt _ints[WRITE_BEHIND_MAX_KEYS];
+    PendingFile _files[WRITE_BEHIND_MAX_FILES];
+
+    int64_t _firstDirtyTs = 0;
+    uint16_t _dirtyChanges = 0;
+    bool _flushRequested = false;
+    uint32_t _flashWrites = 0;
+    uint32_t _coalescedWrites = 0;
+
+    static WriteBehindStore* _instance;
+};
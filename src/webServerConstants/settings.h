@@ -0,0 +1,119 @@
+#pragma once
+
+// settings.html, converted by compress_assets.py (5035 -> 1761 bytes)
+const bool settings_html_gzip = true;
+const char settings_html_etag[] = "\"4adf230184ef40b9\"";
+const uint8_t settings_html[] =
+{
+0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x58, 0x4d, 0x73, 0xdb, 0xb6,
+0x16, 0xdd, 0xfb, 0x57, 0x20, 0x5a, 0x94, 0xd4, 0x44, 0x21, 0x95, 0xb8, 0xdd, 0xd8, 0xa2, 0x32,
+0x8e, 0xe3, 0x4e, 0xd3, 0x71, 0x63, 0x4f, 0xe3, 0xb7, 0xe8, 0x78, 0xbc, 0x80, 0x48, 0xc8, 0x42,
+0x4d, 0x11, 0x2c, 0x00, 0xda, 0x51, 0x33, 0xfe, 0xef, 0xef, 0x5c, 0x90, 0xa0, 0x48, 0x86, 0x8e,
+0xf3, 0xfa, 0x16, 0xd5, 0x46, 0x22, 0x70, 0x71, 0xef, 0xc5, 0x39, 0xf7, 0x8b, 0x5a, 0xbc, 0x78,
+0x7f, 0x71, 0x7a, 0xf5, 0xc7, 0xe5, 0x19, 0xdb, 0xd8, 0x6d, 0xbe, 0x3c, 0x58, 0xf8, 0x2f, 0xc1,
+0x33, 0x7c, 0x6d, 0x85, 0xe5, 0xac, 0xe0, 0x5b, 0x91, 0x4c, 0xee, 0xa5, 0x78, 0x28, 0x95, 0xb6,
+0x13, 0x96, 0xaa, 0xc2, 0x8a, 0xc2, 0x26, 0x93, 0x07, 0x99, 0xd9, 0x4d, 0x92, 0x89, 0x7b, 0x99,
+0x8a, 0x57, 0xee, 0x61, 0xc6, 0x64, 0x21, 0xad, 0xe4, 0xf9, 0x2b, 0x93, 0xf2, 0x5c, 0x24, 0xaf,
+0x27, 0x50, 0x92, 0xcb, 0xe2, 0x8e, 0x69, 0x91, 0x27, 0x13, 0x63, 0x77, 0xb9, 0x30, 0x1b, 0x21,
+0xa0, 0x65, 0xa3, 0xc5, 0x3a, 0x99, 0xc4, 0x6e, 0x29, 0x4a, 0x8d, 0x21, 0x49, 0x2b, 0x6d, 0x2e,
+0x96, 0x1f, 0xab, 0x3b, 0xc9, 0x7e, 0xa9, 0x56, 0x8b, 0xb8, 0x7e, 0x3e, 0x58, 0xc4, 0x8d, 0x3b,
+0x2b, 0x95, 0xed, 0xc8, 0xb9, 0xc3, 0xe5, 0x49, 0x9e, 0x33, 0x23, 0xac, 0x95, 0xc5, 0xad, 0xc1,
+0xf6, 0x21, 0x56, 0xcb, 0xe5, 0xa7, 0x66, 0x81, 0x71, 0xc3, 0x8c, 0x55, 0x5a, 0x64, 0x4c, 0x15,
+0xcc, 0xab, 0x9b, 0xc1, 0x07, 0x9e, 0xb1, 0xb5, 0x56, 0x5b, 0xc6, 0x8b, 0x8c, 0x19, 0x7e, 0x0f,
+0x01, 0xab, 0xd8, 0x22, 0x55, 0x99, 0x58, 0xc6, 0xbc, 0x94, 0xf1, 0x5e, 0xa5, 0x5b, 0x8b, 0xd8,
+0x45, 0x91, 0xef, 0x58, 0xba, 0xe1, 0xc5, 0x2d, 0x64, 0xef, 0x79, 0x5e, 0x09, 0x68, 0xd7, 0x02,
+0xb6, 0x0b, 0xcb, 0x56, 0x3c, 0xbd, 0x8b, 0xd8, 0x29, 0xec, 0xe0, 0x09, 0x97, 0x36, 0xb5, 0x5e,
+0x91, 0x6a, 0x61, 0x6b, 0x31, 0x7f, 0x12, 0x6e, 0xd8, 0x0d, 0x1e, 0x3b, 0xa2, 0x25, 0xbf, 0x15,
+0xd1, 0x22, 0x2e, 0xe1, 0xb9, 0x2c, 0xca, 0xca, 0x32, 0xbb, 0x2b, 0x01, 0xb3, 0x15, 0x9f, 0x01,
+0x8e, 0xcc, 0x92, 0xc9, 0x5a, 0xe6, 0x56, 0xe8, 0x09, 0x2b, 0x73, 0x9e, 0x8a, 0x8d, 0xca, 0x33,
+0xa1, 0x93, 0xc9, 0xcf, 0xcd, 0xa2, 0x91, 0x7f, 0x43, 0xf8, 0xcd, 0x4f, 0x84, 0xda, 0x5a, 0xe9,
+0xad, 0x3b, 0xe1, 0xbd, 0x07, 0x45, 0x39, 0x37, 0x26, 0x99, 0xf0, 0x8c, 0x97, 0xd6, 0x01, 0xcb,
+0x57, 0xb9, 0x70, 0x32, 0xee, 0xd7, 0x64, 0x09, 0x6c, 0xe9, 0xc7, 0xc0, 0xb8, 0xa9, 0x56, 0x5b,
+0x09, 0xf3, 0xee, 0xa2, 0xc9, 0xe4, 0x13, 0x10, 0xa2, 0xd3, 0x31, 0x59, 0x20, 0x84, 0x9d, 0x86,
+0xad, 0x30, 0x06, 0xbe, 0x93, 0x0e, 0x72, 0x9e, 0x7b, 0x26, 0x27, 0xcb, 0x77, 0xc0, 0x63, 0x11,
+0x73, 0x2c, 0x9a, 0x54, 0xcb, 0xd2, 0x2e, 0x0f, 0xe2, 0x98, 0xe1, 0xbe, 0x5a, 0x0a, 0x73, 0xc4,
+0xae, 0xef, 0xc4, 0x6e, 0xe6, 0x0c, 0xb1, 0x70, 0x15, 0xcb, 0xb8, 0x8a, 0xcd, 0x74, 0xc6, 0x78,
+0x59, 0x02, 0xe1, 0x70, 0xce, 0xe4, 0x76, 0x2b, 0x32, 0xc9, 0xad, 0xc8, 0x21, 0xf5, 0x1a, 0x5c,
+0x19, 0xcb, 0xb5, 0x05, 0x9a, 0x9a, 0xc2, 0xcb, 0xcc, 0xd8, 0x1b, 0xac, 0xad, 0x94, 0xb2, 0x38,
+0x94, 0x89, 0x35, 0xaf, 0x72, 0x3b, 0xab, 0x1d, 0xbd, 0x39, 0xb8, 0xe7, 0x9a, 0x9d, 0x5c, 0x5e,
+0x9e, 0xff, 0xc1, 0x12, 0x76, 0x1d, 0x04, 0x33, 0x16, 0x0c, 0x8f, 0xd7, 0x6b, 0x74, 0x3c, 0xb8,
+0x39, 0x76, 0xf2, 0x8d, 0x5f, 0x74, 0x02, 0x2b, 0x07, 0xeb, 0xaa, 0x48, 0xad, 0x04, 0x4f, 0xcd,
+0xf5, 0x42, 0x22, 0x62, 0xca, 0xbe, 0x1c, 0x30, 0x7c, 0x32, 0x95, 0x56, 0x5b, 0x1c, 0x88, 0x6e,
+0x85, 0x3d, 0xcb, 0x05, 0xfd, 0x7c, 0xb7, 0xfb, 0x90, 0x85, 0x41, 0x23, 0x1c, 0x4c, 0x23, 0x12,
+0x3f, 0xad, 0x13, 0x03, 0x2a, 0xe9, 0xe9, 0xf8, 0xe0, 0xb1, 0xa3, 0x56, 0x8b, 0x02, 0x04, 0x86,
+0x5e, 0x23, 0x79, 0x50, 0x93, 0x92, 0x3c, 0xad, 0xdd, 0x09, 0x04, 0xd3, 0x63, 0x77, 0xc2, 0x3d,
+0x44, 0xb2, 0x28, 0x84, 0xfe, 0xe5, 0xea, 0xb7, 0x73, 0x9c, 0x0b, 0x82, 0x7a, 0xa7, 0xb9, 0x49,
+0x04, 0x96, 0xce, 0x78, 0xba, 0x09, 0xbd, 0xcd, 0x90, 0x36, 0x76, 0xde, 0xa2, 0xb7, 0xaa, 0xd5,
+0x03, 0x39, 0xd8, 0x68, 0x03, 0x3e, 0xf6, 0x77, 0xf5, 0x10, 0x36, 0x46, 0xbc, 0x50, 0x1d, 0x14,
+0x1d, 0xd7, 0x10, 0xb9, 0xa0, 0xa6, 0xf1, 0x2e, 0x0c, 0xdc, 0x7e, 0xd0, 0x39, 0xe4, 0x16, 0x22,
+0xaa, 0x14, 0x38, 0xe5, 0xec, 0x5e, 0xcf, 0x6f, 0x3a, 0xdb, 0x6b, 0x56, 0x7b, 0x73, 0xfd, 0xfa,
+0x86, 0x25, 0x70, 0x7d, 0x15, 0x74, 0xfd, 0xda, 0x6b, 0x70, 0xe1, 0x81, 0xfd, 0x74, 0x23, 0xd2,
+0xbb, 0x95, 0xfa, 0x1c, 0x1c, 0x8f, 0x08, 0xb9, 0x4d, 0x64, 0x95, 0xb7, 0xf4, 0x63, 0xc7, 0xd2,
+0x23, 0x13, 0xb9, 0x11, 0xdf, 0xd2, 0xdd, 0xf3, 0xc3, 0x04, 0xec, 0x2d, 0x0b, 0x88, 0xae, 0x80,
+0x1d, 0xb1, 0xa0, 0xa8, 0xb6, 0x2b, 0xa1, 0x47, 0x8d, 0x52, 0xc6, 0xe1, 0xf4, 0x9b, 0x9f, 0xc6,
+0x36, 0x5d, 0x1c, 0x8e, 0xfa, 0xb3, 0x97, 0xe9, 0xe4, 0x71, 0x2b, 0x79, 0xd8, 0xf5, 0x7c, 0x00,
+0xa6, 0x2b, 0x7e, 0x84, 0xc5, 0xfb, 0x3a, 0xda, 0xe1, 0x1e, 0x7b, 0x39, 0x72, 0x0e, 0x84, 0x36,
+0x44, 0x9e, 0x8a, 0x3c, 0x0f, 0x87, 0xa1, 0xe8, 0xc9, 0xc0, 0xd9, 0x86, 0x82, 0x37, 0x37, 0x74,
+0x67, 0x16, 0x92, 0x3a, 0x97, 0x35, 0xd7, 0x7e, 0x9d, 0x84, 0x82, 0xa9, 0x43, 0xa2, 0x4b, 0xee,
+0x57, 0x16, 0x90, 0xb4, 0x08, 0xe7, 0xd3, 0x8d, 0xcc, 0xb3, 0xd0, 0x39, 0xdb, 0x08, 0x3f, 0x36,
+0xdf, 0x75, 0xe9, 0xa2, 0xa0, 0xea, 0xa6, 0x80, 0x5f, 0xed, 0xa6, 0x00, 0x5c, 0xfd, 0x56, 0x06,
+0xd4, 0x47, 0x90, 0x5e, 0x0e, 0xe0, 0xc8, 0xaa, 0x73, 0xf5, 0x20, 0xf4, 0x29, 0x37, 0xc2, 0x47,
+0xec, 0x89, 0xd6, 0x7c, 0x17, 0x95, 0x5a, 0x59, 0x45, 0xfc, 0xfa, 0x24, 0x88, 0xd0, 0x7e, 0xf2,
+0xf0, 0xb9, 0xcc, 0x8a, 0x70, 0x33, 0x54, 0x96, 0x36, 0x61, 0xf0, 0xd8, 0x0d, 0x4b, 0xba, 0x77,
+0xdd, 0x9f, 0x32, 0x69, 0x40, 0xdf, 0x0e, 0xae, 0xd2, 0x5a, 0x0a, 0x14, 0x0c, 0x20, 0xed, 0x22,
+0xdd, 0xf7, 0x0d, 0x70, 0x65, 0xe2, 0xf3, 0xc5, 0xba, 0xa9, 0x22, 0xcb, 0x84, 0xcd, 0x09, 0xf3,
+0x3a, 0xc6, 0x54, 0x21, 0x82, 0x3d, 0x5e, 0x5d, 0x84, 0x32, 0xb9, 0x5e, 0xf7, 0xf0, 0xf1, 0xfd,
+0x23, 0x61, 0x5f, 0x1e, 0x8f, 0xf7, 0xab, 0xaa, 0x72, 0xd4, 0xce, 0xff, 0x49, 0xfe, 0x7f, 0x95,
+0xda, 0x7b, 0x6c, 0xcc, 0xbb, 0xdd, 0x47, 0x64, 0x70, 0xe8, 0x43, 0x66, 0xda, 0xcb, 0x61, 0x3a,
+0xec, 0x68, 0xf8, 0x9f, 0xd2, 0xda, 0x67, 0x46, 0x2f, 0x73, 0x9f, 0x49, 0xd7, 0x7e, 0x36, 0x75,
+0x33, 0xb5, 0x9b, 0x6d, 0x47, 0xe8, 0xec, 0x94, 0xad, 0x61, 0x67, 0x71, 0x3a, 0x9a, 0x4e, 0xf0,
+0xb2, 0x3e, 0xf2, 0x22, 0xd9, 0xa7, 0xe8, 0xd0, 0xd1, 0x06, 0xea, 0x6b, 0x7f, 0x79, 0x58, 0x1d,
+0x5e, 0xd7, 0x89, 0x11, 0xf6, 0x2f, 0x5f, 0x0e, 0xed, 0xf8, 0xc8, 0x47, 0xe7, 0xaf, 0x74, 0xd1,
+0x30, 0xb4, 0x74, 0xac, 0x7b, 0x0e, 0x8f, 0x58, 0x51, 0xe5, 0x79, 0x9f, 0xf0, 0x5c, 0xf1, 0xac,
+0x25, 0x7c, 0x2d, 0x2c, 0xd8, 0x0b, 0x7a, 0x83, 0x08, 0xfa, 0xd6, 0x17, 0x46, 0xd3, 0x8f, 0xd0,
+0x68, 0xa1, 0x5f, 0x58, 0x70, 0x92, 0xa6, 0xa2, 0xb4, 0x01, 0xe2, 0x88, 0x3a, 0xa7, 0x4c, 0x39,
+0xe9, 0x89, 0xff, 0x34, 0xaa, 0x08, 0x00, 0xe6, 0x23, 0xb2, 0x7f, 0x23, 0x8a, 0x7d, 0x08, 0xa0,
+0x0f, 0x96, 0x0a, 0xa9, 0xdb, 0xbd, 0x2d, 0xe1, 0xf1, 0xc2, 0x6f, 0x44, 0xea, 0x6e, 0x88, 0x84,
+0xdd, 0x50, 0x8f, 0x28, 0xc4, 0x03, 0x3b, 0xd3, 0x5a, 0xe9, 0x56, 0x07, 0x72, 0x81, 0xdb, 0xca,
+0x8c, 0x62, 0xdc, 0xdc, 0xbb, 0x15, 0x25, 0x87, 0xc2, 0xb6, 0x2a, 0x0c, 0x9c, 0xa2, 0xcd, 0xae,
+0xd1, 0x7d, 0x2b, 0xa6, 0x9d, 0xc8, 0xdf, 0xbd, 0x53, 0x80, 0x9a, 0xe6, 0xd9, 0xea, 0xc3, 0xb5,
+0x7b, 0x81, 0x4e, 0x7e, 0x76, 0x35, 0xfa, 0x26, 0x1e, 0x9c, 0x03, 0x60, 0xe8, 0x6a, 0x67, 0x45,
+0xb6, 0xe6, 0x32, 0x07, 0x19, 0xae, 0xf8, 0xb9, 0x63, 0x51, 0x23, 0x5b, 0x97, 0xbe, 0x69, 0x2f,
+0x31, 0x31, 0xbe, 0x3c, 0x48, 0xbb, 0x61, 0xbf, 0xfd, 0x7c, 0x42, 0x83, 0x8a, 0x56, 0x08, 0x08,
+0x78, 0x4b, 0xc5, 0x23, 0x73, 0x03, 0x1d, 0xcd, 0x90, 0x6c, 0x83, 0x71, 0x13, 0x63, 0xe4, 0x4a,
+0x34, 0x32, 0xd8, 0x5b, 0xed, 0xd8, 0xd5, 0xc5, 0xd5, 0x25, 0x53, 0x9a, 0x71, 0xf6, 0xbe, 0x52,
+0xac, 0xac, 0x0c, 0x86, 0xe3, 0x5c, 0xde, 0x89, 0xfa, 0x5c, 0xeb, 0x0e, 0x26, 0x2b, 0xb3, 0x8f,
+0x87, 0x46, 0x41, 0xd8, 0xc4, 0xcc, 0x8c, 0x75, 0xa1, 0x22, 0xde, 0x1c, 0x40, 0xad, 0x2b, 0x94,
+0x17, 0xa8, 0x7b, 0x65, 0x30, 0x4c, 0x72, 0x9a, 0x5e, 0x01, 0x27, 0xc4, 0xb6, 0x25, 0xda, 0xf5,
+0x19, 0x4a, 0x94, 0xae, 0x3d, 0x72, 0x3b, 0xf0, 0x96, 0x3c, 0xef, 0x35, 0x70, 0x28, 0xa7, 0xbd,
+0x61, 0x30, 0x90, 0xdc, 0xde, 0x9d, 0xe0, 0x2d, 0x99, 0xc3, 0x20, 0x97, 0xd4, 0xbd, 0x88, 0x4e,
+0xfc, 0xe7, 0xf7, 0x0f, 0xa7, 0x30, 0x83, 0xaa, 0x86, 0xc9, 0xc0, 0xa9, 0x98, 0x3e, 0x93, 0xdf,
+0x2d, 0x3b, 0x18, 0x30, 0x7b, 0xe4, 0xa4, 0xbc, 0xa0, 0xda, 0x2a, 0xb2, 0x28, 0xf8, 0x2a, 0xca,
+0x1a, 0x4d, 0xe3, 0x20, 0x64, 0x95, 0x0a, 0x46, 0xf9, 0x3f, 0xa9, 0x01, 0x75, 0xa0, 0x7b, 0x1e,
+0xfc, 0xf5, 0x7b, 0x46, 0x08, 0xb5, 0x52, 0xe1, 0xad, 0x22, 0x21, 0x77, 0x3e, 0x10, 0x60, 0x50,
+0xbe, 0x0f, 0xb1, 0x21, 0x2e, 0x3e, 0x59, 0x51, 0x3d, 0xdf, 0xd2, 0x28, 0x9f, 0xc0, 0x05, 0x57,
+0xdd, 0x7e, 0x70, 0xa3, 0xf4, 0xe1, 0x0f, 0x18, 0x95, 0x09, 0x23, 0xe7, 0xab, 0xcc, 0xbe, 0x27,
+0x2f, 0x9f, 0xca, 0x25, 0xea, 0x21, 0xdd, 0x01, 0x6d, 0x34, 0xa7, 0xba, 0xe3, 0x6a, 0x6f, 0xf6,
+0x00, 0x5e, 0x75, 0x97, 0x05, 0x4c, 0xaf, 0x83, 0x31, 0x11, 0x57, 0xd6, 0x72, 0xc1, 0x75, 0x7b,
+0x6b, 0x02, 0x62, 0x60, 0xf0, 0x89, 0x78, 0x08, 0x46, 0xc4, 0x3a, 0x4c, 0xb5, 0x96, 0xe7, 0xff,
+0xbf, 0xe5, 0x96, 0x53, 0xe2, 0xb1, 0x65, 0xbf, 0xce, 0xe7, 0x68, 0xd4, 0x8f, 0x01, 0x62, 0x9d,
+0x88, 0xc2, 0xdb, 0xc4, 0x7c, 0x3e, 0xf7, 0xc9, 0x3e, 0x8c, 0xd1, 0x27, 0xe3, 0xb3, 0x5b, 0x3c,
+0x1c, 0xb1, 0xe0, 0x08, 0x93, 0x59, 0xbf, 0x74, 0xf4, 0x0a, 0x7c, 0x1f, 0xae, 0xbf, 0x2a, 0xb1,
+0x6f, 0xc8, 0xa3, 0xe5, 0x1e, 0xaa, 0x9c, 0x10, 0x95, 0x7d, 0xbc, 0x7c, 0x6f, 0x54, 0x86, 0x4a,
+0x7f, 0x79, 0xf1, 0xe9, 0x0a, 0x8d, 0xa0, 0xdb, 0x06, 0x9a, 0xa9, 0xe3, 0xd5, 0x15, 0x82, 0xed,
+0x89, 0x66, 0x30, 0x63, 0xf4, 0xba, 0x7c, 0xc4, 0x7e, 0xfd, 0x74, 0xf1, 0x11, 0xa5, 0x5b, 0x43,
+0xbf, 0x5c, 0xef, 0xbc, 0x33, 0xd3, 0xef, 0xef, 0x15, 0x83, 0xfa, 0x4f, 0x7c, 0xfe, 0x38, 0x3f,
+0x1c, 0xf2, 0x39, 0xde, 0x01, 0x9e, 0xa9, 0xfc, 0xfe, 0x33, 0x5e, 0xf7, 0x8e, 0x9f, 0x26, 0xf0,
+0x5f, 0x68, 0x66, 0xdf, 0x71, 0x95, 0x36, 0x70, 0x40, 0xcf, 0x5a, 0xde, 0x56, 0x9a, 0xb7, 0x41,
+0x90, 0x11, 0xb5, 0x6d, 0xe5, 0xc2, 0x2b, 0x2f, 0xc6, 0xc1, 0x19, 0xdb, 0x8f, 0xe0, 0xfb, 0x1d,
+0x37, 0x84, 0xc3, 0xf8, 0x5f, 0x95, 0xd4, 0xf5, 0x1f, 0x14, 0xf5, 0x01, 0xa3, 0xb6, 0xfb, 0xc6,
+0x11, 0xb9, 0x51, 0x12, 0x61, 0x3f, 0x00, 0xa9, 0x1e, 0x28, 0x3a, 0x97, 0xfa, 0x07, 0x3d, 0xf3,
+0x5b, 0x51, 0xff, 0x6c, 0xcb, 0x7c, 0x7e, 0x94, 0xe7, 0x59, 0x76, 0x76, 0x8f, 0xe5, 0x73, 0x69,
+0x10, 0xc2, 0x68, 0xeb, 0x01, 0xfa, 0x49, 0x55, 0x02, 0x8d, 0x5a, 0x04, 0x7a, 0x9e, 0x54, 0xd2,
+0xe6, 0xc9, 0x98, 0x9a, 0xfa, 0xdf, 0x8b, 0xa0, 0x33, 0xcf, 0x0b, 0x12, 0xf0, 0x77, 0x74, 0x0f,
+0x78, 0x53, 0x70, 0xdf, 0xcd, 0x3b, 0x95, 0x87, 0xaa, 0x3f, 0x6b, 0xd7, 0x63, 0xf8, 0x71, 0xdb,
+0x74, 0xdb, 0x9d, 0xc4, 0x8d, 0x70, 0xa3, 0xa0, 0x7d, 0x54, 0x8d, 0x02, 0xd3, 0xab, 0x45, 0x75,
+0x28, 0xf9, 0xca, 0xf0, 0x44, 0x01, 0x25, 0xe8, 0x3c, 0x71, 0x8b, 0xd8, 0xff, 0x77, 0xb2, 0x88,
+0x9b, 0xbf, 0xbb, 0xe2, 0xfa, 0x3f, 0xb9, 0xff, 0x02, 0x02, 0x0b, 0x5a, 0x59, 0xab, 0x13, 0x00,
+0x00
+};
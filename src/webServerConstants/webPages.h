@@ -0,0 +1,272 @@
+#pragma once
+
+// generated from resources/pages by compile_pages.py, do not edit
+
+#include "../Config.h"
+#include "../PreferencesKeys.h"
+#include "../util/WebPageTemplate.h"
+
+const WebPageOp advanced_page_ops[] =
+{
+    { WebPageOpType::Fragment, 0, 501, "<html><head><meta name='viewport' content='width=device-width, initial-scale=1'><link rel='stylesheet' href='/style.css'"
+        "><title>Nuki Hub</title></head><body><form class=\"adapt\" method=\"post\" action=\"post\"><input type=\"hidden\" name=\""
+        "page\" value=\"savecfg\"><h3>Advanced Configuration</h3><h4 class=\"warning\">Warning: Changing these settings can lead "
+        "to bootloops that might require you to erase the ESP32 and reflash Nuki Hub using USB/serial</h4><table><tr><td>Current "
+        "bootloop prevention state</td><td>", nullptr },
+    { WebPageOpType::EnabledText, 0, false, preference_enable_bootloop_reset, nullptr },
+    { WebPageOpType::Fragment, 0, 177, "</td></tr><tr><td>Disable Network if not connected within 60s</td><td><input type=hidden name=\"DISNTWNOCON\" value=\"0\""
+        "/><input type=checkbox name=\"DISNTWNOCON\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_disable_network_not_connected, nullptr },
+    { WebPageOpType::Fragment, 0, 150, "/></td></tr><tr><td>Enable WebSerial logging</td><td><input type=hidden name=\"WEBLOG\" value=\"0\"/><input type=checkbo"
+        "x name=\"WEBLOG\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_force_hosted_update, nullptr },
+    { WebPageOpType::Fragment, 0, 170, "/></td></tr><tr><td>Force slave Hosted update on next boot</td><td><input type=hidden name=\"FRCHSTUPD\" value=\"0\"/><i"
+        "nput type=checkbox name=\"FRCHSTUPD\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_webserial_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 318, "/></td></tr><tr><td>Enable Bootloop prevention (Try to reset these settings to default on bootloop)</td><td><input type="
+        "hidden name=\"BTLPRST\" value=\"0\"/><input type=checkbox name=\"BTLPRST\" class=\"\" value=\"1\" checked=\"checked\"/><"
+        "/td></tr><tr><td>Char buffer size (min 4096, max 65536)</td><td><input type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, CHAR_BUFFER_SIZE, preference_buffer_size, nullptr },
+    { WebPageOpType::Fragment, 0, 235, "\" name=\"BUFFSIZE\" size=\"25\" maxlength=\"6\"/></td></tr><tr><td>Advised minimum char buffer size based on current se"
+        "ttings</td><td id=\"mincharbuffer\"></td><tr><td>Task size Network (min 12288, max 65536)</td><td><input type=\"text\" v"
+        "alue=\"", nullptr },
+    { WebPageOpType::Int, 0, NETWORK_TASK_SIZE, preference_task_size_network, nullptr },
+    { WebPageOpType::Fragment, 0, 232, "\" name=\"TSKNTWK\" size=\"25\" maxlength=\"6\"/></td></tr><tr><td>Advised minimum network task size based on current se"
+        "ttings</td><td id=\"minnetworktask\"></td><tr><td>Task size Nuki (min 8192, max 65536)</td><td><input type=\"text\" valu"
+        "e=\"", nullptr },
+    { WebPageOpType::Int, 0, NUKI_TASK_SIZE, preference_task_size_nuki, nullptr },
+    { WebPageOpType::Fragment, 0, 143, "\" name=\"TSKNUKI\" size=\"25\" maxlength=\"6\"/></td></tr><tr><td>BLE General timeout in ms (min 10000, max 65536)</td>"
+        "<td><input type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 10000, preference_ble_general_timeout, nullptr },
+    { WebPageOpType::Fragment, 0, 148, "\" name=\"BLEGENTIMEOUT\" size=\"25\" maxlength=\"6\"/></td></tr><tr><td>BLE Command timeout in ms (min 3000, max 65536)"
+        "</td><td><input type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 3000, preference_ble_command_timeout, nullptr },
+    { WebPageOpType::Fragment, 0, 159, "\" name=\"BLECMDTIMEOUT\" size=\"25\" maxlength=\"6\"/></td></tr><tr><td>Max auth log entries (min 1, max 100)</td><td><"
+        "input type=\"text\" id=\"inputmaxauthlog\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, MAX_AUTHLOG, preference_authlog_max_entries, nullptr },
+    { WebPageOpType::Fragment, 0, 148, "\" name=\"ALMAX\" size=\"25\" maxlength=\"3\"/></td></tr><tr><td>Max keypad entries (min 1, max 200)</td><td><input type"
+        "=\"text\" id=\"inputmaxkeypad\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, MAX_KEYPAD, preference_keypad_max_entries, nullptr },
+    { WebPageOpType::Fragment, 0, 158, "\" name=\"KPMAX\" size=\"25\" maxlength=\"3\"/></td></tr><tr><td>Max timecontrol entries (min 1, max 100)</td><td><input"
+        " type=\"text\" id=\"inputmaxtimecontrol\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, MAX_TIMECONTROL, preference_timecontrol_max_entries, nullptr },
+    { WebPageOpType::Fragment, 0, 153, "\" name=\"TCMAX\" size=\"25\" maxlength=\"3\"/></td></tr><tr><td>Max authorization entries (min 1, max 100)</td><td><inp"
+        "ut type=\"text\" id=\"inputmaxauth\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, MAX_AUTH, preference_auth_max_entries, nullptr },
+    { WebPageOpType::Fragment, 0, 209, "\" name=\"AUTHMAX\" size=\"25\" maxlength=\"3\"/></td></tr><tr><td>Show Pairing secrets on Info page</td><td><input type"
+        "=hidden name=\"SHOWSECRETS\" value=\"0\"/><input type=checkbox name=\"SHOWSECRETS\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_show_secrets, nullptr },
+    { WebPageOpType::Fragment, 0, 12, "/></td></tr>", nullptr },
+    { WebPageOpType::IfBool, 31, true, preference_lock_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 648, "<tr><td>Manually set lock pairing data (enable to save values below)</td><td><input type=hidden name=\"LCKMANPAIR\" valu"
+        "e=\"0\"/><input type=checkbox name=\"LCKMANPAIR\" class=\"\" value=\"1\"/></td></tr><tr><td>currentBleAddress</td><td><i"
+        "nput type=\"text\"\" name=\"LCKBLEADDR\" size=\"25\" maxlength=\"12\"/></td></tr><tr><td>secretKeyK</td><td><input type="
+        "\"text\"\" name=\"LCKSECRETK\" size=\"25\" maxlength=\"64\"/></td></tr><tr><td>authorizationId</td><td><input type=\"tex"
+        "t\"\" name=\"LCKAUTHID\" size=\"25\" maxlength=\"8\"/></td></tr><tr><td>isUltra</td><td><input type=hidden name=\"LCKISU"
+        "LTRA\" value=\"0\"/><input type=checkbox name=\"LCKISULTRA\" class=\"\" value=\"1\"/></td></tr>", nullptr },
+    { WebPageOpType::IfBool, 33, false, preference_opener_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 509, "<tr><td>Manually set opener pairing data (enable to save values below)</td><td><input type=hidden name=\"OPNMANPAIR\" va"
+        "lue=\"0\"/><input type=checkbox name=\"OPNMANPAIR\" class=\"\" value=\"1\"/></td></tr><tr><td>currentBleAddress</td><td>"
+        "<input type=\"text\"\" name=\"OPNBLEADDR\" size=\"25\" maxlength=\"12\"/></td></tr><tr><td>secretKeyK</td><td><input typ"
+        "e=\"text\"\" name=\"OPNSECRETK\" size=\"25\" maxlength=\"64\"/></td></tr><tr><td>authorizationId</td><td><input type=\"t"
+        "ext\"\" name=\"OPNAUTHID\" size=\"25\" maxlength=\"8\"/></td></tr>", nullptr },
+    { WebPageOpType::Fragment, 0, 243, "<tr><td>Custom URL to update Nuki Hub updater</td><td><input type=\"text\"\" name=\"OTAUPD\" size=\"25\" maxlength=\"255"
+        "\"/></td></tr><tr><td>Custom URL to update Nuki Hub</td><td><input type=\"text\"\" name=\"OTAMAIN\" size=\"25\" maxlengt"
+        "h=\"255\"/></td></tr>", nullptr },
+    { WebPageOpType::IfCondition, 44, (int32_t)WebPageCondition::LockActive, nullptr, nullptr },
+    { WebPageOpType::Fragment, 0, 37, "<tr><td>Force Lock ID to current ID (", nullptr },
+    { WebPageOpType::HexUInt, 0, 0, preference_nuki_id_lock, nullptr },
+    { WebPageOpType::Fragment, 0, 115, ")</td><td><input type=hidden name=\"LCKFORCEID\" value=\"0\"/><input type=checkbox name=\"LCKFORCEID\" class=\"\" value="
+        "\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_lock_force_id, nullptr },
+    { WebPageOpType::Fragment, 0, 161, "/></td></tr><tr><td>Force Lock Keypad connected</td><td><input type=hidden name=\"LCKFORCEKP\" value=\"0\"/><input type="
+        "checkbox name=\"LCKFORCEKP\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_lock_force_keypad, nullptr },
+    { WebPageOpType::Fragment, 0, 165, "/></td></tr><tr><td>Force Lock Doorsensor connected</td><td><input type=hidden name=\"LCKFORCEDS\" value=\"0\"/><input t"
+        "ype=checkbox name=\"LCKFORCEDS\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_lock_force_doorsensor, nullptr },
+    { WebPageOpType::Fragment, 0, 12, "/></td></tr>", nullptr },
+    { WebPageOpType::IfCondition, 52, (int32_t)WebPageCondition::OpenerActive, nullptr, nullptr },
+    { WebPageOpType::Fragment, 0, 39, "<tr><td>Force Opener ID to current ID (", nullptr },
+    { WebPageOpType::HexUInt, 0, 0, preference_nuki_id_opener, nullptr },
+    { WebPageOpType::Fragment, 0, 113, ")</td><td><input type=hidden name=\"OPFORCEID\" value=\"0\"/><input type=checkbox name=\"OPFORCEID\" class=\"\" value=\""
+        "1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_opener_force_id, nullptr },
+    { WebPageOpType::Fragment, 0, 151, "/></td></tr><tr><td>Force Opener Keypad</td><td><input type=hidden name=\"OPFORCEKP\" value=\"0\"/><input type=checkbox "
+        "name=\"OPFORCEKP\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_opener_force_keypad, nullptr },
+    { WebPageOpType::Fragment, 0, 12, "/></td></tr>", nullptr },
+    { WebPageOpType::Fragment, 0, 149, "<tr><td>Enable Nuki connect debug logging</td><td><input type=hidden name=\"DBGCONN\" value=\"0\"/><input type=checkbox "
+        "name=\"DBGCONN\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_debug_connect, nullptr },
+    { WebPageOpType::Fragment, 0, 169, "/></td></tr><tr><td>Enable Nuki communication debug logging</td><td><input type=hidden name=\"DBGCOMMU\" value=\"0\"/><i"
+        "nput type=checkbox name=\"DBGCOMMU\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_debug_communication, nullptr },
+    { WebPageOpType::Fragment, 0, 167, "/></td></tr><tr><td>Enable Nuki readable data debug logging</td><td><input type=hidden name=\"DBGREAD\" value=\"0\"/><in"
+        "put type=checkbox name=\"DBGREAD\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_debug_readable_data, nullptr },
+    { WebPageOpType::Fragment, 0, 160, "/></td></tr><tr><td>Enable Nuki hex data debug logging</td><td><input type=hidden name=\"DBGHEX\" value=\"0\"/><input ty"
+        "pe=checkbox name=\"DBGHEX\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_debug_hex_data, nullptr },
+    { WebPageOpType::Fragment, 0, 161, "/></td></tr><tr><td>Enable Nuki command debug logging</td><td><input type=hidden name=\"DBGCOMM\" value=\"0\"/><input ty"
+        "pe=checkbox name=\"DBGCOMM\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_debug_command, nullptr },
+    { WebPageOpType::Fragment, 0, 155, "/></td></tr><tr><td>Publish free heap over MQTT</td><td><input type=hidden name=\"DBGHEAP\" value=\"0\"/><input type=che"
+        "ckbox name=\"DBGHEAP\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_publish_debug_info, nullptr },
+    { WebPageOpType::Fragment, 0, 1874, "/></td></tr></table><br><input type=\"submit\" name=\"submit\" value=\"Save\"></form></body><script>window.onload = func"
+        "tion() { document.getElementById(\"inputmaxauthlog\").addEventListener(\"keyup\", calculate);document.getElementById(\"i"
+        "nputmaxkeypad\").addEventListener(\"keyup\", calculate);document.getElementById(\"inputmaxtimecontrol\").addEventListene"
+        "r(\"keyup\", calculate);document.getElementById(\"inputmaxauth\").addEventListener(\"keyup\", calculate); calculate(); }"
+        "; function calculate() { var auth = document.getElementById(\"inputmaxauth\").value; var authlog = document.getElementBy"
+        "Id(\"inputmaxauthlog\").value; var keypad = document.getElementById(\"inputmaxkeypad\").value; var timecontrol = documen"
+        "t.getElementById(\"inputmaxtimecontrol\").value; var charbuf = 0; var networktask = 0; var sizeauth = 0; var sizeauthlog"
+        " = 0; var sizekeypad = 0; var sizetimecontrol = 0; if(auth > 0) { sizeauth = 300 * auth; } if(authlog > 0) { sizeauthlog"
+        " = 280 * authlog; } if(keypad > 0) { sizekeypad = 350 * keypad; } if(timecontrol > 0) { sizetimecontrol = 120 * timecont"
+        "rol; } charbuf = sizetimecontrol; networktask = 10240 + sizetimecontrol; if(sizeauthlog>sizekeypad && sizeauthlog>sizeti"
+        "mecontrol && sizeauthlog>sizeauth) { charbuf = sizeauthlog; networktask = 10240 + sizeauthlog;} else if(sizekeypad>sizea"
+        "uthlog && sizekeypad>sizetimecontrol && sizekeypad>sizeauth) { charbuf = sizekeypad; networktask = 10240 + sizekeypad;} "
+        "else if(sizeauth>sizeauthlog && sizeauth>sizetimecontrol && sizeauth>sizekeypad) { charbuf = sizeauth; networktask = 102"
+        "40 + sizeauth;} if(charbuf<4096) { charbuf = 4096; } else if (charbuf>65536) { charbuf = 65536; } if(networktask<12288) "
+        "{ networktask = 12288; } else if (networktask>65536) { networktask = 65536; } document.getElementById(\"mincharbuffer\")"
+        ".innerHTML = charbuf; document.getElementById(\"minnetworktask\").innerHTML = networktask; }</script></html>", nullptr },
+};
+const WebPageTemplate advanced_page = { advanced_page_ops, sizeof(advanced_page_ops) / sizeof(WebPageOp) };
+
+const WebPageOp mqttconfig_page_ops[] =
+{
+    { WebPageOpType::Fragment, 0, 340, "<html><head><meta name='viewport' content='width=device-width, initial-scale=1'><link rel='stylesheet' href='/style.css'"
+        "><title>Nuki Hub</title></head><body><form class=\"adapt\" method=\"post\" action=\"post\"><input type=\"hidden\" name=\""
+        "page\" value=\"savecfg\"><h3>Basic MQTT Configuration</h3><table><tr><td>MQTT Broker</td><td><input type=\"text\"", nullptr },
+    { WebPageOpType::ValueAttribute, 0, 0, preference_mqtt_broker, nullptr },
+    { WebPageOpType::Fragment, 0, 116, "\" name=\"MQTTSERVER\" size=\"25\" maxlength=\"100\"/></td></tr><tr><td>MQTT Broker port</td><td><input type=\"text\" va"
+        "lue=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_mqtt_broker_port, nullptr },
+    { WebPageOpType::Fragment, 0, 131, "\" name=\"MQTTPORT\" size=\"25\" maxlength=\"5\"/></td></tr><tr><td>MQTT User (# to clear) (Max. 30 characters)</td><td>"
+        "<input type=\"text\"", nullptr },
+    { WebPageOpType::ValueAttribute, 0, 0, preference_mqtt_user, nullptr },
+    { WebPageOpType::Fragment, 0, 243, "\" name=\"MQTTUSER\" size=\"25\" maxlength=\"30\"/></td></tr><tr><td>MQTT Password (Max. 40 characters)</td><td><input t"
+        "ype=\"password\" value=\"*\" name=\"MQTTPASS\" size=\"25\" maxlength=\"40\"/></td></tr><tr><td>MQTT Nuki Hub Path</td><t"
+        "d><input type=\"text\"", nullptr },
+    { WebPageOpType::ValueAttribute, 0, 0, preference_mqtt_lock_path, nullptr },
+    { WebPageOpType::Fragment, 0, 216, "\" name=\"MQTTPATH\" size=\"25\" maxlength=\"180\"/></td></tr><tr><td>Enable Home Assistant auto discovery</td><td><inpu"
+        "t type=hidden name=\"ENHADISC\" value=\"0\"/><input type=checkbox name=\"ENHADISC\" class=\"chkHass\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_mqtt_hass_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 174, "/></td></tr></table><br><h3>Advanced MQTT Configuration</h3><table><tr><td>Home Assistant discovery topic (usually \"hom"
+        "eassistant\")</td><td><input type=\"text\" class=\"chkHass\"", nullptr },
+    { WebPageOpType::ValueAttribute, 0, 0, preference_mqtt_hass_discovery, nullptr },
+    { WebPageOpType::Fragment, 0, 59, "\" name=\"HASSDISCOVERY\" size=\"25\" maxlength=\"30\"/></td></tr>", nullptr },
+    { WebPageOpType::IfBool, 17, false, preference_opener_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 193, "<tr><td>Set Nuki Opener Lock/Unlock action in Home Assistant to Continuous mode</td><td><input type=hidden name=\"OPENER"
+        "CONT\" value=\"0\"/><input type=checkbox name=\"OPENERCONT\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_opener_continuous_mode, nullptr },
+    { WebPageOpType::Fragment, 0, 12, "/></td></tr>", nullptr },
+    { WebPageOpType::Fragment, 0, 133, "<tr><td>Enable MQTT SSL</td><td><input type=hidden name=\"MQTTSENA\" value=\"0\"/><input type=checkbox name=\"MQTTSENA\""
+        " class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_mqtt_ssl_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 662, "/></td></tr><tr><td>Set MQTT SSL CA Certificate</td><td><button title=\"Set MQTT SSL CA Certificate\" onclick=\" window."
+        "open('/get?page=mqttcaconfig', '_self'); return false;\">Change</button></td></tr><tr><td>Set MQTT SSL Client Certificat"
+        "e</td><td><button title=\"Set MQTT Client Certificate\" onclick=\" window.open('/get?page=mqttcrtconfig', '_self'); retu"
+        "rn false;\">Change</button></td></tr><tr><td>Set MQTT SSL Client Key</td><td><button title=\"Set MQTT SSL Client Key\" o"
+        "nclick=\" window.open('/get?page=mqttkeyconfig', '_self'); return false;\">Change</button></td></tr><tr><td>MQTT Timeout"
+        " until restart (seconds; -1 to disable)</td><td><input type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_network_timeout, nullptr },
+    { WebPageOpType::Fragment, 0, 190, "\" name=\"NETTIMEOUT\" size=\"25\" maxlength=\"5\"/></td></tr><tr><td>Enable MQTT logging</td><td><input type=hidden nam"
+        "e=\"MQTTLOG\" value=\"0\"/><input type=checkbox name=\"MQTTLOG\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_mqtt_log_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 159, "/></td></tr><tr><td>Allow updating using MQTT</td><td><input type=hidden name=\"UPDATEMQTT\" value=\"0\"/><input type=ch"
+        "eckbox name=\"UPDATEMQTT\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_update_from_mqtt, nullptr },
+    { WebPageOpType::Fragment, 0, 173, "/></td></tr><tr><td>Disable some extraneous non-JSON topics</td><td><input type=hidden name=\"DISNONJSON\" value=\"0\"/>"
+        "<input type=checkbox name=\"DISNONJSON\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_disable_non_json, nullptr },
+    { WebPageOpType::Fragment, 0, 178, "/></td></tr><tr><td>Enable hybrid official MQTT and Nuki Hub setup</td><td><input type=hidden name=\"OFFHYBRID\" value=\""
+        "0\"/><input type=checkbox name=\"OFFHYBRID\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_official_hybrid_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 176, "/></td></tr><tr><td>Enable sending actions through official MQTT</td><td><input type=hidden name=\"HYBRIDACT\" value=\"0"
+        "\"/><input type=checkbox name=\"HYBRIDACT\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_official_hybrid_actions, nullptr },
+    { WebPageOpType::Fragment, 0, 122, "/></td></tr><tr><td>Time between status updates when official MQTT is offline (seconds)</td><td><input type=\"text\" val"
+        "ue=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_query_interval_hybrid_lockstate, nullptr },
+    { WebPageOpType::Fragment, 0, 237, "\" name=\"HYBRIDTIMER\" size=\"25\" maxlength=\"5\"/></td></tr><tr><td>Retry command sent using official MQTT over BLE i"
+        "f failed</td><td><input type=hidden name=\"HYBRIDRETRY\" value=\"0\"/><input type=checkbox name=\"HYBRIDRETRY\" class=\""
+        "\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_official_hybrid_retry, nullptr },
+    { WebPageOpType::Fragment, 0, 179, "/></td></tr><tr><td>Reboot Nuki lock on official MQTT failure</td><td><input type=hidden name=\"HYBRIDREBOOT\" value=\"0"
+        "\"/><input type=checkbox name=\"HYBRIDREBOOT\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_hybrid_reboot_on_disconnect, nullptr },
+    { WebPageOpType::Fragment, 0, 778, "/></td></tr></table><br><input type=\"submit\" name=\"submit\" value=\"Save\"></form></body><script>window.onload = func"
+        "tion() { var hassChk; var hassTxt; for (var el of document.getElementsByClassName('chkHass')) { if (el.constructor.name "
+        "=== 'HTMLInputElement' && el.type === 'checkbox') { hassChk = el; el.addEventListener('change', hassChkChange); } else i"
+        "f (el.constructor.name==='HTMLInputElement' && el.type==='text') { hassTxt=el; el.addEventListener('keyup', hassTxtChang"
+        "e); } } function hassChkChange() { if(hassChk.checked == true) { if(hassTxt.value.length == 0) { hassTxt.value = 'homeas"
+        "sistant'; } } else { hassTxt.value = ''; } } function hassTxtChange() { if(hassTxt.value.length == 0) { hassChk.checked "
+        "= false; } else { hassChk.checked = true; } } };</script></html>", nullptr },
+};
+const WebPageTemplate mqttconfig_page = { mqttconfig_page_ops, sizeof(mqttconfig_page_ops) / sizeof(WebPageOp) };
+
+const WebPageOp nukicfg_page_ops[] =
+{
+    { WebPageOpType::Fragment, 0, 427, "<html><head><meta name='viewport' content='width=device-width, initial-scale=1'><link rel='stylesheet' href='/style.css'"
+        "><title>Nuki Hub</title></head><body><form class=\"adapt\" method=\"post\" action=\"post\"><input type=\"hidden\" name=\""
+        "page\" value=\"savecfg\"><h3>Basic Nuki Configuration</h3><table><tr><td>Nuki Lock enabled</td><td><input type=hidden na"
+        "me=\"LOCKENA\" value=\"0\"/><input type=checkbox name=\"LOCKENA\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, true, preference_lock_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 171, "/></td></tr><tr><td>Nuki Smartlock Ultra/Go/5th gen enabled</td><td><input type=hidden name=\"GEMINIENA\" value=\"0\"/><"
+        "input type=checkbox name=\"GEMINIENA\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_lock_gemini_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 143, "/></td></tr><tr><td>Nuki Opener enabled</td><td><input type=hidden name=\"OPENA\" value=\"0\"/><input type=checkbox name"
+        "=\"OPENA\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_opener_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 145, "/></td></tr></table><br><h3>Advanced Nuki Configuration</h3><table><tr><td>Query interval lock state (seconds)</td><td><"
+        "input type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_query_interval_lockstate, nullptr },
+    { WebPageOpType::Fragment, 0, 133, "\" name=\"LSTINT\" size=\"25\" maxlength=\"10\"/></td></tr><tr><td>Query interval configuration (seconds)</td><td><input"
+        " type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_query_interval_configuration, nullptr },
+    { WebPageOpType::Fragment, 0, 127, "\" name=\"CFGINT\" size=\"25\" maxlength=\"10\"/></td></tr><tr><td>Query interval battery (seconds)</td><td><input type="
+        "\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_query_interval_battery, nullptr },
+    { WebPageOpType::Fragment, 0, 52, "\" name=\"BATINT\" size=\"25\" maxlength=\"10\"/></td></tr>", nullptr },
+    { WebPageOpType::IfCondition, 17, (int32_t)WebPageCondition::KeypadAvailable, nullptr, nullptr },
+    { WebPageOpType::Fragment, 0, 74, "<tr><td>Query interval keypad (seconds)</td><td><input type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_query_interval_keypad, nullptr },
+    { WebPageOpType::Fragment, 0, 51, "\" name=\"KPINT\" size=\"25\" maxlength=\"10\"/></td></tr>", nullptr },
+    { WebPageOpType::Fragment, 0, 78, "<tr><td>Number of retries if command failed</td><td><input type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_command_nr_of_retries, nullptr },
+    { WebPageOpType::Fragment, 0, 130, "\" name=\"NRTRY\" size=\"25\" maxlength=\"10\"/></td></tr><tr><td>Delay between retries (milliseconds)</td><td><input ty"
+        "pe=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_command_retry_delay, nullptr },
+    { WebPageOpType::Fragment, 0, 52, "\" name=\"TRYDLY\" size=\"25\" maxlength=\"10\"/></td></tr>", nullptr },
+    { WebPageOpType::IfBool, 27, true, preference_lock_enabled, nullptr },
+    { WebPageOpType::IfNotBool, 27, false, preference_lock_gemini_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 191, "<tr><td>Lock: Nuki Bridge is running alongside Nuki Hub (needs re-pairing if changed)</td><td><input type=hidden name=\""
+        "REGAPP\" value=\"0\"/><input type=checkbox name=\"REGAPP\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_register_as_app, nullptr },
+    { WebPageOpType::Fragment, 0, 12, "/></td></tr>", nullptr },
+    { WebPageOpType::IfBool, 31, false, preference_opener_enabled, nullptr },
+    { WebPageOpType::Fragment, 0, 199, "<tr><td>Opener: Nuki Bridge is running alongside Nuki Hub (needs re-pairing if changed)</td><td><input type=hidden name="
+        "\"REGAPPOPN\" value=\"0\"/><input type=checkbox name=\"REGAPPOPN\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, 0, preference_register_opener_as_app, nullptr },
+    { WebPageOpType::Fragment, 0, 12, "/></td></tr>", nullptr },
+    { WebPageOpType::Fragment, 0, 109, "<tr><td>Restart if bluetooth beacons not received (seconds; -1 to disable)</td><td><input type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_restart_ble_beacon_lost, nullptr },
+    { WebPageOpType::Fragment, 0, 50, "\" name=\"RSBC\" size=\"25\" maxlength=\"10\"/></td></tr>", nullptr },
+    { WebPageOpType::IfCondition, 39, (int32_t)WebPageCondition::TargetEsp32, nullptr, nullptr },
+    { WebPageOpType::Fragment, 0, 92, "<tr><td>BLE transmit power in dB (minimum -12, maximum 9)</td><td><input type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 0, preference_ble_tx_power, nullptr },
+    { WebPageOpType::Fragment, 0, 51, "\" name=\"TXPWR\" size=\"25\" maxlength=\"10\"/></td></tr>", nullptr },
+    { WebPageOpType::Jump, 42, 0, nullptr, nullptr },
+    { WebPageOpType::Fragment, 0, 93, "<tr><td>BLE transmit power in dB (minimum -12, maximum 20)</td><td><input type=\"text\" value=\"", nullptr },
+    { WebPageOpType::Int, 0, 9, preference_ble_tx_power, nullptr },
+    { WebPageOpType::Fragment, 0, 51, "\" name=\"TXPWR\" size=\"25\" maxlength=\"10\"/></td></tr>", nullptr },
+    { WebPageOpType::Fragment, 0, 160, "<tr><td>Update Nuki Hub and Lock/Opener time using NTP</td><td><input type=hidden name=\"UPTIME\" value=\"0\"/><input ty"
+        "pe=checkbox name=\"UPTIME\" class=\"\" value=\"1\"", nullptr },
+    { WebPageOpType::Checked, 0, false, preference_update_time, nullptr },
+    { WebPageOpType::Fragment, 0, 57, "/></td></tr><tr><td>NTP server</td><td><input type=\"text\"", nullptr },
+    { WebPageOpType::ValueAttribute, 0, 0, preference_time_server, "pool.ntp.org" },
+    { WebPageOpType::Fragment, 0, 135, "\" name=\"TIMESRV\" size=\"25\" maxlength=\"255\"/></td></tr></table><br><input type=\"submit\" name=\"submit\" value=\""
+        "Save\"></form></body></html>", nullptr },
+};
+const WebPageTemplate nukicfg_page = { nukicfg_page_ops, sizeof(nukicfg_page_ops) / sizeof(WebPageOp) };
@@ -10,9 +10,9 @@ def recursive_purge(dir, pattern):
             elif re.search(pattern, os.path.join(dir, f)):
                 os.remove(os.path.join(dir, f))
 
-os.system("python ../resources/bin2array/bin2array.py ../icon/favicon-32x32.png -O ../src/webServerConstants/favicon-32x32.h -l 16")  
-os.system("python ../resources/bin2array/bin2array.py ../resources/style.css -O ../src/webServerConstants/style.h -l 16")
-os.system("python ../resources/bin2array/bin2array.py ../resources/AsyncWebSerial/frontend/index.html -O ../src/webServerConstants/webSerial.h -l 16")
+os.system("python ../resources/compress_assets.py ../icon/favicon-32x32.png -O ../src/webServerConstants/favicon-32x32.h -N favicon_32x32")
+os.system("python ../resources/compress_assets.py ../resources/style.css -O ../src/webServerConstants/style.h -N stylecss")
+os.system("python ../resources/compress_assets.py ../resources/AsyncWebSerial/frontend/index.html -O ../src/webServerConstants/webSerial.h -N WEBSERIAL_HTML")
 
 if os.path.exists("src/Config.h"):
     with open("../src/Config.h", "rb") as file_a, open("src/Config.h", "rb") as file_b: